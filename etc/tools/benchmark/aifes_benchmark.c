@@ -0,0 +1,1467 @@
+/**
+ * \file aifes_benchmark.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Command line tool that benchmarks the math kernels of the library on the host
+ * \details Every kernel of the default implementation (and on Arm with AIFES_WITH_CMSIS the CMSIS implementation) is called
+ * directly with random data over a sweep of typical shapes. The time per call, the throughput and the moved bytes are printed
+ * as CSV or JSON. A previous CSV output can be given as baseline to detect performance regressions. For build instructions
+ * refer to the README.md.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "aifes.h"
+#if __arm__
+#ifdef AIFES_WITH_CMSIS
+#include "aifes_cmsis.h"
+#endif
+#endif
+
+// Console printing for the host
+static int print_string(const char *string){ return printf("%s", string); }
+static int print_int(const char *format, int var){ return printf(format, var); }
+static int print_uint(const char *format, unsigned int var){ return printf(format, var); }
+static int print_long_int(const char *format, long int var){ return printf(format, var); }
+static int print_float(const char *format, float var){ return printf(format, var); }
+
+int (*aiprint)(const char *string) = print_string;
+int (*aiprint_int)(const char *format, int var) = print_int;
+int (*aiprint_uint)(const char *format, unsigned int var) = print_uint;
+int (*aiprint_long_int)(const char *format, long int var) = print_long_int;
+int (*aiprint_float)(const char *format, float var) = print_float;
+
+#define MAX_TENSORS     16
+#define MAX_ALLOCS      24
+#define MAX_SHAPES      3
+
+#define Q7_SHIFT        4   // Quantization of the random data in [-1, 1]
+#define Q31_SHIFT       16
+
+#define SPARSE_DENSITY  10  // Every n-th weight of the sparse kernels is non-zero
+
+// Data types
+enum { DT_F32, DT_Q7, DT_Q31 };
+static const char *dtype_names[] = {"f32", "q7", "q31"};
+
+// Signatures of the kernels
+enum {
+    K_UNARY,            // fn(x, result)
+    K_UNARY_ALPHA,      // fn(x, alpha, result)
+    K_SCALAR_FN,        // result[i] = fn(x[i]) for scalar functions (float or int64_t)
+    K_SCALAR,           // fn(scalar, a, result)
+    K_BINARY,           // fn(a, b, result)
+    K_REDUCE,           // fn(x, &result)
+    K_LOSS,             // fn(predicted, target, &result)
+    K_CHANNELWISE,      // fn(x, axis, result)
+    K_VARIANCE,         // fn(x, axis, means, result)
+    K_LUT,              // fn(x, lut, result)
+    K_MATMUL,           // fn(a, b, result)
+    K_LINEAR,           // fn(a, b, c, result)
+    K_CONV2D_FWD,       // fn(input, stride, dilation, padding, weights, bias, axis, work_space, output)
+    K_CONV2D_BWD,       // fn(x_in / delta_out, stride, dilation, padding, delta_out / weights, axis, work_space, d_weights / delta_in)
+    K_CONV_TRANSPOSE2D, // fn(input, stride, dilation, padding, output_padding, weights, bias, axis, work_space, output)
+    K_MAXPOOL2D_FWD,    // fn(input, pool_size, stride, padding, axis, work_space, max_locations, output)
+    K_MAXPOOL2D_BWD,    // fn(delta_out, pool_size, stride, padding, axis, work_space, max_locations, delta_in)
+    K_AVGPOOL2D,        // fn(input / delta_out, pool_size, stride, padding, axis, work_space, output / delta_in)
+    K_GLOBAL_AVGPOOL2D, // fn(input, axis, work_space, output) / fn(delta_out, axis, delta_in)
+    K_CONV1D_FWD,
+    K_CONV1D_BWD,
+    K_MAXPOOL1D_FWD,
+    K_MAXPOOL1D_BWD,
+    K_AVGPOOL1D,
+    K_BATCH_NORM,
+    K_BATCH_NORM_TRAIN,
+    K_D_BATCH_NORM,
+    K_LSTM_FWD,         // fn(x_in, weights, bias, return_sequences, work_space, hidden_state, cell_state, caches..., result)
+    K_LSTM_BWD,         // fn(x_in, weights, delta_out, return_sequences, caches..., work_space, d_weights, d_bias, delta_in)
+    K_GRU_FWD,          // fn(x_in, weights, bias, return_sequences, work_space, hidden_state, caches..., result)
+    K_GRU_BWD           // fn(x_in, weights, delta_out, return_sequences, caches..., work_space, d_weights, d_bias, delta_in)
+};
+
+// Flags for the tensor setup
+#define F_AT        0x0001  // Matrix a transposed
+#define F_BT        0x0002  // Matrix b transposed
+#define F_RT        0x0004  // Result transposed
+#define F_PALETTE   0x0008  // Matrix b palettized (4 bit indices)
+#define F_SPARSE    0x0010  // Matrix b sparse (CSR)
+#define F_FUSED     0x0020  // Matrix a raw F32 data (fused input quantization)
+#define F_POSITIVE  0x0040  // Positive input data (e.g. for sqrt or as divisor)
+#define F_PROB      0x0080  // Input data in (0, 1) (for the crossentropy)
+#define F_SPARSE8   0x0100  // Target / b as U8 class indices
+#define F_HWC       0x0200  // Channels last layout
+#define F_DEPTHWISE 0x0400  // Depthwise convolution
+#define F_POINTWISE 0x0800  // Pointwise (1x1) convolution
+#define F_BWD       0x1000  // Input gradient (delta_out -> delta_in)
+#define F_WGRAD     0x2000  // Weight gradient (x_in, delta_out -> d_weights)
+#define F_BLOCK_1X4 0x4000  // Sparse matrix b in 1x4 blocks (with F_SPARSE)
+#define F_BLOCK_4X1 0x8000  // Sparse matrix b in 4x1 blocks (with F_SPARSE)
+
+typedef void (*bench_fn_t)(void);
+
+typedef struct bench_kernel {
+    const char *name;
+    const char *backend;
+    uint8_t dtype;
+    uint8_t kind;
+    uint16_t flags;
+    bench_fn_t fn;
+    bench_fn_t aux; // Forward pass that calculates the max locations for the max-pooling backward kernels
+} bench_kernel_t;
+
+#define BENCH(backend, dtype, kind, flags, fn)          {#fn, backend, dtype, kind, flags, (bench_fn_t) fn, 0}
+#define BENCH_AUX(backend, dtype, kind, flags, fn, aux) {#fn, backend, dtype, kind, flags, (bench_fn_t) fn, (bench_fn_t) aux}
+
+static const bench_kernel_t kernels[] = {
+    // ---------------------------- F32 default ----------------------------
+    BENCH("default", DT_F32, K_LINEAR, 0, aimath_f32_default_linear),
+    BENCH("default", DT_F32, K_LINEAR, 0, aimath_f32_default_linear_rowwise),
+    BENCH("default", DT_F32, K_LINEAR, F_AT, aimath_f32_default_linear_at),
+    BENCH("default", DT_F32, K_LINEAR, F_BT, aimath_f32_default_linear_bt),
+    BENCH("default", DT_F32, K_LINEAR, F_BT | F_PALETTE, aimath_f32_default_linear_palettized_bt),
+    BENCH("default", DT_F32, K_LINEAR, F_BT | F_SPARSE, aimath_f32_default_linear_sparse_bt),
+    BENCH("default", DT_F32, K_LINEAR, F_BT | F_SPARSE | F_BLOCK_1X4, aimath_f32_default_linear_sparse_bt),
+    BENCH("default", DT_F32, K_LINEAR, F_BT | F_SPARSE | F_BLOCK_4X1, aimath_f32_default_linear_sparse_bt),
+    BENCH("default", DT_F32, K_LINEAR, F_AT | F_RT, aimath_f32_default_linear_atrt),
+    BENCH("default", DT_F32, K_MATMUL, 0, aimath_f32_default_mat_mul),
+    BENCH("default", DT_F32, K_MATMUL, F_AT, aimath_f32_default_mat_mul_at),
+    BENCH("default", DT_F32, K_MATMUL, F_BT, aimath_f32_default_mat_mul_bt),
+    BENCH("default", DT_F32, K_MATMUL, F_AT | F_RT, aimath_f32_default_mat_mul_atrt),
+    BENCH("default", DT_F32, K_BINARY, 0, aimath_f32_default_multiply),
+    BENCH("default", DT_F32, K_BINARY, F_POSITIVE, aimath_f32_default_divide),
+    BENCH("default", DT_F32, K_SCALAR, 0, aimath_f32_default_scalar_mul),
+    BENCH("default", DT_F32, K_SCALAR, 0, aimath_f32_default_scalar_add),
+    BENCH("default", DT_F32, K_BINARY, 0, aimath_f32_default_tensor_add),
+    BENCH("default", DT_F32, K_BINARY, 0, aimath_f32_default_tensor_sub),
+    BENCH("default", DT_F32, K_BINARY, F_SPARSE8, aimath_f32_default_tensor_sub_sparse8),
+    BENCH("default", DT_F32, K_REDUCE, 0, aimath_f32_default_norm_squared),
+    BENCH("default", DT_F32, K_REDUCE, 0, aimath_f32_default_sum),
+    BENCH("default", DT_F32, K_REDUCE, 0, aimath_f32_default_min),
+    BENCH("default", DT_F32, K_REDUCE, 0, aimath_f32_default_max),
+    BENCH("default", DT_F32, K_UNARY, 0, aimath_f32_default_sigmoid),
+    BENCH("default", DT_F32, K_UNARY, F_PROB, aimath_f32_default_d_sigmoid),
+    BENCH("default", DT_F32, K_UNARY, 0, aimath_f32_default_tanh),
+    BENCH("default", DT_F32, K_UNARY, 0, aimath_f32_default_d_tanh),
+    BENCH("default", DT_F32, K_UNARY, 0, aimath_f32_default_relu),
+    BENCH("default", DT_F32, K_UNARY, 0, aimath_f32_default_d_relu),
+    BENCH("default", DT_F32, K_UNARY_ALPHA, 0, aimath_f32_default_leaky_relu),
+    BENCH("default", DT_F32, K_UNARY_ALPHA, 0, aimath_f32_default_d_leaky_relu),
+    BENCH("default", DT_F32, K_UNARY_ALPHA, 0, aimath_f32_default_elu),
+    BENCH("default", DT_F32, K_UNARY_ALPHA, 0, aimath_f32_default_d_elu),
+    BENCH("default", DT_F32, K_UNARY, 0, aimath_f32_default_softmax),
+    BENCH("default", DT_F32, K_UNARY, 0, aimath_f32_default_softsign),
+    BENCH("default", DT_F32, K_UNARY, 0, aimath_f32_default_d_softsign),
+    BENCH("default", DT_F32, K_LOSS, F_PROB, aimath_f32_default_binary_crossentropy_sum),
+    BENCH("default", DT_F32, K_LOSS, F_PROB, aimath_f32_default_binary_crossentropy_mean),
+    BENCH("default", DT_F32, K_LOSS, F_PROB, aimath_f32_default_categorical_crossentropy_sum),
+    BENCH("default", DT_F32, K_LOSS, F_PROB, aimath_f32_default_categorical_crossentropy_mean),
+    BENCH("default", DT_F32, K_LOSS, F_PROB | F_SPARSE8, aimath_f32_default_categorical_crossentropy_sum_sparse8),
+    BENCH("default", DT_F32, K_LOSS, F_PROB | F_SPARSE8, aimath_f32_default_categorical_crossentropy_mean_sparse8),
+    BENCH("default", DT_F32, K_UNARY, F_POSITIVE, aimath_f32_default_sqrt),
+    BENCH("default", DT_F32, K_SCALAR_FN, 0, aimath_f32_default_expf_fast),
+    BENCH("default", DT_F32, K_SCALAR_FN, 0, aimath_f32_default_expf_poly),
+    BENCH("default", DT_F32, K_SCALAR_FN, 0, aimath_f32_default_expf_poly_fast),
+    BENCH("default", DT_F32, K_SCALAR_FN, F_POSITIVE, aimath_f32_default_logf_poly),
+    BENCH("default", DT_F32, K_UNARY, 0, aimath_f32_default_sigmoid_poly),
+    BENCH("default", DT_F32, K_UNARY, 0, aimath_f32_default_sigmoid_poly_fast),
+    BENCH("default", DT_F32, K_UNARY, 0, aimath_f32_default_tanh_poly),
+    BENCH("default", DT_F32, K_UNARY, 0, aimath_f32_default_tanh_poly_fast),
+    BENCH("default", DT_F32, K_UNARY_ALPHA, 0, aimath_f32_default_elu_poly),
+    BENCH("default", DT_F32, K_UNARY_ALPHA, 0, aimath_f32_default_elu_poly_fast),
+    BENCH("default", DT_F32, K_UNARY_ALPHA, 0, aimath_f32_default_d_elu_poly),
+    BENCH("default", DT_F32, K_UNARY_ALPHA, 0, aimath_f32_default_d_elu_poly_fast),
+    BENCH("default", DT_F32, K_UNARY, 0, aimath_f32_default_softmax_poly),
+    BENCH("default", DT_F32, K_UNARY, 0, aimath_f32_default_softmax_poly_fast),
+    BENCH("default", DT_F32, K_LOSS, F_PROB, aimath_f32_default_binary_crossentropy_sum_poly),
+    BENCH("default", DT_F32, K_LOSS, F_PROB, aimath_f32_default_binary_crossentropy_mean_poly),
+    BENCH("default", DT_F32, K_LOSS, F_PROB, aimath_f32_default_categorical_crossentropy_sum_poly),
+    BENCH("default", DT_F32, K_LOSS, F_PROB, aimath_f32_default_categorical_crossentropy_mean_poly),
+    BENCH("default", DT_F32, K_LOSS, F_PROB | F_SPARSE8, aimath_f32_default_categorical_crossentropy_sum_sparse8_poly),
+    BENCH("default", DT_F32, K_LOSS, F_PROB | F_SPARSE8, aimath_f32_default_categorical_crossentropy_mean_sparse8_poly),
+    BENCH("default", DT_F32, K_CHANNELWISE, 0, aimath_f32_default_sum_channelwise),
+    BENCH("default", DT_F32, K_CHANNELWISE, 0, aimath_f32_default_mean_channelwise),
+    BENCH("default", DT_F32, K_VARIANCE, 0, aimath_f32_default_variance_channelwise),
+    BENCH("default", DT_F32, K_UNARY_ALPHA, 0, aimath_f32_default_exponential_moving_average),
+    BENCH("default", DT_F32, K_BINARY, 0, aimath_f32_default_mse_gradients_sum),
+    BENCH("default", DT_F32, K_BINARY, 0, aimath_f32_default_mse_gradients_mean),
+    BENCH("default", DT_F32, K_LOSS, 0, aimath_f32_default_mse_loss_sum),
+    BENCH("default", DT_F32, K_LOSS, 0, aimath_f32_default_mse_loss_mean),
+    BENCH("default", DT_F32, K_UNARY, 0, aimath_f32_default_scale_by_batch_size),
+
+    // ---------------------------- Q7 default ----------------------------
+    BENCH("default", DT_Q7, K_LINEAR, 0, aimath_q7_default_linear32),
+    BENCH("default", DT_Q7, K_LINEAR, F_BT, aimath_q7_default_linear32_bt),
+    BENCH("default", DT_Q7, K_LINEAR, F_BT | F_SPARSE, aimath_q7_default_linear32_sparse_bt),
+    BENCH("default", DT_Q7, K_LINEAR, F_BT | F_SPARSE | F_BLOCK_1X4, aimath_q7_default_linear32_sparse_bt),
+    BENCH("default", DT_Q7, K_LINEAR, F_BT | F_SPARSE | F_BLOCK_4X1, aimath_q7_default_linear32_sparse_bt),
+    BENCH("default", DT_Q7, K_LINEAR, F_FUSED, aimath_q7_default_linear32_fused_input),
+    BENCH("default", DT_Q7, K_LINEAR, F_BT | F_FUSED, aimath_q7_default_linear32_bt_fused_input),
+    BENCH("default", DT_Q7, K_MATMUL, 0, aimath_q7_default_mat_mul),
+    BENCH("default", DT_Q7, K_BINARY, 0, aimath_q7_default_multiply),
+    BENCH("default", DT_Q7, K_SCALAR, 0, aimath_q7_default_scalar_mul),
+    BENCH("default", DT_Q7, K_BINARY, 0, aimath_q7_default_tensor_add_different_shift),
+    BENCH("default", DT_Q7, K_BINARY, 0, aimath_q7_default_tensor_add_same_shift),
+    BENCH("default", DT_Q7, K_BINARY, 0, aimath_q7_default_tensor_sub_different_shift),
+    BENCH("default", DT_Q7, K_BINARY, 0, aimath_q7_default_tensor_sub_same_shift),
+    BENCH("default", DT_Q7, K_UNARY, 0, aimath_q7_default_sigmoid),
+    BENCH("default", DT_Q7, K_UNARY, 0, aimath_q7_default_relu),
+    BENCH("default", DT_Q7, K_UNARY, 0, aimath_q7_default_d_relu),
+    BENCH("default", DT_Q7, K_UNARY_ALPHA, 0, aimath_q7_default_leaky_relu),
+    BENCH("default", DT_Q7, K_UNARY_ALPHA, 0, aimath_q7_default_elu),
+    BENCH("default", DT_Q7, K_UNARY, 0, aimath_q7_default_tanh),
+    BENCH("default", DT_Q7, K_UNARY, 0, aimath_q7_default_softsign),
+    BENCH("default", DT_Q7, K_LUT, 0, aimath_q7_default_lut),
+    BENCH("default", DT_Q7, K_UNARY, 0, aimath_q7_default_softmax),
+
+    // ---------------------------- Q31 default ----------------------------
+    BENCH("default", DT_Q31, K_LINEAR, 0, aimath_q31_default_linear32),
+    BENCH("default", DT_Q31, K_MATMUL, 0, aimath_q31_default_mat_mul),
+    BENCH("default", DT_Q31, K_BINARY, 0, aimath_q31_default_multiply),
+    BENCH("default", DT_Q31, K_SCALAR, 0, aimath_q31_default_scalar_mul),
+    BENCH("default", DT_Q31, K_BINARY, 0, aimath_q31_default_tensor_add_different_shift),
+    BENCH("default", DT_Q31, K_BINARY, 0, aimath_q31_default_tensor_add_same_shift),
+    BENCH("default", DT_Q31, K_BINARY, 0, aimath_q31_default_tensor_sub_different_shift),
+    BENCH("default", DT_Q31, K_BINARY, 0, aimath_q31_default_tensor_sub_same_shift),
+    BENCH("default", DT_Q31, K_REDUCE, 0, aimath_q31_default_norm_squared),
+    BENCH("default", DT_Q31, K_UNARY, F_POSITIVE, aimath_q31_default_tensor_sqrt),
+    BENCH("default", DT_Q31, K_SCALAR_FN, F_POSITIVE, aimath_q31_default_sqrt),
+    BENCH("default", DT_Q31, K_UNARY, 0, aimath_q31_default_sigmoid),
+    BENCH("default", DT_Q31, K_UNARY, F_PROB, aimath_q31_default_d_sigmoid),
+    BENCH("default", DT_Q31, K_UNARY, 0, aimath_q31_default_relu),
+    BENCH("default", DT_Q31, K_UNARY, 0, aimath_q31_default_d_relu),
+    BENCH("default", DT_Q31, K_UNARY_ALPHA, 0, aimath_q31_default_leaky_relu),
+    BENCH("default", DT_Q31, K_UNARY_ALPHA, 0, aimath_q31_default_d_leaky_relu),
+    BENCH("default", DT_Q31, K_UNARY, 0, aimath_q31_default_tanh),
+    BENCH("default", DT_Q31, K_UNARY, 0, aimath_q31_default_d_tanh),
+    BENCH("default", DT_Q31, K_UNARY, 0, aimath_q31_default_softsign),
+    BENCH("default", DT_Q31, K_UNARY, 0, aimath_q31_default_d_softsign),
+    BENCH("default", DT_Q31, K_UNARY, 0, aimath_q31_default_softmax),
+    BENCH("default", DT_Q31, K_UNARY_ALPHA, 0, aimath_q31_default_elu),
+    BENCH("default", DT_Q31, K_UNARY_ALPHA, 0, aimath_q31_default_d_elu),
+    BENCH("default", DT_Q31, K_CHANNELWISE, 0, aimath_q31_default_sum_channelwise),
+    BENCH("default", DT_Q31, K_BINARY, 0, aimath_q31_default_mse_gradients_sum),
+    BENCH("default", DT_Q31, K_BINARY, 0, aimath_q31_default_mse_gradients_mean),
+    BENCH("default", DT_Q31, K_LOSS, 0, aimath_q31_default_mse_loss_sum),
+    BENCH("default", DT_Q31, K_LOSS, 0, aimath_q31_default_mse_loss_mean),
+
+    // ---------------------------- CNN F32 default ----------------------------
+    BENCH("default", DT_F32, K_CONV2D_FWD, 0, aimath_f32_default_conv2d_fwd),
+    BENCH("default", DT_F32, K_CONV2D_BWD, F_WGRAD, aimath_f32_default_conv2d_bwd),
+    BENCH("default", DT_F32, K_CONV2D_BWD, F_BWD, aimath_f32_default_conv2d_bwd_full),
+    BENCH("default", DT_F32, K_CONV2D_FWD, F_HWC, aimath_f32_default_conv2d_fwd_hwc),
+    BENCH("default", DT_F32, K_CONV2D_BWD, F_HWC | F_WGRAD, aimath_f32_default_conv2d_bwd_hwc),
+    BENCH("default", DT_F32, K_CONV2D_BWD, F_HWC | F_BWD, aimath_f32_default_conv2d_bwd_full_hwc),
+    BENCH("default", DT_F32, K_CONV2D_FWD, F_HWC | F_DEPTHWISE, aimath_f32_default_depthwise_conv2d_fwd),
+    BENCH("default", DT_F32, K_CONV2D_BWD, F_HWC | F_DEPTHWISE | F_WGRAD, aimath_f32_default_depthwise_conv2d_bwd),
+    BENCH("default", DT_F32, K_CONV2D_BWD, F_HWC | F_DEPTHWISE | F_BWD, aimath_f32_default_depthwise_conv2d_bwd_full),
+    BENCH("default", DT_F32, K_CONV2D_FWD, F_HWC | F_POINTWISE, aimath_f32_default_pointwise_conv2d_fwd),
+    BENCH("default", DT_F32, K_CONV_TRANSPOSE2D, F_HWC, aimath_f32_default_conv_transpose2d_fwd),
+    BENCH("default", DT_F32, K_MAXPOOL2D_FWD, 0, aimath_f32_default_maxpool2d_fwd),
+    BENCH_AUX("default", DT_F32, K_MAXPOOL2D_BWD, F_BWD, aimath_f32_default_maxpool2d_bwd, aimath_f32_default_maxpool2d_fwd),
+    BENCH("default", DT_F32, K_MAXPOOL2D_FWD, F_HWC, aimath_f32_default_maxpool2d_fwd_hwc),
+    BENCH_AUX("default", DT_F32, K_MAXPOOL2D_BWD, F_HWC | F_BWD, aimath_f32_default_maxpool2d_bwd_hwc, aimath_f32_default_maxpool2d_fwd_hwc),
+    BENCH("default", DT_F32, K_MAXPOOL2D_FWD, F_HWC, aimath_f32_default_maxpool2d_2x2_fwd),
+    BENCH_AUX("default", DT_F32, K_MAXPOOL2D_BWD, F_HWC | F_BWD, aimath_f32_default_maxpool2d_2x2_bwd, aimath_f32_default_maxpool2d_2x2_fwd),
+    BENCH("default", DT_F32, K_MAXPOOL2D_FWD, F_HWC, aimath_f32_default_maxpool2d_2x2_relu_fwd),
+    BENCH_AUX("default", DT_F32, K_MAXPOOL2D_BWD, F_HWC | F_BWD, aimath_f32_default_maxpool2d_2x2_relu_bwd, aimath_f32_default_maxpool2d_2x2_relu_fwd),
+    BENCH("default", DT_F32, K_AVGPOOL2D, F_HWC, aimath_f32_default_avgpool2d_fwd),
+    BENCH("default", DT_F32, K_AVGPOOL2D, F_HWC | F_BWD, aimath_f32_default_avgpool2d_bwd),
+    BENCH("default", DT_F32, K_GLOBAL_AVGPOOL2D, F_HWC, aimath_f32_default_global_avgpool2d_fwd),
+    BENCH("default", DT_F32, K_GLOBAL_AVGPOOL2D, F_HWC | F_BWD, aimath_f32_default_global_avgpool2d_bwd),
+    BENCH("default", DT_F32, K_CONV1D_FWD, F_HWC, aimath_f32_default_conv1d_fwd),
+    BENCH("default", DT_F32, K_CONV1D_BWD, F_HWC | F_WGRAD, aimath_f32_default_conv1d_bwd),
+    BENCH("default", DT_F32, K_CONV1D_BWD, F_HWC | F_BWD, aimath_f32_default_conv1d_bwd_full),
+    BENCH("default", DT_F32, K_MAXPOOL1D_FWD, F_HWC, aimath_f32_default_maxpool1d_fwd),
+    BENCH_AUX("default", DT_F32, K_MAXPOOL1D_BWD, F_HWC | F_BWD, aimath_f32_default_maxpool1d_bwd, aimath_f32_default_maxpool1d_fwd),
+    BENCH("default", DT_F32, K_AVGPOOL1D, F_HWC, aimath_f32_default_avgpool1d_fwd),
+    BENCH("default", DT_F32, K_AVGPOOL1D, F_HWC | F_BWD, aimath_f32_default_avgpool1d_bwd),
+    BENCH("default", DT_F32, K_BATCH_NORM, F_HWC, aimath_f32_default_batch_norm),
+    BENCH("default", DT_F32, K_BATCH_NORM_TRAIN, F_HWC, aimath_f32_default_batch_norm_train),
+    BENCH("default", DT_F32, K_D_BATCH_NORM, F_HWC, aimath_f32_default_d_batch_norm),
+
+    // ---------------------------- CNN Q7 default ----------------------------
+    BENCH("default", DT_Q7, K_AVGPOOL2D, F_HWC, aimath_q7_default_avgpool2d_fwd),
+    BENCH("default", DT_Q7, K_GLOBAL_AVGPOOL2D, F_HWC, aimath_q7_default_global_avgpool2d_fwd),
+    BENCH("default", DT_Q7, K_CONV1D_FWD, F_HWC, aimath_q7_default_conv1d_fwd),
+    BENCH("default", DT_Q7, K_CONV1D_FWD, F_HWC | F_FUSED, aimath_q7_default_conv1d_fused_input_fwd),
+    BENCH("default", DT_Q7, K_MAXPOOL1D_FWD, F_HWC, aimath_q7_default_maxpool1d_fwd),
+    BENCH("default", DT_Q7, K_AVGPOOL1D, F_HWC, aimath_q7_default_avgpool1d_fwd),
+
+    // ---------------------------- RNN F32 default ----------------------------
+    BENCH("default", DT_F32, K_LSTM_FWD, 0, aimath_f32_default_lstm_fwd),
+    BENCH_AUX("default", DT_F32, K_LSTM_BWD, F_BWD, aimath_f32_default_lstm_bwd, aimath_f32_default_lstm_fwd),
+    BENCH("default", DT_F32, K_GRU_FWD, 0, aimath_f32_default_gru_fwd),
+    BENCH_AUX("default", DT_F32, K_GRU_BWD, F_BWD, aimath_f32_default_gru_bwd, aimath_f32_default_gru_fwd),
+
+    // ---------------------------- RNN Q7 default ----------------------------
+    BENCH("default", DT_Q7, K_LSTM_FWD, 0, aimath_q7_default_lstm_fwd),
+    BENCH("default", DT_Q7, K_GRU_FWD, 0, aimath_q7_default_gru_fwd),
+
+#if __arm__
+#ifdef AIFES_WITH_CMSIS
+    // ---------------------------- CMSIS ----------------------------
+    BENCH("cmsis", DT_F32, K_LINEAR, 0, aimath_f32_cmsis_linear),
+    BENCH("cmsis", DT_F32, K_MATMUL, 0, aimath_f32_cmsis_mat_mul),
+    BENCH("cmsis", DT_Q7, K_LINEAR, F_BT, aimath_q7_cmsis_linear32_bt),
+#endif
+#endif
+};
+
+#define KERNEL_COUNT (sizeof(kernels) / sizeof(kernels[0]))
+
+// Shape sweeps
+static const uint16_t elementwise_shapes[MAX_SHAPES][2] = {{1, 256}, {16, 1024}, {64, 4096}}; // rows, cols
+static const uint16_t matrix_shapes[MAX_SHAPES][3] = {{1, 128, 64}, {16, 256, 128}, {64, 512, 256}}; // N, K, M
+static const uint16_t conv2d_shapes[MAX_SHAPES][6] = {{1, 32, 32, 3, 16, 3}, {1, 16, 16, 32, 32, 3}, {4, 8, 8, 64, 64, 3}}; // N, H, W, C_in, C_out, kernel
+static const uint16_t conv1d_shapes[MAX_SHAPES][5] = {{1, 128, 8, 16, 5}, {1, 64, 32, 32, 3}, {4, 32, 64, 64, 3}}; // N, L, C_in, C_out, kernel
+static const uint16_t rnn_shapes[MAX_SHAPES][4] = {{1, 16, 8, 16}, {1, 32, 32, 64}, {4, 64, 64, 128}}; // N, T, I, H
+
+// Fill modes of the tensors
+enum { FILL_ZERO, FILL_SIGNED, FILL_POSITIVE, FILL_PROB, FILL_CLASS };
+
+typedef union bench_scalar {
+    float f32;
+    aiscalar_q7_t q7;
+    aiscalar_q31_t q31;
+} bench_scalar_t;
+
+typedef union bench_params {
+    aimath_q7_params_t q7;
+    aimath_q31_params_t q31;
+    aimath_q7_source_params_t source;
+    aimath_palette_params_t palette;
+    aimath_sparse_params_t sparse;
+} bench_params_t;
+
+/** @brief Prepared arguments of one kernel call */
+typedef struct bench_case {
+    const bench_kernel_t *kernel;
+    char shape[64];
+    uint64_t ops; // Multiply-accumulate operations or processed elements
+    const char *op_unit;
+    uint64_t bytes; // Bytes of all operands (every operand read or written once)
+
+    aitensor_t tensors[MAX_TENSORS];
+    uint16_t shapes[MAX_TENSORS][4];
+    bench_params_t params[MAX_TENSORS];
+    uint8_t tensor_count;
+    void *allocs[MAX_ALLOCS];
+    uint8_t alloc_count;
+
+    bench_scalar_t alpha, eps;
+    union { int64_t i; double d; uint8_t bytes[64]; } scalar_result;
+    aimath_q7_lut_t lut;
+    uint16_t classes;
+
+    int8_t axis;
+    uint16_t stride[2], dilation[2], padding[2], output_padding[2], pool_size[2];
+    uint32_t *max_locations;
+    void *work_space;
+} bench_case_t;
+
+/** @brief Timing results of one benchmark */
+typedef struct bench_result {
+    const bench_kernel_t *kernel;
+    char shape[64];
+    uint64_t calls;
+    double median, mean, stddev; // ns per call
+    uint64_t ops;
+    const char *op_unit;
+    uint64_t bytes;
+} bench_result_t;
+
+static uint32_t random_state = 0x12345678;
+
+static uint32_t random_u32(void)
+{
+    // xorshift32
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+static float random_float(float from, float to)
+{
+    return from + (to - from) * (float) (random_u32() >> 8) / 16777216.0f;
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ull + (uint64_t) ts.tv_nsec;
+}
+
+static void *bench_alloc(bench_case_t *bc, uint32_t size)
+{
+    void *ptr;
+
+    if(bc->alloc_count >= MAX_ALLOCS){
+        return 0;
+    }
+    ptr = calloc(1, size > 0 ? size : 1);
+    bc->allocs[bc->alloc_count++] = ptr;
+    bc->bytes += size;
+    return ptr;
+}
+
+static void bench_free(bench_case_t *bc)
+{
+    uint8_t i;
+
+    for(i = 0; i < bc->alloc_count; i++){
+        free(bc->allocs[i]);
+    }
+    bc->alloc_count = 0;
+}
+
+static const aimath_dtype_t *bench_dtype(uint8_t dtype)
+{
+    switch(dtype){
+    case DT_Q7: return aiq7;
+    case DT_Q31: return aiq31;
+    default: return aif32;
+    }
+}
+
+static void fill_tensor(bench_case_t *bc, aitensor_t *t, uint8_t fill)
+{
+    uint32_t i, elements = aimath_tensor_elements(t);
+    float value;
+
+    for(i = 0; i < elements; i++){
+        switch(fill){
+        case FILL_SIGNED: value = random_float(-1.0f, 1.0f); break;
+        case FILL_POSITIVE: value = random_float(0.5f, 1.5f); break;
+        case FILL_PROB: value = random_float(0.01f, 0.99f); break;
+        case FILL_CLASS: ((uint8_t *) t->data)[i] = random_u32() % bc->classes; continue;
+        default: continue;
+        }
+        if(t->dtype == aiq7){
+            ((int8_t *) t->data)[i] = (int8_t) lroundf(value * (float) (1 << Q7_SHIFT));
+        } else if(t->dtype == aiq31){
+            ((int32_t *) t->data)[i] = (int32_t) lroundf(value * (float) (1 << Q31_SHIFT));
+        } else {
+            ((float *) t->data)[i] = value;
+        }
+    }
+}
+
+/** @brief Creates a tensor with 1 to 4 dimensions (unused dimensions 0) and random data */
+static aitensor_t *bench_tensor(bench_case_t *bc, const aimath_dtype_t *dtype, uint8_t fill,
+                                uint16_t d0, uint16_t d1, uint16_t d2, uint16_t d3)
+{
+    aitensor_t *t = &bc->tensors[bc->tensor_count];
+    uint16_t *shape = bc->shapes[bc->tensor_count];
+    bench_params_t *params = &bc->params[bc->tensor_count];
+
+    bc->tensor_count++;
+    shape[0] = d0; shape[1] = d1; shape[2] = d2; shape[3] = d3;
+    t->dtype = dtype;
+    t->dim = d3 ? 4 : (d2 ? 3 : (d1 ? 2 : 1));
+    t->shape = shape;
+    t->tensor_params = 0;
+    if(dtype == aiq7){
+        params->q7.shift = Q7_SHIFT;
+        params->q7.zero_point = 0;
+        t->tensor_params = &params->q7;
+    } else if(dtype == aiq31){
+        params->q31.shift = Q31_SHIFT;
+        params->q31.zero_point = 0;
+        t->tensor_params = &params->q31;
+    }
+    t->data = bench_alloc(bc, aimath_tensor_elements(t) * dtype->size);
+    if(t->data != 0){
+        fill_tensor(bc, t, fill);
+    }
+    return t;
+}
+
+static void set_shift(aitensor_t *t, uint16_t shift)
+{
+    if(t->dtype == aiq7){
+        ((aimath_q7_params_t *) t->tensor_params)->shift = shift;
+    } else if(t->dtype == aiq31){
+        ((aimath_q31_params_t *) t->tensor_params)->shift = shift;
+    }
+}
+
+static void set_alpha(bench_case_t *bc, uint8_t dtype, float value)
+{
+    if(dtype == DT_Q7){
+        bc->alpha.q7.value = (int8_t) lroundf(value * 128.0f);
+        bc->alpha.q7.shift = 7;
+        bc->alpha.q7.zero_point = 0;
+    } else if(dtype == DT_Q31){
+        bc->alpha.q31.value = (int32_t) lroundf(value * (float) (1 << Q31_SHIFT));
+        bc->alpha.q31.shift = Q31_SHIFT;
+        bc->alpha.q31.zero_point = 0;
+    } else {
+        bc->alpha.f32 = value;
+    }
+}
+
+/** @brief Marks a F32 tensor as raw input of the fused input quantization kernels */
+static void set_source_params(bench_case_t *bc, aitensor_t *t)
+{
+    bench_params_t *params = &bc->params[t - bc->tensors];
+
+    params->source.q_params.shift = Q7_SHIFT;
+    params->source.q_params.zero_point = 0;
+    params->source.format = AIMATH_Q7_SOURCE_F32;
+    params->source.source_shift = 0;
+    params->source.source_zero_point = 0;
+    t->tensor_params = &params->source;
+}
+
+static float lut_sigmoid(float x, const void *args)
+{
+    return 1.0f / (1.0f + expf(-x));
+}
+
+static int setup_elementwise(bench_case_t *bc, uint8_t s)
+{
+    const bench_kernel_t *k = bc->kernel;
+    const aimath_dtype_t *dtype = bench_dtype(k->dtype);
+    uint16_t rows = elementwise_shapes[s][0], cols = elementwise_shapes[s][1];
+    uint8_t fill = (k->flags & F_PROB) ? FILL_PROB : ((k->flags & F_POSITIVE) ? FILL_POSITIVE : FILL_SIGNED);
+    uint32_t i;
+    aitensor_t *x;
+
+    snprintf(bc->shape, sizeof(bc->shape), "%ux%u", rows, cols);
+    bc->ops = (uint64_t) rows * cols;
+    bc->op_unit = "element";
+    bc->classes = cols;
+    bc->axis = -1;
+    set_alpha(bc, k->dtype, k->kind == K_SCALAR ? 1.5f : 0.1f);
+
+    switch(k->kind){
+    case K_UNARY:
+    case K_UNARY_ALPHA:
+    case K_SCALAR:
+    case K_SCALAR_FN:
+    case K_LUT:
+        x = bench_tensor(bc, dtype, fill, rows, cols, 0, 0);
+        bench_tensor(bc, dtype, FILL_ZERO, rows, cols, 0, 0);
+        if(dtype == aiq31 && (k->flags & F_PROB)){
+            // Quantization of the sigmoid output (expected by aimath_q31_default_d_sigmoid())
+            bc->params[0].q31.shift = 32;
+            bc->params[0].q31.zero_point = INT32_MIN;
+            for(i = 0; i < aimath_tensor_elements(x); i++){
+                ((int32_t *) x->data)[i] = (int32_t) (random_u32() ^ 0x80000000u);
+            }
+        } else if(dtype == aiq31 && (k->flags & F_POSITIVE)){
+            set_shift(&bc->tensors[1], Q31_SHIFT / 4); // Result shift of aimath_q31_default_tensor_sqrt()
+        }
+        if(k->kind == K_LUT){
+            aimath_q7_default_lut_build((aimath_q7_params_t *) x->tensor_params, (aimath_q7_params_t *) bc->tensors[1].tensor_params,
+                                        lut_sigmoid, 0, &bc->lut);
+        }
+        break;
+    case K_BINARY:
+        bench_tensor(bc, dtype, FILL_SIGNED, rows, cols, 0, 0);
+        if(k->flags & F_SPARSE8){
+            bench_tensor(bc, aiu8, FILL_CLASS, rows, 1, 0, 0);
+        } else {
+            bench_tensor(bc, dtype, fill, rows, cols, 0, 0);
+        }
+        bench_tensor(bc, dtype, FILL_ZERO, rows, cols, 0, 0);
+        break;
+    case K_REDUCE:
+        bench_tensor(bc, dtype, fill, rows, cols, 0, 0);
+        break;
+    case K_LOSS:
+        bench_tensor(bc, dtype, fill, rows, cols, 0, 0);
+        if(k->flags & F_SPARSE8){
+            bench_tensor(bc, aiu8, FILL_CLASS, rows, 1, 0, 0);
+        } else {
+            bench_tensor(bc, dtype, fill, rows, cols, 0, 0);
+        }
+        break;
+    case K_CHANNELWISE:
+        bench_tensor(bc, dtype, fill, rows, cols, 0, 0);
+        bench_tensor(bc, dtype, FILL_ZERO, cols, 0, 0, 0);
+        break;
+    case K_VARIANCE:
+        bench_tensor(bc, dtype, fill, rows, cols, 0, 0);
+        bench_tensor(bc, dtype, FILL_SIGNED, cols, 0, 0, 0);
+        bench_tensor(bc, dtype, FILL_ZERO, cols, 0, 0, 0);
+        break;
+    default:
+        return -1;
+    }
+    return 0;
+}
+
+static int setup_matrix(bench_case_t *bc, uint8_t s)
+{
+    const bench_kernel_t *k = bc->kernel;
+    const aimath_dtype_t *dtype = bench_dtype(k->dtype);
+    uint16_t N = matrix_shapes[s][0], K = matrix_shapes[s][1], M = matrix_shapes[s][2];
+    uint16_t row, col, rows, step, block_size;
+    uint32_t nnz, i;
+    aitensor_t *a, *b, *c;
+    aimath_sparse_params_t *sparse;
+
+    snprintf(bc->shape, sizeof(bc->shape), "%ux%ux%u", N, K, M);
+    bc->ops = (uint64_t) N * K * M;
+    bc->op_unit = "mac";
+
+    // a
+    if(k->flags & F_FUSED){
+        a = bench_tensor(bc, aif32, FILL_SIGNED, N, K, 0, 0);
+        set_source_params(bc, a);
+    } else if(k->flags & F_AT){
+        a = bench_tensor(bc, dtype, FILL_SIGNED, K, N, 0, 0);
+    } else {
+        a = bench_tensor(bc, dtype, FILL_SIGNED, N, K, 0, 0);
+    }
+
+    // b
+    if(k->flags & F_PALETTE){
+        b = &bc->tensors[bc->tensor_count];
+        bc->shapes[bc->tensor_count][0] = M;
+        bc->shapes[bc->tensor_count][1] = K;
+        bc->params[bc->tensor_count].palette.index_bits = 4;
+        bc->params[bc->tensor_count].palette.centroid_count = 16;
+        bc->params[bc->tensor_count].palette.codebook = bench_alloc(bc, 16 * sizeof(float));
+        if(bc->params[bc->tensor_count].palette.codebook == 0) return -1;
+        for(i = 0; i < 16; i++){
+            bc->params[bc->tensor_count].palette.codebook[i] = random_float(-1.0f, 1.0f);
+        }
+        b->dtype = aiu8;
+        b->dim = 2;
+        b->shape = bc->shapes[bc->tensor_count];
+        b->tensor_params = &bc->params[bc->tensor_count].palette;
+        b->data = bench_alloc(bc, (uint32_t) M * ((K + 1) / 2));
+        if(b->data == 0) return -1;
+        for(i = 0; i < (uint32_t) M * ((K + 1) / 2); i++){
+            ((uint8_t *) b->data)[i] = (uint8_t) random_u32();
+        }
+        bc->tensor_count++;
+    } else if(k->flags & F_SPARSE){
+        // Sparse matrix [M x K] with every SPARSE_DENSITY-th element (CSR) or block non-zero
+        b = &bc->tensors[bc->tensor_count];
+        sparse = &bc->params[bc->tensor_count].sparse;
+        bc->shapes[bc->tensor_count][0] = M;
+        bc->shapes[bc->tensor_count][1] = K;
+        if(k->flags & F_BLOCK_1X4){
+            sparse->format = AIMATH_SPARSE_BLOCK_1X4;
+            strcat(bc->shape, " b1x4");
+        } else if(k->flags & F_BLOCK_4X1){
+            sparse->format = AIMATH_SPARSE_BLOCK_4X1;
+            strcat(bc->shape, " b4x1");
+        } else {
+            sparse->format = AIMATH_SPARSE_CSR;
+        }
+        block_size = AIMATH_SPARSE_BLOCK_SIZE(sparse->format);
+        rows = AIMATH_SPARSE_ROW_PTR_LENGTH(sparse->format, M) - 1; // Block rows
+        step = sparse->format == AIMATH_SPARSE_BLOCK_1X4 ? 4 * SPARSE_DENSITY : SPARSE_DENSITY; // Column step between the entries of a row
+        sparse->row_ptr = bench_alloc(bc, (rows + 1) * sizeof(uint32_t));
+        sparse->col_idx = bench_alloc(bc, ((uint32_t) rows * (K / step + 1)) * sizeof(uint16_t));
+        sparse->values_params = 0;
+        if(sparse->row_ptr == 0 || sparse->col_idx == 0) return -1;
+        nnz = 0;
+        for(row = 0; row < rows; row++){
+            sparse->row_ptr[row] = nnz;
+            for(col = (sparse->format == AIMATH_SPARSE_BLOCK_1X4 ? 4 : 1) * (row % SPARSE_DENSITY); col < K; col += step){
+                sparse->col_idx[nnz++] = col;
+            }
+        }
+        sparse->row_ptr[rows] = nnz;
+        sparse->nnz = nnz;
+        b->dtype = dtype;
+        b->dim = 2;
+        b->shape = bc->shapes[bc->tensor_count];
+        b->tensor_params = sparse;
+        b->data = bench_alloc(bc, AIMATH_SPARSE_VALUES_LENGTH(sparse->format, nnz) * dtype->size);
+        if(b->data == 0) return -1;
+        for(i = 0; i < AIMATH_SPARSE_VALUES_LENGTH(sparse->format, nnz); i++){
+            if(dtype == aiq7){
+                ((int8_t *) b->data)[i] = (int8_t) lroundf(random_float(-1.0f, 1.0f) * (float) (1 << Q7_SHIFT));
+            } else {
+                ((float *) b->data)[i] = random_float(-1.0f, 1.0f);
+            }
+        }
+        if(dtype == aiq7){
+            bc->params[bc->tensor_count + 1].q7.shift = Q7_SHIFT;
+            bc->params[bc->tensor_count + 1].q7.zero_point = 0;
+            sparse->values_params = &bc->params[bc->tensor_count + 1].q7;
+            bc->tensor_count++; // Reserve the slot of the value params
+        }
+        bc->tensor_count++;
+        bc->ops = (uint64_t) N * nnz * block_size;
+    } else if(k->flags & F_BT){
+        b = bench_tensor(bc, dtype, FILL_SIGNED, M, K, 0, 0);
+    } else {
+        b = bench_tensor(bc, dtype, FILL_SIGNED, K, M, 0, 0);
+    }
+
+    // c (the bias of the quantized kernels is Q31 with the shift of the accumulator)
+    if(k->kind == K_LINEAR){
+        c = bench_tensor(bc, dtype == aif32 ? aif32 : aiq31, FILL_SIGNED, 1, M, 0, 0);
+        set_shift(c, dtype == aiq7 ? 2 * Q7_SHIFT : (dtype == aiq31 ? 2 * Q31_SHIFT : 0));
+    }
+
+    // result
+    if(k->flags & F_RT){
+        bench_tensor(bc, dtype, FILL_ZERO, M, N, 0, 0);
+    } else {
+        bench_tensor(bc, dtype, FILL_ZERO, N, M, 0, 0);
+    }
+    (void) b;
+    return 0;
+}
+
+static int setup_conv2d(bench_case_t *bc, uint8_t s)
+{
+    const bench_kernel_t *k = bc->kernel;
+    const aimath_dtype_t *dtype = bench_dtype(k->dtype);
+    uint16_t N = conv2d_shapes[s][0], H = conv2d_shapes[s][1], W = conv2d_shapes[s][2];
+    uint16_t C_in = conv2d_shapes[s][3], C_out = conv2d_shapes[s][4], K = conv2d_shapes[s][5];
+    uint8_t hwc = (k->flags & F_HWC) != 0;
+    uint8_t x_fill = (k->flags & F_BWD) ? FILL_ZERO : FILL_SIGNED;
+    uint8_t y_fill = (k->flags & (F_BWD | F_WGRAD)) ? FILL_SIGNED : FILL_ZERO;
+    uint8_t w_fill = (k->flags & F_WGRAD) ? FILL_ZERO : FILL_SIGNED;
+    uint16_t C, H_out, W_out;
+
+    bc->stride[0] = bc->stride[1] = 1;
+    bc->dilation[0] = bc->dilation[1] = 1;
+    bc->output_padding[0] = bc->output_padding[1] = 0;
+    bc->axis = hwc ? 3 : 1;
+
+    switch(k->kind){
+    case K_CONV2D_FWD:
+    case K_CONV2D_BWD:
+    case K_CONV_TRANSPOSE2D:
+        if(k->flags & F_POINTWISE){
+            K = 1;
+        }
+        if(k->flags & F_DEPTHWISE){
+            C_out = C_in;
+        }
+        bc->padding[0] = bc->padding[1] = K / 2;
+        snprintf(bc->shape, sizeof(bc->shape), "%ux%ux%ux%u k%u f%u", N, H, W, C_in, K, C_out);
+        bc->op_unit = "mac";
+        bc->ops = (uint64_t) N * H * W * C_out * K * K * ((k->flags & F_DEPTHWISE) ? 1 : C_in);
+
+        // Tensor 0: input / delta_in, 1: weights / d_weights, 2: bias, 3: output / delta_out
+        if(hwc){
+            bench_tensor(bc, dtype, x_fill, N, H, W, C_in);
+        } else {
+            bench_tensor(bc, dtype, x_fill, N, C_in, H, W);
+        }
+        if(k->flags & F_DEPTHWISE){
+            bench_tensor(bc, dtype, w_fill, K, K, C_out, 0);
+        } else if(hwc){
+            bench_tensor(bc, dtype, w_fill, C_out, K, K, C_in);
+        } else {
+            bench_tensor(bc, dtype, w_fill, C_out, C_in, K, K);
+        }
+        if(k->kind == K_CONV2D_BWD){
+            bc->tensors[bc->tensor_count++] = bc->tensors[1]; // No bias
+        } else {
+            bench_tensor(bc, dtype, FILL_SIGNED, C_out, 0, 0, 0);
+        }
+        if(hwc){
+            bench_tensor(bc, dtype, y_fill, N, H, W, C_out);
+        } else {
+            bench_tensor(bc, dtype, y_fill, N, C_out, H, W);
+        }
+        break;
+    case K_MAXPOOL2D_FWD:
+    case K_MAXPOOL2D_BWD:
+    case K_AVGPOOL2D:
+    case K_GLOBAL_AVGPOOL2D:
+        C = C_out;
+        bc->pool_size[0] = bc->pool_size[1] = 2;
+        bc->stride[0] = bc->stride[1] = 2;
+        bc->padding[0] = bc->padding[1] = 0;
+        H_out = H / 2;
+        W_out = W / 2;
+        snprintf(bc->shape, sizeof(bc->shape), "%ux%ux%ux%u", N, H, W, C);
+        bc->op_unit = "element";
+        bc->ops = (uint64_t) N * H * W * C;
+
+        // Tensor 0: input / delta_in, 1: output / delta_out
+        if(hwc){
+            bench_tensor(bc, dtype, x_fill, N, H, W, C);
+        } else {
+            bench_tensor(bc, dtype, x_fill, N, C, H, W);
+        }
+        if(k->kind == K_GLOBAL_AVGPOOL2D){
+            bench_tensor(bc, dtype, y_fill, N, C, 0, 0);
+        } else if(hwc){
+            bench_tensor(bc, dtype, y_fill, N, H_out, W_out, C);
+        } else {
+            bench_tensor(bc, dtype, y_fill, N, C, H_out, W_out);
+        }
+        if(k->kind == K_GLOBAL_AVGPOOL2D && !(k->flags & F_BWD)){
+            // Channel sums of the Q7 channels last kernel
+            bc->work_space = bench_alloc(bc, (uint32_t) C * sizeof(int32_t));
+            if(bc->work_space == 0) return -1;
+        }
+        if(k->kind == K_MAXPOOL2D_FWD || k->kind == K_MAXPOOL2D_BWD){
+            bc->max_locations = bench_alloc(bc, (uint32_t) N * H_out * W_out * C * sizeof(uint32_t));
+            if(bc->max_locations == 0) return -1;
+        }
+        if(k->kind == K_MAXPOOL2D_BWD){
+            // Calculate valid max locations with the forward pass
+            fill_tensor(bc, &bc->tensors[0], FILL_SIGNED);
+            ((void (*)(const aitensor_t *, const uint16_t *, const uint16_t *, const uint16_t *, int8_t, void *, uint32_t *, aitensor_t *)) k->aux)(
+                &bc->tensors[0], bc->pool_size, bc->stride, bc->padding, bc->axis, 0, bc->max_locations, &bc->tensors[1]);
+            fill_tensor(bc, &bc->tensors[1], FILL_SIGNED);
+        }
+        break;
+    case K_BATCH_NORM:
+    case K_BATCH_NORM_TRAIN:
+    case K_D_BATCH_NORM:
+        C = C_out;
+        snprintf(bc->shape, sizeof(bc->shape), "%ux%ux%ux%u", N, H, W, C);
+        bc->op_unit = "element";
+        bc->ops = (uint64_t) N * H * W * C;
+        bc->axis = 3;
+        bc->alpha.f32 = 0.9f;
+        bc->eps.f32 = 1e-6f;
+
+        // Tensor 0: x, 1: means, 2: variances, 3: offsets, 4: scales, 5: result / delta_in
+        bench_tensor(bc, aif32, FILL_SIGNED, N, H, W, C);
+        bench_tensor(bc, aif32, FILL_SIGNED, C, 0, 0, 0);
+        bench_tensor(bc, aif32, FILL_POSITIVE, C, 0, 0, 0);
+        bench_tensor(bc, aif32, FILL_SIGNED, C, 0, 0, 0);
+        bench_tensor(bc, aif32, FILL_POSITIVE, C, 0, 0, 0);
+        bench_tensor(bc, aif32, FILL_ZERO, N, H, W, C);
+        if(k->kind == K_BATCH_NORM_TRAIN){
+            // 6: moving means, 7: moving variances
+            bench_tensor(bc, aif32, FILL_SIGNED, C, 0, 0, 0);
+            bench_tensor(bc, aif32, FILL_POSITIVE, C, 0, 0, 0);
+        } else if(k->kind == K_D_BATCH_NORM){
+            // 6: delta_out, 7: d_betas, 8: d_gammas
+            bench_tensor(bc, aif32, FILL_SIGNED, N, H, W, C);
+            bench_tensor(bc, aif32, FILL_ZERO, C, 0, 0, 0);
+            bench_tensor(bc, aif32, FILL_ZERO, C, 0, 0, 0);
+        }
+        break;
+    default:
+        return -1;
+    }
+    return 0;
+}
+
+static int setup_conv1d(bench_case_t *bc, uint8_t s)
+{
+    const bench_kernel_t *k = bc->kernel;
+    const aimath_dtype_t *dtype = bench_dtype(k->dtype);
+    uint16_t N = conv1d_shapes[s][0], L = conv1d_shapes[s][1];
+    uint16_t C_in = conv1d_shapes[s][2], C_out = conv1d_shapes[s][3], K = conv1d_shapes[s][4];
+    uint8_t x_fill = (k->flags & F_BWD) ? FILL_ZERO : FILL_SIGNED;
+    uint8_t y_fill = (k->flags & (F_BWD | F_WGRAD)) ? FILL_SIGNED : FILL_ZERO;
+    uint8_t w_fill = (k->flags & F_WGRAD) ? FILL_ZERO : FILL_SIGNED;
+
+    // Channels last: [N, L, C]
+    bc->axis = 2;
+    bc->stride[0] = 1;
+    bc->dilation[0] = 1;
+
+    switch(k->kind){
+    case K_CONV1D_FWD:
+    case K_CONV1D_BWD:
+        bc->padding[0] = K / 2;
+        snprintf(bc->shape, sizeof(bc->shape), "%ux%ux%u k%u f%u", N, L, C_in, K, C_out);
+        bc->op_unit = "mac";
+        bc->ops = (uint64_t) N * L * C_out * C_in * K;
+
+        // Tensor 0: input / delta_in, 1: weights / d_weights, 2: bias, 3: output / delta_out
+        if(k->flags & F_FUSED){
+            set_source_params(bc, bench_tensor(bc, aif32, x_fill, N, L, C_in, 0));
+        } else {
+            bench_tensor(bc, dtype, x_fill, N, L, C_in, 0);
+        }
+        bench_tensor(bc, dtype, w_fill, C_out, K, C_in, 0);
+        bench_tensor(bc, dtype, FILL_SIGNED, C_out, 0, 0, 0);
+        bench_tensor(bc, dtype, y_fill, N, L, C_out, 0);
+        break;
+    case K_MAXPOOL1D_FWD:
+    case K_MAXPOOL1D_BWD:
+    case K_AVGPOOL1D:
+        bc->pool_size[0] = 2;
+        bc->stride[0] = 2;
+        bc->padding[0] = 0;
+        snprintf(bc->shape, sizeof(bc->shape), "%ux%ux%u", N, L, C_out);
+        bc->op_unit = "element";
+        bc->ops = (uint64_t) N * L * C_out;
+
+        // Tensor 0: input / delta_in, 1: output / delta_out
+        bench_tensor(bc, dtype, x_fill, N, L, C_out, 0);
+        bench_tensor(bc, dtype, y_fill, N, L / 2, C_out, 0);
+        if(k->kind != K_AVGPOOL1D){
+            bc->max_locations = bench_alloc(bc, (uint32_t) N * (L / 2) * C_out * sizeof(uint32_t));
+            if(bc->max_locations == 0) return -1;
+        }
+        if(k->kind == K_MAXPOOL1D_BWD){
+            fill_tensor(bc, &bc->tensors[0], FILL_SIGNED);
+            ((void (*)(const aitensor_t *, uint16_t, uint16_t, uint16_t, int8_t, void *, uint32_t *, aitensor_t *)) k->aux)(
+                &bc->tensors[0], bc->pool_size[0], bc->stride[0], bc->padding[0], bc->axis, 0, bc->max_locations, &bc->tensors[1]);
+            fill_tensor(bc, &bc->tensors[1], FILL_SIGNED);
+        }
+        break;
+    default:
+        return -1;
+    }
+    return 0;
+}
+
+typedef void (*lstm_fwd_fn_t)(const aitensor_t *, const aitensor_t *, const aitensor_t *, uint8_t, void *,
+                              aitensor_t *, aitensor_t *, aitensor_t *, aitensor_t *, aitensor_t *, aitensor_t *);
+typedef void (*lstm_bwd_fn_t)(const aitensor_t *, const aitensor_t *, const aitensor_t *, uint8_t,
+                              const aitensor_t *, const aitensor_t *, const aitensor_t *, void *, aitensor_t *, aitensor_t *, aitensor_t *);
+typedef void (*gru_fwd_fn_t)(const aitensor_t *, const aitensor_t *, const aitensor_t *, uint8_t, void *,
+                             aitensor_t *, aitensor_t *, aitensor_t *, aitensor_t *);
+typedef void (*gru_bwd_fn_t)(const aitensor_t *, const aitensor_t *, const aitensor_t *, uint8_t,
+                             const aitensor_t *, const aitensor_t *, void *, aitensor_t *, aitensor_t *, aitensor_t *);
+
+static int setup_rnn(bench_case_t *bc, uint8_t s)
+{
+    const bench_kernel_t *k = bc->kernel;
+    const aimath_dtype_t *dtype = bench_dtype(k->dtype);
+    uint16_t N = rnn_shapes[s][0], T = rnn_shapes[s][1], I = rnn_shapes[s][2], H = rnn_shapes[s][3];
+    uint8_t lstm = (k->kind == K_LSTM_FWD || k->kind == K_LSTM_BWD);
+    uint8_t bwd = (k->flags & F_BWD) != 0;
+    uint32_t G = (lstm ? 4 : 3) * (uint32_t) H; // Gate pre-activations per step
+    uint32_t work_size;
+    aitensor_t *t;
+
+    snprintf(bc->shape, sizeof(bc->shape), "%ux%ux%u h%u", N, T, I, H);
+    bc->op_unit = "mac";
+    // Gate MACs of all time steps (the backward pass calculates the gradients of the weights and of the inputs)
+    bc->ops = (uint64_t) N * T * (I + H) * G * (bwd ? 2 : 1);
+
+    // Tensor 0: x_in, 1: weights, 2: bias, 3: hidden state, 4: cell state, 5: result (all time steps)
+    bench_tensor(bc, dtype, FILL_SIGNED, N, T, I, 0);
+    bench_tensor(bc, dtype, FILL_SIGNED, I + H, G, 0, 0);
+    bench_tensor(bc, dtype, FILL_SIGNED, lstm ? G : 2 * G, 0, 0, 0);
+    bench_tensor(bc, dtype, FILL_ZERO, N, H, 0, 0);
+    t = bench_tensor(bc, dtype == aiq7 ? aiq31 : dtype, FILL_ZERO, N, H, 0, 0);
+    if(dtype == aiq7){
+        set_shift(t, AIMATH_Q7_RNN_CELL_SHIFT);
+    }
+    bench_tensor(bc, dtype, FILL_ZERO, N, T, H, 0);
+
+    // Work space sizes as documented in aimath_rnn_f32_default.h and aimath_rnn_q7_default.h
+    if(dtype == aiq7){
+        work_size = lstm ? 4 * H * sizeof(int32_t) + 8 * H : 6 * H * sizeof(int32_t) + 6 * H;
+    } else if(bwd){
+        work_size = (lstm ? 6 : 7) * H * sizeof(float);
+    } else {
+        work_size = (lstm ? 4 : 6) * H * sizeof(float);
+    }
+    bc->work_space = bench_alloc(bc, work_size);
+    if(bc->work_space == 0) return -1;
+
+    if(bwd){
+        // Tensor 6: gate cache, 7: cell cache (unused for the GRU), 8: hidden cache, 9: delta_out, 10: d_weights, 11: d_bias, 12: delta_in
+        bench_tensor(bc, dtype, FILL_ZERO, N, T, 4 * H, 0);
+        bench_tensor(bc, dtype, FILL_ZERO, N, T + 1, H, 0);
+        bench_tensor(bc, dtype, FILL_ZERO, N, T + 1, H, 0);
+        bench_tensor(bc, dtype, FILL_SIGNED, N, T, H, 0);
+        bench_tensor(bc, dtype, FILL_ZERO, I + H, G, 0, 0);
+        bench_tensor(bc, dtype, FILL_ZERO, lstm ? G : 2 * G, 0, 0, 0);
+        bench_tensor(bc, dtype, FILL_ZERO, N, T, I, 0);
+
+        // Fill the caches with a forward pass
+        if(lstm){
+            ((lstm_fwd_fn_t) k->aux)(&bc->tensors[0], &bc->tensors[1], &bc->tensors[2], 1, bc->work_space, &bc->tensors[3], &bc->tensors[4],
+                                     &bc->tensors[6], &bc->tensors[7], &bc->tensors[8], &bc->tensors[5]);
+        } else {
+            ((gru_fwd_fn_t) k->aux)(&bc->tensors[0], &bc->tensors[1], &bc->tensors[2], 1, bc->work_space, &bc->tensors[3],
+                                    &bc->tensors[6], &bc->tensors[8], &bc->tensors[5]);
+        }
+    }
+    return 0;
+}
+
+static int setup_case(bench_case_t *bc, const bench_kernel_t *k, uint8_t s)
+{
+    uint8_t i;
+
+    memset(bc, 0, sizeof(bench_case_t));
+    bc->kernel = k;
+
+    switch(k->kind){
+    case K_MATMUL:
+    case K_LINEAR:
+        if(setup_matrix(bc, s) != 0) return -1;
+        break;
+    case K_CONV2D_FWD:
+    case K_CONV2D_BWD:
+    case K_CONV_TRANSPOSE2D:
+    case K_MAXPOOL2D_FWD:
+    case K_MAXPOOL2D_BWD:
+    case K_AVGPOOL2D:
+    case K_GLOBAL_AVGPOOL2D:
+    case K_BATCH_NORM:
+    case K_BATCH_NORM_TRAIN:
+    case K_D_BATCH_NORM:
+        if(setup_conv2d(bc, s) != 0) return -1;
+        break;
+    case K_CONV1D_FWD:
+    case K_CONV1D_BWD:
+    case K_MAXPOOL1D_FWD:
+    case K_MAXPOOL1D_BWD:
+    case K_AVGPOOL1D:
+        if(setup_conv1d(bc, s) != 0) return -1;
+        break;
+    case K_LSTM_FWD:
+    case K_LSTM_BWD:
+    case K_GRU_FWD:
+    case K_GRU_BWD:
+        if(setup_rnn(bc, s) != 0) return -1;
+        break;
+    default:
+        if(setup_elementwise(bc, s) != 0) return -1;
+        break;
+    }
+    for(i = 0; i < bc->alloc_count; i++){
+        if(bc->allocs[i] == 0) return -1;
+    }
+    return 0;
+}
+
+typedef void (*unary_fn_t)(const aitensor_t *, aitensor_t *);
+typedef void (*unary_alpha_fn_t)(const aitensor_t *, const void *, aitensor_t *);
+typedef void (*scalar_fn_t)(const void *, const aitensor_t *, aitensor_t *);
+typedef void (*binary_fn_t)(const aitensor_t *, const aitensor_t *, aitensor_t *);
+typedef void (*reduce_fn_t)(const aitensor_t *, void *);
+typedef void (*loss_fn_t)(const aitensor_t *, const aitensor_t *, void *);
+typedef void (*channelwise_fn_t)(const aitensor_t *, int8_t, aitensor_t *);
+typedef void (*variance_fn_t)(const aitensor_t *, int8_t, const aitensor_t *, aitensor_t *);
+typedef void (*lut_fn_t)(const aitensor_t *, const aimath_q7_lut_t *, aitensor_t *);
+typedef float (*scalar_f32_fn_t)(float);
+typedef int64_t (*scalar_q31_fn_t)(int64_t);
+typedef void (*linear_fn_t)(const aitensor_t *, const aitensor_t *, const aitensor_t *, aitensor_t *);
+typedef void (*conv2d_fwd_fn_t)(const aitensor_t *, const uint16_t *, const uint16_t *, const uint16_t *,
+                                const aitensor_t *, const aitensor_t *, int8_t, void *, aitensor_t *);
+typedef void (*conv2d_bwd_fn_t)(const aitensor_t *, const uint16_t *, const uint16_t *, const uint16_t *,
+                                const aitensor_t *, int8_t, void *, aitensor_t *);
+typedef void (*conv_transpose2d_fn_t)(const aitensor_t *, const uint16_t *, const uint16_t *, const uint16_t *, const uint16_t *,
+                                      const aitensor_t *, const aitensor_t *, int8_t, void *, aitensor_t *);
+typedef void (*maxpool2d_fwd_fn_t)(const aitensor_t *, const uint16_t *, const uint16_t *, const uint16_t *,
+                                   int8_t, void *, uint32_t *, aitensor_t *);
+typedef void (*maxpool2d_bwd_fn_t)(const aitensor_t *, const uint16_t *, const uint16_t *, const uint16_t *,
+                                   int8_t, void *, const uint32_t *, aitensor_t *);
+typedef void (*avgpool2d_fn_t)(const aitensor_t *, const uint16_t *, const uint16_t *, const uint16_t *,
+                               int8_t, void *, aitensor_t *);
+typedef void (*global_avgpool2d_fwd_fn_t)(const aitensor_t *, int8_t, void *, aitensor_t *);
+typedef void (*conv1d_fwd_fn_t)(const aitensor_t *, uint16_t, uint16_t, uint16_t,
+                                const aitensor_t *, const aitensor_t *, int8_t, void *, aitensor_t *);
+typedef void (*conv1d_bwd_fn_t)(const aitensor_t *, uint16_t, uint16_t, uint16_t,
+                                const aitensor_t *, int8_t, void *, aitensor_t *);
+typedef void (*maxpool1d_fwd_fn_t)(const aitensor_t *, uint16_t, uint16_t, uint16_t, int8_t, void *, uint32_t *, aitensor_t *);
+typedef void (*maxpool1d_bwd_fn_t)(const aitensor_t *, uint16_t, uint16_t, uint16_t, int8_t, void *, const uint32_t *, aitensor_t *);
+typedef void (*avgpool1d_fn_t)(const aitensor_t *, uint16_t, uint16_t, uint16_t, int8_t, void *, aitensor_t *);
+typedef void (*batch_norm_fn_t)(const aitensor_t *, int8_t, const aitensor_t *, const aitensor_t *, const aitensor_t *,
+                                const aitensor_t *, const void *, aitensor_t *);
+typedef void (*batch_norm_train_fn_t)(const aitensor_t *, int8_t, uint8_t, const void *, const void *, aitensor_t *, aitensor_t *,
+                                      aitensor_t *, aitensor_t *, const aitensor_t *, const aitensor_t *, aitensor_t *);
+typedef void (*d_batch_norm_fn_t)(const aitensor_t *, int8_t, const aitensor_t *, const aitensor_t *, const aitensor_t *,
+                                  const aitensor_t *, const aitensor_t *, const void *, aitensor_t *, aitensor_t *, aitensor_t *);
+
+/** @brief Calls the kernel once with the prepared arguments */
+static void bench_call(bench_case_t *bc)
+{
+    const bench_kernel_t *k = bc->kernel;
+    aitensor_t *t = bc->tensors;
+    uint8_t bwd = (k->flags & F_BWD) != 0;
+    uint8_t last = bc->tensor_count - 1;
+    uint32_t i, elements;
+
+    switch(k->kind){
+    case K_UNARY:
+        ((unary_fn_t) k->fn)(&t[0], &t[1]);
+        break;
+    case K_UNARY_ALPHA:
+        ((unary_alpha_fn_t) k->fn)(&t[0], &bc->alpha, &t[1]);
+        break;
+    case K_SCALAR:
+        ((scalar_fn_t) k->fn)(&bc->alpha, &t[0], &t[1]);
+        break;
+    case K_SCALAR_FN:
+        elements = aimath_tensor_elements(&t[0]);
+        if(k->dtype == DT_F32){
+            for(i = 0; i < elements; i++){
+                ((float *) t[1].data)[i] = ((scalar_f32_fn_t) k->fn)(((float *) t[0].data)[i]);
+            }
+        } else {
+            for(i = 0; i < elements; i++){
+                ((int32_t *) t[1].data)[i] = (int32_t) ((scalar_q31_fn_t) k->fn)(((int32_t *) t[0].data)[i]);
+            }
+        }
+        break;
+    case K_BINARY:
+        ((binary_fn_t) k->fn)(&t[0], &t[1], &t[2]);
+        break;
+    case K_REDUCE:
+        ((reduce_fn_t) k->fn)(&t[0], &bc->scalar_result);
+        break;
+    case K_LOSS:
+        ((loss_fn_t) k->fn)(&t[0], &t[1], &bc->scalar_result);
+        break;
+    case K_CHANNELWISE:
+        ((channelwise_fn_t) k->fn)(&t[0], bc->axis, &t[1]);
+        break;
+    case K_VARIANCE:
+        ((variance_fn_t) k->fn)(&t[0], bc->axis, &t[1], &t[2]);
+        break;
+    case K_LUT:
+        ((lut_fn_t) k->fn)(&t[0], &bc->lut, &t[1]);
+        break;
+    case K_MATMUL:
+        ((binary_fn_t) k->fn)(&t[0], &t[1], &t[last]);
+        break;
+    case K_LINEAR:
+        ((linear_fn_t) k->fn)(&t[0], &t[1], &t[last - 1], &t[last]);
+        break;
+    case K_CONV2D_FWD:
+        ((conv2d_fwd_fn_t) k->fn)(&t[0], bc->stride, bc->dilation, bc->padding, &t[1], &t[2], bc->axis, 0, &t[3]);
+        break;
+    case K_CONV2D_BWD:
+        if(bwd){
+            ((conv2d_bwd_fn_t) k->fn)(&t[3], bc->stride, bc->dilation, bc->padding, &t[1], bc->axis, 0, &t[0]);
+        } else {
+            ((conv2d_bwd_fn_t) k->fn)(&t[0], bc->stride, bc->dilation, bc->padding, &t[3], bc->axis, 0, &t[1]);
+        }
+        break;
+    case K_CONV_TRANSPOSE2D:
+        ((conv_transpose2d_fn_t) k->fn)(&t[0], bc->stride, bc->dilation, bc->padding, bc->output_padding, &t[1], &t[2], bc->axis, 0, &t[3]);
+        break;
+    case K_MAXPOOL2D_FWD:
+        ((maxpool2d_fwd_fn_t) k->fn)(&t[0], bc->pool_size, bc->stride, bc->padding, bc->axis, 0, bc->max_locations, &t[1]);
+        break;
+    case K_MAXPOOL2D_BWD:
+        ((maxpool2d_bwd_fn_t) k->fn)(&t[1], bc->pool_size, bc->stride, bc->padding, bc->axis, 0, bc->max_locations, &t[0]);
+        break;
+    case K_AVGPOOL2D:
+        ((avgpool2d_fn_t) k->fn)(&t[bwd], bc->pool_size, bc->stride, bc->padding, bc->axis, 0, &t[!bwd]);
+        break;
+    case K_GLOBAL_AVGPOOL2D:
+        if(bwd){
+            ((channelwise_fn_t) k->fn)(&t[1], bc->axis, &t[0]);
+        } else {
+            ((global_avgpool2d_fwd_fn_t) k->fn)(&t[0], bc->axis, bc->work_space, &t[1]);
+        }
+        break;
+    case K_CONV1D_FWD:
+        ((conv1d_fwd_fn_t) k->fn)(&t[0], bc->stride[0], bc->dilation[0], bc->padding[0], &t[1], &t[2], bc->axis, 0, &t[3]);
+        break;
+    case K_CONV1D_BWD:
+        if(bwd){
+            ((conv1d_bwd_fn_t) k->fn)(&t[3], bc->stride[0], bc->dilation[0], bc->padding[0], &t[1], bc->axis, 0, &t[0]);
+        } else {
+            ((conv1d_bwd_fn_t) k->fn)(&t[0], bc->stride[0], bc->dilation[0], bc->padding[0], &t[3], bc->axis, 0, &t[1]);
+        }
+        break;
+    case K_MAXPOOL1D_FWD:
+        ((maxpool1d_fwd_fn_t) k->fn)(&t[0], bc->pool_size[0], bc->stride[0], bc->padding[0], bc->axis, 0, bc->max_locations, &t[1]);
+        break;
+    case K_MAXPOOL1D_BWD:
+        ((maxpool1d_bwd_fn_t) k->fn)(&t[1], bc->pool_size[0], bc->stride[0], bc->padding[0], bc->axis, 0, bc->max_locations, &t[0]);
+        break;
+    case K_AVGPOOL1D:
+        ((avgpool1d_fn_t) k->fn)(&t[bwd], bc->pool_size[0], bc->stride[0], bc->padding[0], bc->axis, 0, &t[!bwd]);
+        break;
+    case K_BATCH_NORM:
+        ((batch_norm_fn_t) k->fn)(&t[0], bc->axis, &t[1], &t[2], &t[3], &t[4], &bc->eps, &t[5]);
+        break;
+    case K_BATCH_NORM_TRAIN:
+        ((batch_norm_train_fn_t) k->fn)(&t[0], bc->axis, 1, &bc->alpha, &bc->eps, &t[1], &t[2], &t[6], &t[7], &t[3], &t[4], &t[5]);
+        break;
+    case K_D_BATCH_NORM:
+        ((d_batch_norm_fn_t) k->fn)(&t[0], bc->axis, &t[1], &t[2], &t[3], &t[4], &t[6], &bc->eps, &t[5], &t[7], &t[8]);
+        break;
+    case K_LSTM_FWD:
+        ((lstm_fwd_fn_t) k->fn)(&t[0], &t[1], &t[2], 1, bc->work_space, &t[3], &t[4], 0, 0, 0, &t[5]);
+        break;
+    case K_LSTM_BWD:
+        ((lstm_bwd_fn_t) k->fn)(&t[0], &t[1], &t[9], 1, &t[6], &t[7], &t[8], bc->work_space, &t[10], &t[11], &t[12]);
+        break;
+    case K_GRU_FWD:
+        ((gru_fwd_fn_t) k->fn)(&t[0], &t[1], &t[2], 1, bc->work_space, &t[3], 0, 0, &t[5]);
+        break;
+    case K_GRU_BWD:
+        ((gru_bwd_fn_t) k->fn)(&t[0], &t[1], &t[9], 1, &t[6], &t[8], bc->work_space, &t[10], &t[11], &t[12]);
+        break;
+    }
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *) a, y = *(const double *) b;
+    return (x > y) - (x < y);
+}
+
+/** @brief Calibrates the repetitions to min_time_ns per sample and measures the time per call */
+static void bench_measure(bench_case_t *bc, uint16_t samples, double min_time_ns, bench_result_t *result)
+{
+    double sample_ns[64];
+    double sum = 0.0, sq_sum = 0.0;
+    uint64_t start, reps, r;
+    uint16_t i;
+
+    // Warm-up and calibration
+    start = now_ns();
+    bench_call(bc);
+    reps = 1;
+    while(now_ns() - start < 1000000ull && reps < 1000000ull){
+        bench_call(bc);
+        reps++;
+    }
+    reps = (uint64_t) (min_time_ns / samples / ((double) (now_ns() - start) / reps)) + 1;
+
+    for(i = 0; i < samples; i++){
+        start = now_ns();
+        for(r = 0; r < reps; r++){
+            bench_call(bc);
+        }
+        sample_ns[i] = (double) (now_ns() - start) / reps;
+        sum += sample_ns[i];
+    }
+    result->mean = sum / samples;
+    for(i = 0; i < samples; i++){
+        sq_sum += (sample_ns[i] - result->mean) * (sample_ns[i] - result->mean);
+    }
+    result->stddev = samples > 1 ? sqrt(sq_sum / (samples - 1)) : 0.0;
+    qsort(sample_ns, samples, sizeof(double), compare_double);
+    result->median = (samples % 2) ? sample_ns[samples / 2] : 0.5 * (sample_ns[samples / 2 - 1] + sample_ns[samples / 2]);
+
+    result->kernel = bc->kernel;
+    strcpy(result->shape, bc->shape);
+    result->calls = reps * samples;
+    result->ops = bc->ops;
+    result->op_unit = bc->op_unit;
+    result->bytes = bc->bytes;
+}
+
+static void print_result(const bench_result_t *r, uint8_t json, uint8_t first)
+{
+    // ops / ns = Gops / s, bytes / ns = GB / s
+    if(json){
+        printf("%s    {\"kernel\": \"%s\", \"backend\": \"%s\", \"dtype\": \"%s\", \"shape\": \"%s\", \"calls\": %llu, "
+               "\"time_ns_median\": %.1f, \"time_ns_mean\": %.1f, \"time_ns_stddev\": %.1f, "
+               "\"ops\": %llu, \"op_unit\": \"%s\", \"gops\": %.4f, \"bytes\": %llu, \"gbps\": %.4f}",
+               first ? "" : ",\n", r->kernel->name, r->kernel->backend, dtype_names[r->kernel->dtype], r->shape,
+               (unsigned long long) r->calls, r->median, r->mean, r->stddev,
+               (unsigned long long) r->ops, r->op_unit, r->ops / r->median, (unsigned long long) r->bytes, r->bytes / r->median);
+    } else {
+        printf("%s,%s,%s,%s,%llu,%.1f,%.1f,%.1f,%llu,%s,%.4f,%llu,%.4f\n",
+               r->kernel->name, r->kernel->backend, dtype_names[r->kernel->dtype], r->shape,
+               (unsigned long long) r->calls, r->median, r->mean, r->stddev,
+               (unsigned long long) r->ops, r->op_unit, r->ops / r->median, (unsigned long long) r->bytes, r->bytes / r->median);
+    }
+    fflush(stdout);
+}
+
+/** @brief Compares the medians with a CSV output of a previous run
+ *
+ * @return Number of regressions (current median more than threshold percent slower than the baseline)
+ */
+static int compare_baseline(const char *path, const bench_result_t *results, uint32_t count, double threshold)
+{
+    FILE *file = fopen(path, "r");
+    char line[512], *fields[16], *token;
+    int col_kernel = -1, col_backend = -1, col_shape = -1, col_median = -1;
+    int n, regressions = 0, compared = 0;
+    uint32_t i;
+    double base, change;
+
+    if(file == 0){
+        fprintf(stderr, "Could not open baseline %s\n", path);
+        return -1;
+    }
+    while(fgets(line, sizeof(line), file) != 0){
+        line[strcspn(line, "\r\n")] = '\0';
+        n = 0;
+        for(token = strtok(line, ","); token != 0 && n < 16; token = strtok(0, ",")){
+            fields[n++] = token;
+        }
+        if(col_median < 0){
+            // Header
+            for(i = 0; i < (uint32_t) n; i++){
+                if(strcmp(fields[i], "kernel") == 0) col_kernel = i;
+                else if(strcmp(fields[i], "backend") == 0) col_backend = i;
+                else if(strcmp(fields[i], "shape") == 0) col_shape = i;
+                else if(strcmp(fields[i], "time_ns_median") == 0) col_median = i;
+            }
+            if(col_kernel < 0 || col_backend < 0 || col_shape < 0 || col_median < 0){
+                fprintf(stderr, "Baseline %s is not a CSV output of this tool\n", path);
+                fclose(file);
+                return -1;
+            }
+            continue;
+        }
+        if(n <= col_median){
+            continue;
+        }
+        for(i = 0; i < count; i++){
+            if(strcmp(results[i].kernel->name, fields[col_kernel]) == 0 && strcmp(results[i].kernel->backend, fields[col_backend]) == 0
+               && strcmp(results[i].shape, fields[col_shape]) == 0){
+                base = atof(fields[col_median]);
+                change = base > 0.0 ? 100.0 * (results[i].median - base) / base : 0.0;
+                compared++;
+                if(change > threshold){
+                    fprintf(stderr, "REGRESSION %s (%s, %s): %.1f ns -> %.1f ns (%+.1f %%)\n",
+                            results[i].kernel->name, results[i].kernel->backend, results[i].shape, base, results[i].median, change);
+                    regressions++;
+                }
+                break;
+            }
+        }
+    }
+    fclose(file);
+    fprintf(stderr, "%d of %d compared benchmarks slower than the baseline by more than %.1f %%\n", regressions, compared, threshold);
+    return regressions;
+}
+
+static void usage(const char *program)
+{
+    fprintf(stderr,
+        "Usage: %s [options]\n"
+        "\n"
+        "Benchmarks the math kernels with random data over a sweep of typical shapes and prints\n"
+        "the time per call, the throughput and the moved bytes.\n"
+        "\n"
+        "Options:\n"
+        "  --format csv|json        Output format (default: csv)\n"
+        "  --filter <text>          Only kernels whose name contains the text\n"
+        "  --dtype f32|q7|q31       Only kernels of the data type\n"
+        "  --quick                  Only the smallest shape of every sweep with short measurements\n"
+        "  --samples <n>            Number of timed samples per benchmark (default: 7, max. 64)\n"
+        "  --min-time <ms>          Total measurement time per benchmark (default: 100)\n"
+        "  --baseline <csv>         Compare the medians with a previous CSV output\n"
+        "  --threshold <percent>    Allowed slowdown against the baseline (default: 10)\n"
+        "  --list                   Print the names of the kernels and exit\n"
+        "\n"
+        "Exit code 2 if a benchmark is slower than the baseline by more than the threshold.\n"
+        "\n"
+        "Example: %s --dtype q7 --format json > q7.json\n",
+        program, program);
+}
+
+int main(int argc, char *argv[])
+{
+    uint8_t json = 0, quick = 0, list = 0, first = 1;
+    const char *filter = 0, *baseline = 0;
+    int dtype = -1;
+    uint16_t samples = 7;
+    double min_time_ms = 100.0, threshold = 10.0;
+    uint8_t s, shape_count;
+    uint32_t i, result_count = 0;
+    int a, regressions;
+    bench_case_t *bc;
+    bench_result_t *results;
+
+    for(a = 1; a < argc; a++){
+        if(strcmp(argv[a], "--format") == 0 && a + 1 < argc){
+            a++;
+            if(strcmp(argv[a], "json") == 0) json = 1;
+            else if(strcmp(argv[a], "csv") != 0){ usage(argv[0]); return 1; }
+        } else if(strcmp(argv[a], "--filter") == 0 && a + 1 < argc){
+            filter = argv[++a];
+        } else if(strcmp(argv[a], "--dtype") == 0 && a + 1 < argc){
+            a++;
+            for(dtype = DT_Q31; dtype >= 0 && strcmp(argv[a], dtype_names[dtype]) != 0; dtype--);
+            if(dtype < 0){ usage(argv[0]); return 1; }
+        } else if(strcmp(argv[a], "--quick") == 0){
+            quick = 1;
+        } else if(strcmp(argv[a], "--samples") == 0 && a + 1 < argc){
+            samples = (uint16_t) atoi(argv[++a]);
+            if(samples < 1 || samples > 64){ usage(argv[0]); return 1; }
+        } else if(strcmp(argv[a], "--min-time") == 0 && a + 1 < argc){
+            min_time_ms = atof(argv[++a]);
+        } else if(strcmp(argv[a], "--baseline") == 0 && a + 1 < argc){
+            baseline = argv[++a];
+        } else if(strcmp(argv[a], "--threshold") == 0 && a + 1 < argc){
+            threshold = atof(argv[++a]);
+        } else if(strcmp(argv[a], "--list") == 0){
+            list = 1;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if(quick){
+        samples = samples < 3 ? samples : 3;
+        min_time_ms = min_time_ms < 10.0 ? min_time_ms : 10.0;
+    }
+    shape_count = quick ? 1 : MAX_SHAPES;
+
+    bc = malloc(sizeof(bench_case_t));
+    results = malloc(KERNEL_COUNT * MAX_SHAPES * sizeof(bench_result_t));
+    if(bc == 0 || results == 0){
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    if(json){
+        printf("{\n  \"samples\": %u,\n  \"min_time_ms\": %.1f,\n  \"benchmarks\": [\n", samples, min_time_ms);
+    } else if(!list){
+        printf("kernel,backend,dtype,shape,calls,time_ns_median,time_ns_mean,time_ns_stddev,ops,op_unit,gops,bytes,gbps\n");
+    }
+
+    for(i = 0; i < KERNEL_COUNT; i++){
+        if((filter != 0 && strstr(kernels[i].name, filter) == 0) || (dtype >= 0 && kernels[i].dtype != dtype)){
+            continue;
+        }
+        if(list){
+            printf("%s (%s, %s)\n", kernels[i].name, kernels[i].backend, dtype_names[kernels[i].dtype]);
+            continue;
+        }
+        for(s = 0; s < shape_count; s++){
+            if(setup_case(bc, &kernels[i], s) != 0){
+                fprintf(stderr, "Could not set up %s (%s)\n", kernels[i].name, bc->shape);
+                bench_free(bc);
+                continue;
+            }
+            bench_measure(bc, samples, min_time_ms * 1e6, &results[result_count]);
+            print_result(&results[result_count], json, first);
+            first = 0;
+            result_count++;
+            bench_free(bc);
+        }
+    }
+
+    if(json){
+        printf("\n  ]\n}\n");
+    }
+
+    regressions = 0;
+    if(baseline != 0){
+        regressions = compare_baseline(baseline, results, result_count, threshold);
+    }
+
+    free(results);
+    free(bc);
+
+    if(regressions < 0){
+        return 1;
+    }
+    return regressions > 0 ? 2 : 0;
+}
@@ -0,0 +1,330 @@
+/**
+ * \file aifes_footprint.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Command line tool that prints the footprint of a model as JSON
+ * \details The model is described on the command line (see usage()) and analyzed with aialgo_analyze_footprint().
+ * No parameter, inference or training memory is allocated. For build instructions refer to the README.md.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "aifes.h"
+
+// Console printing for the host
+static int print_string(const char *string){ return printf("%s", string); }
+static int print_int(const char *format, int var){ return printf(format, var); }
+static int print_uint(const char *format, unsigned int var){ return printf(format, var); }
+static int print_long_int(const char *format, long int var){ return printf(format, var); }
+static int print_float(const char *format, float var){ return printf(format, var); }
+
+int (*aiprint)(const char *string) = print_string;
+int (*aiprint_int)(const char *format, int var) = print_int;
+int (*aiprint_uint)(const char *format, unsigned int var) = print_uint;
+int (*aiprint_long_int)(const char *format, long int var) = print_long_int;
+int (*aiprint_float)(const char *format, float var) = print_float;
+
+#define MAX_LAYERS  128
+#define MAX_ARGS    5
+#define MAX_INPUT_DIM   5
+
+static void usage(const char *program)
+{
+    fprintf(stderr,
+        "Usage: %s [options] <input_shape> <layer> [<layer> ...]\n"
+        "\n"
+        "Prints the memory footprint and the MACs of a model as JSON.\n"
+        "\n"
+        "  <input_shape>    Shape of one sample without the batch dimension, channels last (e.g. 28x28x1)\n"
+        "\n"
+        "Options:\n"
+        "  --dtype f32|q7                       Data type of the model (default: f32)\n"
+        "  --batch <n>                          Batch size (default: 1)\n"
+        "  --optimizer sgd|sgd_momentum|adam    Analyze the training with the given optimizer (F32 only)\n"
+        "  --loss mse|crossentropy              Loss for the training analysis (default: mse)\n"
+        "\n"
+        "Layers (all spatial layers in channels last layout):\n"
+        "  dense:<neurons>\n"
+        "  conv1d:<filters>,<kernel>[,<stride>[,<padding>[,<dilation>]]]\n"
+        "  conv2d:<filters>,<kernel>[,<stride>[,<padding>[,<dilation>]]]\n"
+        "  depthwise_conv2d:<multiplier>,<kernel>[,<stride>[,<padding>[,<dilation>]]]\n"
+        "  maxpool1d|avgpool1d|maxpool2d|avgpool2d:<pool>[,<stride>[,<padding>]]\n"
+        "  global_avgpool2d, batch_norm, flatten\n"
+        "  relu, leaky_relu, elu, sigmoid, tanh, softsign, softmax\n"
+        "  lstm:<units>[,<return_sequences>], gru:<units>[,<return_sequences>]\n"
+        "\n"
+        "Example: %s --optimizer adam 28x28x1 conv2d:8,3,1,1 relu maxpool2d:2 flatten dense:10 softmax\n",
+        program, program);
+}
+
+static int parse_args(const char *text, int *args)
+{
+    int count = 0;
+    char *end;
+
+    while(text != 0 && *text != '\0' && count < MAX_ARGS){
+        args[count++] = (int) strtol(text, &end, 10);
+        if(end == text) return -1;
+        text = (*end == ',') ? end + 1 : end;
+        if(*end != ',' && *end != '\0') return -1;
+    }
+    return count;
+}
+
+// Returns the argument or the default value if the argument is not given
+#define ARG(INDEX, DEFAULT)     (argc_layer > (INDEX) ? args[INDEX] : (DEFAULT))
+
+#define NEW_LAYER(TYPE)         TYPE *layer = calloc(1, sizeof(TYPE)); if(layer == 0) return 0
+
+static ailayer_t *create_layer(const char *spec, uint8_t q7, ailayer_t *input_layer)
+{
+    char name[32];
+    const char *colon = strchr(spec, ':');
+    size_t name_length = colon != 0 ? (size_t) (colon - spec) : strlen(spec);
+    int args[MAX_ARGS];
+    int argc_layer;
+
+    if(name_length >= sizeof(name)) return 0;
+    memcpy(name, spec, name_length);
+    name[name_length] = '\0';
+    argc_layer = parse_args(colon != 0 ? colon + 1 : 0, args);
+    if(argc_layer < 0) return 0;
+
+    if(strcmp(name, "dense") == 0 && argc_layer >= 1){
+        NEW_LAYER(ailayer_dense_t);
+        layer->neurons = args[0];
+        return q7 ? ailayer_dense_q7_default(layer, input_layer) : ailayer_dense_f32_default(layer, input_layer);
+    } else if(strcmp(name, "conv1d") == 0 && argc_layer >= 2){
+        NEW_LAYER(ailayer_conv1d_t);
+        layer->filter_count = args[0];
+        layer->kernel_size = args[1];
+        layer->stride = ARG(2, 1);
+        layer->padding = ARG(3, 0);
+        layer->dilation = ARG(4, 1);
+        return q7 ? ailayer_conv1d_lc_q7_default(layer, input_layer) : ailayer_conv1d_lc_f32_default(layer, input_layer);
+    } else if(strcmp(name, "conv2d") == 0 && argc_layer >= 2 && !q7){
+        NEW_LAYER(ailayer_conv2d_t);
+        layer->filter_count = args[0];
+        layer->kernel_size[0] = layer->kernel_size[1] = args[1];
+        layer->stride[0] = layer->stride[1] = ARG(2, 1);
+        layer->padding[0] = layer->padding[1] = ARG(3, 0);
+        layer->dilation[0] = layer->dilation[1] = ARG(4, 1);
+        return ailayer_conv2d_hwc_f32_default(layer, input_layer);
+    } else if(strcmp(name, "depthwise_conv2d") == 0 && argc_layer >= 2 && !q7){
+        NEW_LAYER(ailayer_depthwise_conv2d_t);
+        layer->depth_multiplier = args[0];
+        layer->kernel_size[0] = layer->kernel_size[1] = args[1];
+        layer->stride[0] = layer->stride[1] = ARG(2, 1);
+        layer->padding[0] = layer->padding[1] = ARG(3, 0);
+        layer->dilation[0] = layer->dilation[1] = ARG(4, 1);
+        return ailayer_depthwise_conv2d_hwc_f32_default(layer, input_layer);
+    } else if(strcmp(name, "maxpool1d") == 0 && argc_layer >= 1){
+        NEW_LAYER(ailayer_maxpool1d_t);
+        layer->pool_size = args[0];
+        layer->stride = ARG(1, args[0]);
+        layer->padding = ARG(2, 0);
+        return q7 ? ailayer_maxpool1d_lc_q7_default(layer, input_layer) : ailayer_maxpool1d_lc_f32_default(layer, input_layer);
+    } else if(strcmp(name, "avgpool1d") == 0 && argc_layer >= 1){
+        NEW_LAYER(ailayer_avgpool1d_t);
+        layer->pool_size = args[0];
+        layer->stride = ARG(1, args[0]);
+        layer->padding = ARG(2, 0);
+        return q7 ? ailayer_avgpool1d_lc_q7_default(layer, input_layer) : ailayer_avgpool1d_lc_f32_default(layer, input_layer);
+    } else if(strcmp(name, "maxpool2d") == 0 && argc_layer >= 1 && !q7){
+        NEW_LAYER(ailayer_maxpool2d_t);
+        layer->pool_size[0] = layer->pool_size[1] = args[0];
+        layer->stride[0] = layer->stride[1] = ARG(1, args[0]);
+        layer->padding[0] = layer->padding[1] = ARG(2, 0);
+        return ailayer_maxpool2d_hwc_f32_default(layer, input_layer);
+    } else if(strcmp(name, "avgpool2d") == 0 && argc_layer >= 1){
+        NEW_LAYER(ailayer_avgpool2d_t);
+        layer->pool_size[0] = layer->pool_size[1] = args[0];
+        layer->stride[0] = layer->stride[1] = ARG(1, args[0]);
+        layer->padding[0] = layer->padding[1] = ARG(2, 0);
+        return q7 ? ailayer_avgpool2d_hwc_q7_default(layer, input_layer) : ailayer_avgpool2d_hwc_f32_default(layer, input_layer);
+    } else if(strcmp(name, "global_avgpool2d") == 0){
+        NEW_LAYER(ailayer_global_avgpool2d_t);
+        return q7 ? ailayer_global_avgpool2d_hwc_q7_default(layer, input_layer) : ailayer_global_avgpool2d_hwc_f32_default(layer, input_layer);
+    } else if(strcmp(name, "batch_norm") == 0 && !q7){
+        NEW_LAYER(ailayer_batch_norm_f32_t);
+        layer->momentum = 0.9f;
+        layer->eps = 1e-6f;
+        return ailayer_batch_norm_clast_f32_default(layer, input_layer);
+    } else if(strcmp(name, "flatten") == 0){
+        NEW_LAYER(ailayer_flatten_f32_t);
+        return q7 ? ailayer_flatten_q7_default(layer, input_layer) : ailayer_flatten_f32_default(layer, input_layer);
+    } else if(strcmp(name, "relu") == 0){
+        NEW_LAYER(ailayer_relu_t);
+        return q7 ? ailayer_relu_q7_default(layer, input_layer) : ailayer_relu_f32_default(layer, input_layer);
+    } else if(strcmp(name, "leaky_relu") == 0){
+        if(q7){
+            NEW_LAYER(ailayer_leaky_relu_q7_t);
+            return ailayer_leaky_relu_q7_default(layer, input_layer);
+        } else {
+            NEW_LAYER(ailayer_leaky_relu_f32_t);
+            layer->alpha = 0.01f;
+            return ailayer_leaky_relu_f32_default(layer, input_layer);
+        }
+    } else if(strcmp(name, "elu") == 0){
+        if(q7){
+            NEW_LAYER(ailayer_elu_q7_t);
+            return ailayer_elu_q7_default(layer, input_layer);
+        } else {
+            NEW_LAYER(ailayer_elu_f32_t);
+            layer->alpha = 1.0f;
+            return ailayer_elu_f32_default(layer, input_layer);
+        }
+    } else if(strcmp(name, "sigmoid") == 0){
+        NEW_LAYER(ailayer_sigmoid_t);
+        return q7 ? ailayer_sigmoid_q7_default(layer, input_layer) : ailayer_sigmoid_f32_default(layer, input_layer);
+    } else if(strcmp(name, "tanh") == 0){
+        NEW_LAYER(ailayer_tanh_t);
+        return q7 ? ailayer_tanh_q7_default(layer, input_layer) : ailayer_tanh_f32_default(layer, input_layer);
+    } else if(strcmp(name, "softsign") == 0){
+        NEW_LAYER(ailayer_softsign_t);
+        return q7 ? ailayer_softsign_q7_default(layer, input_layer) : ailayer_softsign_f32_default(layer, input_layer);
+    } else if(strcmp(name, "softmax") == 0){
+        NEW_LAYER(ailayer_softmax_t);
+        return q7 ? ailayer_softmax_q7_default(layer, input_layer) : ailayer_softmax_f32_default(layer, input_layer);
+    } else if(strcmp(name, "lstm") == 0 && argc_layer >= 1){
+        NEW_LAYER(ailayer_lstm_t);
+        layer->units = args[0];
+        layer->return_sequences = ARG(1, 0);
+        return q7 ? ailayer_lstm_q7_default(layer, input_layer) : ailayer_lstm_f32_default(layer, input_layer);
+    } else if(strcmp(name, "gru") == 0 && argc_layer >= 1){
+        NEW_LAYER(ailayer_gru_t);
+        layer->units = args[0];
+        layer->return_sequences = ARG(1, 0);
+        return q7 ? ailayer_gru_q7_default(layer, input_layer) : ailayer_gru_f32_default(layer, input_layer);
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    int i;
+    uint8_t q7 = FALSE;
+    uint16_t batch_size = 1;
+    const char *optimizer_name = 0, *loss_name = "mse";
+    char *shape_text, *end;
+    uint16_t input_shape[MAX_INPUT_DIM];
+    uint8_t input_dim = 1;
+
+    aimodel_t model;
+    ailayer_input_t input_layer = {0};
+    ailayer_t *x;
+    aiopti_t *optimizer = 0;
+    aiopti_sgd_f32_t sgd = {0};
+    aiopti_adam_f32_t adam = {0};
+    ailoss_mse_f32_t mse_loss;
+    ailoss_crossentropy_f32_t crossentropy_loss;
+    aialgo_layer_footprint_t layer_footprints[MAX_LAYERS];
+    aialgo_model_footprint_t model_footprint;
+
+    // Options
+    for(i = 1; i < argc && strncmp(argv[i], "--", 2) == 0; i += 2){
+        if(i + 1 >= argc){
+            usage(argv[0]);
+            return 2;
+        }
+        if(strcmp(argv[i], "--dtype") == 0){
+            if(strcmp(argv[i + 1], "q7") == 0) q7 = TRUE;
+            else if(strcmp(argv[i + 1], "f32") != 0){ usage(argv[0]); return 2; }
+        } else if(strcmp(argv[i], "--batch") == 0){
+            batch_size = (uint16_t) atoi(argv[i + 1]);
+        } else if(strcmp(argv[i], "--optimizer") == 0){
+            optimizer_name = argv[i + 1];
+        } else if(strcmp(argv[i], "--loss") == 0){
+            loss_name = argv[i + 1];
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if(argc - i < 2 || batch_size == 0 || (q7 && optimizer_name != 0)){
+        usage(argv[0]);
+        return 2;
+    }
+
+    // Input shape
+    input_shape[0] = batch_size;
+    shape_text = argv[i++];
+    while(*shape_text != '\0' && input_dim < MAX_INPUT_DIM){
+        input_shape[input_dim++] = (uint16_t) strtol(shape_text, &end, 10);
+        if(end == shape_text || (*end != 'x' && *end != '\0')){
+            fprintf(stderr, "Invalid input shape: %s\n", argv[i - 1]);
+            return 2;
+        }
+        shape_text = *end == 'x' ? end + 1 : end;
+    }
+    input_layer.input_dim = input_dim;
+    input_layer.input_shape = input_shape;
+    model.input_layer = q7 ? ailayer_input_q7_default(&input_layer) : ailayer_input_f32_default(&input_layer);
+
+    // Layers
+    x = model.input_layer;
+    for(; i < argc; i++){
+        if(argc - i >= MAX_LAYERS){
+            fprintf(stderr, "Too many layers\n");
+            return 2;
+        }
+        x = create_layer(argv[i], q7, x);
+        if(x == 0){
+            fprintf(stderr, "Invalid or unsupported layer for this data type: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    model.output_layer = x;
+
+    // Loss and optimizer for the training analysis
+    if(optimizer_name != 0){
+        if(strcmp(loss_name, "crossentropy") == 0){
+            model.loss = ailoss_crossentropy_f32_default(&crossentropy_loss, model.output_layer);
+        } else {
+            model.loss = ailoss_mse_f32_default(&mse_loss, model.output_layer);
+        }
+
+        if(strcmp(optimizer_name, "sgd") == 0 || strcmp(optimizer_name, "sgd_momentum") == 0){
+            sgd.learning_rate = 0.01f;
+            sgd.momentum = strcmp(optimizer_name, "sgd_momentum") == 0 ? 0.9f : 0.0f;
+            optimizer = aiopti_sgd_f32_default(&sgd);
+        } else if(strcmp(optimizer_name, "adam") == 0){
+            adam.learning_rate = 0.001f;
+            adam.beta1 = 0.9f;
+            adam.beta2 = 0.999f;
+            adam.eps = 1e-7f;
+            optimizer = aiopti_adam_f32_default(&adam);
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    aialgo_compile_model(&model);
+    if(model.output_layer == 0){
+        fprintf(stderr, "Model could not be compiled\n");
+        return 1;
+    }
+
+    if(aialgo_analyze_footprint(&model, optimizer, layer_footprints, MAX_LAYERS, &model_footprint) != 0){
+        return 1;
+    }
+    aialgo_print_footprint_json(&model_footprint, layer_footprints);
+
+    return 0;
+}
@@ -0,0 +1,257 @@
+/**
+ * \file aifes_gradient_check.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Command line tool that checks the backward passes of the F32 layers with finite differences
+ * \details Every case builds a small model, calculates the gradients of all trainable parameters with
+ * aialgo_backward_model() and compares them with central differences of the loss. For build instructions refer to the README.md.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "aifes.h"
+
+// Console printing for the host
+static int print_string(const char *string){ return printf("%s", string); }
+static int print_int(const char *format, int var){ return printf(format, var); }
+static int print_uint(const char *format, unsigned int var){ return printf(format, var); }
+static int print_long_int(const char *format, long int var){ return printf(format, var); }
+static int print_float(const char *format, float var){ return printf(format, var); }
+
+int (*aiprint)(const char *string) = print_string;
+int (*aiprint_int)(const char *format, int var) = print_int;
+int (*aiprint_uint)(const char *format, unsigned int var) = print_uint;
+int (*aiprint_long_int)(const char *format, long int var) = print_long_int;
+int (*aiprint_float)(const char *format, float var) = print_float;
+
+#define EPSILON     1e-2f   // Step of the central differences
+#define TOLERANCE   2e-2f   // Allowed relative error (float precision of the loss)
+
+typedef struct gradcheck_model gradcheck_model_t;
+
+struct gradcheck_model {
+    aimodel_t model;
+    uint16_t input_shape[4];
+    uint8_t input_dim;
+    uint16_t target_shape[2];
+
+    ailayer_input_f32_t input_layer;
+    ailayer_depthwise_conv2d_f32_t depthwise_layer[2];
+    ailayer_global_avgpool2d_f32_t global_avgpool_layer;
+    ailayer_dense_f32_t dense_layer;
+    ailoss_mse_f32_t loss;
+};
+
+typedef struct {
+    const char *name;
+    void (*build)(gradcheck_model_t *m);
+} gradcheck_case_t;
+
+// Depthwise Conv2D (channels last) -> GlobalAvgPool2D -> Dense
+static void build_depthwise_hwc(gradcheck_model_t *m)
+{
+    ailayer_t *x;
+    uint16_t shape[] = {2, 5, 5, 2};
+
+    memcpy(m->input_shape, shape, sizeof(shape));
+    m->input_dim = 4;
+    m->input_layer = (ailayer_input_f32_t) AILAYER_INPUT_F32_A(4, m->input_shape);
+    m->depthwise_layer[0] = (ailayer_depthwise_conv2d_f32_t) AILAYER_DEPTHWISE_CONV2D_F32_A(2, HW(3, 3), HW(1, 1), HW(1, 1), HW(1, 1));
+    m->dense_layer = (ailayer_dense_f32_t) AILAYER_DENSE_F32_A(3);
+
+    m->model.input_layer = ailayer_input_f32_default(&m->input_layer);
+    x = ailayer_depthwise_conv2d_hwc_f32_default(&m->depthwise_layer[0], m->model.input_layer);
+    x = ailayer_global_avgpool2d_hwc_f32_default(&m->global_avgpool_layer, x);
+    m->model.output_layer = ailayer_dense_f32_default(&m->dense_layer, x);
+}
+
+// Depthwise Conv2D (channels first, stride 2, dilation 2) -> GlobalAvgPool2D -> Dense
+static void build_depthwise_chw(gradcheck_model_t *m)
+{
+    ailayer_t *x;
+    uint16_t shape[] = {2, 3, 7, 6};
+
+    memcpy(m->input_shape, shape, sizeof(shape));
+    m->input_dim = 4;
+    m->input_layer = (ailayer_input_f32_t) AILAYER_INPUT_F32_A(4, m->input_shape);
+    m->depthwise_layer[0] = (ailayer_depthwise_conv2d_f32_t) AILAYER_DEPTHWISE_CONV2D_F32_A(1, HW(3, 2), HW(2, 2), HW(2, 1), HW(1, 0));
+    m->dense_layer = (ailayer_dense_f32_t) AILAYER_DENSE_F32_A(2);
+
+    m->model.input_layer = ailayer_input_f32_default(&m->input_layer);
+    x = ailayer_depthwise_conv2d_chw_f32_default(&m->depthwise_layer[0], m->model.input_layer);
+    x = ailayer_global_avgpool2d_chw_f32_default(&m->global_avgpool_layer, x);
+    m->model.output_layer = ailayer_dense_f32_default(&m->dense_layer, x);
+}
+
+// Two Depthwise Conv2D layers (checks the input gradient of the second one) -> GlobalAvgPool2D -> Dense
+static void build_depthwise_stacked(gradcheck_model_t *m)
+{
+    ailayer_t *x;
+    uint16_t shape[] = {1, 6, 6, 2};
+
+    memcpy(m->input_shape, shape, sizeof(shape));
+    m->input_dim = 4;
+    m->input_layer = (ailayer_input_f32_t) AILAYER_INPUT_F32_A(4, m->input_shape);
+    m->depthwise_layer[0] = (ailayer_depthwise_conv2d_f32_t) AILAYER_DEPTHWISE_CONV2D_F32_A(2, HW(3, 3), HW(1, 1), HW(1, 1), HW(1, 1));
+    m->depthwise_layer[1] = (ailayer_depthwise_conv2d_f32_t) AILAYER_DEPTHWISE_CONV2D_F32_A(1, HW(3, 3), HW(2, 2), HW(1, 1), HW(0, 0));
+    m->dense_layer = (ailayer_dense_f32_t) AILAYER_DENSE_F32_A(2);
+
+    m->model.input_layer = ailayer_input_f32_default(&m->input_layer);
+    x = ailayer_depthwise_conv2d_hwc_f32_default(&m->depthwise_layer[0], m->model.input_layer);
+    x = ailayer_depthwise_conv2d_hwc_f32_default(&m->depthwise_layer[1], x);
+    x = ailayer_global_avgpool2d_hwc_f32_default(&m->global_avgpool_layer, x);
+    m->model.output_layer = ailayer_dense_f32_default(&m->dense_layer, x);
+}
+
+static const gradcheck_case_t cases[] = {
+    {"depthwise_conv2d_hwc", build_depthwise_hwc},
+    {"depthwise_conv2d_chw", build_depthwise_chw},
+    {"depthwise_conv2d_stacked", build_depthwise_stacked},
+};
+
+static float uniform(float min, float max)
+{
+    return min + (max - min) * ((float) rand() / (float) RAND_MAX);
+}
+
+static float calc_loss(aimodel_t *model, aitensor_t *input, aitensor_t *target)
+{
+    float loss;
+
+    aialgo_forward_model(model, input);
+    model->loss->calc_loss(model->loss, target, &loss);
+    return loss;
+}
+
+// Returns the number of gradient entries that differ more than the tolerance
+static uint32_t run_case(const gradcheck_case_t *c, int verbose)
+{
+    gradcheck_model_t m;
+    aiopti_sgd_f32_t sgd = AIOPTI_SGD_F32(0.0f);
+    aiopti_t *optimizer;
+    ailayer_t *layer_ptr;
+    aitensor_t input, target;
+    float *input_data, *target_data;
+    void *parameter_memory, *training_memory;
+    uint32_t parameter_memory_size, training_memory_size, i, j, k, elements, failures = 0;
+    uint16_t l;
+    float *param, *grad, saved, loss_plus, loss_minus, numeric, error, max_error;
+
+    memset(&m, 0, sizeof(m));
+    c->build(&m);
+    m.model.loss = ailoss_mse_sum_f32_default(&m.loss, m.model.output_layer);
+    aialgo_compile_model(&m.model);
+
+    parameter_memory_size = aialgo_sizeof_parameter_memory(&m.model);
+    parameter_memory = malloc(parameter_memory_size);
+    aialgo_distribute_parameter_memory(&m.model, parameter_memory, parameter_memory_size);
+    aialgo_initialize_parameters_model(&m.model);
+
+    optimizer = aiopti_sgd_f32_default(&sgd);
+    training_memory_size = aialgo_sizeof_training_memory(&m.model, optimizer);
+    training_memory = malloc(training_memory_size);
+    aialgo_schedule_training_memory(&m.model, optimizer, training_memory, training_memory_size);
+    aialgo_init_model_for_training(&m.model, optimizer);
+
+    elements = 1;
+    for(i = 0; i < m.input_dim; i++) elements *= m.input_shape[i];
+    input_data = malloc(elements * sizeof(float));
+    for(i = 0; i < elements; i++) input_data[i] = uniform(-1.0f, 1.0f);
+    input = (aitensor_t) {.dtype = aif32, .dim = m.input_dim, .shape = m.input_shape, .data = input_data};
+
+    m.target_shape[0] = m.model.output_layer->result.shape[0];
+    m.target_shape[1] = m.model.output_layer->result.shape[1];
+    target_data = malloc(m.target_shape[0] * m.target_shape[1] * sizeof(float));
+    for(i = 0; i < (uint32_t) m.target_shape[0] * m.target_shape[1]; i++) target_data[i] = uniform(-1.0f, 1.0f);
+    target = (aitensor_t) AITENSOR_2D_F32(m.target_shape, target_data);
+
+    // Analytic gradients
+    aialgo_zero_gradients_model(&m.model, optimizer);
+    aialgo_forward_model(&m.model, &input);
+    aialgo_backward_model(&m.model, &target);
+
+    // Numeric gradients of every trainable parameter
+    layer_ptr = m.model.input_layer;
+    for(l = 0; l < m.model.layer_count; l++){
+        for(j = 0; j < layer_ptr->trainable_params_count; j++){
+            param = (float *) layer_ptr->trainable_params[j]->data;
+            grad = (float *) layer_ptr->gradients[j]->data;
+            max_error = 0.0f;
+            for(k = 0; k < aimath_tensor_elements(layer_ptr->trainable_params[j]); k++){
+                saved = param[k];
+                param[k] = saved + EPSILON;
+                loss_plus = calc_loss(&m.model, &input, &target);
+                param[k] = saved - EPSILON;
+                loss_minus = calc_loss(&m.model, &input, &target);
+                param[k] = saved;
+
+                numeric = (loss_plus - loss_minus) / (2.0f * EPSILON);
+                error = fabsf(numeric - grad[k]) / fmaxf(1.0f, fmaxf(fabsf(numeric), fabsf(grad[k])));
+                if(error > max_error) max_error = error;
+                if(error > TOLERANCE){
+                    failures++;
+                    if(verbose){
+                        printf("  layer %u param %u [%u]: analytic %g, numeric %g\n", l, j, k, grad[k], numeric);
+                    }
+                }
+            }
+            printf("%s: layer %u (%s) param %u: max relative error %.2e\n", c->name, l,
+                   layer_ptr->layer_type->name != 0 ? layer_ptr->layer_type->name : "?", j, max_error);
+        }
+        layer_ptr = layer_ptr->output_layer;
+    }
+
+    free(target_data);
+    free(input_data);
+    free(training_memory);
+    free(parameter_memory);
+    return failures;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t i, failures, failed_cases = 0;
+    int verbose = 0;
+    const char *filter = 0;
+
+    for(i = 1; i < (uint32_t) argc; i++){
+        if(strcmp(argv[i], "--verbose") == 0){
+            verbose = 1;
+        } else if(strcmp(argv[i], "--filter") == 0 && i + 1 < (uint32_t) argc){
+            filter = argv[++i];
+        } else {
+            fprintf(stderr, "Usage: %s [--filter <text>] [--verbose]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    srand(1);
+    for(i = 0; i < sizeof(cases) / sizeof(cases[0]); i++){
+        if(filter != 0 && strstr(cases[i].name, filter) == 0){
+            continue;
+        }
+        failures = run_case(&cases[i], verbose);
+        if(failures > 0){
+            printf("%s: FAILED (%u gradient entries)\n", cases[i].name, failures);
+            failed_cases++;
+        }
+    }
+    printf("%s\n", failed_cases == 0 ? "All gradients match" : "Gradient check failed");
+    return failed_cases == 0 ? 0 : 1;
+}
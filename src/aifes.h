@@ -22,4 +22,6 @@
 // Include AIfES default modules here
 #include "aifes_config.h"
 #include "aifes_basic.h"
-#include "aifes_cnn.h"
\ No newline at end of file
+#include "aifes_cnn.h"
+#include "aifes_rnn.h"
+#include "aifes_basic_storage.h"
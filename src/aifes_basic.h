@@ -34,6 +34,8 @@ extern "C" {
 #include "basic/base/aimath/aimath_q31.h"
 #include "basic/base/aimath/aimath_q7.h"
 #include "basic/base/aimath/aimath_u8.h"
+#include "basic/base/aimath/aimath_palette.h"
+#include "basic/base/aimath/aimath_sparse.h"
 
 // Include basic datatype independent math functions
 #include "basic/base/aimath/aimath_basic.h"
@@ -78,6 +80,7 @@ extern "C" {
 #include "basic/default/ailayer/ailayer_tanh_default.h"
 #include "basic/default/ailayer/ailayer_softmax_default.h"
 #include "basic/default/ailayer/ailayer_softsign_default.h"
+#include "basic/default/ailayer/ailayer_q7_lut_default.h"
 
 // Include the losses in default implementation
 #include "basic/default/ailoss/ailoss_mse_default.h"
@@ -92,6 +95,15 @@ extern "C" {
 // Include the algorithmic
 #include "basic/base/aialgo/aialgo_sequential_inference.h"
 #include "basic/base/aialgo/aialgo_sequential_training.h"
+#include "basic/base/aialgo/aialgo_footprint.h"
+#include "basic/base/aialgo/aialgo_palettization.h"
+#include "basic/base/aialgo/aialgo_pruning.h"
+#include "basic/base/aialgo/aialgo_low_rank.h"
+#include "basic/base/aialgo/aialgo_classification.h"
+#include "basic/base/aialgo/aialgo_snapshot.h"
+#include "basic/base/aialgo/aialgo_kernel_tuning.h"
+#include "basic/base/aialgo/aialgo_profiling.h"
+#include "basic/default/aialgo/aialgo_kernels_default.h"
 
 // ---------------------------- AIfES express -----------------------
 
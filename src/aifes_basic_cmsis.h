@@ -35,6 +35,9 @@ extern "C" {
 // Include the layers in cmsis implementation
 #include "basic/cmsis/ailayer/ailayer_dense_cmsis.h"
 
+// Include the algorithmic in cmsis implementation
+#include "basic/cmsis/aialgo/aialgo_kernels_cmsis.h"
+
 #ifdef __cplusplus
 } // End extern "C"
 #endif
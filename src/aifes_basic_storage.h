@@ -0,0 +1,49 @@
+/**
+ * \file basic/aifes_basic_storage.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Include all headers of the AIfES 2 basic module with parameter storage implementations
+ *
+ * The layers of this module read their parameters through a \link aimath_storage.h parameter storage accessor \endlink
+ * (direct pointer, accessor callback or page-cached reader) instead of direct RAM access.
+ */
+
+#ifndef AIFES_BASIC_STORAGE_H
+#define AIFES_BASIC_STORAGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Include the parameter storage accessor and backends
+#include "basic/storage/aimath/aimath_storage.h"
+#include "basic/storage/aimath/aimath_storage_posix.h"
+
+// Include the math in storage implementation
+#include "basic/storage/aimath/aimath_f32_storage.h"
+#include "basic/storage/aimath/aimath_q7_storage.h"
+
+// Include the layers in storage implementation
+#include "basic/storage/ailayer/ailayer_dense_storage.h"
+
+#ifdef __cplusplus
+} // End extern "C"
+#endif
+
+#endif // AIFES_BASIC_STORAGE_H
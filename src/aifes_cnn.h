@@ -29,23 +29,42 @@ extern "C" {
 #endif
 
 // Include the layer base implementations
+#include "cnn/base/ailayer/ailayer_conv1d.h"
 #include "cnn/base/ailayer/ailayer_conv2d.h"
+#include "cnn/base/ailayer/ailayer_depthwise_conv2d.h"
 #include "cnn/base/ailayer/ailayer_reshape.h"
+#include "cnn/base/ailayer/ailayer_maxpool1d.h"
 #include "cnn/base/ailayer/ailayer_maxpool2d.h"
+#include "cnn/base/ailayer/ailayer_avgpool1d.h"
+#include "cnn/base/ailayer/ailayer_avgpool2d.h"
+#include "cnn/base/ailayer/ailayer_global_avgpool2d.h"
 #include "cnn/base/ailayer/ailayer_batch_normalization.h"
 
+// Include the algorithmic
+#include "cnn/base/aialgo/aialgo_streaming.h"
+
 // ---------------------------- Module default implementations -----------------------
 // (Fallback functions if no hardware optimized implementation available)
 
 // Include the math in default implementation
 #include "cnn/default/aimath/aimath_cnn_f32_default.h"
+#include "cnn/default/aimath/aimath_cnn_q7_default.h"
 
 // Include the layers in default implementation
+#include "cnn/default/ailayer/ailayer_conv1d_default.h"
 #include "cnn/default/ailayer/ailayer_conv2d_default.h"
+#include "cnn/default/ailayer/ailayer_depthwise_conv2d_default.h"
 #include "cnn/default/ailayer/ailayer_reshape_default.h"
+#include "cnn/default/ailayer/ailayer_maxpool1d_default.h"
 #include "cnn/default/ailayer/ailayer_maxpool2d_default.h"
+#include "cnn/default/ailayer/ailayer_avgpool1d_default.h"
+#include "cnn/default/ailayer/ailayer_avgpool2d_default.h"
+#include "cnn/default/ailayer/ailayer_global_avgpool2d_default.h"
 #include "cnn/default/ailayer/ailayer_batch_normalization_default.h"
 
+// Include the algorithmic in default implementation
+#include "cnn/default/aialgo/aialgo_cnn_kernels_default.h"
+
 
 #ifdef __cplusplus
 } // End extern "C"
@@ -48,9 +48,13 @@
 #       endif
 #   endif
 #endif // __AVR__
+#if defined __unix__ || defined __APPLE__
+#   define AIFES_WITH_POSIX_STORAGE   /**< File and mmap backed parameter storage (see aimath_storage_posix.h) */
+#endif // __unix__
 
 #define AIDEBUG_SHAPE_CHECKS /**< Enable checking for tensor shapes before performing math operations on them */
 #define AIDEBUG_GENERAL_CHECKS /**< Enable general checks for all kind of situations */
+//#define AIFES_WITH_PROFILING /**< Enable the per-layer profiling hooks in the forward, backward and update loops (see aialgo_profiling.h) */
 
 #define AIFES_MEMORY_ALIGNMENT  sizeof(int) /** Set the memory alignment size used by AIfES functions when distributing or calculating memory */
 #define AIFES_ALIGN_INTEGER(variable, alignment)  while(variable % alignment != 0) variable ++		/** Define the code to align a variable in memory (e.g. a pointer) to the given size */
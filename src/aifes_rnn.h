@@ -0,0 +1,52 @@
+/**
+ * \file rnn/aifes_rnn.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Include all headers of the aifes 2 - rnn module
+ * \details
+ */
+
+#ifndef AIFES_RNN_H
+#define AIFES_RNN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Include the layer base implementations
+#include "rnn/base/ailayer/ailayer_lstm.h"
+#include "rnn/base/ailayer/ailayer_gru.h"
+
+// ---------------------------- Module default implementations -----------------------
+// (Fallback functions if no hardware optimized implementation available)
+
+// Include the math in default implementation
+#include "rnn/default/aimath/aimath_rnn_f32_default.h"
+#include "rnn/default/aimath/aimath_rnn_q7_default.h"
+
+// Include the layers in default implementation
+#include "rnn/default/ailayer/ailayer_lstm_default.h"
+#include "rnn/default/ailayer/ailayer_gru_default.h"
+
+
+#ifdef __cplusplus
+} // End extern "C"
+#endif
+
+#endif // AIFES_RNN_H
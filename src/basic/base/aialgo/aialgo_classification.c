@@ -0,0 +1,183 @@
+/**
+ * \file basic/base/aialgo/aialgo_classification.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+#include "basic/base/aialgo/aialgo_classification.h"
+#include <math.h>
+
+AISTRING_STORAGE_WRAPPER(aistring_error_classify_model_1, "[aialgo_classify_model] Error: Number of samples must be dividable by the input layer batch size.\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_classify_model_2, "[aialgo_classify_model] Error: k must be between 1 and the number of classes.\n");
+
+static uint8_t aialgo_is_monotonic_activation(const ailayer_t *layer)
+{
+    return layer->layer_type == ailayer_softmax_type
+        || layer->layer_type == ailayer_sigmoid_type
+        || layer->layer_type == ailayer_tanh_type
+        || layer->layer_type == ailayer_softsign_type
+        || layer->layer_type == ailayer_leaky_relu_type
+        || layer->layer_type == ailayer_elu_type;
+}
+
+ailayer_t *aialgo_get_logits_layer(aimodel_t *model)
+{
+    ailayer_t *layer_ptr = model->output_layer;
+
+    while(layer_ptr != model->input_layer && aialgo_is_monotonic_activation(layer_ptr)){
+        layer_ptr = layer_ptr->input_layer;
+    }
+    return layer_ptr;
+}
+
+// Logit as integer (Q7, Q31) for the comparison in the integer domain
+static int32_t aialgo_logit_int(const aitensor_t *logits, uint32_t index)
+{
+    if(logits->dtype == aiq7){
+        return ((int8_t *) logits->data)[index];
+    }
+    return ((int32_t *) logits->data)[index];
+}
+
+static float aialgo_logit_f32(const aitensor_t *logits, uint32_t index)
+{
+    if(logits->dtype == aif32){
+        return ((float *) logits->data)[index];
+    } else if(logits->dtype == aiq7){
+        return Q7_TO_FLOAT(((int8_t *) logits->data)[index],
+                           ((aimath_q7_params_t *) logits->tensor_params)->shift,
+                           ((aimath_q7_params_t *) logits->tensor_params)->zero_point);
+    }
+    return Q31_TO_FLOAT(((int32_t *) logits->data)[index],
+                        ((aimath_q31_params_t *) logits->tensor_params)->shift,
+                        ((aimath_q31_params_t *) logits->tensor_params)->zero_point);
+}
+
+static uint8_t aialgo_logit_greater(const aitensor_t *logits, uint32_t index_a, uint32_t index_b)
+{
+    if(logits->dtype == aif32){
+        return ((float *) logits->data)[index_a] > ((float *) logits->data)[index_b];
+    }
+    return aialgo_logit_int(logits, index_a) > aialgo_logit_int(logits, index_b);
+}
+
+uint8_t aialgo_classify_model(aimodel_t *model, aitensor_t *input_data, uint16_t k, uint16_t *indices, float *confidences)
+{
+    uint32_t i, j, n, sample_offset;
+    uint16_t c, p, class_count;
+    uint16_t batch_size = input_data->shape[0];
+    uint16_t batch_slice_size = model->input_layer->result.shape[0];
+    ailayer_t *logits_layer = aialgo_get_logits_layer(model);
+    ailayer_t *layer_ptr;
+    aitensor_t *logits = &logits_layer->result;
+    uint16_t *top;
+    float value, logit, sum;
+    const aicore_layertype_t *activation_type = 0;
+
+    if(batch_size % batch_slice_size != 0){
+        AILOG_E(aistring_error_classify_model_1);
+        return 1;
+    }
+
+    class_count = (uint16_t) (aimath_tensor_elements(logits) / logits->shape[0]);
+    if(k == 0 || k > class_count){
+        AILOG_E(aistring_error_classify_model_2);
+        return 1;
+    }
+
+    // The confidence is the skipped activation if it is a single Sigmoid, Tanh or Softsign layer, otherwise the softmax of the logits
+    if(logits_layer->output_layer == model->output_layer && logits_layer != model->output_layer){
+        activation_type = model->output_layer->layer_type;
+    }
+
+    uint16_t input_batch_shape[input_data->dim];
+    aitensor_t input_batch = {
+        .dtype = input_data->dtype,
+        .shape = input_batch_shape,
+        .dim = input_data->dim,
+        .tensor_params = input_data->tensor_params
+    };
+
+    uint32_t input_multiplier = 1;
+    for(i = input_data->dim - 1; i > 0; i--)
+    {
+        input_multiplier *= input_data->shape[i];
+        input_batch_shape[i] = input_data->shape[i];
+    }
+    input_batch_shape[0] = batch_slice_size;
+
+    aialgo_set_training_mode_model(model, FALSE);
+    aialgo_set_batch_mode_model(model, FALSE);
+
+    for(i = 0; i < batch_size / batch_slice_size; i++)
+    {
+        input_batch.data = input_data->data + i * batch_slice_size * input_multiplier * input_data->dtype->size;
+
+        // Forward pass up to the logits layer
+        model->input_layer->result.data = input_batch.data;
+        layer_ptr = model->input_layer;
+        while(1){
+            layer_ptr->forward(layer_ptr);
+            if(layer_ptr == logits_layer) break;
+            layer_ptr = layer_ptr->output_layer;
+        }
+
+        for(n = 0; n < batch_slice_size; n++)
+        {
+            sample_offset = n * class_count;
+            top = &indices[(i * batch_slice_size + n) * k];
+
+            // Top-k selection by insertion into the sorted list
+            for(c = 0; c < class_count; c++){
+                if(c >= k && !aialgo_logit_greater(logits, sample_offset + c, sample_offset + top[k - 1])){
+                    continue;
+                }
+                p = c < k ? c : k - 1;
+                while(p > 0 && aialgo_logit_greater(logits, sample_offset + c, sample_offset + top[p - 1])){
+                    top[p] = top[p - 1];
+                    p--;
+                }
+                top[p] = c;
+            }
+
+            if(confidences == 0){
+                continue;
+            }
+            for(j = 0; j < k; j++){
+                logit = aialgo_logit_f32(logits, sample_offset + top[j]);
+                if(activation_type == ailayer_sigmoid_type){
+                    value = 1.0f / (1.0f + expf(-logit));
+                } else if(activation_type == ailayer_tanh_type){
+                    value = tanhf(logit);
+                } else if(activation_type == ailayer_softsign_type){
+                    value = logit / (1.0f + fabsf(logit));
+                } else {
+                    // Softmax output layer, and the fallback for outputs that are no probability (e.g. ELU, Leaky ReLU or no activation)
+                    sum = 0.0f;
+                    for(c = 0; c < class_count; c++){
+                        sum += expf(aialgo_logit_f32(logits, sample_offset + c) - logit);
+                    }
+                    value = 1.0f / sum;
+                }
+                confidences[(i * batch_slice_size + n) * k + j] = value;
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * \file basic/base/aialgo/aialgo_classification.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Classification fast path: Top-k class indices without evaluating the output activation
+ * \details For an inference-only classification, often only the index of the winning class is needed.
+ * Strictly monotonic output activations (Softmax, Sigmoid, Tanh, Softsign, Leaky ReLU and ELU) don't change the order
+ * of the values, so aialgo_classify_model() stops the forward pass at the last layer before these activations
+ * (usually the logits of a Dense layer) and selects the top-k classes directly from the logits.
+ * For \link aimath_q7.h Q7 \endlink and \link aimath_q31.h Q31 \endlink models, the comparison is done in the integer domain.
+ *
+ * Optionally a confidence is calculated only for the top-k classes (see aialgo_classify_model()).
+ */
+
+#ifndef AIALGO_CLASSIFICATION
+#define AIALGO_CLASSIFICATION
+
+#include "core/aifes_core.h"
+#include "core/aifes_math.h"
+#include "basic/base/aimath/aimath_basic.h"
+#include "basic/base/aimath/aimath_f32.h"
+#include "basic/base/aimath/aimath_q31.h"
+#include "basic/base/aimath/aimath_q7.h"
+#include "basic/base/aialgo/aialgo_sequential_inference.h"
+#include "basic/base/ailayer/ailayer_softmax.h"
+#include "basic/base/ailayer/ailayer_sigmoid.h"
+#include "basic/base/ailayer/ailayer_tanh.h"
+#include "basic/base/ailayer/ailayer_softsign.h"
+#include "basic/base/ailayer/ailayer_leaky_relu.h"
+#include "basic/base/ailayer/ailayer_elu.h"
+
+/** @brief Get the layer that computes the logits of the model
+ *
+ * Skips all strictly monotonic activation layers at the end of the model.
+ *
+ * @param *model    The model
+ * @return          The last layer that is not a trailing monotonic activation (the output layer if there is none)
+ */
+ailayer_t *aialgo_get_logits_layer(aimodel_t *model);
+
+/** @brief Perform a classification on the model and return the indices of the top-k classes
+ *
+ * The forward pass is only calculated up to the logits layer (aialgo_get_logits_layer()), the trailing monotonic
+ * activations are skipped. The indices of every sample are sorted descending by the logit value (ties: lower index first).
+ *
+ * If confidences is not 0, a confidence is calculated for the top-k classes of every sample: If exactly one layer
+ * was skipped and it is a Sigmoid, Tanh or Softsign layer, this is the output of this activation for the class.
+ * In all other cases (Softmax, ELU or Leaky ReLU output layer, no or several trailing activations) it is the
+ * softmax of the (dequantized) logits \f$ 1 / \sum_j e^{l_j - l_i} \f$ (without a division per logit),
+ * so unbounded outputs like ELU or Leaky ReLU also get a confidence in [0, 1].
+ *
+ * Make sure to initialize the model (aialgo_compile_model()) and schedule the inference memory before calling this function.
+ *
+ * Example:
+ * \code{.c}
+ * float input_data[4*3] = {...};
+ * uint16_t input_shape[] = {4, 3};
+ * aitensor_t input_tensor = AITENSOR_2D_F32(input_shape, input_data);
+ *
+ * uint16_t classes[4*2];
+ * float confidences[4*2];
+ * aialgo_classify_model(&model, &input_tensor, 2, classes, confidences);
+ * // classes[2*i] is the winning class of sample i with the confidence confidences[2*i]
+ * \endcode
+ *
+ * @param *model         The model
+ * @param *input_data    Input data tensor (the first dimension is the number of samples N)
+ * @param k              Number of classes to return per sample
+ * @param *indices       Array for the class indices [N x k] (output)
+ * @param *confidences   Array for the confidences [N x k] (output, optional - 0 to skip the calculation)
+ * @return               0 if successful, 1 on invalid batch size or k
+ */
+uint8_t aialgo_classify_model(aimodel_t *model, aitensor_t *input_data, uint16_t k, uint16_t *indices, float *confidences);
+
+#endif // AIALGO_CLASSIFICATION
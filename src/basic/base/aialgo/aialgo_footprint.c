@@ -0,0 +1,275 @@
+/**
+ * \file basic/base/aialgo/aialgo_footprint.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+#include "basic/base/aialgo/aialgo_footprint.h"
+
+AISTRING_STORAGE_WRAPPER(aistring_error_footprint_1, "[aialgo_analyze_footprint] Error: The layer footprint array is too small.\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_footprint_2, "[aialgo_analyze_footprint] Error: The loss must be set for the training analysis.\n");
+
+// Returns the size of an allocation including the alignment padding and adds the padding to the counter
+static uint32_t aligned_size(uint32_t size, uint32_t *padding)
+{
+    uint32_t aligned = size;
+
+    AIFES_ALIGN_INTEGER(aligned, AIFES_MEMORY_ALIGNMENT);
+    *padding += aligned - size;
+    return aligned;
+}
+
+uint8_t aialgo_analyze_footprint(aimodel_t *model,
+                                 aiopti_t *optimizer,
+                                 aialgo_layer_footprint_t *layer_footprints,
+                                 uint16_t layer_footprints_count,
+                                 aialgo_model_footprint_t *model_footprint)
+{
+    uint16_t i, j;
+    uint32_t live_bytes;
+    uint8_t frozen_prefix = TRUE;
+    ailayer_t *layer_ptr, *consumer_ptr;
+    ailayer_t *first_trainable_layer;
+    aialgo_layer_footprint_t *fp;
+
+    if(layer_footprints_count < model->layer_count){
+        AILOG_E(aistring_error_footprint_1);
+        return 1;
+    }
+    if(optimizer != 0 && model->output_layer->output_layer == 0){
+        AILOG_E(aistring_error_footprint_2);
+        return 1;
+    }
+
+    first_trainable_layer = aialgo_get_first_trainable_layer(model);
+
+    model_footprint->layer_count = model->layer_count;
+    model_footprint->alignment = AIFES_MEMORY_ALIGNMENT;
+    model_footprint->max_fwd_scratch_bytes = 0;
+    model_footprint->max_bwd_scratch_bytes = 0;
+    model_footprint->padding_bytes = 0;
+    model_footprint->macs = 0;
+
+    layer_ptr = model->input_layer;
+    for(i = 0; i < model->layer_count; i++)
+    {
+        fp = &layer_footprints[i];
+        if(layer_ptr == first_trainable_layer){
+            frozen_prefix = FALSE;
+        }
+
+        layer_ptr->calc_result_shape(layer_ptr);
+
+        fp->layer = layer_ptr;
+        fp->inference_padding_bytes = 0;
+        fp->training_padding_bytes = 0;
+
+        // Tensor parameters of the result (in the parameter memory or, if predefined by the layer, in the inference / training memory)
+        fp->result_params_bytes = layer_ptr->result.dtype->tensor_params_size;
+        aligned_size(fp->result_params_bytes, &fp->inference_padding_bytes);
+
+        fp->parameter_bytes = layer_ptr->sizeof_paramem != 0 ? layer_ptr->sizeof_paramem(layer_ptr) : 0;
+        aligned_size(fp->parameter_bytes, &fp->inference_padding_bytes);
+
+        // Intermediate results
+        if(AILAYER_SETTINGS_IS(layer_ptr->settings, 0b1, AILAYER_SETTINGS_KEEP_INPUT_BUFFER_FOR_RESULT)){
+            fp->activation_bytes = 0;
+        } else {
+            fp->activation_bytes = aimath_sizeof_tensor_data(&(layer_ptr->result));
+            aligned_size(fp->activation_bytes, &fp->inference_padding_bytes);
+        }
+
+        // Lifetime of the result in the inference: Follow the layers that reuse the buffer of their input
+        fp->activation_first_layer = i;
+        fp->activation_last_layer = i;
+        consumer_ptr = layer_ptr->output_layer;
+        for(j = i + 1; j < model->layer_count && consumer_ptr != 0; j++){
+            fp->activation_last_layer = j;
+            if(!AILAYER_SETTINGS_IS(consumer_ptr->settings, 0b1, AILAYER_SETTINGS_KEEP_INPUT_BUFFER_FOR_RESULT)){
+                break;
+            }
+            consumer_ptr = consumer_ptr->output_layer;
+        }
+
+        // Scratch memory
+        fp->fwd_scratch_bytes = layer_ptr->sizeof_fwdmem != 0 ? layer_ptr->sizeof_fwdmem(layer_ptr) : 0;
+        fp->bwd_scratch_bytes = (optimizer != 0 && layer_ptr->sizeof_bwdmem != 0 && !frozen_prefix) ? layer_ptr->sizeof_bwdmem(layer_ptr) : 0;
+        if(fp->fwd_scratch_bytes > model_footprint->max_fwd_scratch_bytes) model_footprint->max_fwd_scratch_bytes = fp->fwd_scratch_bytes;
+        if(fp->bwd_scratch_bytes > model_footprint->max_bwd_scratch_bytes) model_footprint->max_bwd_scratch_bytes = fp->bwd_scratch_bytes;
+
+        // Training memory (same allocations as in aialgo_schedule_training_memory())
+        fp->gradient_bytes = 0;
+        fp->optimizer_bytes = 0;
+        if(optimizer != 0){
+            if(layer_ptr->calc_result_tensor_params != 0){
+                aligned_size(fp->result_params_bytes, &fp->training_padding_bytes);
+            }
+            if(fp->activation_bytes != 0){
+                aligned_size(fp->activation_bytes, &fp->training_padding_bytes);
+            }
+            if(layer_ptr->output_layer->deltas.dtype != 0 && !frozen_prefix){
+                aligned_size(layer_ptr->output_layer->deltas.dtype->tensor_params_size, &fp->training_padding_bytes);
+            }
+            if(layer_ptr->sizeof_trainmem != 0){
+                fp->gradient_bytes = layer_ptr->sizeof_trainmem(layer_ptr);
+                aligned_size(fp->gradient_bytes, &fp->training_padding_bytes);
+            }
+            if(optimizer->sizeof_optimem != 0 && AILAYER_SETTINGS_IS(layer_ptr->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)){
+                for(j = 0; j < layer_ptr->trainable_params_count; j++){
+                    fp->optimizer_bytes += aligned_size(optimizer->sizeof_optimem(optimizer, layer_ptr->trainable_params[j]), &fp->training_padding_bytes);
+                }
+            }
+        }
+
+        fp->macs = layer_ptr->layer_type->count_macs != 0 ? layer_ptr->layer_type->count_macs(layer_ptr) : 0;
+
+        model_footprint->padding_bytes += fp->inference_padding_bytes + fp->training_padding_bytes;
+        model_footprint->macs += fp->macs;
+
+        layer_ptr = layer_ptr->output_layer;
+    }
+
+    // Largest sum of the activations that are alive at the same time (while layer i is calculated)
+    model_footprint->peak_activation_bytes = 0;
+    for(i = 0; i < model->layer_count; i++){
+        live_bytes = 0;
+        for(j = 0; j <= i; j++){
+            if(layer_footprints[j].activation_last_layer >= i){
+                live_bytes += layer_footprints[j].activation_bytes;
+            }
+        }
+        if(live_bytes > model_footprint->peak_activation_bytes) model_footprint->peak_activation_bytes = live_bytes;
+    }
+
+    model_footprint->parameter_memory = aialgo_sizeof_parameter_memory(model);
+    model_footprint->inference_memory = aialgo_sizeof_inference_memory(model);
+    model_footprint->training_memory = optimizer != 0 ? aialgo_sizeof_training_memory(model, optimizer) : 0;
+
+    return 0;
+}
+
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_1, "{\n  \"alignment\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_2, ",\n  \"parameter_memory\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_3, ",\n  \"inference_memory\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_4, ",\n  \"training_memory\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_5, ",\n  \"peak_activation_bytes\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_6, ",\n  \"max_fwd_scratch_bytes\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_7, ",\n  \"max_bwd_scratch_bytes\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_8, ",\n  \"padding_bytes\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_9, ",\n  \"macs\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_10, ",\n  \"layers\": [");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_11, "\n    {\"index\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_12, ", \"type\": \"");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_13, "\", \"dtype\": \"");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_14, "\", \"shape\": [");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_15, ", ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_16, "],\n     \"parameter_bytes\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_17, ", \"result_params_bytes\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_18, ", \"activation_bytes\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_19, ", \"activation_lifetime\": [");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_20, "],\n     \"fwd_scratch_bytes\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_21, ", \"bwd_scratch_bytes\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_22, ", \"gradient_bytes\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_23, ", \"optimizer_bytes\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_24, ",\n     \"inference_padding_bytes\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_25, ", \"training_padding_bytes\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_26, ", \"macs\": ");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_27, "}");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_28, ",");
+AISTRING_STORAGE_WRAPPER(aistring_footprint_json_29, "\n  ]\n}\n");
+
+void aialgo_print_footprint_json(const aialgo_model_footprint_t *model_footprint, const aialgo_layer_footprint_t *layer_footprints)
+{
+    uint16_t i, j;
+    const aialgo_layer_footprint_t *fp;
+
+    AIPRINT(aistring_footprint_json_1);
+    AIPRINT_LONG_INT("%ld", (long int) model_footprint->alignment);
+    AIPRINT(aistring_footprint_json_2);
+    AIPRINT_LONG_INT("%ld", (long int) model_footprint->parameter_memory);
+    AIPRINT(aistring_footprint_json_3);
+    AIPRINT_LONG_INT("%ld", (long int) model_footprint->inference_memory);
+    AIPRINT(aistring_footprint_json_4);
+    AIPRINT_LONG_INT("%ld", (long int) model_footprint->training_memory);
+    AIPRINT(aistring_footprint_json_5);
+    AIPRINT_LONG_INT("%ld", (long int) model_footprint->peak_activation_bytes);
+    AIPRINT(aistring_footprint_json_6);
+    AIPRINT_LONG_INT("%ld", (long int) model_footprint->max_fwd_scratch_bytes);
+    AIPRINT(aistring_footprint_json_7);
+    AIPRINT_LONG_INT("%ld", (long int) model_footprint->max_bwd_scratch_bytes);
+    AIPRINT(aistring_footprint_json_8);
+    AIPRINT_LONG_INT("%ld", (long int) model_footprint->padding_bytes);
+    AIPRINT(aistring_footprint_json_9);
+    AIPRINT_LONG_INT("%ld", (long int) model_footprint->macs);
+    AIPRINT(aistring_footprint_json_10);
+
+    for(i = 0; i < model_footprint->layer_count; i++){
+        fp = &layer_footprints[i];
+
+        AIPRINT(aistring_footprint_json_11);
+        AIPRINT_LONG_INT("%ld", (long int) i);
+        AIPRINT(aistring_footprint_json_12);
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+        if(fp->layer->layer_type->name != 0){
+            AIPRINT(fp->layer->layer_type->name);
+        }
+#endif
+        AIPRINT(aistring_footprint_json_13);
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+        if(fp->layer->result.dtype->name != 0){
+            AIPRINT(fp->layer->result.dtype->name);
+        }
+#endif
+        AIPRINT(aistring_footprint_json_14);
+        for(j = 0; j < fp->layer->result.dim; j++){
+            if(j > 0){
+                AIPRINT(aistring_footprint_json_15);
+            }
+            AIPRINT_LONG_INT("%ld", (long int) fp->layer->result.shape[j]);
+        }
+        AIPRINT(aistring_footprint_json_16);
+        AIPRINT_LONG_INT("%ld", (long int) fp->parameter_bytes);
+        AIPRINT(aistring_footprint_json_17);
+        AIPRINT_LONG_INT("%ld", (long int) fp->result_params_bytes);
+        AIPRINT(aistring_footprint_json_18);
+        AIPRINT_LONG_INT("%ld", (long int) fp->activation_bytes);
+        AIPRINT(aistring_footprint_json_19);
+        AIPRINT_LONG_INT("%ld", (long int) fp->activation_first_layer);
+        AIPRINT(aistring_footprint_json_15);
+        AIPRINT_LONG_INT("%ld", (long int) fp->activation_last_layer);
+        AIPRINT(aistring_footprint_json_20);
+        AIPRINT_LONG_INT("%ld", (long int) fp->fwd_scratch_bytes);
+        AIPRINT(aistring_footprint_json_21);
+        AIPRINT_LONG_INT("%ld", (long int) fp->bwd_scratch_bytes);
+        AIPRINT(aistring_footprint_json_22);
+        AIPRINT_LONG_INT("%ld", (long int) fp->gradient_bytes);
+        AIPRINT(aistring_footprint_json_23);
+        AIPRINT_LONG_INT("%ld", (long int) fp->optimizer_bytes);
+        AIPRINT(aistring_footprint_json_24);
+        AIPRINT_LONG_INT("%ld", (long int) fp->inference_padding_bytes);
+        AIPRINT(aistring_footprint_json_25);
+        AIPRINT_LONG_INT("%ld", (long int) fp->training_padding_bytes);
+        AIPRINT(aistring_footprint_json_26);
+        AIPRINT_LONG_INT("%ld", (long int) fp->macs);
+        AIPRINT(aistring_footprint_json_27);
+        if(i + 1 < model_footprint->layer_count){
+            AIPRINT(aistring_footprint_json_28);
+        }
+    }
+    AIPRINT(aistring_footprint_json_29);
+}
@@ -0,0 +1,120 @@
+/**
+ * \file basic/base/aialgo/aialgo_footprint.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Static analysis of the memory footprint and the computational cost of a model
+ * \details aialgo_sizeof_parameter_memory(), aialgo_sizeof_inference_memory() and aialgo_sizeof_training_memory()
+ * return the total memory sizes of a model. The footprint analysis breaks these sizes down per layer and reports
+ * - the parameter bytes (weights, biases, states; RAM or flash if the parameters are stored as constants),
+ * - the bytes and the lifetime of the intermediate results (activations),
+ * - the forward and backward scratch memory,
+ * - the gradient and optimizer state bytes,
+ * - the padding bytes that are wasted by the memory alignment (AIFES_ALIGN_INTEGER with AIFES_MEMORY_ALIGNMENT) and
+ * - the number of multiply-accumulate operations (MACs) of a forward pass (see aicore_layertype.count_macs).
+ *
+ * The analysis does not execute the model and needs no parameter, inference or training memory.
+ * aialgo_print_footprint_json() prints the report as JSON, for example to track the model budget in a continuous integration
+ * or to select the smallest suitable target. A command line tool for the host is provided in etc/tools/footprint.
+ *
+ * Example:
+ * \code{.c}
+ * // Model is compiled (aialgo_compile_model()) and the loss is set (only required for the training analysis)
+ * aialgo_layer_footprint_t layer_footprints[10];
+ * aialgo_model_footprint_t model_footprint;
+ *
+ * aialgo_analyze_footprint(&model, optimizer, layer_footprints, 10, &model_footprint);
+ * aialgo_print_footprint_json(&model_footprint, layer_footprints);
+ * \endcode
+ */
+
+#ifndef AIALGO_FOOTPRINT
+#define AIALGO_FOOTPRINT
+
+#include "core/aifes_core.h"
+#include "core/aifes_math.h"
+#include "basic/base/aimath/aimath_basic.h"
+#include "basic/base/aialgo/aialgo_sequential_inference.h"
+#include "basic/base/aialgo/aialgo_sequential_training.h"
+
+typedef struct aialgo_layer_footprint aialgo_layer_footprint_t;
+typedef struct aialgo_model_footprint aialgo_model_footprint_t;
+
+/** @brief Footprint of a single layer
+ *
+ * All sizes are given in bytes without the alignment padding (the padding is reported separately).
+ */
+struct aialgo_layer_footprint {
+    const ailayer_t *layer; /**< The analyzed layer. */
+    uint32_t parameter_bytes; /**< Parameter memory of the layer (sizeof_paramem(), e.g. weights, biases and states). */
+    uint32_t result_params_bytes; /**< Tensor parameters of the result (e.g. Q7 shift and zero point). */
+    uint32_t activation_bytes; /**< Data of the result tensor. 0 if the layer reuses the buffer of its input (e.g. Flatten). */
+    uint16_t activation_first_layer; /**< Index of the layer that writes the result (the layer itself). */
+    uint16_t activation_last_layer; /**< Index of the last layer that reads the result in the inference (consumers that reuse the buffer are followed). */
+    uint32_t fwd_scratch_bytes; /**< Temporary memory of the forward pass (sizeof_fwdmem()). */
+    uint32_t bwd_scratch_bytes; /**< Temporary memory of the backward pass (sizeof_bwdmem()). 0 without optimizer or if no backward pass is required for the layer. */
+    uint32_t gradient_bytes; /**< Training memory of the layer (sizeof_trainmem(), gradients and training caches). */
+    uint32_t optimizer_bytes; /**< Optimizer state of the trainable parameters (e.g. momentums). 0 without optimizer. */
+    uint32_t inference_padding_bytes; /**< Alignment padding of the allocations of the layer in the parameter and inference memory. */
+    uint32_t training_padding_bytes; /**< Alignment padding of the allocations of the layer in the training memory. 0 without optimizer. */
+    uint32_t macs; /**< Multiply-accumulate operations of one forward pass. 0 if not available for the layer type. */
+};
+
+/** @brief Footprint summary of a model
+ */
+struct aialgo_model_footprint {
+    uint16_t layer_count; /**< Number of layers of the model. */
+    uint16_t alignment; /**< The memory alignment (AIFES_MEMORY_ALIGNMENT). */
+    uint32_t parameter_memory; /**< Size of the parameter memory (aialgo_sizeof_parameter_memory()). */
+    uint32_t inference_memory; /**< Size of the inference memory (aialgo_sizeof_inference_memory()). */
+    uint32_t training_memory; /**< Size of the training memory (aialgo_sizeof_training_memory()). 0 without optimizer. */
+    uint32_t peak_activation_bytes; /**< Maximum of the activation bytes that are alive at the same time during the inference (lower bound for the result buffers). */
+    uint32_t max_fwd_scratch_bytes; /**< Largest forward scratch memory of all layers. */
+    uint32_t max_bwd_scratch_bytes; /**< Largest backward scratch memory of all layers. */
+    uint32_t padding_bytes; /**< Alignment padding of all layers (inference and training). */
+    uint32_t macs; /**< Multiply-accumulate operations of one forward pass of the model. */
+};
+
+/** @brief Analyzes the memory footprint and the multiply-accumulate operations of every layer of a model
+ *
+ * The model must be compiled with aialgo_compile_model() before. For the training analysis (optimizer != 0),
+ * the loss must be set and the trainable layers must be configured (e.g. with aialgo_set_trainable_model()),
+ * because layers in front of the first trainable layer need no backward memory.
+ *
+ * @param *model                    The compiled model
+ * @param *optimizer                The optimizer for the training analysis (set to 0 for an inference only analysis)
+ * @param *layer_footprints         Array for the footprints of the layers (in the order of the model, starting with the input layer)
+ * @param layer_footprints_count    Number of elements in the layer_footprints array (at least model->layer_count)
+ * @param *model_footprint          Summary of the model
+ * @return                          0 if successful, 1 if the array is too small or the loss is missing for the training analysis
+ */
+uint8_t aialgo_analyze_footprint(aimodel_t *model,
+                                 aiopti_t *optimizer,
+                                 aialgo_layer_footprint_t *layer_footprints,
+                                 uint16_t layer_footprints_count,
+                                 aialgo_model_footprint_t *model_footprint);
+
+/** @brief Prints the result of aialgo_analyze_footprint() as JSON
+ *
+ * The layer type and data type names are only available if AIDEBUG_PRINT_MODULE_SPECS is enabled.
+ *
+ * @param *model_footprint      Summary of the model
+ * @param *layer_footprints     Footprints of the layers (model_footprint->layer_count elements)
+ */
+void aialgo_print_footprint_json(const aialgo_model_footprint_t *model_footprint, const aialgo_layer_footprint_t *layer_footprints);
+
+#endif // AIALGO_FOOTPRINT
@@ -0,0 +1,230 @@
+/**
+ * \file basic/base/aialgo/aialgo_kernel_tuning.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+#include "basic/base/aialgo/aialgo_kernel_tuning.h"
+
+AISTRING_STORAGE_WRAPPER(aistring_error_kernel_tuning_1, "[aialgo_tune_kernels_model] Error: Tuning cache is full.\n");
+
+uint32_t aialgo_kernel_cache_key(const ailayer_t *layer, uint16_t layer_index)
+{
+    uint32_t hash = 2166136261UL; // FNV-1a offset basis
+    uint8_t i;
+
+    #define AIALGO_KERNEL_CACHE_HASH(VALUE) {hash = (hash ^ ((VALUE) & 0xFF)) * 16777619UL; hash = (hash ^ (((VALUE) >> 8) & 0xFF)) * 16777619UL;}
+
+    AIALGO_KERNEL_CACHE_HASH(layer_index);
+    AIALGO_KERNEL_CACHE_HASH(layer->result.dtype->size);
+    if(layer->input_layer != 0){
+        AIALGO_KERNEL_CACHE_HASH(layer->input_layer->result.dim);
+        for(i = 0; i < layer->input_layer->result.dim; i++){
+            AIALGO_KERNEL_CACHE_HASH(layer->input_layer->result.shape[i]);
+        }
+    }
+    AIALGO_KERNEL_CACHE_HASH(layer->result.dim);
+    for(i = 0; i < layer->result.dim; i++){
+        AIALGO_KERNEL_CACHE_HASH(layer->result.shape[i]);
+    }
+
+    #undef AIALGO_KERNEL_CACHE_HASH
+
+    return hash;
+}
+
+// The predicates are evaluated before any kernel is installed, because they may depend on the kernel set by the layer constructor
+static uint16_t check_applicable_kernels(const ailayer_t *layer, const aialgo_kernel_registry_t *registry, uint8_t *applicable)
+{
+    uint16_t i, count = 0;
+
+    for(i = 0; i < registry->kernel_count; i++){
+        applicable[i] = registry->kernels[i]->is_applicable(layer) ? TRUE : FALSE;
+        count += applicable[i];
+    }
+    return count;
+}
+
+static uint8_t record_kernel_decision(aialgo_kernel_cache_t *cache, uint32_t key, uint16_t kernel_id)
+{
+    uint16_t i;
+
+    for(i = 0; i < cache->entry_count; i++){
+        if(cache->entries[i].key == key){
+            cache->entries[i].kernel_id = kernel_id;
+            return 0;
+        }
+    }
+    if(cache->entry_count >= cache->capacity){
+        return 1;
+    }
+    cache->entries[cache->entry_count].key = key;
+    cache->entries[cache->entry_count].kernel_id = kernel_id;
+    cache->entry_count++;
+    return 0;
+}
+
+uint8_t aialgo_tune_kernels_model(aimodel_t *model,
+                                  aitensor_t *input_data,
+                                  const aialgo_kernel_registry_t *registry,
+                                  uint32_t (*clock)(void),
+                                  uint16_t repetitions,
+                                  aialgo_kernel_cache_t *cache)
+{
+    uint16_t i, k, r;
+    uint8_t error = 0;
+    uint32_t start_time, time, best_time;
+    const aialgo_kernel_t *kernel, *best_kernel;
+    ailayer_t *layer_ptr = model->input_layer;
+    uint8_t applicable[registry->kernel_count > 0 ? registry->kernel_count : 1];
+
+    if(repetitions == 0){
+        repetitions = 1;
+    }
+
+    aialgo_set_training_mode_model(model, FALSE);
+    aialgo_set_batch_mode_model(model, FALSE);
+
+    model->input_layer->result.data = input_data->data;
+    for(i = 0; i < model->layer_count; i++)
+    {
+        if(check_applicable_kernels(layer_ptr, registry, applicable) >= 2){
+            best_kernel = 0;
+            best_time = 0;
+            for(k = 0; k < registry->kernel_count; k++){
+                if(!applicable[k]){
+                    continue;
+                }
+                kernel = registry->kernels[k];
+                kernel->install(layer_ptr);
+
+                // Warm up (caches, branch predictors, lazy initializations)
+                layer_ptr->forward(layer_ptr);
+
+                start_time = clock();
+                for(r = 0; r < repetitions; r++){
+                    layer_ptr->forward(layer_ptr);
+                }
+                time = clock() - start_time; // Unsigned arithmetic handles an overflow of the clock counter
+
+                if(best_kernel == 0 || time < best_time){
+                    best_kernel = kernel;
+                    best_time = time;
+                }
+            }
+            best_kernel->install(layer_ptr);
+
+            if(cache != 0 && record_kernel_decision(cache, aialgo_kernel_cache_key(layer_ptr, i), best_kernel->id) != 0){
+                AILOG_E(aistring_error_kernel_tuning_1);
+                error = 1;
+            }
+        }
+
+        // Calculate the input of the next layer
+        layer_ptr->forward(layer_ptr);
+        layer_ptr = layer_ptr->output_layer;
+    }
+    return error;
+}
+
+uint8_t aialgo_apply_kernel_cache(aimodel_t *model,
+                                  const aialgo_kernel_registry_t *registry,
+                                  const aialgo_kernel_cache_t *cache)
+{
+    uint16_t i, e, k;
+    uint8_t found;
+    uint32_t key;
+    uint8_t result = 0;
+    const aialgo_kernel_t *kernel;
+    ailayer_t *layer_ptr = model->input_layer;
+    uint8_t applicable[registry->kernel_count > 0 ? registry->kernel_count : 1];
+
+    for(i = 0; i < model->layer_count; i++)
+    {
+        if(check_applicable_kernels(layer_ptr, registry, applicable) >= 2){
+            key = aialgo_kernel_cache_key(layer_ptr, i);
+            found = FALSE;
+            for(e = 0; e < cache->entry_count && !found; e++){
+                if(cache->entries[e].key != key){
+                    continue;
+                }
+                for(k = 0; k < registry->kernel_count; k++){
+                    kernel = registry->kernels[k];
+                    if(applicable[k] && kernel->id == cache->entries[e].kernel_id){
+                        kernel->install(layer_ptr);
+                        found = TRUE;
+                        break;
+                    }
+                }
+            }
+            if(!found){
+                result = 1;
+            }
+        }
+        layer_ptr = layer_ptr->output_layer;
+    }
+    return result;
+}
+
+uint16_t aialgo_install_kernels_model(aimodel_t *model, const aialgo_kernel_registry_t *registry)
+{
+    uint16_t i, k;
+    uint16_t install_count = 0;
+    ailayer_t *layer_ptr = model->input_layer;
+
+    for(i = 0; i < model->layer_count; i++)
+    {
+        for(k = 0; k < registry->kernel_count; k++){
+            if(registry->kernels[k]->is_applicable(layer_ptr)){
+                registry->kernels[k]->install(layer_ptr);
+                install_count++;
+                break;
+            }
+        }
+        layer_ptr = layer_ptr->output_layer;
+    }
+    return install_count;
+}
+
+AISTRING_STORAGE_WRAPPER(aistring_kernel_cache_print_1, "aialgo_kernel_cache_entry_t kernel_cache_entries[] = {\n");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_cache_print_2, "    {");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_cache_print_3, ", ");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_cache_print_4, "},\n");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_cache_print_5, "};\naialgo_kernel_cache_t kernel_cache = {kernel_cache_entries, ");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_cache_print_6, ", ");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_cache_print_7, "};\n");
+
+void aialgo_print_kernel_cache(const aialgo_kernel_cache_t *cache)
+{
+    uint16_t i;
+
+    AIPRINT(aistring_kernel_cache_print_1);
+    for(i = 0; i < cache->entry_count; i++){
+        AIPRINT(aistring_kernel_cache_print_2);
+        AIPRINT_UINT("0x%04X", (unsigned int) (cache->entries[i].key >> 16));
+        AIPRINT_UINT("%04X", (unsigned int) (cache->entries[i].key & 0xFFFF));
+        AIPRINT(aistring_kernel_cache_print_3);
+        AIPRINT_UINT("0x%04X", (unsigned int) cache->entries[i].kernel_id);
+        AIPRINT(aistring_kernel_cache_print_4);
+    }
+    AIPRINT(aistring_kernel_cache_print_5);
+    AIPRINT_UINT("%u", (unsigned int) cache->entry_count);
+    AIPRINT(aistring_kernel_cache_print_6);
+    AIPRINT_UINT("%u", (unsigned int) cache->entry_count);
+    AIPRINT(aistring_kernel_cache_print_7);
+}
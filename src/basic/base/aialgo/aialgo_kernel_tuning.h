@@ -0,0 +1,232 @@
+/**
+ * \file basic/base/aialgo/aialgo_kernel_tuning.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Kernel registry and shape-aware auto-tuner that selects the fastest math kernel for every layer
+ * \details The layer constructors (for example ailayer_dense_f32_default() or ailayer_conv2d_f32_default())
+ * hard-wire one math kernel into the function pointers of the layer. Which implementation is the fastest
+ * however depends on the actual tensor shapes and on the target (cache, SIMD, memory speed).
+ *
+ * A kernel (aialgo_kernel_t) describes one interchangeable implementation of a layer function with
+ * - a capability predicate that checks if the kernel can be used for a given (already constructed) layer and
+ * - an install function that patches the kernel into the function pointers of the layer.
+ *
+ * The kernels are collected in a registry (aialgo_kernel_registry_t). aialgo_tune_kernels_model() runs the model once layer by layer,
+ * benchmarks all applicable kernels of every layer with a user supplied clock and installs the fastest one.
+ * The decisions can be recorded in a tuning cache (aialgo_kernel_cache_t) that can be exported with aialgo_print_kernel_cache()
+ * and re-applied without benchmarking with aialgo_apply_kernel_cache() on later startups.
+ *
+ * Predefined kernels:
+ * - aialgo_kernels_default.h (Dense F32, activation function approximations F32)
+ * - aialgo_cnn_kernels_default.h (Conv2D F32)
+ * - aialgo_kernels_cmsis.h (Dense F32 with ARM CMSIS)
+ *
+ * Own kernels (for example hardware accelerators or kernels with other blocking sizes) can be added to the registry
+ * by defining further aialgo_kernel_t structures with a unique id.
+ *
+ * Example:
+ * \code{.c}
+ * // Model is compiled and the parameter and inference memory is scheduled
+ * const aialgo_kernel_t *kernels[] = {
+ *     &aialgo_kernel_dense_linear_f32_default,
+ *     &aialgo_kernel_dense_linear_rowwise_f32_default,
+ *     &aialgo_kernel_conv2d_fwd_f32_default,
+ *     &aialgo_kernel_conv2d_fwd_hwc_f32_default,
+ *     &aialgo_kernel_conv2d_fwd_pointwise_f32_default
+ * };
+ * aialgo_kernel_registry_t registry = {kernels, sizeof(kernels) / sizeof(kernels[0])};
+ *
+ * aialgo_kernel_cache_entry_t cache_entries[8];
+ * aialgo_kernel_cache_t cache = {cache_entries, 8, 0};
+ *
+ * if(aialgo_apply_kernel_cache(&model, &registry, &cache) != 0){
+ *     aialgo_tune_kernels_model(&model, &example_input, &registry, micros, 10, &cache);
+ *     aialgo_print_kernel_cache(&cache); // Paste the output into the source code for the next startup
+ * }
+ * \endcode
+ */
+
+#ifndef AIALGO_KERNEL_TUNING
+#define AIALGO_KERNEL_TUNING
+
+#include "core/aifes_core.h"
+#include "core/aifes_math.h"
+#include "basic/base/aialgo/aialgo_sequential_inference.h"
+
+typedef struct aialgo_kernel aialgo_kernel_t;
+typedef struct aialgo_kernel_registry aialgo_kernel_registry_t;
+typedef struct aialgo_kernel_cache_entry aialgo_kernel_cache_entry_t;
+typedef struct aialgo_kernel_cache aialgo_kernel_cache_t;
+
+/** @brief Description of one interchangeable kernel implementation for a layer
+ *
+ * Example for a kernel that computes the dense layer with aimath_f32_default_linear():
+ * \code{.c}
+ * uint8_t is_applicable(const ailayer_t *layer)
+ * {
+ *     return layer->layer_type == ailayer_dense_type && layer->result.dtype == aif32 && ...;
+ * }
+ *
+ * void install(ailayer_t *layer)
+ * {
+ *     ((ailayer_dense_t *) layer->layer_configuration)->linear = aimath_f32_default_linear;
+ * }
+ *
+ * const aialgo_kernel_t my_kernel = {
+ * #ifdef AIDEBUG_PRINT_MODULE_SPECS
+ *     .name = "Dense linear F32",
+ * #else
+ *     .name = 0,
+ * #endif
+ *     .id = 0x8001,
+ *     .is_applicable = is_applicable,
+ *     .install = install
+ * };
+ * \endcode
+ */
+struct aialgo_kernel {
+    const char *name; /**< Name of the kernel (for example "Dense linear F32 default"). Only set in debug mode (AIDEBUG_PRINT_MODULE_SPECS) to save memory otherwise. */
+    uint16_t id; /**< Unique and stable identifier of the kernel. It is stored in the tuning cache. */
+
+    /** @brief Capability predicate
+    *
+    * Checks if the kernel can replace the current kernel of the given layer (layer type, data type, data layout, shapes, ...).
+    * The predicates of all kernels are evaluated before the tuner installs any kernel into the layer.
+    *
+    * @param *layer     The constructed layer
+    * @return           TRUE if the kernel can be installed, FALSE otherwise
+    */
+    uint8_t (*is_applicable)(const ailayer_t *layer);
+
+    /** @brief Patches the kernel into the function pointers of the layer
+    *
+    * @param *layer     The layer
+    */
+    void (*install)(ailayer_t *layer);
+};
+
+/** @brief Collection of candidate kernels
+ */
+struct aialgo_kernel_registry {
+    const aialgo_kernel_t * const *kernels; /**< Array of pointers to the candidate kernels. */
+    uint16_t kernel_count; /**< Number of kernels in the array. */
+};
+
+/** @brief Tuning decision for one layer
+ */
+struct aialgo_kernel_cache_entry {
+    uint32_t key; /**< Key of the layer (see aialgo_kernel_cache_key()). */
+    uint16_t kernel_id; /**< Id of the fastest kernel for this layer. */
+};
+
+/** @brief Tuning cache with the kernel decisions of a model
+ *
+ * The memory for the entries is provided by the user.
+ */
+struct aialgo_kernel_cache {
+    aialgo_kernel_cache_entry_t *entries; /**< Array of cache entries. */
+    uint16_t capacity; /**< Maximum number of entries in the array. */
+    uint16_t entry_count; /**< Number of used entries. */
+};
+
+/** @brief Calculates the cache key of a layer
+ *
+ * The key is a hash (FNV-1a) over the position of the layer in the model, the data type size
+ * and the shapes of the input and the result tensor.
+ *
+ * @param *layer        The layer
+ * @param layer_index   Position of the layer in the model (0 for the input layer)
+ * @return              The cache key
+ */
+uint32_t aialgo_kernel_cache_key(const ailayer_t *layer, uint16_t layer_index);
+
+/** @brief Benchmarks all applicable kernels for every layer of the model and installs the fastest ones
+ *
+ * The model is executed layer by layer (in inference mode) on the first batch slice of the given input.
+ * For every layer with at least two applicable kernels in the registry, every kernel is installed,
+ * warmed up with one forward pass and then timed over the given number of forward passes. The kernel with the
+ * smallest time stays installed (on ties the first kernel in the registry is preferred).
+ *
+ * The model must be compiled and the parameter and inference memory must be scheduled before (the parameters should
+ * be initialized or loaded, but the values do not influence the decision of the tuner).
+ * Layers with less than two applicable kernels are forwarded only once.
+ *
+ * @param *model        The model
+ * @param *input_data   Example input data (at least one batch slice of the input layer)
+ * @param *registry     The registry with the candidate kernels
+ * @param clock         Monotonic clock function (for example micros() on Arduino). Overflows of the counter are handled.
+ * @param repetitions   Number of timed forward passes per kernel (at least 1)
+ * @param *cache        Tuning cache to record the decisions in (optional, set to 0 if not needed).
+ *                      Existing entries with the same key are updated.
+ * @return              0 if successful, 1 if the cache was too small to record all decisions
+ */
+uint8_t aialgo_tune_kernels_model(aimodel_t *model,
+                                  aitensor_t *input_data,
+                                  const aialgo_kernel_registry_t *registry,
+                                  uint32_t (*clock)(void),
+                                  uint16_t repetitions,
+                                  aialgo_kernel_cache_t *cache);
+
+/** @brief Installs the kernels that are recorded in a tuning cache
+ *
+ * No benchmarking is done. A recorded kernel is only installed if it is part of the registry
+ * and applicable to the layer. The model must be compiled before.
+ *
+ * @param *model        The model
+ * @param *registry     The registry with the candidate kernels
+ * @param *cache        The tuning cache
+ * @return              0 if the cache contained a valid decision for every layer with at least two applicable kernels, 1 otherwise (re-tuning recommended)
+ */
+uint8_t aialgo_apply_kernel_cache(aimodel_t *model,
+                                  const aialgo_kernel_registry_t *registry,
+                                  const aialgo_kernel_cache_t *cache);
+
+/** @brief Installs the first applicable kernel of the registry into every layer of the model
+ *
+ * No benchmarking is done. This selects a fixed set of kernels for a model, for example the accuracy level of the
+ * activation function approximations (see aialgo_kernels_default.h):
+ * \code{.c}
+ * const aialgo_kernel_t *kernels[] = {
+ *     &aialgo_kernel_sigmoid_poly_f32_default,
+ *     &aialgo_kernel_tanh_poly_f32_default,
+ *     &aialgo_kernel_softmax_poly_f32_default
+ * };
+ * aialgo_kernel_registry_t registry = {kernels, sizeof(kernels) / sizeof(kernels[0])};
+ *
+ * aialgo_install_kernels_model(&model, &registry);
+ * \endcode
+ *
+ * The model must be compiled before.
+ *
+ * @param *model        The model
+ * @param *registry     The registry with the kernels (the order defines the priority)
+ * @return              Number of layers a kernel was installed into
+ */
+uint16_t aialgo_install_kernels_model(aimodel_t *model, const aialgo_kernel_registry_t *registry);
+
+/** @brief Prints the tuning cache as C source code
+ *
+ * The output can be pasted into the source code to re-apply the tuning results with aialgo_apply_kernel_cache()
+ * on later startups (for example on a microcontroller without a file system).
+ * On platforms with a file system, the entries array can also be written to a file as binary data.
+ *
+ * @param *cache    The tuning cache
+ */
+void aialgo_print_kernel_cache(const aialgo_kernel_cache_t *cache);
+
+#endif // AIALGO_KERNEL_TUNING
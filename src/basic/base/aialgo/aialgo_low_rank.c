@@ -0,0 +1,173 @@
+/**
+ * \file basic/base/aialgo/aialgo_low_rank.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+#include "basic/base/aialgo/aialgo_low_rank.h"
+#include <math.h>
+
+AISTRING_STORAGE_WRAPPER(aistring_error_low_rank_1, "[aialgo_low_rank_factorize_f32] Error: The factor shapes don't match the weights and the rank.\n");
+
+#define AIALGO_LOW_RANK_MAX_SWEEPS  30
+
+// Workspace layout: singular values [outputs], columns U*S [outputs x inputs], V [outputs x outputs], order [outputs]
+uint32_t aialgo_sizeof_low_rank_workspace(uint16_t inputs, uint16_t outputs)
+{
+    return (uint32_t) outputs * (1 + inputs + outputs) * sizeof(float) + (uint32_t) outputs * sizeof(uint16_t);
+}
+
+uint16_t aialgo_low_rank_decompose_f32(const aitensor_t *weights, float energy_threshold, uint16_t max_rank, void *workspace)
+{
+    uint16_t inputs = weights->shape[0];
+    uint16_t outputs = weights->shape[1];
+    float *w = (float *) weights->data;
+    float *sigma = (float *) workspace;
+    float *us = sigma + outputs;
+    float *v = us + (uint32_t) inputs * outputs;
+    uint16_t *order = (uint16_t *) (v + (uint32_t) outputs * outputs);
+    uint16_t i, j, p, q, sweep, rank;
+    uint8_t rotated;
+    double alpha, beta, gamma, zeta, t, c, s, energy, total_energy;
+    float up, uq;
+
+    // Columns of W (one per output) as rows of us; V = identity
+    for(j = 0; j < outputs; j++){
+        for(i = 0; i < inputs; i++){
+            us[(uint32_t) j * inputs + i] = w[(uint32_t) i * outputs + j];
+        }
+        for(i = 0; i < outputs; i++){
+            v[(uint32_t) j * outputs + i] = (i == j) ? 1.0f : 0.0f;
+        }
+    }
+
+    // One-sided Jacobi: Orthogonalize the columns pairwise, W * V = U * S
+    for(sweep = 0; sweep < AIALGO_LOW_RANK_MAX_SWEEPS; sweep++){
+        rotated = 0;
+        for(p = 0; p + 1 < outputs; p++){
+            for(q = p + 1; q < outputs; q++){
+                alpha = 0.0; beta = 0.0; gamma = 0.0;
+                for(i = 0; i < inputs; i++){
+                    up = us[(uint32_t) p * inputs + i];
+                    uq = us[(uint32_t) q * inputs + i];
+                    alpha += (double) up * up;
+                    beta += (double) uq * uq;
+                    gamma += (double) up * uq;
+                }
+                if(gamma == 0.0 || fabs(gamma) <= 1e-9 * sqrt(alpha * beta)){
+                    continue;
+                }
+                rotated = 1;
+
+                zeta = (beta - alpha) / (2.0 * gamma);
+                t = (zeta >= 0.0 ? 1.0 : -1.0) / (fabs(zeta) + sqrt(1.0 + zeta * zeta));
+                c = 1.0 / sqrt(1.0 + t * t);
+                s = c * t;
+                for(i = 0; i < inputs; i++){
+                    up = us[(uint32_t) p * inputs + i];
+                    uq = us[(uint32_t) q * inputs + i];
+                    us[(uint32_t) p * inputs + i] = (float) (c * up - s * uq);
+                    us[(uint32_t) q * inputs + i] = (float) (s * up + c * uq);
+                }
+                for(i = 0; i < outputs; i++){
+                    up = v[(uint32_t) p * outputs + i];
+                    uq = v[(uint32_t) q * outputs + i];
+                    v[(uint32_t) p * outputs + i] = (float) (c * up - s * uq);
+                    v[(uint32_t) q * outputs + i] = (float) (s * up + c * uq);
+                }
+            }
+        }
+        if(!rotated){
+            break;
+        }
+    }
+
+    // Singular values are the column norms, sorted descending (insertion sort on the order)
+    total_energy = 0.0;
+    for(j = 0; j < outputs; j++){
+        energy = 0.0;
+        for(i = 0; i < inputs; i++){
+            energy += (double) us[(uint32_t) j * inputs + i] * us[(uint32_t) j * inputs + i];
+        }
+        sigma[j] = (float) sqrt(energy);
+        total_energy += energy;
+
+        for(p = j; p > 0 && sigma[order[p - 1]] < sigma[j]; p--){
+            order[p] = order[p - 1];
+        }
+        order[p] = j;
+    }
+
+    // Rank selection by the energy threshold
+    energy = 0.0;
+    rank = 0;
+    while(rank < outputs && rank < inputs){
+        energy += (double) sigma[order[rank]] * sigma[order[rank]];
+        rank++;
+        if(energy >= energy_threshold * total_energy){
+            break;
+        }
+    }
+    if(max_rank > 0 && rank > max_rank){
+        rank = max_rank;
+    }
+    return rank;
+}
+
+uint8_t aialgo_low_rank_factorize_f32(const aitensor_t *weights, const aitensor_t *bias, uint16_t rank, const void *workspace,
+                                      aitensor_t *weights_a, aitensor_t *bias_a, aitensor_t *weights_b, aitensor_t *bias_b)
+{
+    uint16_t inputs = weights->shape[0];
+    uint16_t outputs = weights->shape[1];
+    const float *sigma = (const float *) workspace;
+    const float *us = sigma + outputs;
+    const float *v = us + (uint32_t) inputs * outputs;
+    const uint16_t *order = (const uint16_t *) (v + (uint32_t) outputs * outputs);
+    float *a_data = (float *) weights_a->data;
+    float *b_data = (float *) weights_b->data;
+    uint16_t i, k, j;
+    float scale;
+
+    if(rank == 0 || rank > outputs
+       || weights_a->shape[0] != inputs || weights_a->shape[1] != rank
+       || weights_b->shape[0] != rank || weights_b->shape[1] != outputs
+       || aimath_tensor_elements(bias_a) != rank || aimath_tensor_elements(bias_b) != outputs)
+    {
+        AILOG_E(aistring_error_low_rank_1);
+        return 1;
+    }
+
+    for(k = 0; k < rank; k++){
+        j = order[k];
+        // A = U * sqrt(S) = (U * S) / sqrt(S); B = sqrt(S) * V^T
+        scale = sigma[j] > 0.0f ? 1.0f / sqrtf(sigma[j]) : 0.0f;
+        for(i = 0; i < inputs; i++){
+            a_data[(uint32_t) i * rank + k] = us[(uint32_t) j * inputs + i] * scale;
+        }
+        scale = sqrtf(sigma[j]);
+        for(i = 0; i < outputs; i++){
+            b_data[(uint32_t) k * outputs + i] = v[(uint32_t) j * outputs + i] * scale;
+        }
+        ((float *) bias_a->data)[k] = 0.0f;
+    }
+    for(i = 0; i < outputs; i++){
+        ((float *) bias_b->data)[i] = bias != 0 ? ((float *) bias->data)[i] : 0.0f;
+    }
+
+    return 0;
+}
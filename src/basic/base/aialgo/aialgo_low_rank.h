@@ -0,0 +1,107 @@
+/**
+ * \file basic/base/aialgo/aialgo_low_rank.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Low-rank factorization of \link ailayer_dense.h Dense layers \endlink with a truncated singular value decomposition
+ * \details Large Dense layers are often over-parameterized. The weights matrix \f$ W \f$ ([inputs x outputs]) can then be approximated
+ * by the product of two thin matrices
+ * \f[
+ *  W \approx A \cdot B = (U_r \sqrt{S_r}) \cdot (\sqrt{S_r} V_r^T)
+ * \f]
+ * where \f$ U_r S_r V_r^T \f$ is the singular value decomposition truncated to the r largest singular values.
+ * The layer is replaced by two chained Dense layers with r and outputs neurons. The first layer has a zero bias,
+ * the second one gets the bias of the original layer. Parameter memory and MACs are reduced from
+ * \f$ inputs \cdot outputs \f$ to \f$ r \cdot (inputs + outputs) \f$, only the existing Dense layer is needed at runtime
+ * and both layers can be fine-tuned with the normal training functions afterwards.
+ *
+ * The rank is selected with an energy threshold: The smallest r with
+ * \f$ \sum_{i<r} \sigma_i^2 \geq threshold \cdot \sum_i \sigma_i^2 \f$.
+ * Because the decomposition is stored in the workspace, different ranks can be factorized and evaluated (e.g. with
+ * aialgo_evaluate_model()) without recomputing it, to select the rank by the accuracy of the model instead.
+ *
+ * The decomposition is a one-sided Jacobi SVD and is meant to be run on the host (or on a device with enough memory).
+ *
+ * Example: Factorize a trained Dense layer with 256 inputs and 256 outputs
+ * \code{.c}
+ * void *workspace = malloc(aialgo_sizeof_low_rank_workspace(256, 256));
+ * uint16_t rank = aialgo_low_rank_decompose_f32(&dense_layer.weights, 0.95f, 64, workspace);
+ *
+ * float *weights_a = malloc(256 * rank * sizeof(float)), *bias_a = malloc(rank * sizeof(float));
+ * float *weights_b = malloc(rank * 256 * sizeof(float)), *bias_b = malloc(256 * sizeof(float));
+ * uint16_t weights_a_shape[2] = {256, rank}, bias_a_shape[2] = {1, rank};
+ * uint16_t weights_b_shape[2] = {rank, 256}, bias_b_shape[2] = {1, 256};
+ * aitensor_t weights_a_tensor = AITENSOR_2D_F32(weights_a_shape, weights_a);
+ * ...
+ * aialgo_low_rank_factorize_f32(&dense_layer.weights, &dense_layer.bias, rank, workspace,
+ *                               &weights_a_tensor, &bias_a_tensor, &weights_b_tensor, &bias_b_tensor);
+ *
+ * ailayer_dense_f32_t dense_layer_a = AILAYER_DENSE_F32_M(rank, weights_a, bias_a);
+ * ailayer_dense_f32_t dense_layer_b = AILAYER_DENSE_F32_M(256, weights_b, bias_b);
+ * ...
+ * x = ailayer_dense_f32_default(&dense_layer_a, x);
+ * x = ailayer_dense_f32_default(&dense_layer_b, x);
+ * \endcode
+ */
+
+#ifndef AIALGO_LOW_RANK
+#define AIALGO_LOW_RANK
+
+#include "core/aifes_core.h"
+#include "core/aifes_math.h"
+#include "basic/base/aimath/aimath_f32.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+/** @brief Calculate the memory size in bytes of the workspace for the decomposition
+ *
+ * @param inputs    Number of inputs of the Dense layer (rows of the weights)
+ * @param outputs   Number of outputs of the Dense layer (columns of the weights)
+ * @return          Required memory size in bytes
+ */
+uint32_t aialgo_sizeof_low_rank_workspace(uint16_t inputs, uint16_t outputs);
+
+/** @brief Decompose an \link aimath_f32.h F32 \endlink weights matrix and select the rank with an energy threshold
+ *
+ * The singular value decomposition is stored in the workspace for aialgo_low_rank_factorize_f32().
+ *
+ * @param *weights          F32 weights matrix of shape [inputs x outputs] (e.g. of ailayer_dense_f32_default())
+ * @param energy_threshold  Fraction of the squared singular values to keep (0 to 1, e.g. 0.95)
+ * @param max_rank          Upper limit for the selected rank (0 for no limit)
+ * @param *workspace        Memory of aialgo_sizeof_low_rank_workspace() bytes
+ * @return                  The selected rank (at least 1)
+ */
+uint16_t aialgo_low_rank_decompose_f32(const aitensor_t *weights, float energy_threshold, uint16_t max_rank, void *workspace);
+
+/** @brief Write the factors of the decomposition for a given rank
+ *
+ * Writes \f$ A = U_r \sqrt{S_r} \f$ with a zero bias and \f$ B = \sqrt{S_r} V_r^T \f$ with the original bias.
+ * aialgo_low_rank_decompose_f32() has to be called before with the same weights and workspace.
+ *
+ * @param *weights      F32 weights matrix of shape [inputs x outputs]
+ * @param *bias         F32 bias of shape [1 x outputs] (optional, 0 for a zero bias)
+ * @param rank          Rank r of the factorization (any value up to the number of singular values)
+ * @param *workspace    Workspace of aialgo_low_rank_decompose_f32()
+ * @param *weights_a    F32 weights of the first layer (output, shape [inputs x r])
+ * @param *bias_a       F32 bias of the first layer (output, shape [1 x r])
+ * @param *weights_b    F32 weights of the second layer (output, shape [r x outputs])
+ * @param *bias_b       F32 bias of the second layer (output, shape [1 x outputs])
+ * @return              0 on success, 1 if the shapes don't match
+ */
+uint8_t aialgo_low_rank_factorize_f32(const aitensor_t *weights, const aitensor_t *bias, uint16_t rank, const void *workspace,
+                                      aitensor_t *weights_a, aitensor_t *bias_a, aitensor_t *weights_b, aitensor_t *bias_b);
+
+#endif // AIALGO_LOW_RANK
@@ -0,0 +1,146 @@
+/**
+ * \file basic/base/aialgo/aialgo_palettization.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+#include "basic/base/aialgo/aialgo_palettization.h"
+
+AISTRING_STORAGE_WRAPPER(aistring_error_palettize_1, "[aialgo_palettize_f32] Error: Only 4 or 8 bit indices with 1 to 2^bits centroids are supported.\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_palettize_2, "[aialgo_palettize_f32] Error: The index tensor shape doesn't match the weights shape.\n");
+
+static uint8_t aialgo_palette_get_index(const uint8_t *data, uint32_t row_bytes, uint8_t index_bits, uint16_t row, uint16_t col)
+{
+    if(index_bits == 4){
+        return (data[row * row_bytes + (col >> 1)] >> ((col & 1) * 4)) & 0x0F;
+    }
+    return data[row * row_bytes + col];
+}
+
+static void aialgo_palette_set_index(uint8_t *data, uint32_t row_bytes, uint8_t index_bits, uint16_t row, uint16_t col, uint8_t index)
+{
+    uint8_t *byte;
+
+    if(index_bits == 4){
+        byte = &data[row * row_bytes + (col >> 1)];
+        if(col & 1){
+            *byte = (*byte & 0x0F) | (index << 4);
+        } else {
+            *byte = (*byte & 0xF0) | index;
+        }
+    } else {
+        data[row * row_bytes + col] = index;
+    }
+}
+
+uint32_t aialgo_sizeof_palettized_data(uint16_t rows, uint16_t cols, uint8_t index_bits)
+{
+    return rows * AIMATH_PALETTE_ROW_BYTES(cols, index_bits);
+}
+
+uint8_t aialgo_palettize_f32(const aitensor_t *weights, uint8_t transposed, uint16_t iterations, aitensor_t *indices)
+{
+    aimath_palette_params_t *palette = (aimath_palette_params_t *) indices->tensor_params;
+    float *w = (float *) weights->data;
+    float *codebook = palette->codebook;
+    uint8_t *index_data = (uint8_t *) indices->data;
+    uint16_t rows = indices->shape[0];
+    uint16_t cols = indices->shape[1];
+    uint32_t row_bytes;
+    uint16_t row, col, p, nearest;
+    uint32_t iteration;
+    uint32_t changes;
+    float value, distance, nearest_distance, w_min, w_max;
+    float cluster_sums[256];
+    uint32_t cluster_counts[256];
+
+    if((palette->index_bits != 4 && palette->index_bits != 8)
+       || palette->centroid_count == 0 || palette->centroid_count > (1 << palette->index_bits))
+    {
+        AILOG_E(aistring_error_palettize_1);
+        return 1;
+    }
+    if((transposed && (weights->shape[0] != rows || weights->shape[1] != cols))
+       || (!transposed && (weights->shape[0] != cols || weights->shape[1] != rows)))
+    {
+        AILOG_E(aistring_error_palettize_2);
+        return 1;
+    }
+
+    row_bytes = AIMATH_PALETTE_ROW_BYTES(cols, palette->index_bits);
+
+    // Linear initialization of the centroids between min and max
+    w_min = w[0];
+    w_max = w[0];
+    for(row = 0; row < rows; row++){
+        for(col = 0; col < cols; col++){
+            value = w[row * cols + col];
+            if(value < w_min) w_min = value;
+            if(value > w_max) w_max = value;
+        }
+    }
+    for(p = 0; p < palette->centroid_count; p++){
+        codebook[p] = palette->centroid_count > 1 ? w_min + (w_max - w_min) * p / (palette->centroid_count - 1) : (w_min + w_max) / 2.0f;
+    }
+
+    // Lloyd iterations (the first iteration assigns all weights)
+    for(iteration = 0; iteration <= (uint32_t) iterations; iteration++){
+        changes = 0;
+        for(p = 0; p < palette->centroid_count; p++){
+            cluster_sums[p] = 0.0f;
+            cluster_counts[p] = 0;
+        }
+
+        // Assignment step
+        for(row = 0; row < rows; row++){
+            for(col = 0; col < cols; col++){
+                value = transposed ? w[row * cols + col] : w[col * rows + row];
+
+                nearest = 0;
+                nearest_distance = (value - codebook[0]) * (value - codebook[0]);
+                for(p = 1; p < palette->centroid_count; p++){
+                    distance = (value - codebook[p]) * (value - codebook[p]);
+                    if(distance < nearest_distance){
+                        nearest_distance = distance;
+                        nearest = p;
+                    }
+                }
+
+                if(iteration == 0 || aialgo_palette_get_index(index_data, row_bytes, palette->index_bits, row, col) != nearest){
+                    aialgo_palette_set_index(index_data, row_bytes, palette->index_bits, row, col, (uint8_t) nearest);
+                    changes++;
+                }
+                cluster_sums[nearest] += value;
+                cluster_counts[nearest]++;
+            }
+        }
+
+        // Update step (empty clusters keep their centroid)
+        for(p = 0; p < palette->centroid_count; p++){
+            if(cluster_counts[p] > 0){
+                codebook[p] = cluster_sums[p] / (float) cluster_counts[p];
+            }
+        }
+
+        if(changes == 0){
+            break;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+/**
+ * \file basic/base/aialgo/aialgo_palettization.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Weight palettization (k-means codebook compression) of trained \link aimath_f32.h F32 \endlink weights
+ * \details The weights of a trained layer are clustered with the k-means algorithm (1D, Lloyd iterations) into
+ * 16 or 256 centroids. The centroids form the codebook and every weight is replaced by the 4 or 8 bit index of its centroid
+ * (see aimath_palette.h). Because the weights of a trained layer are usually concentrated in a few clusters, the accuracy loss
+ * is typically small while the weights memory shrinks by a factor of 4 to 8.
+ *
+ * The palettization is usually done on the host (e.g. with the weights of a model trained with AIfES or converted from another framework)
+ * and the resulting codebook and indices are stored as constants in the program memory of the target. A palettized Dense layer
+ * (ailayer_dense_palettized_f32_default()) then uses the indices and codebook directly.
+ *
+ * Example: Palettize a trained Dense layer (ailayer_dense_f32_default(), weights [inputs x neurons])
+ * \code{.c}
+ * float codebook[16];
+ * aimath_palette_params_t palette = {4, 16, codebook};
+ *
+ * uint16_t indices_shape[2] = {NEURONS, INPUTS};
+ * uint8_t indices_data[AIMATH_PALETTE_ROW_BYTES(INPUTS, 4) * NEURONS];
+ * aitensor_t indices = {aiu8, 2, indices_shape, &palette, indices_data};
+ *
+ * aialgo_palettize_f32(&dense_layer.weights, 0, 50, &indices);
+ *
+ * ailayer_dense_f32_t palettized_layer = AILAYER_DENSE_PALETTIZED_F32_M(NEURONS, indices_data, &palette, dense_layer.bias.data);
+ * \endcode
+ */
+
+#ifndef AIALGO_PALETTIZATION
+#define AIALGO_PALETTIZATION
+
+#include "core/aifes_core.h"
+#include "core/aifes_math.h"
+#include "basic/base/aimath/aimath_f32.h"
+#include "basic/base/aimath/aimath_palette.h"
+
+/** @brief Calculate the memory size in bytes for the indices of a palettized matrix
+ *
+ * @param rows          Number of rows (neurons for a Dense layer)
+ * @param cols          Number of columns (inputs for a Dense layer)
+ * @param index_bits    Bits per index (4 or 8)
+ * @return              Required memory size in bytes
+ */
+uint32_t aialgo_sizeof_palettized_data(uint16_t rows, uint16_t cols, uint8_t index_bits);
+
+/** @brief Cluster the elements of an \link aimath_f32.h F32 \endlink matrix into a codebook and write the palettized indices
+ *
+ * The centroids are initialized linearly between the minimal and maximal weight (this preserves the large weights better than a random
+ * initialization) and refined with Lloyd iterations until no assignment changes or the maximal number of iterations is reached.
+ *
+ * The indices are always written in the transposed layout [neurons x inputs] that is used by aimath_f32_default_linear_palettized_bt().
+ * Use transposed = 0 for weights of shape [inputs x neurons] (e.g. ailayer_dense_f32_default()) and transposed = 1 for weights of
+ * shape [neurons x inputs] (e.g. ailayer_dense_wt_f32_default()).
+ *
+ * The tensor params of the index tensor have to be an aimath_palette_params_t with index_bits, centroid_count and the
+ * codebook buffer (centroid_count floats) set. The index data buffer must have aialgo_sizeof_palettized_data() bytes.
+ *
+ * @param *weights      F32 weights matrix (2D tensor)
+ * @param transposed    Weights are of shape [neurons x inputs] (1) or [inputs x neurons] (0)
+ * @param iterations    Maximal number of k-means iterations
+ * @param *indices      U8 index tensor of shape [neurons x inputs] with aimath_palette_params_t (output)
+ * @return              0 on success, 1 if the palette parameters are invalid
+ */
+uint8_t aialgo_palettize_f32(const aitensor_t *weights, uint8_t transposed, uint16_t iterations, aitensor_t *indices);
+
+#endif // AIALGO_PALETTIZATION
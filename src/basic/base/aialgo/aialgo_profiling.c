@@ -0,0 +1,361 @@
+/**
+ * \file basic/base/aialgo/aialgo_profiling.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief
+ * \details
+ */
+
+#include "basic/base/aialgo/aialgo_profiling.h"
+
+#ifdef AIFES_WITH_PROFILING
+
+#include "basic/base/ailayer/ailayer_input.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+void aialgo_init_profile(aialgo_profile_t *profile,
+                         uint32_t (*clock)(void),
+                         uint32_t ticks_per_us,
+                         aialgo_profile_counter_t *layer_counters,
+                         uint16_t layer_capacity,
+                         aialgo_profile_event_t *events,
+                         uint32_t event_capacity)
+{
+    profile->clock = clock;
+    profile->ticks_per_us = ticks_per_us > 0 ? ticks_per_us : 1;
+    profile->layers = layer_counters;
+    profile->layer_capacity = layer_counters != 0 ? layer_capacity : 0;
+    profile->events = events;
+    profile->event_capacity = events != 0 ? event_capacity : 0;
+
+    aialgo_reset_profile(profile);
+    return;
+}
+
+static void aialgo_reset_profile_counter(aialgo_profile_counter_t *counter)
+{
+    counter->ticks = 0;
+    counter->calls = 0;
+    counter->bytes = 0;
+    return;
+}
+
+void aialgo_reset_profile(aialgo_profile_t *profile)
+{
+    uint32_t i;
+
+    for(i = 0; i < AIALGO_PROFILE_PHASES; i++){
+        aialgo_reset_profile_counter(&profile->phases[i]);
+    }
+    for(i = 0; i < (uint32_t) profile->layer_capacity * AIALGO_PROFILE_PHASES; i++){
+        aialgo_reset_profile_counter(&profile->layers[i]);
+    }
+    profile->event_count = 0;
+    profile->events_dropped = 0;
+    return;
+}
+
+void aialgo_set_profile_model(aimodel_t *model, aialgo_profile_t *profile)
+{
+    model->profile = profile;
+    return;
+}
+
+static uint32_t aialgo_profile_tensor_bytes(const aitensor_t *tensor)
+{
+    if(tensor->data == 0 || tensor->shape == 0 || tensor->dtype == 0){
+        return 0;
+    }
+    return aimath_tensor_elements(tensor) * tensor->dtype->size;
+}
+
+uint32_t aialgo_profile_layer_bytes(const ailayer_t *layer, uint8_t phase, aiopti_t *optimizer)
+{
+    uint32_t bytes = 0, result_bytes, param_bytes = 0;
+    uint16_t i;
+
+    // The input layer only provides the input data
+    if(layer->layer_type == ailayer_input_type){
+        return 0;
+    }
+
+    for(i = 0; i < layer->trainable_params_count; i++){
+        param_bytes += aialgo_profile_tensor_bytes(layer->trainable_params[i]);
+    }
+    // Layers like Reshape reuse the buffer of the input for the result
+    result_bytes = layer->result.data != layer->input_layer->result.data ? aialgo_profile_tensor_bytes(&layer->result) : 0;
+
+    switch(phase){
+    case AIALGO_PROFILE_FORWARD:
+        bytes = aialgo_profile_tensor_bytes(&layer->input_layer->result) + result_bytes;
+        if(layer->sizeof_paramem != 0){
+            bytes += layer->sizeof_paramem(layer);
+        }
+        break;
+    case AIALGO_PROFILE_BACKWARD:
+        bytes = aialgo_profile_tensor_bytes(&layer->input_layer->result) + aialgo_profile_tensor_bytes(&layer->result) + 2 * param_bytes;
+        if(!AILAYER_SETTINGS_IS(layer->settings, 0b1, AILAYER_SETTINGS_NO_INPUT_GRADIENT)){
+            bytes += aialgo_profile_tensor_bytes(&layer->deltas);
+        }
+        break;
+    case AIALGO_PROFILE_UPDATE:
+        if(!AILAYER_SETTINGS_IS(layer->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)){
+            break;
+        }
+        bytes = 2 * param_bytes;
+        if(optimizer != 0 && optimizer->sizeof_optimem != 0){
+            for(i = 0; i < layer->trainable_params_count; i++){
+                bytes += optimizer->sizeof_optimem(optimizer, layer->trainable_params[i]);
+            }
+        }
+        break;
+    }
+    return bytes;
+}
+
+static void aialgo_profile_record_event(aialgo_profile_t *profile, uint16_t layer_index, uint8_t phase, uint32_t start, uint32_t duration)
+{
+    aialgo_profile_event_t *event;
+
+    if(profile->events == 0){
+        return;
+    }
+    if(profile->event_count >= profile->event_capacity){
+        profile->events_dropped++;
+        return;
+    }
+    event = &profile->events[profile->event_count++];
+    event->start = start;
+    event->duration = duration;
+    event->layer_index = layer_index;
+    event->phase = phase;
+    return;
+}
+
+uint32_t aialgo_profile_begin(aialgo_profile_t *profile)
+{
+    if(profile == 0){
+        return 0;
+    }
+    return profile->clock();
+}
+
+void aialgo_profile_end_layer(aialgo_profile_t *profile, const ailayer_t *layer, uint16_t layer_index, uint8_t phase, uint32_t start, aiopti_t *optimizer)
+{
+    uint32_t duration, bytes;
+    aialgo_profile_counter_t *counter;
+
+    if(profile == 0){
+        return;
+    }
+    duration = profile->clock() - start; // Unsigned difference handles an overflow of the clock
+
+    bytes = aialgo_profile_layer_bytes(layer, phase, optimizer);
+    profile->phases[phase].bytes += bytes;
+    if(layer_index < profile->layer_capacity){
+        counter = &profile->layers[(uint32_t) layer_index * AIALGO_PROFILE_PHASES + phase];
+        counter->ticks += duration;
+        counter->calls++;
+        counter->bytes += bytes;
+    }
+    aialgo_profile_record_event(profile, layer_index, phase, start, duration);
+    return;
+}
+
+void aialgo_profile_end_phase(aialgo_profile_t *profile, uint8_t phase, uint32_t start)
+{
+    uint32_t duration;
+
+    if(profile == 0){
+        return;
+    }
+    duration = profile->clock() - start;
+
+    profile->phases[phase].ticks += duration;
+    profile->phases[phase].calls++;
+    aialgo_profile_record_event(profile, AIALGO_PROFILE_NO_LAYER, phase, start, duration);
+    return;
+}
+
+#ifdef AIDEBUG_ENABLE_PRINTING
+
+AISTRING_STORAGE_WRAPPER(aistring_profile_phase_forward, "forward");
+AISTRING_STORAGE_WRAPPER(aistring_profile_phase_backward, "backward");
+AISTRING_STORAGE_WRAPPER(aistring_profile_phase_update, "update");
+
+static const char *aialgo_profile_phase_name(uint8_t phase)
+{
+    switch(phase){
+    case AIALGO_PROFILE_FORWARD: return aistring_profile_phase_forward;
+    case AIALGO_PROFILE_BACKWARD: return aistring_profile_phase_backward;
+    default: return aistring_profile_phase_update;
+    }
+}
+
+AISTRING_STORAGE_WRAPPER(aistring_print_profile_1, ": ");
+AISTRING_STORAGE_WRAPPER(aistring_print_profile_2, " ticks, ");
+AISTRING_STORAGE_WRAPPER(aistring_print_profile_3, " calls, ");
+AISTRING_STORAGE_WRAPPER(aistring_print_profile_4, " bytes\n");
+AISTRING_STORAGE_WRAPPER(aistring_print_profile_5, "\n");
+AISTRING_STORAGE_WRAPPER(aistring_print_profile_6, "      ");
+AISTRING_STORAGE_WRAPPER(aistring_print_profile_7, "Dropped events: ");
+
+static void aialgo_print_profile_counter(uint8_t phase, const aialgo_profile_counter_t *counter)
+{
+    AIPRINT(aialgo_profile_phase_name(phase));
+    AIPRINT(aistring_print_profile_1);
+    AIPRINT_LONG_INT("%ld", (long int) counter->ticks);
+    AIPRINT(aistring_print_profile_2);
+    AIPRINT_LONG_INT("%ld", (long int) counter->calls);
+    AIPRINT(aistring_print_profile_3);
+    AIPRINT_LONG_INT("%ld", (long int) counter->bytes);
+    AIPRINT(aistring_print_profile_4);
+    return;
+}
+
+void aialgo_print_profile(aimodel_t *model, const aialgo_profile_t *profile)
+{
+    uint16_t i;
+    uint8_t phase;
+    const aialgo_profile_counter_t *counter;
+    ailayer_t *layer_ptr = model->input_layer;
+
+    for(phase = 0; phase < AIALGO_PROFILE_PHASES; phase++){
+        if(profile->phases[phase].calls > 0){
+            aialgo_print_profile_counter(phase, &profile->phases[phase]);
+        }
+    }
+    for(i = 0; i < model->layer_count && i < profile->layer_capacity; i++){
+        AIPRINT_INT("%4d", i);
+        AIPRINT(aistring_print_profile_1);
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+        if(layer_ptr->layer_type->name != 0){
+            AIPRINT(layer_ptr->layer_type->name);
+        }
+#endif
+        AIPRINT(aistring_print_profile_5);
+        for(phase = 0; phase < AIALGO_PROFILE_PHASES; phase++){
+            counter = &profile->layers[(uint32_t) i * AIALGO_PROFILE_PHASES + phase];
+            if(counter->calls > 0){
+                AIPRINT(aistring_print_profile_6);
+                aialgo_print_profile_counter(phase, counter);
+            }
+        }
+        layer_ptr = layer_ptr->output_layer;
+    }
+    if(profile->events_dropped > 0){
+        AIPRINT(aistring_print_profile_7);
+        AIPRINT_LONG_INT("%ld", (long int) profile->events_dropped);
+        AIPRINT(aistring_print_profile_5);
+    }
+    return;
+}
+
+AISTRING_STORAGE_WRAPPER(aistring_profile_trace_1, "{\"traceEvents\": [");
+AISTRING_STORAGE_WRAPPER(aistring_profile_trace_2, "\n  {\"name\": \"");
+AISTRING_STORAGE_WRAPPER(aistring_profile_trace_3, " ");
+AISTRING_STORAGE_WRAPPER(aistring_profile_trace_4, "\", \"cat\": \"");
+AISTRING_STORAGE_WRAPPER(aistring_profile_trace_5, "\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1, \"ts\": ");
+AISTRING_STORAGE_WRAPPER(aistring_profile_trace_6, ", \"dur\": ");
+AISTRING_STORAGE_WRAPPER(aistring_profile_trace_7, ", \"args\": {\"layer\": ");
+AISTRING_STORAGE_WRAPPER(aistring_profile_trace_8, "}}");
+AISTRING_STORAGE_WRAPPER(aistring_profile_trace_9, "}");
+AISTRING_STORAGE_WRAPPER(aistring_profile_trace_10, ",");
+AISTRING_STORAGE_WRAPPER(aistring_profile_trace_11, "\n], \"displayTimeUnit\": \"ms\"}\n");
+AISTRING_STORAGE_WRAPPER(aistring_profile_trace_12, ".");
+AISTRING_STORAGE_WRAPPER(aistring_profile_trace_13, "phase");
+
+// Prints ticks as microseconds with 3 decimal places (without floating point precision loss)
+static void aialgo_print_profile_us(uint32_t ticks, uint32_t ticks_per_us)
+{
+    AIPRINT_LONG_INT("%ld", (long int) (ticks / ticks_per_us));
+    AIPRINT(aistring_profile_trace_12);
+    AIPRINT_LONG_INT("%03ld", (long int) ((uint64_t) (ticks % ticks_per_us) * 1000 / ticks_per_us));
+    return;
+}
+
+void aialgo_print_profile_chrome_trace(aimodel_t *model, const aialgo_profile_t *profile)
+{
+    uint32_t i, origin;
+    uint16_t j;
+    const aialgo_profile_event_t *event;
+    ailayer_t *layer_ptr;
+
+    // Phase events start before their first layer event, so the trace begins at the earliest start
+    origin = profile->event_count > 0 ? profile->events[0].start : 0;
+    for(i = 1; i < profile->event_count; i++){
+        if((int32_t) (profile->events[i].start - origin) < 0){
+            origin = profile->events[i].start;
+        }
+    }
+
+    AIPRINT(aistring_profile_trace_1);
+    for(i = 0; i < profile->event_count; i++){
+        event = &profile->events[i];
+
+        AIPRINT(aistring_profile_trace_2);
+        if(event->layer_index == AIALGO_PROFILE_NO_LAYER){
+            AIPRINT(aialgo_profile_phase_name(event->phase));
+        } else {
+            AIPRINT_LONG_INT("%ld", (long int) event->layer_index);
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+            layer_ptr = model->input_layer;
+            for(j = 0; j < event->layer_index && layer_ptr != model->output_layer; j++){
+                layer_ptr = layer_ptr->output_layer;
+            }
+            if(layer_ptr->layer_type->name != 0){
+                AIPRINT(aistring_profile_trace_3);
+                AIPRINT(layer_ptr->layer_type->name);
+            }
+#endif
+        }
+        AIPRINT(aistring_profile_trace_4);
+        AIPRINT(event->layer_index == AIALGO_PROFILE_NO_LAYER ? aistring_profile_trace_13 : aialgo_profile_phase_name(event->phase));
+        AIPRINT(aistring_profile_trace_5);
+        aialgo_print_profile_us(event->start - origin, profile->ticks_per_us);
+        AIPRINT(aistring_profile_trace_6);
+        aialgo_print_profile_us(event->duration, profile->ticks_per_us);
+        if(event->layer_index == AIALGO_PROFILE_NO_LAYER){
+            AIPRINT(aistring_profile_trace_9);
+        } else {
+            AIPRINT(aistring_profile_trace_7);
+            AIPRINT_LONG_INT("%ld", (long int) event->layer_index);
+            AIPRINT(aistring_profile_trace_8);
+        }
+        if(i + 1 < profile->event_count){
+            AIPRINT(aistring_profile_trace_10);
+        }
+    }
+    AIPRINT(aistring_profile_trace_11);
+    return;
+}
+
+#else
+
+void aialgo_print_profile(aimodel_t *model, const aialgo_profile_t *profile)
+{
+    return;
+}
+
+void aialgo_print_profile_chrome_trace(aimodel_t *model, const aialgo_profile_t *profile)
+{
+    return;
+}
+
+#endif // AIDEBUG_ENABLE_PRINTING
+
+#endif // AIFES_WITH_PROFILING
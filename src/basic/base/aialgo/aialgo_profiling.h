@@ -0,0 +1,218 @@
+/**
+ * \file basic/base/aialgo/aialgo_profiling.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Per-layer profiling of the forward pass, the backward pass and the optimizer update
+ * \details If AIFES_WITH_PROFILING is defined in aifes_config.h, aialgo_forward_model(), aialgo_backward_model() and
+ * aialgo_update_params_model() measure every layer with a user supplied clock (for example micros() on Arduino,
+ * the DWT cycle counter on Arm Cortex-M or clock_gettime() on the host). For every layer and every phase
+ * (forward, backward, optimizer update) the profile accumulates
+ * - the clock ticks,
+ * - the number of calls and
+ * - the touched bytes (estimate: every operand of the layer is read or written once, see aialgo_profile_layer_bytes()).
+ *
+ * The same counters are accumulated for the whole phases. Optionally, every call is recorded in an event buffer
+ * that can be exported as Chrome trace JSON (chrome://tracing or https://ui.perfetto.dev) with aialgo_print_profile_chrome_trace().
+ * Without AIFES_WITH_PROFILING (default), the hooks are compiled out and the model loops have no overhead.
+ *
+ * All memory of the profile is provided by the user.
+ *
+ * Example:
+ * \code{.c}
+ * // Model is compiled (aialgo_compile_model())
+ * aialgo_profile_counter_t layer_counters[10 * AIALGO_PROFILE_PHASES];
+ * aialgo_profile_event_t events[256];
+ * aialgo_profile_t profile;
+ *
+ * aialgo_init_profile(&profile, micros, 1, layer_counters, 10, events, 256);
+ * aialgo_set_profile_model(&model, &profile);
+ *
+ * aialgo_train_model(&model, &input_tensor, &target_tensor, optimizer, batch_size);
+ *
+ * aialgo_print_profile(&model, &profile);
+ * aialgo_print_profile_chrome_trace(&model, &profile); // Save the output as trace.json
+ * \endcode
+ */
+
+#ifndef AIALGO_PROFILING
+#define AIALGO_PROFILING
+
+#include "core/aifes_core.h"
+#include "core/aifes_math.h"
+
+#ifdef AIFES_WITH_PROFILING
+
+#define AIALGO_PROFILE_FORWARD      0 /**< Phase of aialgo_forward_model() */
+#define AIALGO_PROFILE_BACKWARD     1 /**< Phase of aialgo_backward_model() */
+#define AIALGO_PROFILE_UPDATE       2 /**< Phase of aialgo_update_params_model() */
+#define AIALGO_PROFILE_PHASES       3 /**< Number of phases */
+
+#define AIALGO_PROFILE_NO_LAYER     0xFFFF /**< Layer index of the events of a whole phase */
+
+typedef struct aialgo_profile_counter aialgo_profile_counter_t;
+typedef struct aialgo_profile_event aialgo_profile_event_t;
+
+/** @brief Accumulated counters of one layer (or of all layers) in one phase
+ */
+struct aialgo_profile_counter {
+    uint64_t ticks; /**< Clock ticks (e.g. cycles or microseconds, depending on the clock function). */
+    uint32_t calls; /**< Number of calls. */
+    uint64_t bytes; /**< Touched bytes (see aialgo_profile_layer_bytes()). */
+};
+
+/** @brief Recorded call of a layer or of a whole phase
+ */
+struct aialgo_profile_event {
+    uint32_t start; /**< Clock value at the start of the call. */
+    uint32_t duration; /**< Clock ticks of the call. */
+    uint16_t layer_index; /**< Index of the layer in the model (0 = input layer) or AIALGO_PROFILE_NO_LAYER for a whole phase. */
+    uint8_t phase; /**< AIALGO_PROFILE_FORWARD, AIALGO_PROFILE_BACKWARD or AIALGO_PROFILE_UPDATE */
+};
+
+/** @brief Profile of a model
+ *
+ * Initialize the profile with aialgo_init_profile() and attach it to the model with aialgo_set_profile_model().
+ */
+struct aialgo_profile {
+    /** @brief Monotonic clock function (for example micros() on Arduino). Overflows of the counter are handled.
+     */
+    uint32_t (*clock)(void);
+    uint32_t ticks_per_us; /**< Clock ticks per microsecond (e.g. 1 for micros(), the CPU frequency in MHz for a cycle counter). Only used for the Chrome trace. */
+
+    aialgo_profile_counter_t phases[AIALGO_PROFILE_PHASES]; /**< Counters of the whole phases (including e.g. the loss in the backward pass). */
+    aialgo_profile_counter_t *layers; /**< Counters of the layers: layers[layer_index * AIALGO_PROFILE_PHASES + phase]. Can be 0. */
+    uint16_t layer_capacity; /**< Number of layers that fit into the layers array. Further layers are only counted in the phases. */
+
+    aialgo_profile_event_t *events; /**< Buffer for the recorded calls (for aialgo_print_profile_chrome_trace()). Can be 0. */
+    uint32_t event_capacity; /**< Number of events that fit into the buffer. */
+    uint32_t event_count; /**< Number of recorded events. */
+    uint32_t events_dropped; /**< Number of calls that were not recorded because the event buffer was full. */
+};
+
+/** @brief Initializes a profile and sets all counters to zero
+ *
+ * @param *profile          The profile to initialize
+ * @param clock             Monotonic clock function (for example micros() on Arduino)
+ * @param ticks_per_us      Clock ticks per microsecond (only used for the Chrome trace)
+ * @param *layer_counters   Array for the layer counters with at least layer_capacity * AIALGO_PROFILE_PHASES elements (can be 0)
+ * @param layer_capacity    Number of layers of the layer_counters array (at least model->layer_count to profile all layers)
+ * @param *events           Buffer for the recorded calls (can be 0)
+ * @param event_capacity    Number of elements in the events buffer
+ */
+void aialgo_init_profile(aialgo_profile_t *profile,
+                         uint32_t (*clock)(void),
+                         uint32_t ticks_per_us,
+                         aialgo_profile_counter_t *layer_counters,
+                         uint16_t layer_capacity,
+                         aialgo_profile_event_t *events,
+                         uint32_t event_capacity);
+
+/** @brief Sets all counters of a profile to zero and clears the recorded events
+ *
+ * @param *profile  The profile
+ */
+void aialgo_reset_profile(aialgo_profile_t *profile);
+
+/** @brief Attaches a profile to a model
+ *
+ * Must be called after aialgo_compile_model() (the model compilation detaches the profile).
+ *
+ * @param *model    The model
+ * @param *profile  The profile or 0 to stop the profiling
+ */
+void aialgo_set_profile_model(aimodel_t *model, aialgo_profile_t *profile);
+
+/** @brief Estimates the bytes that a layer touches in one call of a phase
+ *
+ * Every operand is counted once:
+ * - Forward: Input and result of the layer and the parameter memory (ailayer.sizeof_paramem).
+ * - Backward: Input, output deltas (size of the result), input deltas (if calculated) and the trainable parameters and their gradients.
+ * - Update: Trainable parameters, their gradients and the optimizer memory (aiopti.sizeof_optimem). 0 if the layer is not trainable.
+ *
+ * The input layer only provides the input data and touches 0 bytes. The result of layers that reuse the input buffer (e.g. Reshape) is not counted in the forward pass.
+ *
+ * @param *layer        The layer
+ * @param phase         AIALGO_PROFILE_FORWARD, AIALGO_PROFILE_BACKWARD or AIALGO_PROFILE_UPDATE
+ * @param *optimizer    The optimizer (only required for AIALGO_PROFILE_UPDATE)
+ * @return              Estimated bytes
+ */
+uint32_t aialgo_profile_layer_bytes(const ailayer_t *layer, uint8_t phase, aiopti_t *optimizer);
+
+/** @brief Starts the measurement of a layer or phase (hook of the model loops)
+ *
+ * @param *profile  The profile of the model (can be 0)
+ * @return          The current clock value (0 if profile is 0)
+ */
+uint32_t aialgo_profile_begin(aialgo_profile_t *profile);
+
+/** @brief Finishes the measurement of a layer (hook of the model loops)
+ *
+ * Adds the ticks since start, one call and the bytes of the layer (aialgo_profile_layer_bytes()) to the counters
+ * of the layer and the bytes to the counters of the phase. Records the call if an event buffer is set.
+ *
+ * @param *profile      The profile of the model (nothing happens if 0)
+ * @param *layer        The layer
+ * @param layer_index   Index of the layer in the model (0 = input layer)
+ * @param phase         AIALGO_PROFILE_FORWARD, AIALGO_PROFILE_BACKWARD or AIALGO_PROFILE_UPDATE
+ * @param start         Return value of aialgo_profile_begin()
+ * @param *optimizer    The optimizer (only required for AIALGO_PROFILE_UPDATE)
+ */
+void aialgo_profile_end_layer(aialgo_profile_t *profile, const ailayer_t *layer, uint16_t layer_index, uint8_t phase, uint32_t start, aiopti_t *optimizer);
+
+/** @brief Finishes the measurement of a whole phase (hook of the model loops)
+ *
+ * @param *profile      The profile of the model (nothing happens if 0)
+ * @param phase         AIALGO_PROFILE_FORWARD, AIALGO_PROFILE_BACKWARD or AIALGO_PROFILE_UPDATE
+ * @param start         Return value of aialgo_profile_begin()
+ */
+void aialgo_profile_end_phase(aialgo_profile_t *profile, uint8_t phase, uint32_t start);
+
+/** @brief Prints the counters of the phases and of all layers
+ *
+ * Example output (phases without calls are skipped):
+ * \code
+ * forward: 1520 ticks, 10 calls, 27520 bytes
+ * backward: 2790 ticks, 10 calls, 52480 bytes
+ * update: 940 ticks, 10 calls, 62720 bytes
+ *    0: Input
+ *       forward: 20 ticks, 10 calls, 0 bytes
+ *    1: Dense
+ *       forward: 1210 ticks, 10 calls, 21760 bytes
+ * ...
+ * \endcode
+ * The layer type names are only available if AIDEBUG_PRINT_MODULE_SPECS is enabled.
+ *
+ * @param *model    The model
+ * @param *profile  The profile
+ */
+void aialgo_print_profile(aimodel_t *model, const aialgo_profile_t *profile);
+
+/** @brief Prints the recorded events as Chrome trace JSON
+ *
+ * Every layer call is a complete event ("ph": "X") with the layer index and type as name and the phase as category.
+ * The events of the whole phases have the phase as name and the category "phase". The timestamps are relative to the earliest event. Save the output as .json file and open it in chrome://tracing or https://ui.perfetto.dev.
+ *
+ * @param *model    The model
+ * @param *profile  The profile with an event buffer
+ */
+void aialgo_print_profile_chrome_trace(aimodel_t *model, const aialgo_profile_t *profile);
+
+#endif // AIFES_WITH_PROFILING
+
+#endif // AIALGO_PROFILING
@@ -0,0 +1,234 @@
+/**
+ * \file basic/base/aialgo/aialgo_pruning.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief
+ * \details
+ */
+
+#include "basic/base/aialgo/aialgo_pruning.h"
+#include <math.h>
+#include <string.h>
+
+AISTRING_STORAGE_WRAPPER(aistring_error_sparsify_1, "[aialgo_sparsify] Error: The sparse tensor shape or data type doesn't match the weights.\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_sparsify_2, "[aialgo_sparsify] Error: The zero point of Q7 weights has to be 0.\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_sparsify_3, "[aialgo_sparsify] Error: The capacity (nnz) of the sparse tensor is too small.\n");
+
+// Number of bisection steps for the magnitude threshold (resolution of max|w| / 2^32)
+#define AIALGO_PRUNING_BISECTION_STEPS  32
+
+static uint8_t aialgo_is_prunable_f32(const ailayer_t *layer)
+{
+    return layer->layer_type == ailayer_dense_type
+           && ((ailayer_dense_t *) layer->layer_configuration)->weights.dtype == aif32
+           && layer->backward != 0;
+}
+
+// Counts the weights with |w| < threshold of one layer (layer != 0) or of all prunable layers of the model
+static uint32_t aialgo_prune_count_below(aimodel_t *model, ailayer_dense_t *layer, float threshold, float *max_abs, uint32_t *total)
+{
+    uint32_t i, j, elements, count = 0;
+    ailayer_t *layer_ptr = layer != 0 ? &layer->base : model->input_layer;
+    uint16_t layer_count = layer != 0 ? 1 : model->layer_count;
+    float *w;
+
+    *total = 0;
+    for(i = 0; i < layer_count; i++){
+        if(layer != 0 || aialgo_is_prunable_f32(layer_ptr)){
+            w = (float *) ((ailayer_dense_t *) layer_ptr->layer_configuration)->weights.data;
+            elements = aimath_tensor_elements(&((ailayer_dense_t *) layer_ptr->layer_configuration)->weights);
+            for(j = 0; j < elements; j++){
+                if(fabsf(w[j]) < threshold) count++;
+                if(fabsf(w[j]) > *max_abs) *max_abs = fabsf(w[j]);
+            }
+            *total += elements;
+        }
+        layer_ptr = layer_ptr->output_layer;
+    }
+    return count;
+}
+
+static uint32_t aialgo_prune_below(aimodel_t *model, ailayer_dense_t *layer, float sparsity)
+{
+    uint32_t i, j, elements, target, total, zeros = 0;
+    uint16_t step;
+    float max_abs = 0.0f, low, high, mid;
+    ailayer_t *layer_ptr = layer != 0 ? &layer->base : model->input_layer;
+    uint16_t layer_count = layer != 0 ? 1 : model->layer_count;
+    float *w;
+
+    if(sparsity <= 0.0f){
+        return 0;
+    }
+
+    aialgo_prune_count_below(model, layer, 0.0f, &max_abs, &total);
+    target = sparsity >= 1.0f ? total : (uint32_t) (sparsity * (float) total);
+
+    // Largest threshold with at most target weights below it
+    low = 0.0f;
+    high = max_abs;
+    if(sparsity >= 1.0f){
+        low = high * 2.0f + 1.0f;
+    } else {
+        for(step = 0; step < AIALGO_PRUNING_BISECTION_STEPS; step++){
+            mid = 0.5f * (low + high);
+            if(aialgo_prune_count_below(model, layer, mid, &max_abs, &total) <= target){
+                low = mid;
+            } else {
+                high = mid;
+            }
+        }
+    }
+
+    for(i = 0; i < layer_count; i++){
+        if(layer != 0 || aialgo_is_prunable_f32(layer_ptr)){
+            w = (float *) ((ailayer_dense_t *) layer_ptr->layer_configuration)->weights.data;
+            elements = aimath_tensor_elements(&((ailayer_dense_t *) layer_ptr->layer_configuration)->weights);
+            for(j = 0; j < elements; j++){
+                if(fabsf(w[j]) < low) w[j] = 0.0f;
+                if(w[j] == 0.0f) zeros++;
+            }
+        }
+        layer_ptr = layer_ptr->output_layer;
+    }
+    return zeros;
+}
+
+uint32_t aialgo_prune_dense_f32(ailayer_dense_t *layer, float sparsity)
+{
+    return aialgo_prune_below(0, layer, sparsity);
+}
+
+uint32_t aialgo_prune_model_f32(aimodel_t *model, float sparsity, uint8_t global)
+{
+    uint16_t i;
+    uint32_t zeros = 0;
+    ailayer_t *layer_ptr = model->input_layer;
+
+    if(global){
+        return aialgo_prune_below(model, 0, sparsity);
+    }
+
+    for(i = 0; i < model->layer_count; i++){
+        if(aialgo_is_prunable_f32(layer_ptr)){
+            zeros += aialgo_prune_below(0, (ailayer_dense_t *) layer_ptr->layer_configuration, sparsity);
+        }
+        layer_ptr = layer_ptr->output_layer;
+    }
+    return zeros;
+}
+
+// Pointer to the element [row, col] of the [neurons x inputs] view of the weights
+static const void *aialgo_sparse_element(const aitensor_t *weights, uint8_t transposed, uint16_t row, uint16_t col)
+{
+    uint32_t index = transposed ? (uint32_t) row * weights->shape[1] + col : (uint32_t) col * weights->shape[1] + row;
+
+    return weights->data + index * aimath_sizeof_dtype(weights->dtype);
+}
+
+static uint8_t aialgo_sparse_is_zero(const aitensor_t *weights, uint8_t transposed, uint16_t row, uint16_t col, uint16_t rows, uint16_t cols)
+{
+    if(row >= rows || col >= cols){
+        return TRUE;
+    }
+    if(weights->dtype == aif32){
+        return *((const float *) aialgo_sparse_element(weights, transposed, row, col)) == 0.0f;
+    }
+    return *((const int8_t *) aialgo_sparse_element(weights, transposed, row, col)) == 0;
+}
+
+// Visits all entries of the sparse format in storage order and writes them if sparse != 0
+static uint32_t aialgo_sparse_convert(const aitensor_t *weights, uint8_t transposed, uint8_t format, aitensor_t *sparse)
+{
+    uint16_t rows = transposed ? weights->shape[0] : weights->shape[1];
+    uint16_t cols = transposed ? weights->shape[1] : weights->shape[0];
+    uint32_t block_rows = AIMATH_SPARSE_ROW_PTR_LENGTH(format, rows) - 1;
+    uint16_t block_height = format == AIMATH_SPARSE_BLOCK_4X1 ? 4 : 1;
+    uint16_t block_width = format == AIMATH_SPARSE_BLOCK_1X4 ? 4 : 1;
+    uint32_t element_size = aimath_sizeof_dtype(weights->dtype);
+    aimath_sparse_params_t *params = sparse != 0 ? (aimath_sparse_params_t *) sparse->tensor_params : 0;
+    uint32_t r, c, p, row, col, entries = 0;
+    uint8_t is_zero;
+    void *value;
+
+    for(r = 0; r < block_rows; r++){
+        if(params != 0) params->row_ptr[r] = entries;
+        for(c = 0; c < cols; c += block_width){
+            is_zero = TRUE;
+            for(p = 0; p < 4 && is_zero; p++){
+                row = r * block_height + (block_height > 1 ? p : 0);
+                col = c + (block_width > 1 ? p : 0);
+                is_zero = aialgo_sparse_is_zero(weights, transposed, row, col, rows, cols);
+                if(block_height == 1 && block_width == 1) break;
+            }
+            if(is_zero){
+                continue;
+            }
+            if(params != 0){
+                params->col_idx[entries] = c;
+                for(p = 0; p < AIMATH_SPARSE_BLOCK_SIZE(format); p++){
+                    row = r * block_height + (block_height > 1 ? p : 0);
+                    col = c + (block_width > 1 ? p : 0);
+                    value = sparse->data + (entries * AIMATH_SPARSE_BLOCK_SIZE(format) + p) * element_size;
+                    if(row < rows && col < cols){
+                        memcpy(value, aialgo_sparse_element(weights, transposed, row, col), element_size);
+                    } else {
+                        memset(value, 0, element_size); // Zero padding outside of the matrix
+                    }
+                }
+            }
+            entries++;
+        }
+    }
+    if(params != 0) params->row_ptr[block_rows] = entries;
+    return entries;
+}
+
+uint32_t aialgo_count_sparse_entries(const aitensor_t *weights, uint8_t transposed, uint8_t format)
+{
+    return aialgo_sparse_convert(weights, transposed, format, 0);
+}
+
+uint8_t aialgo_sparsify(const aitensor_t *weights, uint8_t transposed, aitensor_t *sparse)
+{
+    aimath_sparse_params_t *params = (aimath_sparse_params_t *) sparse->tensor_params;
+    uint16_t rows = transposed ? weights->shape[0] : weights->shape[1];
+    uint16_t cols = transposed ? weights->shape[1] : weights->shape[0];
+
+    if(weights->dtype != sparse->dtype || (weights->dtype != aif32 && weights->dtype != aiq7)
+       || sparse->shape[0] != rows || sparse->shape[1] != cols)
+    {
+        AILOG_E(aistring_error_sparsify_1);
+        return 1;
+    }
+    if(weights->dtype == aiq7 && ((aimath_q7_params_t *) weights->tensor_params)->zero_point != 0)
+    {
+        AILOG_E(aistring_error_sparsify_2);
+        return 1;
+    }
+    if(aialgo_count_sparse_entries(weights, transposed, params->format) > params->nnz)
+    {
+        AILOG_E(aistring_error_sparsify_3);
+        return 1;
+    }
+
+    params->nnz = aialgo_sparse_convert(weights, transposed, params->format, sparse);
+    if(weights->dtype == aiq7 && params->values_params != 0){
+        memcpy(params->values_params, weights->tensor_params, sizeof(aimath_q7_params_t));
+    }
+    return 0;
+}
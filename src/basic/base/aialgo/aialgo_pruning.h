@@ -0,0 +1,115 @@
+/**
+ * \file basic/base/aialgo/aialgo_pruning.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Magnitude pruning of \link ailayer_dense.h Dense layers \endlink and conversion to \link aimath_sparse.h sparse \endlink weights
+ * \details Many weights of a trained Dense layer can be set to zero with only a small loss of accuracy. The magnitude pruning
+ * sets the weights with the smallest absolute values to zero, so that the given fraction (sparsity) of the weights is zero.
+ * The threshold can be selected per layer (every layer gets the same sparsity) or globally for all Dense layers of the model
+ * (layers with many small weights are pruned more).
+ *
+ * To recover the accuracy, the pruned model can be fine-tuned with the normal training functions. Because the training
+ * also updates the pruned weights, the model has to be pruned again after every epoch (or every few epochs) with the same sparsity.
+ * A gradual increase of the sparsity over the fine-tuning epochs usually gives a better accuracy than pruning at once.
+ *
+ * After the pruning, the weights are converted to one of the sparse formats of aimath_sparse.h with aialgo_sparsify() and
+ * used with a sparse Dense layer (e.g. ailayer_dense_sparse_f32_default() or ailayer_dense_sparse_q7_default()).
+ * Parameter memory and MACs of the layer are reduced in proportion to the sparsity.
+ *
+ * Example: Prune and fine-tune a trained F32 model, then convert a Dense layer (ailayer_dense_f32_default(), 64 inputs, 32 neurons)
+ * \code{.c}
+ * for(epoch = 0; epoch < 10; epoch++){
+ *     aialgo_prune_model_f32(&model, 0.08f * (epoch + 1), 1); // Gradually up to 80 % sparsity
+ *     aialgo_train_model(&model, &x_train, &y_train, optimizer, BATCH_SIZE);
+ * }
+ * aialgo_prune_model_f32(&model, 0.8f, 1);
+ *
+ * aimath_sparse_params_t sparse_params = {AIMATH_SPARSE_BLOCK_1X4};
+ * sparse_params.nnz = aialgo_count_sparse_entries(&dense_layer.weights, 0, AIMATH_SPARSE_BLOCK_1X4);
+ * sparse_params.row_ptr = malloc(AIMATH_SPARSE_ROW_PTR_LENGTH(AIMATH_SPARSE_BLOCK_1X4, 32) * sizeof(uint32_t));
+ * sparse_params.col_idx = malloc(sparse_params.nnz * sizeof(uint16_t));
+ * float *values = malloc(AIMATH_SPARSE_VALUES_LENGTH(AIMATH_SPARSE_BLOCK_1X4, sparse_params.nnz) * sizeof(float));
+ * uint16_t sparse_shape[2] = {32, 64};
+ * aitensor_t sparse_weights = {aif32, 2, sparse_shape, &sparse_params, values};
+ * aialgo_sparsify(&dense_layer.weights, 0, &sparse_weights);
+ *
+ * ailayer_dense_f32_t sparse_layer = AILAYER_DENSE_SPARSE_F32_M(32, &sparse_params, values, dense_layer.bias.data);
+ * \endcode
+ */
+
+#ifndef AIALGO_PRUNING
+#define AIALGO_PRUNING
+
+#include "core/aifes_core.h"
+#include "core/aifes_math.h"
+#include "basic/base/aimath/aimath_f32.h"
+#include "basic/base/aimath/aimath_q7.h"
+#include "basic/base/aimath/aimath_sparse.h"
+#include "basic/base/ailayer/ailayer_dense.h"
+
+/** @brief Set the weights with the smallest magnitude of an \link aimath_f32.h F32 \endlink Dense layer to zero
+ *
+ * The threshold is selected so that (at least nearly, equal magnitudes are pruned together) the given fraction of the weights is zero.
+ * The bias is not pruned.
+ *
+ * @param *layer        F32 Dense layer (e.g. ailayer_dense_f32_default() or ailayer_dense_wt_f32_default())
+ * @param sparsity      Fraction of the weights to set to zero (0 to 1)
+ * @return              Number of zero weights of the layer
+ */
+uint32_t aialgo_prune_dense_f32(ailayer_dense_t *layer, float sparsity);
+
+/** @brief Set the weights with the smallest magnitude of all \link aimath_f32.h F32 \endlink Dense layers of a model to zero
+ *
+ * Layers with read-only parameters (without a backward function, e.g. ailayer_dense_f32_storage()) are skipped.
+ *
+ * @param *model        The model
+ * @param sparsity      Fraction of the weights to set to zero (0 to 1)
+ * @param global        One threshold for all layers (1) or the same sparsity for every layer (0)
+ * @return              Number of zero weights of all pruned layers
+ */
+uint32_t aialgo_prune_model_f32(aimodel_t *model, float sparsity, uint8_t global);
+
+/** @brief Count the entries that are needed to store a weights matrix in a sparse format
+ *
+ * The result is the nnz field of aimath_sparse_params_t: The number of non-zero elements for AIMATH_SPARSE_CSR or
+ * the number of blocks with at least one non-zero element for the block formats.
+ *
+ * @param *weights      F32 or Q7 weights matrix (2D tensor)
+ * @param transposed    Weights are of shape [neurons x inputs] (1) or [inputs x neurons] (0)
+ * @param format        Sparse format (AIMATH_SPARSE_CSR, AIMATH_SPARSE_BLOCK_1X4 or AIMATH_SPARSE_BLOCK_4X1)
+ * @return              Number of entries
+ */
+uint32_t aialgo_count_sparse_entries(const aitensor_t *weights, uint8_t transposed, uint8_t format);
+
+/** @brief Convert a (pruned) weights matrix into a sparse matrix
+ *
+ * The sparse matrix has always the transposed layout [neurons x inputs] that is used by the sparse Dense layers.
+ * The tensor params of the sparse tensor have to be an aimath_sparse_params_t with the format set, nnz set to the capacity
+ * of the buffers (at least aialgo_count_sparse_entries()) and the row_ptr, col_idx and data buffers set.
+ * nnz is set to the number of written entries. For \link aimath_q7.h Q7 \endlink weights, the quantization parameters are copied
+ * to values_params (if set) and the zero point has to be 0.
+ *
+ * @param *weights      F32 or Q7 weights matrix (2D tensor)
+ * @param transposed    Weights are of shape [neurons x inputs] (1) or [inputs x neurons] (0)
+ * @param *sparse       Sparse tensor of the same data type with shape [neurons x inputs] (output)
+ * @return              0 on success, 1 if the shapes, data types or the capacity do not match
+ */
+uint8_t aialgo_sparsify(const aitensor_t *weights, uint8_t transposed, aitensor_t *sparse);
+
+#endif // AIALGO_PRUNING
@@ -23,6 +23,7 @@
 
 #include "basic/default/aimath/aimath_f32_default.h"
 #include "basic/default/aimath/aimath_q7_default.h"
+#include "basic/base/aialgo/aialgo_profiling.h"
 
 #include <float.h>
 #include <string.h>
@@ -219,13 +220,27 @@ aitensor_t *aialgo_forward_model(aimodel_t *model, aitensor_t *input_data)
 {
 	uint16_t i;
 	ailayer_t *layer_ptr = model->input_layer;
+#ifdef AIFES_WITH_PROFILING
+	uint32_t phase_start, layer_start;
+
+	phase_start = aialgo_profile_begin(model->profile);
+#endif
 
 	model->input_layer->result.data = input_data->data;
 	for(i = 0; i < model->layer_count; i++)
 	{
+#ifdef AIFES_WITH_PROFILING
+	    layer_start = aialgo_profile_begin(model->profile);
+#endif
 		layer_ptr->forward(layer_ptr);
+#ifdef AIFES_WITH_PROFILING
+		aialgo_profile_end_layer(model->profile, layer_ptr, i, AIALGO_PROFILE_FORWARD, layer_start, 0);
+#endif
 		layer_ptr = layer_ptr->output_layer;
 	}
+#ifdef AIFES_WITH_PROFILING
+	aialgo_profile_end_phase(model->profile, AIALGO_PROFILE_FORWARD, phase_start);
+#endif
 	return &(model->output_layer->result);
 }
 
@@ -252,6 +267,12 @@ uint8_t aialgo_inference_model(aimodel_t *model, aitensor_t *input_data, aitenso
 	};
 	aitensor_t *output_batch;
 
+	// With fused input quantization, the input data contains raw values in the format of the aimath_q7_source_params_t
+	uint8_t input_element_size = input_data->dtype->size;
+	if(AILAYER_SETTINGS_IS(model->input_layer->settings, 0b1, AILAYER_SETTINGS_SOURCE_INPUT)){
+        input_element_size = aimath_q7_sizeof_source_value((aimath_q7_source_params_t *) model->input_layer->result.tensor_params);
+	}
+
 	uint32_t input_multiplier = 1;
 	for(i = input_data->dim - 1; i > 0; i--)
 	{
@@ -271,7 +292,7 @@ uint8_t aialgo_inference_model(aimodel_t *model, aitensor_t *input_data, aitenso
 
 	for(i = 0; i < batch_size / batch_slice_size; i++)
 	{
-		input_batch.data = input_data->data + i * batch_slice_size * input_multiplier * input_data->dtype->size;
+		input_batch.data = input_data->data + i * batch_slice_size * input_multiplier * input_element_size;
 
 		output_batch = aialgo_forward_model(model, &input_batch);
 
@@ -304,6 +325,9 @@ uint8_t aialgo_compile_model(aimodel_t *model)
 		layer_ptr = layer_ptr->output_layer;
 	}
 	model->layer_count = layer_counter;
+#ifdef AIFES_WITH_PROFILING
+	model->profile = 0;
+#endif
 
 	return 0;
 }
@@ -431,8 +455,11 @@ void aialgo_set_model_delta_precision_q31(aimodel_t *model, uint16_t shift)
 
 	if(model->output_layer->output_layer != 0){
         for(i = 0; i < model->layer_count; i++){
-            ((aimath_q31_params_t *) layer_ptr->deltas.tensor_params)->shift = shift;
-            ((aimath_q31_params_t *) layer_ptr->deltas.tensor_params)->zero_point = 0;
+            // Layers in front of the first trainable layer have no deltas
+            if(layer_ptr->deltas.tensor_params != 0){
+                ((aimath_q31_params_t *) layer_ptr->deltas.tensor_params)->shift = shift;
+                ((aimath_q31_params_t *) layer_ptr->deltas.tensor_params)->zero_point = 0;
+            }
 
             layer_ptr = layer_ptr->output_layer;
         }
@@ -452,9 +479,12 @@ void aialgo_set_model_gradient_precision_q31(aimodel_t *model, uint16_t shift)
 	ailayer_t *layer_ptr = model->input_layer;
 
 	for(i = 0; i < model->layer_count; i++){
-        for(j = 0; j < layer_ptr->trainable_params_count; j++){
-            ((aimath_q31_params_t *) layer_ptr->gradients[j]->tensor_params)->shift = shift;
-            ((aimath_q31_params_t *) layer_ptr->gradients[j]->tensor_params)->zero_point = 0;
+        // Frozen layers have no gradients
+        if(AILAYER_SETTINGS_IS(layer_ptr->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)){
+            for(j = 0; j < layer_ptr->trainable_params_count; j++){
+                ((aimath_q31_params_t *) layer_ptr->gradients[j]->tensor_params)->shift = shift;
+                ((aimath_q31_params_t *) layer_ptr->gradients[j]->tensor_params)->zero_point = 0;
+            }
         }
 
 		layer_ptr = layer_ptr->output_layer;
@@ -21,9 +21,14 @@
 
 #include "basic/base/aialgo/aialgo_sequential_training.h"
 #include "basic/base/aialgo/aialgo_sequential_inference.h"
+#include "basic/base/aialgo/aialgo_profiling.h"
 
 // ToDo: Remove dependency
 #include "basic/default/aimath/aimath_f32_default.h"
+#include "basic/base/aimath/aimath_q7.h"
+
+#include <float.h>
+#include <string.h>
 
 #ifdef AIDEBUG_GENERAL_CHECKS
 AISTRING_STORAGE_WRAPPER(aistring_error_no_output_layer, "[aialgo_..._training_memory] Layer output missing! Define a loss for every output layer or use aialgo_..._inference_memory() instead.\n");
@@ -35,6 +40,10 @@ uint32_t aialgo_sizeof_training_memory(aimodel_t *model, aiopti_t *optimizer)
 	ailayer_t *layer_ptr = model->input_layer;
 	uint32_t memory = 0, fwd_bwd_memory = 0;
 
+	// The backward pass stops at the first trainable layer, so the layers in front of it need no memory for the backward pass
+	ailayer_t *first_trainable_layer = aialgo_get_first_trainable_layer(model);
+	uint8_t frozen_prefix = TRUE;
+
 	for(i = 0; i < model->layer_count; i++)
 	{
 #ifdef AIDEBUG_GENERAL_CHECKS
@@ -43,6 +52,9 @@ uint32_t aialgo_sizeof_training_memory(aimodel_t *model, aiopti_t *optimizer)
             return 1;
 	    }
 #endif
+        if(layer_ptr == first_trainable_layer){
+            frozen_prefix = FALSE;
+        }
 
 		layer_ptr->calc_result_shape(layer_ptr);
 
@@ -61,7 +73,7 @@ uint32_t aialgo_sizeof_training_memory(aimodel_t *model, aiopti_t *optimizer)
         }
 
 		// Memory for the qantization parameter of the deltas
-		if(layer_ptr->output_layer->deltas.dtype != 0){
+		if(layer_ptr->output_layer->deltas.dtype != 0 && !frozen_prefix){
             memory += layer_ptr->output_layer->deltas.dtype->tensor_params_size;
             AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
 		}
@@ -73,7 +85,7 @@ uint32_t aialgo_sizeof_training_memory(aimodel_t *model, aiopti_t *optimizer)
 		}
 
 		// optimization memory (e.g. first or second momentum)
-		if(optimizer->sizeof_optimem != 0){
+		if(optimizer->sizeof_optimem != 0 && AILAYER_SETTINGS_IS(layer_ptr->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)){
 			for(j = 0; j < layer_ptr->trainable_params_count; j++){
 				memory += optimizer->sizeof_optimem(optimizer, layer_ptr->trainable_params[j]);
                 AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
@@ -86,7 +98,7 @@ uint32_t aialgo_sizeof_training_memory(aimodel_t *model, aiopti_t *optimizer)
         }
 
         // Memory for temporary results of the backward pass
-        if(layer_ptr->sizeof_bwdmem != 0){
+        if(layer_ptr->sizeof_bwdmem != 0 && !frozen_prefix){
             if(layer_ptr->sizeof_bwdmem(layer_ptr) > fwd_bwd_memory) fwd_bwd_memory = layer_ptr->sizeof_bwdmem(layer_ptr);
         }
 
@@ -102,14 +114,21 @@ uint8_t aialgo_schedule_training_memory(aimodel_t *model, aiopti_t *optimizer, v
 	uint32_t address_counter = 0, fwd_bwd_memory = 0;
 	ailayer_t *layer_ptr = model->input_layer;
 
+	// The backward pass stops at the first trainable layer, so the layers in front of it need no memory for the backward pass
+	ailayer_t *first_trainable_layer = aialgo_get_first_trainable_layer(model);
+	uint8_t frozen_prefix = TRUE;
+
     // Assign memory for foreward pass and backward pass temp results
 	for(i = 0; i < model->layer_count; i++){
+        if(layer_ptr == first_trainable_layer){
+            frozen_prefix = FALSE;
+        }
         // Memory for temporary results of the forward pass
         if(layer_ptr->sizeof_fwdmem != 0){
             if(layer_ptr->sizeof_fwdmem(layer_ptr) > fwd_bwd_memory) fwd_bwd_memory = layer_ptr->sizeof_fwdmem(layer_ptr);
         }
         // Memory for temporary results of the backward pass
-        if(layer_ptr->sizeof_bwdmem != 0){
+        if(layer_ptr->sizeof_bwdmem != 0 && !frozen_prefix){
             if(layer_ptr->sizeof_bwdmem(layer_ptr) > fwd_bwd_memory) fwd_bwd_memory = layer_ptr->sizeof_bwdmem(layer_ptr);
         }
         layer_ptr->tempmem = memory_ptr;
@@ -120,6 +139,7 @@ uint8_t aialgo_schedule_training_memory(aimodel_t *model, aiopti_t *optimizer, v
     address_counter += fwd_bwd_memory;
 
     layer_ptr = model->input_layer;
+    frozen_prefix = TRUE;
 	for(i = 0; i < model->layer_count; i++)
 	{
 #ifdef AIDEBUG_GENERAL_CHECKS
@@ -128,6 +148,9 @@ uint8_t aialgo_schedule_training_memory(aimodel_t *model, aiopti_t *optimizer, v
             return -1;
 	    }
 #endif
+        if(layer_ptr == first_trainable_layer){
+            frozen_prefix = FALSE;
+        }
 
 		layer_ptr->calc_result_shape(layer_ptr);
 
@@ -157,7 +180,10 @@ uint8_t aialgo_schedule_training_memory(aimodel_t *model, aiopti_t *optimizer, v
 		layer_ptr->output_layer->deltas.shape = layer_ptr->result.shape;
 
 		// Memory for the qantization parameter of the deltas
-		if(layer_ptr->output_layer->deltas.dtype != 0){
+		if(frozen_prefix){
+            // No deltas are calculated for the frozen layers in front of the first trainable layer
+            layer_ptr->output_layer->deltas.tensor_params = 0;
+		} else if(layer_ptr->output_layer->deltas.dtype != 0){
             layer_ptr->output_layer->deltas.tensor_params = memory_ptr + address_counter;
             address_counter += layer_ptr->output_layer->deltas.dtype->tensor_params_size;
             AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
@@ -171,7 +197,7 @@ uint8_t aialgo_schedule_training_memory(aimodel_t *model, aiopti_t *optimizer, v
 		}
 
 		// optimization memory (e.g. first or second momentum)
-		if(optimizer->sizeof_optimem != 0){
+		if(optimizer->sizeof_optimem != 0 && AILAYER_SETTINGS_IS(layer_ptr->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)){
 			for(j = 0; j < layer_ptr->trainable_params_count; j++){
 				layer_ptr->optimem[j] = memory_ptr + address_counter;
 				address_counter += optimizer->sizeof_optimem(optimizer, layer_ptr->trainable_params[j]);
@@ -193,10 +219,13 @@ void aialgo_init_model_for_training(aimodel_t *model, aiopti_t *optimizer)
 	for(i = 0; i < model->layer_count; i++)
 	{
 		// Init the optimization memory (e.g. setting the momentums to zero)
-		for(j = 0; j < layer_ptr->trainable_params_count; j++){
-			if(optimizer->init_optimem != 0){
-				optimizer->init_optimem(optimizer, layer_ptr->trainable_params[j], layer_ptr->gradients[j], layer_ptr->optimem[j]);
-			}
+		// Frozen layers have no optimization memory
+		if(AILAYER_SETTINGS_IS(layer_ptr->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)){
+            for(j = 0; j < layer_ptr->trainable_params_count; j++){
+                if(optimizer->init_optimem != 0){
+                    optimizer->init_optimem(optimizer, layer_ptr->trainable_params[j], layer_ptr->gradients[j], layer_ptr->optimem[j]);
+                }
+            }
 		}
 		layer_ptr = layer_ptr->output_layer;
 	}
@@ -211,25 +240,77 @@ void aialgo_backward_model(aimodel_t *model, aitensor_t *target_data)
 {
 	uint16_t i;
 	ailayer_t *layer_ptr = model->output_layer;
+	ailayer_t *first_trainable_layer = aialgo_get_first_trainable_layer(model);
+	uint32_t first_trainable_settings;
+#ifdef AIFES_WITH_PROFILING
+	uint32_t phase_start, layer_start;
+#endif
 
+	if(first_trainable_layer == 0){
+        // Nothing to train
+        return;
+	}
+
+	// No layer in front of the first trainable layer needs deltas
+	first_trainable_settings = first_trainable_layer->settings;
+	AILAYER_SETTINGS_SET(first_trainable_layer->settings, 0b1, AILAYER_SETTINGS_NO_INPUT_GRADIENT, TRUE);
+
+#ifdef AIFES_WITH_PROFILING
+	phase_start = aialgo_profile_begin(model->profile);
+#endif
 	model->loss->calc_delta(model->loss, target_data);
 	for(i = 0; i < model->layer_count; i++)
 	{
 #ifdef AIDEBUG_GENERAL_CHECKS
 	    if(layer_ptr->backward == 0){
             AILOG_E(aistring_error_backward_1);
-            return;
+            break;
 	    }
+#endif
+#ifdef AIFES_WITH_PROFILING
+	    layer_start = aialgo_profile_begin(model->profile);
 #endif
 		layer_ptr->backward(layer_ptr);
+#ifdef AIFES_WITH_PROFILING
+		aialgo_profile_end_layer(model->profile, layer_ptr, model->layer_count - 1 - i, AIALGO_PROFILE_BACKWARD, layer_start, 0);
+#endif
+		if(layer_ptr == first_trainable_layer){
+            break;
+		}
 		layer_ptr = layer_ptr->input_layer;
 	}
+#ifdef AIFES_WITH_PROFILING
+	aialgo_profile_end_phase(model->profile, AIALGO_PROFILE_BACKWARD, phase_start);
+#endif
+
+	first_trainable_layer->settings = first_trainable_settings;
 	return;
 }
 
 AISTRING_STORAGE_WRAPPER(aistring_error_train_model_1, "[aialgo_train_model] ERROR: Batch size must be dividable by the input layer batch size.\n");
 
-uint8_t aialgo_train_model(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size)
+// Accumulate the loss of the current forward pass (called before the backward pass overrides the output layer results)
+static void aialgo_accumulate_loss_f32(ailoss_t *loss, aitensor_t *target_batch, void *result)
+{
+    float slice_loss;
+
+    loss->calc_loss(loss, target_batch, &slice_loss);
+    *((float *) result) += slice_loss;
+    return;
+}
+
+static void aialgo_accumulate_loss_q31(ailoss_t *loss, aitensor_t *target_batch, void *result)
+{
+    aiscalar_q31_t *result_q31 = (aiscalar_q31_t *) result;
+    aiscalar_q31_t slice_loss = { .shift = result_q31->shift, .zero_point = result_q31->zero_point};
+
+    loss->calc_loss(loss, target_batch, &slice_loss);
+    result_q31->value += slice_loss.value - slice_loss.zero_point;
+    return;
+}
+
+static uint8_t aialgo_train_model_internal(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size,
+                                           void (*accumulate_loss)(ailoss_t *loss, aitensor_t *target_batch, void *result), void *loss_result)
 {
 	uint32_t i, batch;
 
@@ -286,6 +367,10 @@ uint8_t aialgo_train_model(aimodel_t *model, aitensor_t *input_tensor, aitensor_
 			target_batch.data = target_tensor->data + batch * target_multiplier * batch_size + i * target_multiplier * batch_slice_size;
 
 			aialgo_forward_model(model, &input_batch);
+			if(accumulate_loss != 0){
+                // The loss has to be calculated before the backward pass, because the deltas override the output results
+                accumulate_loss(model->loss, &target_batch, loss_result);
+			}
 			aialgo_backward_model(model, &target_batch);
 		}
 
@@ -294,6 +379,253 @@ uint8_t aialgo_train_model(aimodel_t *model, aitensor_t *input_tensor, aitensor_
 	return 0;
 }
 
+uint8_t aialgo_train_model(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size)
+{
+    return aialgo_train_model_internal(model, input_tensor, target_tensor, optimizer, batch_size, 0, 0);
+}
+
+uint8_t aialgo_train_model_with_loss_f32(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size, float *loss)
+{
+    *loss = 0;
+    return aialgo_train_model_internal(model, input_tensor, target_tensor, optimizer, batch_size, aialgo_accumulate_loss_f32, loss);
+}
+
+uint8_t aialgo_train_model_with_loss_q31(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size, aiscalar_q31_t *loss)
+{
+    loss->value = loss->zero_point;
+    return aialgo_train_model_internal(model, input_tensor, target_tensor, optimizer, batch_size, aialgo_accumulate_loss_q31, loss);
+}
+
+ailayer_t *aialgo_get_first_trainable_layer(aimodel_t *model)
+{
+	uint16_t i;
+	ailayer_t *layer_ptr = model->input_layer;
+
+	for(i = 0; i < model->layer_count; i++)
+	{
+	    if(layer_ptr->trainable_params_count > 0 && AILAYER_SETTINGS_IS(layer_ptr->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)){
+            return layer_ptr;
+	    }
+		layer_ptr = layer_ptr->output_layer;
+	}
+	return 0;
+}
+
+// Returns the layer that owns the result buffer of the given layer (Layers like reshape reuse the buffer of the previous layer)
+static ailayer_t *aialgo_get_result_buffer_owner(ailayer_t *layer)
+{
+    while(AILAYER_SETTINGS_IS(layer->settings, 0b1, AILAYER_SETTINGS_KEEP_INPUT_BUFFER_FOR_RESULT) && layer->input_layer != 0){
+        layer = layer->input_layer;
+    }
+    return layer;
+}
+
+AISTRING_STORAGE_WRAPPER(aistring_error_frozen_features_1, "[aialgo_..._frozen_features] ERROR: The model has no frozen layers in front of the first trainable layer.\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_frozen_features_2, "[aialgo_..._frozen_features] ERROR: Data type of the feature tensor does not match the feature layer result (only F32 results can be cached as Q7).\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_frozen_features_3, "[aialgo_..._frozen_features] ERROR: Number of samples must be dividable by the input layer batch size.\n");
+
+// Check the model and the feature tensor and return the last frozen layer (the layer that provides the features)
+static ailayer_t *aialgo_get_frozen_feature_layer(aimodel_t *model, aitensor_t *feature_tensor)
+{
+    ailayer_t *first_trainable_layer = aialgo_get_first_trainable_layer(model);
+    ailayer_t *feature_layer;
+
+    if(first_trainable_layer == 0 || aialgo_get_result_buffer_owner(first_trainable_layer->input_layer) == model->input_layer){
+        AILOG_E(aistring_error_frozen_features_1);
+        return 0;
+    }
+    feature_layer = first_trainable_layer->input_layer;
+
+    if(feature_tensor->dtype != feature_layer->result.dtype
+       && !(feature_tensor->dtype == aiq7 && feature_layer->result.dtype == aif32)){
+        AILOG_E(aistring_error_frozen_features_2);
+        return 0;
+    }
+    if(feature_tensor->shape[0] % feature_layer->result.shape[0] != 0){
+        AILOG_E(aistring_error_frozen_features_3);
+        return 0;
+    }
+    return feature_layer;
+}
+
+uint32_t aialgo_sizeof_frozen_features(aimodel_t *model, uint32_t sample_count, const aimath_dtype_t *dtype)
+{
+    ailayer_t *first_trainable_layer = aialgo_get_first_trainable_layer(model);
+    ailayer_t *feature_layer;
+
+    if(first_trainable_layer == 0){
+        return 0;
+    }
+    feature_layer = first_trainable_layer->input_layer;
+    feature_layer->calc_result_shape(feature_layer);
+
+    return sample_count * (aimath_tensor_elements(&feature_layer->result) / feature_layer->result.shape[0]) * aimath_sizeof_dtype(dtype);
+}
+
+uint8_t aialgo_calc_frozen_features(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *feature_tensor)
+{
+	uint32_t i, j;
+	uint8_t pass, quantize;
+	float min_value, max_value, slice_min, slice_max;
+	ailayer_t *layer_ptr;
+    ailayer_t *feature_layer = aialgo_get_frozen_feature_layer(model, feature_tensor);
+
+    if(feature_layer == 0){
+        return 1;
+    }
+
+	// Only a F32 result is quantized into a Q7 cache, otherwise the data types are equal and the result is copied
+	quantize = (feature_tensor->dtype == aiq7 && feature_layer->result.dtype == aif32);
+
+	uint16_t batch_slice_size = model->input_layer->result.shape[0]; // Size of a batch that is processed by one forward pass
+
+	aitensor_t feature_batch;
+	feature_batch.dtype = feature_tensor->dtype;
+	feature_batch.dim = feature_layer->result.dim;
+	feature_batch.shape = feature_layer->result.shape;
+	feature_batch.tensor_params = feature_tensor->tensor_params;
+
+	uint32_t input_multiplier = 1;
+	for(i = input_tensor->dim - 1; i > 0; i--)
+	{
+		input_multiplier *= input_tensor->shape[i];
+	}
+	input_multiplier *= input_tensor->dtype->size;
+	uint32_t feature_multiplier = aimath_tensor_elements(&feature_layer->result) / batch_slice_size;
+	feature_multiplier *= feature_tensor->dtype->size;
+
+	aialgo_set_training_mode_model(model, FALSE);
+	aialgo_set_batch_mode_model(model, FALSE);
+
+	min_value = FLT_MAX;
+	max_value = -FLT_MAX;
+
+	// Quantizing the features needs an additional pass to determine their value range
+	for(pass = quantize ? 0 : 1; pass < 2; pass++)
+	{
+        for(i = 0; i < input_tensor->shape[0] / batch_slice_size; i++)
+        {
+            // Forward pass through the frozen layers only
+            model->input_layer->result.data = input_tensor->data + i * batch_slice_size * input_multiplier;
+            layer_ptr = model->input_layer;
+            for(j = 0; j < model->layer_count; j++)
+            {
+                layer_ptr->forward(layer_ptr);
+                if(layer_ptr == feature_layer) break;
+                layer_ptr = layer_ptr->output_layer;
+            }
+
+            feature_batch.data = feature_tensor->data + i * batch_slice_size * feature_multiplier;
+            if(pass == 0){
+                aimath_f32_default_min(&feature_layer->result, &slice_min);
+                aimath_f32_default_max(&feature_layer->result, &slice_max);
+                if(slice_min < min_value) min_value = slice_min;
+                if(slice_max > max_value) max_value = slice_max;
+            } else if(quantize){
+                aimath_q7_quantize_tensor_from_f32(&feature_layer->result, &feature_batch);
+            } else {
+                memcpy(feature_batch.data, feature_layer->result.data, aimath_sizeof_tensor_data(&feature_layer->result));
+            }
+        }
+
+        if(pass == 0){
+            aimath_q7_calc_q_params_from_f32(min_value, max_value, (aimath_q7_params_t *) feature_tensor->tensor_params);
+        }
+	}
+
+	// A Q7 result is copied as it is, so the cache takes over the quantization parameters of the feature layer
+	if(!quantize && feature_tensor->dtype == aiq7){
+        *((aimath_q7_params_t *) feature_tensor->tensor_params) = *((aimath_q7_params_t *) feature_layer->result.tensor_params);
+	}
+	return 0;
+}
+
+uint8_t aialgo_train_model_on_frozen_features(aimodel_t *model, aitensor_t *feature_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size)
+{
+	uint32_t i, j, k, batch;
+	ailayer_t *layer_ptr;
+	ailayer_t *feature_layer = aialgo_get_frozen_feature_layer(model, feature_tensor);
+
+	if(feature_layer == 0){
+        return 1;
+	}
+
+	ailayer_t *first_trainable_layer = feature_layer->output_layer;
+	void *feature_buffer = aialgo_get_result_buffer_owner(feature_layer)->result.data;
+	void *feature_layer_data = feature_layer->result.data;
+
+	uint32_t batch_count = (uint32_t) (feature_tensor->shape[0] / batch_size);
+	uint32_t batch_slice_size = model->input_layer->result.shape[0]; // Size of a batch that is processed by one forward pass
+
+	// Do some error checking
+	if(batch_size % batch_slice_size != 0){
+        AILOG_E(aistring_error_train_model_1);
+        return 1;
+	}
+
+	aitensor_t target_batch;
+	uint16_t target_batch_shape[target_tensor->dim];
+	target_batch.dtype = target_tensor->dtype;
+	target_batch.dim = target_tensor->dim;
+	target_batch.shape = target_batch_shape;
+	target_batch.tensor_params = target_tensor->tensor_params;
+
+	uint32_t feature_elements = aimath_tensor_elements(&feature_layer->result);
+	uint32_t feature_multiplier = feature_elements / batch_slice_size;
+	feature_multiplier *= feature_tensor->dtype->size;
+	uint32_t target_multiplier = 1;
+	for(i = target_tensor->dim - 1; i > 0; i--)
+	{
+		target_multiplier *= target_tensor->shape[i];
+		target_batch_shape[i] = target_tensor->shape[i];
+	}
+	target_multiplier *= target_tensor->dtype->size;
+	target_batch_shape[0] = batch_slice_size;
+
+	aialgo_set_training_mode_model(model, TRUE);
+    aialgo_set_batch_mode_model(model, (batch_size == batch_slice_size)? TRUE : FALSE);
+
+	for(batch = 0; batch < batch_count; batch++)
+	{
+		aialgo_zero_gradients_model(model, optimizer);
+		for(i = 0; i < batch_size / batch_slice_size; i++)
+		{
+			void *feature_data = feature_tensor->data + batch * feature_multiplier * batch_size + i * feature_multiplier * batch_slice_size;
+			target_batch.data = target_tensor->data + batch * target_multiplier * batch_size + i * target_multiplier * batch_slice_size;
+
+			if(feature_tensor->dtype == feature_layer->result.dtype){
+                // Use the cached features directly as input for the trainable layers
+                feature_layer->result.data = feature_data;
+			} else {
+			    // Dequantize the Q7 features into the result buffer of the feature layer
+			    uint16_t shift = ((aimath_q7_params_t *) feature_tensor->tensor_params)->shift;
+			    int8_t zero_point = ((aimath_q7_params_t *) feature_tensor->tensor_params)->zero_point;
+			    for(k = 0; k < feature_elements; k++){
+                    ((float *) feature_buffer)[k] = Q7_TO_FLOAT(((int8_t *) feature_data)[k], shift, zero_point);
+			    }
+			    feature_layer->result.data = feature_buffer;
+			}
+
+			// Forward pass through the trainable layers
+			layer_ptr = first_trainable_layer;
+            for(j = 0; j < model->layer_count; j++)
+            {
+                layer_ptr->forward(layer_ptr);
+                if(layer_ptr == model->output_layer) break;
+                layer_ptr = layer_ptr->output_layer;
+            }
+
+            // The backward pass stops at the first trainable layer and does not override the features
+            aialgo_backward_model(model, &target_batch);
+		}
+
+		aialgo_update_params_model(model, optimizer);
+	}
+
+	feature_layer->result.data = feature_layer_data;
+	return 0;
+}
+
 AISTRING_STORAGE_WRAPPER(aistring_error_loss_model_1, "[aialgo_calc_loss_model] ERROR: Number of samples must be dividable by the input layer batch size.\n");
 
 uint8_t aialgo_calc_loss_model_f32(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, float *result)
@@ -436,6 +768,11 @@ void aialgo_update_params_model(aimodel_t *model, aiopti_t *optimizer)
 {
 	uint16_t i, j;
 	ailayer_t *layer_ptr = model->input_layer;
+#ifdef AIFES_WITH_PROFILING
+	uint32_t phase_start, layer_start;
+
+	phase_start = aialgo_profile_begin(model->profile);
+#endif
 
 	if(optimizer->begin_step != 0){
 		optimizer->begin_step(optimizer);
@@ -443,16 +780,25 @@ void aialgo_update_params_model(aimodel_t *model, aiopti_t *optimizer)
 	for(i = 0; i < model->layer_count; i++)
 	{
 	    if(AILAYER_SETTINGS_IS(layer_ptr->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)){
+#ifdef AIFES_WITH_PROFILING
+            layer_start = aialgo_profile_begin(model->profile);
+#endif
             for(j = 0; j < layer_ptr->trainable_params_count; j++){
                 optimizer->update_params(optimizer, layer_ptr->trainable_params[j], layer_ptr->gradients[j], layer_ptr->optimem[j]);
                 //print_aitensor(layer_ptr->gradients[j]);
             }
+#ifdef AIFES_WITH_PROFILING
+            aialgo_profile_end_layer(model->profile, layer_ptr, i, AIALGO_PROFILE_UPDATE, layer_start, optimizer);
+#endif
 	    }
 		layer_ptr = layer_ptr->output_layer;
 	}
 	if(optimizer->end_step != 0){
 		optimizer->end_step(optimizer);
 	}
+#ifdef AIFES_WITH_PROFILING
+	aialgo_profile_end_phase(model->profile, AIALGO_PROFILE_UPDATE, phase_start);
+#endif
 	return;
 }
 
@@ -33,6 +33,10 @@
  *
  * This memory is used for intermediate results, gradients and momentums.
  *
+ * Frozen layers (AILAYER_SETTINGS_TRAINABLE not set) need no memory for gradients and momentums.
+ * The layers in front of the first trainable layer additionally need no memory for the backward pass.
+ * Therefore the trainable settings of the layers must be set before calling this function.
+ *
  * Use aialgo_schedule_training_memory() to set the memory to the model.
  *
  * @param *model        The model
@@ -63,6 +67,9 @@ uint8_t aialgo_schedule_training_memory(aimodel_t *model, aiopti_t *optimizer, v
 void aialgo_init_model_for_training(aimodel_t *model, aiopti_t *optimizer);
 
 /** @brief Perform the backward pass
+ *
+ * The backward pass stops at the first trainable layer of the model, because the deltas of the
+ * frozen layers in front of it are not needed. The input gradient of the first trainable layer is not calculated.
  *
  * @param *model         The model
  * @param *target_data   The tensor containing the target data / labels
@@ -104,6 +111,133 @@ void aialgo_backward_model(aimodel_t *model, aitensor_t *target_data);
  */
 uint8_t aialgo_train_model(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size);
 
+/** @brief Perform one training epoch and accumulate the loss in \link aimath_f32.h F32 \endlink data type
+ *
+ * Same as aialgo_train_model(), but the loss of every forward pass is accumulated on the fly with
+ * ailoss.calc_loss before the backward pass is performed. Compared to calling aialgo_calc_loss_model_f32()
+ * after the epoch, no additional forward pass over the whole dataset is needed.
+ *
+ * Keep in mind that the parameters are updated during the epoch, so the resulting loss is the running loss of the
+ * epoch and not the loss of the final parameters. Layers like Batch Normalization are also in training mode while the loss is calculated.
+ *
+ * Example: Training of an F32 model with loss monitoring
+ * \code{.c}
+ * float loss;
+ * for(i = 0; i < epochs; i++)
+ * {
+ *     if(i % print_interval == 0)
+ *     {
+ *         aialgo_train_model_with_loss_f32(&model, &input_tensor, &target_tensor, optimizer, batch_size, &loss);
+ *         printf("Epoch %5d: loss: %f\n", i, loss);
+ *     } else {
+ *         aialgo_train_model(&model, &input_tensor, &target_tensor, optimizer, batch_size);
+ *     }
+ * }
+ * \endcode
+ *
+ * @param *model            The model
+ * @param *input_tensor     The tensor containing the input data
+ * @param *target_tensor    The tensor containing the target data / labels
+ * @param *optimizer        The optimizer that is used for training
+ * @param batch_size        Size of a batch / Number of input vektors
+ * @param *loss             The accumulated loss of the epoch will be written here
+ * @return                  0 if successful
+ */
+uint8_t aialgo_train_model_with_loss_f32(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size, float *loss);
+
+/** @brief Perform one training epoch and accumulate the loss in \link aimath_q31.h Q31 \endlink data type
+ *
+ * Same as aialgo_train_model_with_loss_f32() but for \link aimath_q31.h Q31 \endlink losses.
+ *
+ * @param *model            The model
+ * @param *input_tensor     The tensor containing the input data
+ * @param *target_tensor    The tensor containing the target data / labels
+ * @param *optimizer        The optimizer that is used for training
+ * @param batch_size        Size of a batch / Number of input vektors
+ * @param *loss             The accumulated loss of the epoch will be written here. The zero_point and the scale should be set to proper values.
+ * @return                  0 if successful
+ */
+uint8_t aialgo_train_model_with_loss_q31(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size, aiscalar_q31_t *loss);
+
+/** @brief Get the first layer of the model that has trainable parameters and is set to trainable
+ *
+ * All layers in front of this layer are frozen (or have no parameters at all).
+ *
+ * @param *model    The model
+ * @return          Pointer to the first trainable layer or 0 if the model has no trainable layer
+ */
+ailayer_t *aialgo_get_first_trainable_layer(aimodel_t *model);
+
+/** @brief Calculate the memory requirements for a frozen feature cache
+ *
+ * The features are the results of the last frozen layer in front of the first trainable layer
+ * (see aialgo_calc_frozen_features()).
+ *
+ * @param *model        The model
+ * @param sample_count  Number of samples in the dataset
+ * @param *dtype        Data type of the feature cache (the result data type of the last frozen layer or \link aimath_q7.h aiq7 \endlink)
+ * @return              Required memory size in bytes
+ */
+uint32_t aialgo_sizeof_frozen_features(aimodel_t *model, uint32_t sample_count, const aimath_dtype_t *dtype);
+
+/** @brief Calculate the features of the frozen layers for the whole dataset (transfer learning)
+ *
+ * When only the last layers of a model should be trained (for example the head of a pretrained feature extractor),
+ * the frozen layers in front of the first trainable layer (see aialgo_get_first_trainable_layer()) always calculate the same results.
+ * This function runs the frozen layers once over the dataset and writes the results into the feature tensor.
+ * Afterwards use aialgo_train_model_on_frozen_features() to train only the trainable layers.
+ *
+ * The feature tensor can either have the result data type of the last frozen layer or it can be
+ * \link aimath_q7.h Q7 \endlink quantized to save memory (only for \link aimath_f32.h F32 \endlink models).
+ * In the Q7 case, the quantization parameters are calculated from the value range of the features and written to the
+ * tensor_params of the feature tensor. This requires an additional pass through the frozen layers.
+ * If the last frozen layer already has a Q7 result, the features are copied and the quantization parameters
+ * of the layer result are written to the tensor_params of the feature tensor.
+ * Any other data type combination is rejected with an error (return value 1).
+ *
+ * The shape of the feature tensor is the result shape of the last frozen layer with the number of samples as first element.
+ *
+ * Make sure to schedule the inference or training memory before calling this function.
+ *
+ * Example: Training of the head of an F32 model with a Q7 feature cache
+ * \code{.c}
+ * aialgo_set_layer_settings_model(&model, 0b1, AILAYER_SETTINGS_TRAINABLE, FALSE);
+ * AILAYER_SETTINGS_SET(head_layer->settings, 0b1, AILAYER_SETTINGS_TRAINABLE, TRUE);
+ * ...
+ * uint16_t feature_shape[] = {SAMPLE_COUNT, 64};
+ * int8_t feature_data[SAMPLE_COUNT * 64];
+ * aimath_q7_params_t feature_params;
+ * aitensor_t feature_tensor = AITENSOR_2D_Q7(feature_shape, &feature_params, feature_data);
+ *
+ * aialgo_calc_frozen_features(&model, &input_tensor, &feature_tensor);
+ * for(i = 0; i < epochs; i++)
+ * {
+ *     aialgo_train_model_on_frozen_features(&model, &feature_tensor, &target_tensor, optimizer, batch_size);
+ * }
+ * \endcode
+ *
+ * @param *model            The model
+ * @param *input_tensor     The tensor containing the input data
+ * @param *feature_tensor   The tensor to write the features to
+ * @return                  0 if successful
+ */
+uint8_t aialgo_calc_frozen_features(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *feature_tensor);
+
+/** @brief Perform one training epoch on the cached features of the frozen layers
+ *
+ * Same as aialgo_train_model(), but only the layers starting at the first trainable layer are executed.
+ * The inputs for these layers are taken from the feature tensor that was calculated with aialgo_calc_frozen_features().
+ * The backward pass stops at the first trainable layer.
+ *
+ * @param *model            The model
+ * @param *feature_tensor   The tensor containing the cached features (calculated with aialgo_calc_frozen_features())
+ * @param *target_tensor    The tensor containing the target data / labels
+ * @param *optimizer        The optimizer that is used for training
+ * @param batch_size        Size of a batch / Number of input vektors
+ * @return                  0 if successful
+ */
+uint8_t aialgo_train_model_on_frozen_features(aimodel_t *model, aitensor_t *feature_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size);
+
 /** @brief Calculate the loss in \link aimath_f32.h F32 \endlink data type
  *
  * @param *model         The model
@@ -0,0 +1,177 @@
+/**
+ * \file basic/base/aialgo/aialgo_snapshot.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+#include "basic/base/aialgo/aialgo_snapshot.h"
+
+#include <string.h>
+
+AISTRING_STORAGE_WRAPPER(aistring_error_snapshot_1, "[aialgo_save_training_snapshot] Error: The image memory is too small.\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_snapshot_2, "[aialgo_restore_training_snapshot] Error: The image is invalid or from a different model.\n");
+
+#define AIALGO_SNAPSHOT_SIZE        0
+#define AIALGO_SNAPSHOT_SAVE        1
+#define AIALGO_SNAPSHOT_RESTORE     2
+
+typedef struct {
+    uint8_t mode;
+    uint8_t incremental;
+    void *image;
+    uint32_t offset;
+    uint32_t written;
+    uint32_t hash;
+} aialgo_snapshot_cursor_t;
+
+static void aialgo_snapshot_block(aialgo_snapshot_cursor_t *cursor, void *data, uint32_t size)
+{
+    uint8_t i;
+    void *block = cursor->image + cursor->offset;
+
+    // FNV-1a over the block sizes
+    for(i = 0; i < 4; i++){
+        cursor->hash ^= (size >> (8 * i)) & 0xFF;
+        cursor->hash *= 16777619UL;
+    }
+
+    if(cursor->mode == AIALGO_SNAPSHOT_SAVE){
+        if(!cursor->incremental || memcmp(block, data, size) != 0){
+            memcpy(block, data, size);
+            cursor->written += size;
+        }
+    } else if(cursor->mode == AIALGO_SNAPSHOT_RESTORE){
+        memcpy(data, block, size);
+    }
+
+    cursor->offset += size;
+    AIFES_ALIGN_INTEGER(cursor->offset, AIFES_MEMORY_ALIGNMENT);
+}
+
+// Only the data of the state tensors, the tensor headers in the optimizer memory contain pointers
+static void aialgo_snapshot_optimem(aialgo_snapshot_cursor_t *cursor, aiopti_t *optimizer, void *optimem)
+{
+    aiopti_adam_momentums_t *momentums;
+    aitensor_t *v;
+
+    if(optimizer->optimizer_type == aiopti_adam_type){
+        momentums = (aiopti_adam_momentums_t *) optimem;
+        aialgo_snapshot_block(cursor, momentums->m.data, aimath_sizeof_tensor_data(&momentums->m));
+        aialgo_snapshot_block(cursor, momentums->v.data, aimath_sizeof_tensor_data(&momentums->v));
+    } else if(optimizer->optimizer_type == aiopti_sgd_type){
+        // SGD with momentum
+        v = (aitensor_t *) optimem;
+        aialgo_snapshot_block(cursor, v->data, aimath_sizeof_tensor_data(v));
+    }
+}
+
+static void aialgo_snapshot_walk(aimodel_t *model, aiopti_t *optimizer, aialgo_snapshot_cursor_t *cursor)
+{
+    uint16_t i, j;
+    ailayer_t *layer_ptr = model->input_layer;
+    aiopti_adam_t *adam;
+
+    cursor->offset = sizeof(aialgo_snapshot_header_t);
+    AIFES_ALIGN_INTEGER(cursor->offset, AIFES_MEMORY_ALIGNMENT);
+    cursor->written = 0;
+    cursor->hash = 2166136261UL;
+
+    // Optimizer scalars
+    if(optimizer->optimizer_type == aiopti_adam_type){
+        adam = (aiopti_adam_t *) optimizer->optimizer_configuration;
+        aialgo_snapshot_block(cursor, adam->beta1t, optimizer->dtype->size);
+        aialgo_snapshot_block(cursor, adam->beta2t, optimizer->dtype->size);
+        aialgo_snapshot_block(cursor, adam->lrt, optimizer->dtype->size);
+    }
+
+    // Parameters and optimizer memory
+    for(i = 0; i < model->layer_count; i++){
+        for(j = 0; j < layer_ptr->trainable_params_count; j++){
+            aialgo_snapshot_block(cursor, layer_ptr->trainable_params[j]->data, aimath_sizeof_tensor_data(layer_ptr->trainable_params[j]));
+            // E.g. SGD without momentum sets sizeof_optimem but has no optimizer memory
+            if(optimizer->sizeof_optimem != 0 && AILAYER_SETTINGS_IS(layer_ptr->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)
+                    && optimizer->sizeof_optimem(optimizer, layer_ptr->trainable_params[j]) > 0){
+                aialgo_snapshot_optimem(cursor, optimizer, layer_ptr->optimem[j]);
+            }
+        }
+        layer_ptr = layer_ptr->output_layer;
+    }
+}
+
+uint32_t aialgo_sizeof_training_snapshot(aimodel_t *model, aiopti_t *optimizer)
+{
+    aialgo_snapshot_cursor_t cursor = { .mode = AIALGO_SNAPSHOT_SIZE };
+
+    aialgo_snapshot_walk(model, optimizer, &cursor);
+    return cursor.offset;
+}
+
+uint32_t aialgo_save_training_snapshot(aimodel_t *model, aiopti_t *optimizer, uint32_t step, void *image, uint32_t image_size, uint8_t incremental)
+{
+    aialgo_snapshot_cursor_t cursor = { .mode = AIALGO_SNAPSHOT_SIZE };
+    aialgo_snapshot_header_t *header = (aialgo_snapshot_header_t *) image;
+    uint32_t size, layout_hash;
+
+    aialgo_snapshot_walk(model, optimizer, &cursor);
+    size = cursor.offset;
+    layout_hash = cursor.hash;
+    if(image_size < size){
+        AILOG_E(aistring_error_snapshot_1);
+        return 0;
+    }
+
+    // Incremental only on top of a valid snapshot of the same layout
+    incremental = incremental && header->magic == AIALGO_SNAPSHOT_MAGIC && header->layout_hash == layout_hash && header->size == size;
+
+    // Invalidate the header while the blocks are written, so an interrupted save is detected on restore
+    header->magic = 0;
+
+    cursor.mode = AIALGO_SNAPSHOT_SAVE;
+    cursor.incremental = incremental;
+    cursor.image = image;
+    aialgo_snapshot_walk(model, optimizer, &cursor);
+
+    header->layout_hash = layout_hash;
+    header->size = size;
+    header->step = step;
+    header->magic = AIALGO_SNAPSHOT_MAGIC;
+
+    return cursor.written + sizeof(aialgo_snapshot_header_t);
+}
+
+uint8_t aialgo_restore_training_snapshot(aimodel_t *model, aiopti_t *optimizer, const void *image, uint32_t image_size, uint32_t *step)
+{
+    aialgo_snapshot_cursor_t cursor = { .mode = AIALGO_SNAPSHOT_SIZE };
+    const aialgo_snapshot_header_t *header = (const aialgo_snapshot_header_t *) image;
+
+    aialgo_snapshot_walk(model, optimizer, &cursor);
+    if(image_size < cursor.offset || header->magic != AIALGO_SNAPSHOT_MAGIC
+       || header->layout_hash != cursor.hash || header->size != cursor.offset){
+        AILOG_E(aistring_error_snapshot_2);
+        return 1;
+    }
+
+    cursor.mode = AIALGO_SNAPSHOT_RESTORE;
+    cursor.image = (void *) image;
+    aialgo_snapshot_walk(model, optimizer, &cursor);
+
+    if(step != 0){
+        *step = header->step;
+    }
+    return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * \file basic/base/aialgo/aialgo_snapshot.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Binary snapshot of the training state to resume an interrupted training
+ * \details The training state of a model is spread over the parameter memory (trainable parameters), the training memory
+ * (optimizer state like the momentums of \link aiopti_adam.h Adam \endlink and \link aiopti_sgd.h SGD \endlink with momentum) and the optimizer structure (e.g. the auxiliary
+ * scalars \f$ \beta_1^t \f$, \f$ \beta_2^t \f$ and \f$ lr_t \f$ of Adam). aialgo_save_training_snapshot() copies all of this
+ * into one binary image with a fixed, aligned layout (header, optimizer scalars, then per trainable parameter tensor
+ * the parameters and the optimizer memory). aialgo_restore_training_snapshot() copies it back without any parsing.
+ *
+ * The gradients are not part of the snapshot, because they are reset at the beginning of every training step.
+ * Non-trainable layer states (e.g. the moving averages of Batch Normalization) are not included either.
+ *
+ * The image can be placed in a battery backed RAM, FRAM, a memory mapped file or copied to a flash memory. With incremental = 1,
+ * only the blocks that differ from the previous snapshot in the image are written (e.g. frozen layers are skipped),
+ * which reduces the write accesses to non-volatile memories.
+ *
+ * Example: Save a snapshot after every epoch and resume after a restart
+ * \code{.c}
+ * // Model compiled, parameter and training memory scheduled, optimizer memory initialized
+ * uint32_t snapshot_size = aialgo_sizeof_training_snapshot(&model, optimizer);
+ * void *snapshot = malloc(snapshot_size);  // e.g. a memory mapped file
+ * uint32_t epoch = 0;
+ *
+ * if(aialgo_restore_training_snapshot(&model, optimizer, snapshot, snapshot_size, &epoch) != 0){
+ *     epoch = 0; // No valid snapshot: Start from scratch
+ * }
+ * for(; epoch < EPOCHS; epoch++){
+ *     aialgo_train_model(&model, &input_tensor, &target_tensor, optimizer, BATCH_SIZE);
+ *     aialgo_save_training_snapshot(&model, optimizer, epoch + 1, snapshot, snapshot_size, 1);
+ * }
+ * \endcode
+ */
+
+#ifndef AIALGO_SNAPSHOT
+#define AIALGO_SNAPSHOT
+
+#include "core/aifes_core.h"
+#include "core/aifes_math.h"
+#include "basic/base/aimath/aimath_basic.h"
+#include "basic/base/aiopti/aiopti_adam.h"
+#include "basic/base/aiopti/aiopti_sgd.h"
+
+#define AIALGO_SNAPSHOT_MAGIC   0x53544941 /**< "AITS" in little endian */
+
+typedef struct aialgo_snapshot_header aialgo_snapshot_header_t;
+
+/** @brief Header of a training snapshot image
+ */
+struct aialgo_snapshot_header {
+    uint32_t magic; /**< AIALGO_SNAPSHOT_MAGIC */
+    uint32_t layout_hash; /**< Hash over the block sizes, to detect a snapshot of a different model or optimizer */
+    uint32_t size; /**< Size of the image in bytes */
+    uint32_t step; /**< User defined step counter (e.g. the epoch) */
+};
+
+/** @brief Calculate the size of a training snapshot image in bytes
+ *
+ * @param *model        The compiled model with scheduled parameter and training memory
+ * @param *optimizer    The optimizer
+ * @return              Size of the image in bytes
+ */
+uint32_t aialgo_sizeof_training_snapshot(aimodel_t *model, aiopti_t *optimizer);
+
+/** @brief Save the training state (parameters, optimizer memory and optimizer scalars) into a snapshot image
+ *
+ * @param *model        The model
+ * @param *optimizer    The optimizer
+ * @param step          User defined step counter that is stored in the header (e.g. the epoch)
+ * @param *image        Memory for the image (aialgo_sizeof_training_snapshot() bytes, aligned to AIFES_MEMORY_ALIGNMENT)
+ * @param image_size    Size of the image memory (for error checking)
+ * @param incremental   If the image contains a valid snapshot of the same model, only write the blocks that changed (1) or always write all blocks (0)
+ * @return              Number of bytes that were written (0 if the image memory is too small)
+ */
+uint32_t aialgo_save_training_snapshot(aimodel_t *model, aiopti_t *optimizer, uint32_t step, void *image, uint32_t image_size, uint8_t incremental);
+
+/** @brief Restore the training state from a snapshot image
+ *
+ * @param *model        The model (same structure as when the snapshot was saved)
+ * @param *optimizer    The optimizer (same type as when the snapshot was saved)
+ * @param *image        The snapshot image
+ * @param image_size    Size of the image memory
+ * @param *step         The step counter of the snapshot (output, optional - may be 0)
+ * @return              0 if successful, 1 if the image is invalid or from a different model
+ */
+uint8_t aialgo_restore_training_snapshot(aimodel_t *model, aiopti_t *optimizer, const void *image, uint32_t image_size, uint32_t *step);
+
+#endif // AIALGO_SNAPSHOT
@@ -23,18 +23,32 @@
 #include "basic/base/aimath/aimath_basic.h"
 
 AISTRING_STORAGE_WRAPPER(aistring_layer_dense, "Dense");
+AISTRING_STORAGE_WRAPPER(aistring_layer_dense_sparse, "Dense (sparse)");
 
 const aicore_layertype_t ailayer_dense_type_s = {
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
     .name = aistring_layer_dense,
-	.print_specs = ailayer_dense_print_specs
+	.print_specs = ailayer_dense_print_specs,
 #else
     .name = 0,
-    .print_specs = 0
+    .print_specs = 0,
 #endif
+    .count_macs = ailayer_dense_count_macs
 };
 const aicore_layertype_t *ailayer_dense_type = &ailayer_dense_type_s;
 
+const aicore_layertype_t ailayer_dense_sparse_type_s = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_layer_dense_sparse,
+	.print_specs = ailayer_dense_sparse_print_specs,
+#else
+    .name = 0,
+    .print_specs = 0,
+#endif
+    .count_macs = ailayer_dense_sparse_count_macs
+};
+const aicore_layertype_t *ailayer_dense_sparse_type = &ailayer_dense_sparse_type_s;
+
 ailayer_t *ailayer_dense(ailayer_dense_t *layer, ailayer_t *input_layer)
 {
     layer->base.layer_type = ailayer_dense_type;
@@ -89,6 +103,30 @@ ailayer_t *ailayer_dense(ailayer_dense_t *layer, ailayer_t *input_layer)
 	return &layer->base;
 }
 
+ailayer_t *ailayer_dense_sparse(ailayer_dense_t *layer, ailayer_t *input_layer)
+{
+    ailayer_dense(layer, input_layer);
+
+    layer->base.layer_type = ailayer_dense_sparse_type;
+    AILAYER_SETTINGS_SET(layer->base.settings, 0b1, AILAYER_SETTINGS_TRAINABLE, FALSE);
+
+    // Transposed weights shape [neurons x inputs]
+	layer->weights.shape[0] = layer->neurons;
+	layer->weights.shape[1] = input_layer->result.shape[1];
+
+	layer->base.sizeof_paramem = ailayer_dense_sparse_sizeof_paramem;
+	layer->base.set_paramem = ailayer_dense_sparse_set_paramem;
+
+	// No training supported
+	layer->base.backward = 0;
+	layer->base.sizeof_trainmem = 0;
+	layer->base.set_trainmem = 0;
+	layer->base.sizeof_bwdmem = 0;
+	layer->base.trainable_params_count = 0;
+
+	return &layer->base;
+}
+
 void ailayer_dense_forward(ailayer_t *self)
 {
 	aitensor_t *x_in = &(self->input_layer->result);
@@ -215,11 +253,70 @@ void ailayer_dense_set_paramem(ailayer_t *self, void *memory_ptr)
 	return;
 }
 
+uint32_t ailayer_dense_sparse_sizeof_paramem(const ailayer_t *self)
+{
+	uint32_t memory = 0;
+	ailayer_dense_t *layer = (ailayer_dense_t *)(self->layer_configuration);
+	aimath_sparse_params_t *sparse = (aimath_sparse_params_t *) layer->weights.tensor_params;
+
+	// Sparse weights
+	memory += layer->weights.dtype->tensor_params_size;
+    AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
+	memory += AIMATH_SPARSE_VALUES_LENGTH(sparse->format, sparse->nnz) * aimath_sizeof_dtype(layer->weights.dtype); // values
+    AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
+	memory += AIMATH_SPARSE_ROW_PTR_LENGTH(sparse->format, layer->neurons) * sizeof(uint32_t); // row_ptr
+    AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
+	memory += sparse->nnz * sizeof(uint16_t); // col_idx
+    AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
+
+	// Bias
+	memory += layer->bias.dtype->tensor_params_size;
+    AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
+	memory += layer->neurons * aimath_sizeof_dtype(layer->bias.dtype); // data
+	return memory;
+}
+
+void ailayer_dense_sparse_set_paramem(ailayer_t *self, void *memory_ptr)
+{
+	uint32_t address_counter = 0;
+	ailayer_dense_t *layer = (ailayer_dense_t *) (self->layer_configuration);
+	aimath_sparse_params_t *sparse = (aimath_sparse_params_t *) layer->weights.tensor_params;
+
+	sparse->values_params = layer->weights.dtype->tensor_params_size > 0 ? memory_ptr + address_counter : 0;
+	address_counter += layer->weights.dtype->tensor_params_size;
+    AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+
+	layer->weights.data = memory_ptr + address_counter;
+	address_counter += AIMATH_SPARSE_VALUES_LENGTH(sparse->format, sparse->nnz) * aimath_sizeof_dtype(layer->weights.dtype);
+    AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+
+	sparse->row_ptr = memory_ptr + address_counter;
+	address_counter += AIMATH_SPARSE_ROW_PTR_LENGTH(sparse->format, layer->neurons) * sizeof(uint32_t);
+    AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+
+	sparse->col_idx = memory_ptr + address_counter;
+	address_counter += sparse->nnz * sizeof(uint16_t);
+    AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+
+	layer->bias.tensor_params = memory_ptr + address_counter;
+	address_counter += layer->bias.dtype->tensor_params_size;
+    AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+
+	layer->bias.data = memory_ptr + address_counter;
+
+	return;
+}
+
 uint32_t ailayer_dense_sizeof_trainmem(const ailayer_t *self)
 {
 	uint32_t memory = 0;
 	ailayer_dense_t *layer = (ailayer_dense_t *)(self->layer_configuration);
 
+	if(!AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)){
+        // No gradients are needed for frozen parameters
+        return 0;
+	}
+
 	// Weights
 	memory += sizeof(aitensor_t);
 	memory += aimath_sizeof_tensor_data(&layer->weights);
@@ -239,6 +336,13 @@ void ailayer_dense_set_trainmem(ailayer_t *self, void *memory_ptr)
 	uint32_t address_counter = 0;
 	ailayer_dense_t *layer = (ailayer_dense_t *) (self->layer_configuration);
 
+	if(!AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)){
+        // No gradients are needed for frozen parameters
+        self->gradients[0] = 0;
+        self->gradients[1] = 0;
+        return;
+	}
+
 	// Weights gradients in gradients[0]
 	self->gradients[0] = memory_ptr;
 	address_counter += sizeof(aitensor_t);
@@ -267,6 +371,22 @@ void ailayer_dense_set_trainmem(ailayer_t *self, void *memory_ptr)
 	return;
 }
 
+uint32_t ailayer_dense_count_macs(const ailayer_t *self)
+{
+    ailayer_dense_t *layer = (ailayer_dense_t *)(self->layer_configuration);
+
+    // result[N,O] = x[N,I] * W[I,O]
+    return (uint32_t) self->result.shape[0] * self->input_layer->result.shape[1] * layer->neurons;
+}
+
+uint32_t ailayer_dense_sparse_count_macs(const ailayer_t *self)
+{
+    ailayer_dense_t *layer = (ailayer_dense_t *)(self->layer_configuration);
+    aimath_sparse_params_t *sparse = (aimath_sparse_params_t *) layer->weights.tensor_params;
+
+    return (uint32_t) self->result.shape[0] * AIMATH_SPARSE_VALUES_LENGTH(sparse->format, sparse->nnz);
+}
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_dense_1, "neurons: ");
 
@@ -277,4 +397,17 @@ void ailayer_dense_print_specs(const ailayer_t *self)
     AIPRINT(aistring_print_layer_specs_dense_1);
     AIPRINT_LONG_INT("%ld", (long int) layer->neurons);
 }
+
+AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_dense_sparse_1, "; stored weights: ");
+
+void ailayer_dense_sparse_print_specs(const ailayer_t *self)
+{
+    ailayer_dense_t *layer = (ailayer_dense_t *)(self->layer_configuration);
+    aimath_sparse_params_t *sparse = (aimath_sparse_params_t *) layer->weights.tensor_params;
+
+    AIPRINT(aistring_print_layer_specs_dense_1);
+    AIPRINT_LONG_INT("%ld", (long int) layer->neurons);
+    AIPRINT(aistring_print_layer_specs_dense_sparse_1);
+    AIPRINT_LONG_INT("%ld", (long int) AIMATH_SPARSE_VALUES_LENGTH(sparse->format, sparse->nnz));
+}
 #endif
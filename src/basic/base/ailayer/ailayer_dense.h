@@ -56,6 +56,7 @@
 #include "basic/default/aimath/aimath_f32_default.h"
 #include "basic/default/aimath/aimath_q7_default.h"
 #include "basic/base/aimath/aimath_q31.h"
+#include "basic/base/aimath/aimath_sparse.h"
 
 #define DENSE_WEIGHTS_SIZE(INPUTS, OUTPUTS)		((INPUTS) * (OUTPUTS))
 #define DENSE_BIAS_SIZE(OUTPUTS)				(OUTPUTS)
@@ -170,6 +171,13 @@ struct ailayer_dense {
  */
 extern const aicore_layertype_t *ailayer_dense_type;
 
+/** @brief Sparse Dense layer type
+ *
+ * Type of the Dense layers with \link aimath_sparse.h sparse \endlink weights (e.g. ailayer_dense_sparse_f32_default()).
+ * The layers use the ailayer_dense_t structure, but the weights are stored in a compressed format.
+ */
+extern const aicore_layertype_t *ailayer_dense_sparse_type;
+
 /** @brief Initialize and connect the given Dense layer
  *
  * This function represents the "constructor" of the abstract Dense layer. It initializes the layer structure
@@ -183,6 +191,21 @@ extern const aicore_layertype_t *ailayer_dense_type;
  */
 ailayer_t *ailayer_dense(ailayer_dense_t *layer, ailayer_t *input_layer);
 
+/** @brief Initialize and connect the given Dense layer with \link aimath_sparse.h sparse \endlink weights
+ *
+ * This function represents the "constructor" of the abstract sparse Dense layer. It initializes the layer like ailayer_dense(),
+ * but with the transposed weights shape [neurons x inputs] and the parameter memory functions for the sparse weights.
+ * The tensor parameters of the weights tensor have to point to an aimath_sparse_params_t with the format and the number of entries set.
+ * The layer supports inference only.\n
+ * This function is not intended to call it directly. Instead use one of the data type specific implementations
+ * (like for example ailayer_dense_sparse_f32_default()).
+ *
+ * @param *layer        The layer to initialize.
+ * @param *input_layer  The previous layer that provides the inputs to the layer.
+ * @return  Pointer to the (successfully) initialized general layer structure (ailayer_dense.base)
+ */
+ailayer_t *ailayer_dense_sparse(ailayer_dense_t *layer, ailayer_t *input_layer);
+
 /** @brief Calculate the forward pass for given Dense layer
  *
  * *Implementation of ailayer.forward.*
@@ -282,6 +305,30 @@ uint32_t ailayer_dense_sizeof_paramem(const ailayer_t *self);
  */
 void ailayer_dense_set_paramem(ailayer_t *self, void *memory_ptr);
 
+/** @brief Calculate and return the parameter memory size needed for a sparse Dense layer
+ *
+ * *Implementation of ailayer.sizeof_paramem.*
+ *
+ * The size is calculated for the compressed weights (values, row pointers, column indices and the tensor parameters of the values)
+ * as given by the aimath_sparse_params_t of the weights, and for the bias.
+ *
+ * @param *self The layer to calculate the parameter memory size for
+ * @return  Calculated parameter memory size in bytes.
+ */
+uint32_t ailayer_dense_sparse_sizeof_paramem(const ailayer_t *self);
+
+/** @brief Distribute provided memory to the sparse weights and the bias
+ *
+ * *Implementation of ailayer.set_paramem.*
+ *
+ * Sets the values, row pointer, column index and value parameter pointers of the sparse weights and the bias pointers.
+ * The sparse weights can be written to the memory afterwards (e.g. with aialgo_sparsify()).
+ *
+ * @param *self         The layer to set the memory fields for.
+ * @param *memory_ptr   The memory that can be used for the parameters
+ */
+void ailayer_dense_sparse_set_paramem(ailayer_t *self, void *memory_ptr);
+
 /** @brief Calculate and return the memory size needed by this layer for training
  *
  * *Implementation of ailayer.sizeof_trainmem.*
@@ -304,12 +351,40 @@ uint32_t ailayer_dense_sizeof_trainmem(const ailayer_t *self);
  */
 void ailayer_dense_set_trainmem(ailayer_t *self, void *memory_ptr);
 
+/** @brief Count the multiply-accumulate operations of one forward pass
+ *
+ * Counts the multiply-accumulate operations of the matrix multiplication (\f$ N \cdot I \cdot O \f$).
+ *
+ * *Implementation of aicore_layertype.count_macs.*
+ *
+ * @param *self     The layer
+ * @return          Number of multiply-accumulate operations
+ */
+uint32_t ailayer_dense_count_macs(const ailayer_t *self);
+
+/** @brief Count the multiply-accumulate operations of one forward pass of a sparse Dense layer
+ *
+ * Counts the multiply-accumulate operations of the stored weights (\f$ N \cdot entries \cdot blocksize \f$).
+ *
+ * *Implementation of aicore_layertype.count_macs.*
+ *
+ * @param *self     The layer
+ * @return          Number of multiply-accumulate operations
+ */
+uint32_t ailayer_dense_sparse_count_macs(const ailayer_t *self);
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 /** @brief Print the layer specification
  *
  * @param *self     The layer to print the specification for
  */
 void ailayer_dense_print_specs(const ailayer_t *self);
+
+/** @brief Print the sparse layer specification
+ *
+ * @param *self     The layer to print the specification for
+ */
+void ailayer_dense_sparse_print_specs(const ailayer_t *self);
 #endif // AIDEBUG_PRINT_MODULE_SPECS
 
 #endif // AILAYER_DENSE
@@ -27,11 +27,12 @@ AISTRING_STORAGE_WRAPPER(aistring_layer_template, "Template");
 const aicore_layertype_t ailayer_template_type_s = {
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
     .name = aistring_layer_template,
-	.print_specs = ailayer_template_print_specs
+	.print_specs = ailayer_template_print_specs,
 #else
     .name = 0,
-    .print_specs = 0
+    .print_specs = 0,
 #endif
+    .count_macs = 0 // Set a function if the layer does a significant amount of multiply-accumulate operations
 };
 const aicore_layertype_t *ailayer_template_type = &ailayer_template_type_s;
 
@@ -89,6 +89,13 @@
  */
 #define AITENSOR_2D_F32(shape, data)    {aif32, 2, (uint16_t *) shape, 0, (float *) data}
 
+/** @brief Initialize a 3 dimensional F32 tensor
+ *
+ * @param shape A uint16_t array of length 3 for the shape
+ * @param data  A float array for the tensor data
+ */
+#define AITENSOR_3D_F32(shape, data)    {aif32, 3, (uint16_t *) shape, 0, (float *) data}
+
 /** @brief Initialize a 4 dimensional F32 tensor
  *
  * @param shape A uint16_t array of length 4 for the shape
@@ -0,0 +1,66 @@
+/**
+ * \file basic/base/aimath/aimath_palette.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Definition of palettized (codebook compressed) tensors
+ * \details A palettized tensor stores every element as an index into a small codebook of centroids
+ * (e.g. found by k-means clustering with aialgo_palettize_f32()). The indices are stored in an \link aimath_u8.h U8 \endlink tensor
+ * with either 8 bit (up to 256 centroids) or 4 bit (up to 16 centroids) per index. 4 bit indices are packed two per byte
+ * (low nibble first) and every row starts at a new byte.
+ *
+ * The codebook and the index width are stored in the tensor parameters (aimath_palette_params_t) of the index tensor.
+ *
+ * Example: 4 bit indices of a [2 x 3] matrix with 16 F32 centroids\n
+ * \code{.c}
+ * float codebook[16] = {...};
+ * aimath_palette_params_t palette = {4, 16, codebook};
+ *
+ * uint16_t indices_shape[2] = {2, 3};
+ * uint8_t indices_data[AIMATH_PALETTE_ROW_BYTES(3, 4) * 2] = {0x10, 0x02,
+ *                                                             0x54, 0x0F};
+ * aitensor_t indices = {aiu8, 2, indices_shape, &palette, indices_data};
+ * \endcode
+ * Represents the matrix
+ * \f[
+ *  \left( \begin{array}{ccc}
+ *  cb_0 & cb_1 & cb_2 \\
+ *  cb_4 & cb_5 & cb_{15}
+ *  \end{array}\right)
+ * \f]
+ */
+
+#ifndef AIMATH_PALETTE
+#define AIMATH_PALETTE
+
+#include "core/aifes_math.h"
+#include "basic/base/aimath/aimath_u8.h"
+
+/** @brief Number of bytes of one row with cols indices of index_bits bits */
+#define AIMATH_PALETTE_ROW_BYTES(cols, index_bits)  (((uint32_t) (cols) * (index_bits) + 7) / 8)
+
+typedef struct aimath_palette_params aimath_palette_params_t;
+
+/** @brief Parameters of a palettized tensor, used as property of the \link aimath_u8.h U8 \endlink index tensor
+ */
+struct aimath_palette_params {
+	uint8_t index_bits; /**< Bits per index (4 or 8) */
+	uint16_t centroid_count; /**< Number of centroids in the codebook (max. \f$ 2^{index\_bits} \f$) */
+	float *codebook; /**< F32 centroids */
+};
+
+#endif // AIMATH_PALETTE
@@ -197,4 +197,50 @@ void aimath_q7_quantize_tensor_from_f32(const aitensor_t *tensor_f32, aitensor_t
     return;
 }
 
+void aimath_q7_quantize_from_source(const void *source, const aimath_q7_source_params_t *source_params, int8_t *result, uint32_t count)
+{
+    uint32_t i;
+
+    for(i = 0; i < count; i++){
+        result[i] = aimath_q7_quantize_value_from_source(source, i, source_params);
+    }
+    return;
+}
+
+int8_t aimath_q7_quantize_value_from_source(const void *source, uint32_t index, const aimath_q7_source_params_t *source_params)
+{
+    int32_t value, shift_diff;
+    float value_f32;
+    uint16_t shift = source_params->q_params.shift;
+    int8_t zero_point = source_params->q_params.zero_point;
+
+    if(source_params->format == AIMATH_Q7_SOURCE_F32){
+        value_f32 = ((const float *) source)[index] * (float) (1 << shift);
+        value = (int32_t) (value_f32 + (value_f32 >= 0.0f ? 0.5f : -0.5f));
+    } else {
+        // q = (r - z_r) * 2^(s - s_r) + z
+        if(source_params->format == AIMATH_Q7_SOURCE_I16){
+            value = (int32_t) ((const int16_t *) source)[index];
+        } else {
+            value = (int32_t) ((const uint16_t *) source)[index];
+        }
+        value -= source_params->source_zero_point;
+        shift_diff = (int32_t) shift - (int32_t) source_params->source_shift;
+        if(shift_diff < 0){
+            value = (value + (1 << (-shift_diff - 1))) >> (-shift_diff);
+        } else {
+            // Pre-saturation to avoid an overflow of the shift (the result saturates anyway)
+            value = value > 512 ? 512 : (value < -512 ? -512 : value);
+            value = value << shift_diff;
+        }
+    }
+    value += zero_point;
+    return (int8_t) (value > 127 ? 127 : (value < -128 ? -128 : value));
+}
+
+uint8_t aimath_q7_sizeof_source_value(const aimath_q7_source_params_t *source_params)
+{
+    return source_params->format == AIMATH_Q7_SOURCE_F32 ? sizeof(float) : sizeof(int16_t);
+}
+
 
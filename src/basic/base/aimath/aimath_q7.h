@@ -141,7 +141,9 @@
 #define AISCALAR_Q7(F, S, Z)       {FLOAT_TO_Q7(F, S, Z), S, Z}
 
 typedef struct aimath_q7_params	aimath_q7_params_t;
+typedef struct aimath_q7_source_params	aimath_q7_source_params_t;
 typedef struct aiscalar_q7	aiscalar_q7_t;
+typedef struct aimath_q7_lut	aimath_q7_lut_t;
 
 /** @brief Parameters used for the quantized \link aimath_q7.h Q7 \endlink values, used as property of a tensor
  */
@@ -150,6 +152,32 @@ struct aimath_q7_params {
 	int8_t zero_point; /**< The zero point \f$ z \f$ of the quantization */
 };
 
+#define AIMATH_Q7_SOURCE_F32    1 /**< Raw input data format of aimath_q7_source_params: float */
+#define AIMATH_Q7_SOURCE_I16    2 /**< Raw input data format of aimath_q7_source_params: int16_t (e.g. signed ADC values) */
+#define AIMATH_Q7_SOURCE_U16    3 /**< Raw input data format of aimath_q7_source_params: uint16_t (e.g. unsigned ADC values) */
+
+/** @brief Parameters of a \link aimath_q7.h Q7 \endlink tensor whose data is still in a raw (not quantized) format
+ *
+ * Used as tensor params of the input layer, if the raw input data (F32 values or 16 bit ADC values) should be quantized
+ * on the fly by the first layer (e.g. ailayer_dense_wt_q7_fused_input_default()) instead of in a separate pass into an extra buffer.
+ * Because the Q7 quantization parameters are the first member, the struct can be used as aimath_q7_params_t
+ * by all other Q7 functions.
+ *
+ * For I16 and U16 data, the raw value \f$ r \f$ represents the real value \f$ x = (r - source\_zero\_point) \cdot 2^{-source\_shift} \f$.
+ *
+ * Example: 12 bit ADC values (0 to 4095) that represent the voltage range 0 to 3.3 V, quantized to Q7 with shift = 5 and zero point = -128
+ * \code{.c}
+ * // 4096 / 3.3 V ~ 2^10 per volt -> source_shift = 10
+ * aimath_q7_source_params_t input_q_params = { {5, -128}, AIMATH_Q7_SOURCE_U16, 10, 0 };
+ * \endcode
+ */
+struct aimath_q7_source_params {
+	aimath_q7_params_t q_params; /**< Quantization parameters of the Q7 values (must be the first member) */
+	uint8_t format; /**< Format of the raw data (AIMATH_Q7_SOURCE_F32, AIMATH_Q7_SOURCE_I16 or AIMATH_Q7_SOURCE_U16) */
+	uint16_t source_shift; /**< I16 / U16: Fractional bits of the raw values */
+	int32_t source_zero_point; /**< I16 / U16: Raw value that represents 0 */
+};
+
 /** @brief Single quantized \link aimath_q7.h Q7 \endlink value/scalar
  */
 struct aiscalar_q7 {
@@ -158,6 +186,21 @@ struct aiscalar_q7 {
 	int8_t zero_point; /**< The zero point \f$ z \f$ of the quantization */
 };
 
+/** @brief Lookup table of an element wise function for \link aimath_q7.h Q7 \endlink tensors
+ *
+ * Because a Q7 value has only 256 possible values, every element wise function (e.g. activation functions)
+ * can be replaced by a table with the 256 pre-calculated results. The table is only valid for the
+ * quantization parameters of the input tensor it was calculated for (the key of the table).
+ *
+ * The table is calculated with aimath_q7_default_lut_build() and applied with aimath_q7_default_lut().
+ */
+struct aimath_q7_lut {
+	int8_t table[256]; /**< Results for the input values -128 to 127 (index = input value + 128) */
+	aimath_q7_params_t x_params; /**< Quantization parameters of the input tensor the table was calculated for (key) */
+	aimath_q7_params_t result_params; /**< Quantization parameters of the results */
+	uint8_t is_valid; /**< 1 if the table is calculated, 0 otherwise */
+};
+
 /** @brief Printing a Q7 tensor to console
  *
  * For users the function
@@ -203,6 +246,37 @@ void aimath_q7_calc_q_params_from_f32(float min_value, float max_value, aimath_q
  */
 void aimath_q7_quantize_tensor_from_f32(const aitensor_t *tensor_f32, aitensor_t *tensor_q7);
 
+/** @brief Quantizes raw input data (F32 or 16 bit integer values) into \link aimath_q7.h Q7 \endlink values
+ *
+ * @details The values are rounded to the nearest Q7 value and saturated to the Q7 range.
+ *          This is used to quantize the input data on the fly, see aimath_q7_source_params.
+ *
+ * @param *source			Raw data in the format given by the params
+ * @param *source_params	Format of the raw data and Q7 quantization parameters
+ * @param *result			Q7 values (output)
+ * @param count				Number of values
+ */
+void aimath_q7_quantize_from_source(const void *source, const aimath_q7_source_params_t *source_params, int8_t *result, uint32_t count);
+
+/** @brief Quantizes a single raw input value (F32 or 16 bit integer value) into a \link aimath_q7.h Q7 \endlink value
+ *
+ * @details Same as aimath_q7_quantize_from_source() for the element at the given index of the raw data.
+ *          This is used by kernels that quantize their input inside the inner loop.
+ *
+ * @param *source			Raw data in the format given by the params
+ * @param index				Index of the value in the raw data
+ * @param *source_params	Format of the raw data and Q7 quantization parameters
+ * @return					Quantized Q7 value
+ */
+int8_t aimath_q7_quantize_value_from_source(const void *source, uint32_t index, const aimath_q7_source_params_t *source_params);
+
+/** @brief Returns the size of one raw input value in bytes
+ *
+ * @param *source_params	Format of the raw data
+ * @return					Size of one value of the raw data in bytes (4 for F32, 2 for I16 and U16)
+ */
+uint8_t aimath_q7_sizeof_source_value(const aimath_q7_source_params_t *source_params);
+
 /** @brief The Q7 data-type indicator
  *
  * Use this variable to configure some element with the \link aimath_q7.h Q7 \endlink data-type,
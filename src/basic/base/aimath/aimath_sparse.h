@@ -0,0 +1,85 @@
+/**
+ * \file basic/base/aimath/aimath_sparse.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Definition of sparse (pruned) matrices
+ * \details A sparse matrix of shape [rows x cols] stores only the non-zero elements (or blocks of elements) of the dense matrix.
+ * The values are stored in the data field of a normal tensor of the value data type (e.g. \link aimath_f32.h F32 \endlink or
+ * \link aimath_q7.h Q7 \endlink) and the shape of the tensor is the shape of the dense matrix. The format and the index arrays are stored
+ * in the tensor parameters (aimath_sparse_params_t). Three formats are supported:
+ *
+ * - **AIMATH_SPARSE_CSR**: Compressed sparse row format with one element per entry. Entry e of row r (row_ptr[r] <= e < row_ptr[r+1])
+ *   is at column col_idx[e]. Best compression for high (unstructured) sparsity.
+ * - **AIMATH_SPARSE_BLOCK_1X4**: Blocks of 4 adjacent elements of one row. Block b of row r starts at column col_idx[b]
+ *   (multiple of 4). The 4 values of a block are stored consecutively and the inner loop has no indirect loads.
+ * - **AIMATH_SPARSE_BLOCK_4X1**: Blocks of 4 adjacent elements of one column. Block row r covers the rows 4r ... 4r+3 and block b
+ *   is at column col_idx[b]. One input value is used for 4 outputs.
+ *
+ * Elements of blocks that are outside of the matrix (if rows or cols is not a multiple of 4) are stored as zero.
+ *
+ * Example: CSR matrix of shape [2 x 4]\n
+ * \code{.c}
+ * uint32_t row_ptr[3] = {0, 2, 3};
+ * uint16_t col_idx[3] = {0, 3, 1};
+ * aimath_sparse_params_t sparse_params = {AIMATH_SPARSE_CSR, 3, row_ptr, col_idx, 0};
+ *
+ * uint16_t shape[2] = {2, 4};
+ * float values[3] = {1.0f, 2.0f, 3.0f};
+ * aitensor_t sparse = {aif32, 2, shape, &sparse_params, values};
+ * \endcode
+ * Represents the matrix
+ * \f[
+ *  \left( \begin{array}{cccc}
+ *  1 & 0 & 0 & 2 \\
+ *  0 & 3 & 0 & 0
+ *  \end{array}\right)
+ * \f]
+ */
+
+#ifndef AIMATH_SPARSE
+#define AIMATH_SPARSE
+
+#include "core/aifes_math.h"
+
+#define AIMATH_SPARSE_CSR           0 /**< Compressed sparse row format (1 element per entry) */
+#define AIMATH_SPARSE_BLOCK_1X4     1 /**< Blocks of 4 elements in one row */
+#define AIMATH_SPARSE_BLOCK_4X1     2 /**< Blocks of 4 elements in one column */
+
+/** @brief Number of elements of one block of the given format */
+#define AIMATH_SPARSE_BLOCK_SIZE(format)                    ((format) == AIMATH_SPARSE_CSR ? 1 : 4)
+
+/** @brief Number of elements of the row_ptr array for a matrix with the given number of rows */
+#define AIMATH_SPARSE_ROW_PTR_LENGTH(format, rows)          (((format) == AIMATH_SPARSE_BLOCK_4X1 ? ((uint32_t) (rows) + 3) / 4 : (uint32_t) (rows)) + 1)
+
+/** @brief Number of values of a sparse matrix with the given number of entries (elements or blocks) */
+#define AIMATH_SPARSE_VALUES_LENGTH(format, nnz)            ((uint32_t) (nnz) * AIMATH_SPARSE_BLOCK_SIZE(format))
+
+typedef struct aimath_sparse_params aimath_sparse_params_t;
+
+/** @brief Parameters of a sparse matrix, used as property of the value tensor
+ */
+struct aimath_sparse_params {
+	uint8_t format; /**< Storage format (AIMATH_SPARSE_CSR, AIMATH_SPARSE_BLOCK_1X4 or AIMATH_SPARSE_BLOCK_4X1) */
+	uint32_t nnz; /**< Number of stored entries (elements for CSR, blocks otherwise) */
+	uint32_t *row_ptr; /**< Start entry of every (block) row, AIMATH_SPARSE_ROW_PTR_LENGTH() elements */
+	uint16_t *col_idx; /**< Column of every entry (first column of the block for AIMATH_SPARSE_BLOCK_1X4), nnz elements */
+	void *values_params; /**< Tensor parameters of the values (e.g. aimath_q7_params_t for Q7, 0 for F32) */
+};
+
+#endif // AIMATH_SPARSE
@@ -0,0 +1,50 @@
+/**
+ * \file basic/cmsis/aialgo/aialgo_kernels_cmsis.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+#include "aifes_config.h"
+
+#if __arm__
+#ifdef AIFES_WITH_CMSIS
+
+#include "basic/cmsis/aialgo/aialgo_kernels_cmsis.h"
+
+static void install_dense_linear_f32_cmsis(ailayer_t *layer)
+{
+    ((ailayer_dense_t *) layer->layer_configuration)->linear = aimath_f32_cmsis_linear;
+}
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+AISTRING_STORAGE_WRAPPER(aistring_kernel_dense_linear_f32_cmsis, "Dense linear F32 CMSIS");
+#endif
+
+const aialgo_kernel_t aialgo_kernel_dense_linear_f32_cmsis = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_dense_linear_f32_cmsis,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_DENSE_LINEAR_F32_CMSIS,
+    .is_applicable = aialgo_kernel_is_dense_f32,
+    .install = install_dense_linear_f32_cmsis
+};
+
+#endif // AIFES_WITH_CMSIS
+#endif //__arm__
@@ -0,0 +1,50 @@
+/**
+ * \file basic/cmsis/aialgo/aialgo_kernels_cmsis.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief [Arm CMSIS](https://developer.arm.com/tools-and-software/embedded/cmsis) kernel candidates of the basic module for the kernel auto-tuner
+ * \details The kernels can be collected in an aialgo_kernel_registry_t together with the default kernels
+ * (aialgo_kernels_default.h) and tuned with aialgo_tune_kernels_model().
+ * For more information refer to aialgo_kernel_tuning.h.
+ */
+
+#include "aifes_config.h"
+
+#if __arm__
+#ifdef AIFES_WITH_CMSIS
+
+#ifndef AIALGO_KERNELS_CMSIS
+#define AIALGO_KERNELS_CMSIS
+
+#include "basic/base/aialgo/aialgo_kernel_tuning.h"
+#include "basic/default/aialgo/aialgo_kernels_default.h"
+#include "basic/cmsis/aimath/aimath_f32_cmsis.h"
+
+#define AIALGO_KERNEL_ID_DENSE_LINEAR_F32_CMSIS    0x1101 /**< Id of aialgo_kernel_dense_linear_f32_cmsis */
+
+/** @brief Dense layer (F32) with aimath_f32_cmsis_linear()
+ *
+ * Applicable to \link aimath_f32.h F32 \endlink Dense layers with weights of shape [inputs x neurons]
+ * (for example created with ailayer_dense_f32_default() or ailayer_dense_f32_cmsis()).
+ */
+extern const aialgo_kernel_t aialgo_kernel_dense_linear_f32_cmsis;
+
+#endif // AIALGO_KERNELS_CMSIS
+
+#endif // AIFES_WITH_CMSIS
+#endif //__arm__
@@ -0,0 +1,321 @@
+/**
+ * \file basic/default/aialgo/aialgo_kernels_default.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+#include "basic/default/aialgo/aialgo_kernels_default.h"
+
+#if __arm__
+#ifdef AIFES_WITH_CMSIS
+#include "basic/cmsis/aimath/aimath_f32_cmsis.h"
+#endif // AIFES_WITH_CMSIS
+#endif // __arm__
+
+uint8_t aialgo_kernel_is_dense_f32(const ailayer_t *layer)
+{
+    const ailayer_dense_t *dense;
+
+    if(layer->layer_type != ailayer_dense_type || layer->result.dtype != aif32){
+        return FALSE;
+    }
+    dense = (const ailayer_dense_t *) layer->layer_configuration;
+
+    // All kernels of the same family share the weights layout [inputs x neurons]
+    if(dense->linear == aimath_f32_default_linear
+       || dense->linear == aimath_f32_default_linear_rowwise){
+        return TRUE;
+    }
+#if __arm__
+#ifdef AIFES_WITH_CMSIS
+    if(dense->linear == aimath_f32_cmsis_linear){
+        return TRUE;
+    }
+#endif // AIFES_WITH_CMSIS
+#endif // __arm__
+    return FALSE;
+}
+
+static void install_dense_linear_f32_default(ailayer_t *layer)
+{
+    ((ailayer_dense_t *) layer->layer_configuration)->linear = aimath_f32_default_linear;
+}
+
+static void install_dense_linear_rowwise_f32_default(ailayer_t *layer)
+{
+    ((ailayer_dense_t *) layer->layer_configuration)->linear = aimath_f32_default_linear_rowwise;
+}
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+AISTRING_STORAGE_WRAPPER(aistring_kernel_dense_linear_f32_default, "Dense linear F32 default");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_dense_linear_rowwise_f32_default, "Dense linear rowwise F32 default");
+#endif
+
+const aialgo_kernel_t aialgo_kernel_dense_linear_f32_default = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_dense_linear_f32_default,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_DENSE_LINEAR_F32_DEFAULT,
+    .is_applicable = aialgo_kernel_is_dense_f32,
+    .install = install_dense_linear_f32_default
+};
+
+const aialgo_kernel_t aialgo_kernel_dense_linear_rowwise_f32_default = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_dense_linear_rowwise_f32_default,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_DENSE_LINEAR_ROWWISE_F32_DEFAULT,
+    .is_applicable = aialgo_kernel_is_dense_f32,
+    .install = install_dense_linear_rowwise_f32_default
+};
+
+// Activation function kernels
+
+static uint8_t is_sigmoid_f32(const ailayer_t *layer)
+{
+    return layer->layer_type == ailayer_sigmoid_type && layer->result.dtype == aif32;
+}
+
+static uint8_t is_tanh_f32(const ailayer_t *layer)
+{
+    return layer->layer_type == ailayer_tanh_type && layer->result.dtype == aif32;
+}
+
+static uint8_t is_elu_f32(const ailayer_t *layer)
+{
+    return layer->layer_type == ailayer_elu_type && layer->result.dtype == aif32;
+}
+
+static uint8_t is_softmax_f32(const ailayer_t *layer)
+{
+    return layer->layer_type == ailayer_softmax_type && layer->result.dtype == aif32;
+}
+
+static void install_sigmoid_f32_default(ailayer_t *layer)
+{
+    ((ailayer_sigmoid_t *) layer->layer_configuration)->sigmoid = aimath_f32_default_sigmoid;
+}
+
+static void install_sigmoid_poly_f32_default(ailayer_t *layer)
+{
+    ((ailayer_sigmoid_t *) layer->layer_configuration)->sigmoid = aimath_f32_default_sigmoid_poly;
+}
+
+static void install_sigmoid_poly_fast_f32_default(ailayer_t *layer)
+{
+    ((ailayer_sigmoid_t *) layer->layer_configuration)->sigmoid = aimath_f32_default_sigmoid_poly_fast;
+}
+
+static void install_tanh_f32_default(ailayer_t *layer)
+{
+    ((ailayer_tanh_t *) layer->layer_configuration)->tanh = aimath_f32_default_tanh;
+}
+
+static void install_tanh_poly_f32_default(ailayer_t *layer)
+{
+    ((ailayer_tanh_t *) layer->layer_configuration)->tanh = aimath_f32_default_tanh_poly;
+}
+
+static void install_tanh_poly_fast_f32_default(ailayer_t *layer)
+{
+    ((ailayer_tanh_t *) layer->layer_configuration)->tanh = aimath_f32_default_tanh_poly_fast;
+}
+
+static void install_elu_f32_default(ailayer_t *layer)
+{
+    ((ailayer_elu_t *) layer->layer_configuration)->elu = aimath_f32_default_elu;
+    ((ailayer_elu_t *) layer->layer_configuration)->d_elu = aimath_f32_default_d_elu;
+}
+
+static void install_elu_poly_f32_default(ailayer_t *layer)
+{
+    ((ailayer_elu_t *) layer->layer_configuration)->elu = aimath_f32_default_elu_poly;
+    ((ailayer_elu_t *) layer->layer_configuration)->d_elu = aimath_f32_default_d_elu_poly;
+}
+
+static void install_elu_poly_fast_f32_default(ailayer_t *layer)
+{
+    ((ailayer_elu_t *) layer->layer_configuration)->elu = aimath_f32_default_elu_poly_fast;
+    ((ailayer_elu_t *) layer->layer_configuration)->d_elu = aimath_f32_default_d_elu_poly_fast;
+}
+
+static void install_softmax_f32_default(ailayer_t *layer)
+{
+    ((ailayer_softmax_t *) layer->layer_configuration)->softmax = aimath_f32_default_softmax;
+}
+
+static void install_softmax_poly_f32_default(ailayer_t *layer)
+{
+    ((ailayer_softmax_t *) layer->layer_configuration)->softmax = aimath_f32_default_softmax_poly;
+}
+
+static void install_softmax_poly_fast_f32_default(ailayer_t *layer)
+{
+    ((ailayer_softmax_t *) layer->layer_configuration)->softmax = aimath_f32_default_softmax_poly_fast;
+}
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+AISTRING_STORAGE_WRAPPER(aistring_kernel_sigmoid_f32_default, "Sigmoid F32 default");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_sigmoid_poly_f32_default, "Sigmoid poly F32 default");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_sigmoid_poly_fast_f32_default, "Sigmoid poly fast F32 default");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_tanh_f32_default, "Tanh F32 default");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_tanh_poly_f32_default, "Tanh poly F32 default");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_tanh_poly_fast_f32_default, "Tanh poly fast F32 default");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_elu_f32_default, "ELU F32 default");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_elu_poly_f32_default, "ELU poly F32 default");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_elu_poly_fast_f32_default, "ELU poly fast F32 default");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_softmax_f32_default, "Softmax F32 default");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_softmax_poly_f32_default, "Softmax poly F32 default");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_softmax_poly_fast_f32_default, "Softmax poly fast F32 default");
+#endif
+
+const aialgo_kernel_t aialgo_kernel_sigmoid_f32_default = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_sigmoid_f32_default,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_SIGMOID_F32_DEFAULT,
+    .is_applicable = is_sigmoid_f32,
+    .install = install_sigmoid_f32_default
+};
+
+const aialgo_kernel_t aialgo_kernel_sigmoid_poly_f32_default = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_sigmoid_poly_f32_default,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_SIGMOID_POLY_F32_DEFAULT,
+    .is_applicable = is_sigmoid_f32,
+    .install = install_sigmoid_poly_f32_default
+};
+
+const aialgo_kernel_t aialgo_kernel_sigmoid_poly_fast_f32_default = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_sigmoid_poly_fast_f32_default,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_SIGMOID_POLY_FAST_F32_DEFAULT,
+    .is_applicable = is_sigmoid_f32,
+    .install = install_sigmoid_poly_fast_f32_default
+};
+
+const aialgo_kernel_t aialgo_kernel_tanh_f32_default = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_tanh_f32_default,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_TANH_F32_DEFAULT,
+    .is_applicable = is_tanh_f32,
+    .install = install_tanh_f32_default
+};
+
+const aialgo_kernel_t aialgo_kernel_tanh_poly_f32_default = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_tanh_poly_f32_default,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_TANH_POLY_F32_DEFAULT,
+    .is_applicable = is_tanh_f32,
+    .install = install_tanh_poly_f32_default
+};
+
+const aialgo_kernel_t aialgo_kernel_tanh_poly_fast_f32_default = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_tanh_poly_fast_f32_default,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_TANH_POLY_FAST_F32_DEFAULT,
+    .is_applicable = is_tanh_f32,
+    .install = install_tanh_poly_fast_f32_default
+};
+
+const aialgo_kernel_t aialgo_kernel_elu_f32_default = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_elu_f32_default,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_ELU_F32_DEFAULT,
+    .is_applicable = is_elu_f32,
+    .install = install_elu_f32_default
+};
+
+const aialgo_kernel_t aialgo_kernel_elu_poly_f32_default = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_elu_poly_f32_default,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_ELU_POLY_F32_DEFAULT,
+    .is_applicable = is_elu_f32,
+    .install = install_elu_poly_f32_default
+};
+
+const aialgo_kernel_t aialgo_kernel_elu_poly_fast_f32_default = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_elu_poly_fast_f32_default,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_ELU_POLY_FAST_F32_DEFAULT,
+    .is_applicable = is_elu_f32,
+    .install = install_elu_poly_fast_f32_default
+};
+
+const aialgo_kernel_t aialgo_kernel_softmax_f32_default = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_softmax_f32_default,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_SOFTMAX_F32_DEFAULT,
+    .is_applicable = is_softmax_f32,
+    .install = install_softmax_f32_default
+};
+
+const aialgo_kernel_t aialgo_kernel_softmax_poly_f32_default = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_softmax_poly_f32_default,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_SOFTMAX_POLY_F32_DEFAULT,
+    .is_applicable = is_softmax_f32,
+    .install = install_softmax_poly_f32_default
+};
+
+const aialgo_kernel_t aialgo_kernel_softmax_poly_fast_f32_default = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_softmax_poly_fast_f32_default,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_SOFTMAX_POLY_FAST_F32_DEFAULT,
+    .is_applicable = is_softmax_f32,
+    .install = install_softmax_poly_fast_f32_default
+};
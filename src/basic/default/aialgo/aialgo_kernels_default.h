@@ -0,0 +1,134 @@
+/**
+ * \file basic/default/aialgo/aialgo_kernels_default.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Default kernel candidates of the basic module for the kernel auto-tuner
+ * \details The kernels can be collected in an aialgo_kernel_registry_t and tuned with aialgo_tune_kernels_model().
+ * For more information refer to aialgo_kernel_tuning.h.
+ */
+
+#ifndef AIALGO_KERNELS_DEFAULT
+#define AIALGO_KERNELS_DEFAULT
+
+#include "basic/base/aialgo/aialgo_kernel_tuning.h"
+#include "basic/base/ailayer/ailayer_dense.h"
+#include "basic/base/ailayer/ailayer_sigmoid.h"
+#include "basic/base/ailayer/ailayer_tanh.h"
+#include "basic/base/ailayer/ailayer_elu.h"
+#include "basic/base/ailayer/ailayer_softmax.h"
+#include "basic/default/aimath/aimath_f32_default.h"
+
+#define AIALGO_KERNEL_ID_DENSE_LINEAR_F32_DEFAULT            0x0101 /**< Id of aialgo_kernel_dense_linear_f32_default */
+#define AIALGO_KERNEL_ID_DENSE_LINEAR_ROWWISE_F32_DEFAULT    0x0102 /**< Id of aialgo_kernel_dense_linear_rowwise_f32_default */
+#define AIALGO_KERNEL_ID_SIGMOID_F32_DEFAULT                 0x0111 /**< Id of aialgo_kernel_sigmoid_f32_default */
+#define AIALGO_KERNEL_ID_SIGMOID_POLY_F32_DEFAULT            0x0112 /**< Id of aialgo_kernel_sigmoid_poly_f32_default */
+#define AIALGO_KERNEL_ID_SIGMOID_POLY_FAST_F32_DEFAULT       0x0113 /**< Id of aialgo_kernel_sigmoid_poly_fast_f32_default */
+#define AIALGO_KERNEL_ID_TANH_F32_DEFAULT                    0x0121 /**< Id of aialgo_kernel_tanh_f32_default */
+#define AIALGO_KERNEL_ID_TANH_POLY_F32_DEFAULT               0x0122 /**< Id of aialgo_kernel_tanh_poly_f32_default */
+#define AIALGO_KERNEL_ID_TANH_POLY_FAST_F32_DEFAULT          0x0123 /**< Id of aialgo_kernel_tanh_poly_fast_f32_default */
+#define AIALGO_KERNEL_ID_ELU_F32_DEFAULT                     0x0131 /**< Id of aialgo_kernel_elu_f32_default */
+#define AIALGO_KERNEL_ID_ELU_POLY_F32_DEFAULT                0x0132 /**< Id of aialgo_kernel_elu_poly_f32_default */
+#define AIALGO_KERNEL_ID_ELU_POLY_FAST_F32_DEFAULT           0x0133 /**< Id of aialgo_kernel_elu_poly_fast_f32_default */
+#define AIALGO_KERNEL_ID_SOFTMAX_F32_DEFAULT                 0x0141 /**< Id of aialgo_kernel_softmax_f32_default */
+#define AIALGO_KERNEL_ID_SOFTMAX_POLY_F32_DEFAULT            0x0142 /**< Id of aialgo_kernel_softmax_poly_f32_default */
+#define AIALGO_KERNEL_ID_SOFTMAX_POLY_FAST_F32_DEFAULT       0x0143 /**< Id of aialgo_kernel_softmax_poly_fast_f32_default */
+
+/** @brief Dense layer (F32) with aimath_f32_default_linear()
+ *
+ * Applicable to \link aimath_f32.h F32 \endlink Dense layers with weights of shape [inputs x neurons]
+ * (for example created with ailayer_dense_f32_default() or ailayer_dense_f32_cmsis()).
+ */
+extern const aialgo_kernel_t aialgo_kernel_dense_linear_f32_default;
+
+/** @brief Dense layer (F32) with aimath_f32_default_linear_rowwise()
+ *
+ * Applicable to \link aimath_f32.h F32 \endlink Dense layers with weights of shape [inputs x neurons]
+ * (for example created with ailayer_dense_f32_default() or ailayer_dense_f32_cmsis()).
+ */
+extern const aialgo_kernel_t aialgo_kernel_dense_linear_rowwise_f32_default;
+
+/* Activation function kernels
+ *
+ * Three accuracy levels for the activation functions with exponential functions:
+ * - default: The kernel of the layer constructor (C library or aimath_f32_default_expf_fast() for the softmax)
+ * - poly: Branch-free polynomial approximation with an error of a few ULP (growing with the row length for the softmax, vectorizable)
+ * - poly_fast: Branch-free polynomial approximation with a relative error of about 1e-4 (vectorizable)
+ *
+ * The level can be selected for the whole model with aialgo_install_kernels_model() or tuned with aialgo_tune_kernels_model().
+ */
+
+/** @brief Sigmoid layer (F32) with aimath_f32_default_sigmoid() (expf() of the C library)
+ */
+extern const aialgo_kernel_t aialgo_kernel_sigmoid_f32_default;
+
+/** @brief Sigmoid layer (F32) with aimath_f32_default_sigmoid_poly() (accurate polynomial approximation)
+ */
+extern const aialgo_kernel_t aialgo_kernel_sigmoid_poly_f32_default;
+
+/** @brief Sigmoid layer (F32) with aimath_f32_default_sigmoid_poly_fast() (fast polynomial approximation)
+ */
+extern const aialgo_kernel_t aialgo_kernel_sigmoid_poly_fast_f32_default;
+
+/** @brief Tanh layer (F32) with aimath_f32_default_tanh() (expf() of the C library)
+ */
+extern const aialgo_kernel_t aialgo_kernel_tanh_f32_default;
+
+/** @brief Tanh layer (F32) with aimath_f32_default_tanh_poly() (accurate polynomial approximation)
+ */
+extern const aialgo_kernel_t aialgo_kernel_tanh_poly_f32_default;
+
+/** @brief Tanh layer (F32) with aimath_f32_default_tanh_poly_fast() (fast polynomial approximation)
+ */
+extern const aialgo_kernel_t aialgo_kernel_tanh_poly_fast_f32_default;
+
+/** @brief ELU layer (F32) with aimath_f32_default_elu() and aimath_f32_default_d_elu() (exp() of the C library)
+ */
+extern const aialgo_kernel_t aialgo_kernel_elu_f32_default;
+
+/** @brief ELU layer (F32) with aimath_f32_default_elu_poly() and aimath_f32_default_d_elu_poly() (accurate polynomial approximation)
+ */
+extern const aialgo_kernel_t aialgo_kernel_elu_poly_f32_default;
+
+/** @brief ELU layer (F32) with aimath_f32_default_elu_poly_fast() and aimath_f32_default_d_elu_poly_fast() (fast polynomial approximation)
+ */
+extern const aialgo_kernel_t aialgo_kernel_elu_poly_fast_f32_default;
+
+/** @brief Softmax layer (F32) with aimath_f32_default_softmax() (aimath_f32_default_expf_fast())
+ */
+extern const aialgo_kernel_t aialgo_kernel_softmax_f32_default;
+
+/** @brief Softmax layer (F32) with aimath_f32_default_softmax_poly() (accurate polynomial approximation)
+ */
+extern const aialgo_kernel_t aialgo_kernel_softmax_poly_f32_default;
+
+/** @brief Softmax layer (F32) with aimath_f32_default_softmax_poly_fast() (fast polynomial approximation)
+ */
+extern const aialgo_kernel_t aialgo_kernel_softmax_poly_fast_f32_default;
+
+/** @brief Checks if the layer is a \link aimath_f32.h F32 \endlink Dense layer with weights of shape [inputs x neurons]
+ *
+ * The data layout is determined from the kernel that is currently installed in the layer,
+ * so that for example read-only storage layers or layers with transposed weights are rejected.
+ * Can be used in the capability predicates of own Dense layer kernels.
+ *
+ * @param *layer    The layer
+ * @return          TRUE if the layer is a F32 Dense layer in standard layout, FALSE otherwise
+ */
+uint8_t aialgo_kernel_is_dense_f32(const ailayer_t *layer);
+
+#endif // AIALGO_KERNELS_DEFAULT
@@ -80,6 +80,55 @@ ailayer_t *ailayer_dense_wt_f32_default(ailayer_dense_f32_t *layer, ailayer_t *i
 	return return_layer;
 }
 
+ailayer_t *ailayer_dense_palettized_f32_default(ailayer_dense_f32_t *layer, ailayer_t *input_layer)
+{
+    ailayer_t *return_layer;
+
+	layer->base.result.dtype = aif32;
+	layer->base.deltas.dtype = aif32;
+	layer->weights.dtype = aiu8; // Codebook indices, the codebook is in the tensor params
+	layer->bias.dtype = aif32;
+
+	layer->base.calc_result_tensor_params = 0;
+	layer->base.init_params = 0;
+
+	// Forward pass
+	layer->linear = aimath_f32_default_linear_palettized_bt;
+
+	// Call "constructor" of base "class"
+	return_layer = ailayer_dense(layer, input_layer);
+
+	// Change shape to match transposed weights
+	layer->weights.shape[0] = layer->neurons;
+	layer->weights.shape[1] = input_layer->result.shape[1];
+
+	// The palettized parameters must be given by the user (no automatic parameter distribution)
+	return_layer->sizeof_paramem = 0;
+	return_layer->set_paramem = 0;
+
+	// No training supported
+	return_layer->backward = 0;
+
+	return return_layer;
+}
+
+ailayer_t *ailayer_dense_sparse_f32_default(ailayer_dense_f32_t *layer, ailayer_t *input_layer)
+{
+	layer->base.result.dtype = aif32;
+	layer->base.deltas.dtype = aif32;
+	layer->weights.dtype = aif32; // Values of the sparse weights, the indices are in the tensor params
+	layer->bias.dtype = aif32;
+
+	layer->base.calc_result_tensor_params = 0;
+	layer->base.init_params = 0;
+
+	// Forward pass
+	layer->linear = aimath_f32_default_linear_sparse_bt;
+
+	// Call "constructor" of base "class"
+	return ailayer_dense_sparse(layer, input_layer);
+}
+
 ailayer_t *ailayer_dense_q31_default(ailayer_dense_q31_t *layer, ailayer_t *input_layer)
 {
 	layer->base.result.dtype = aiq31;
@@ -152,6 +201,47 @@ ailayer_t *ailayer_dense_wt_q7_default(ailayer_dense_q7_t *layer, ailayer_t *inp
 	return return_layer;
 }
 
+ailayer_t *ailayer_dense_q7_fused_input_default(ailayer_dense_q7_t *layer, ailayer_t *input_layer)
+{
+    ailayer_t *return_layer = ailayer_dense_q7_default(layer, input_layer);
+
+    // The input layer holds raw data in the format of its aimath_q7_source_params_t
+    AILAYER_SETTINGS_SET(input_layer->settings, 0b1, AILAYER_SETTINGS_SOURCE_INPUT, TRUE);
+    // Quantize the raw input rows on the fly
+	layer->linear = aimath_q7_default_linear32_fused_input;
+
+	return return_layer;
+}
+
+ailayer_t *ailayer_dense_wt_q7_fused_input_default(ailayer_dense_q7_t *layer, ailayer_t *input_layer)
+{
+    ailayer_t *return_layer = ailayer_dense_wt_q7_default(layer, input_layer);
+
+    // The input layer holds raw data in the format of its aimath_q7_source_params_t
+    AILAYER_SETTINGS_SET(input_layer->settings, 0b1, AILAYER_SETTINGS_SOURCE_INPUT, TRUE);
+    // Quantize the raw input rows on the fly
+	layer->linear = aimath_q7_default_linear32_bt_fused_input;
+
+	return return_layer;
+}
+
+ailayer_t *ailayer_dense_sparse_q7_default(ailayer_dense_q7_t *layer, ailayer_t *input_layer)
+{
+	layer->base.result.dtype = aiq7;
+	layer->base.deltas.dtype = aiq7;
+	layer->weights.dtype = aiq7; // Values of the sparse weights, the indices are in the tensor params
+	layer->bias.dtype = aiq31; // Higher precision (s_bias = s_input + s_weights)
+
+	layer->base.calc_result_tensor_params = 0;
+	layer->base.init_params = 0;
+
+    // forward
+	layer->linear = aimath_q7_default_linear32_sparse_bt;
+
+	// Call "constructor" of base "class"
+	return ailayer_dense_sparse(layer, input_layer);
+}
+
 void ailayer_dense_init_params_f32_default(ailayer_t *self)
 {
 	ailayer_dense_t *layer = (ailayer_dense_t *) (self->layer_configuration);
@@ -39,6 +39,11 @@
 #define AILAYER_DENSE_Q31_A(neurons)                 {{0,},neurons,{0,0,0,0,0},{0,0,0,0,0}}
 #define AILAYER_DENSE_Q7_M(neurons, weights, weights_qparams, bias, bias_qparams, result_qparams)  {{0,0,0,0,0,0,0,{0,0,0,result_qparams,0}},neurons,{0,0,0,weights_qparams,(float *) weights},{0,0,0,bias_qparams,(float *) bias},}
 #define AILAYER_DENSE_Q7_A(neurons)                  {{0,},neurons,{0,0,0,0,0},{0,0,0,0,0}}
+#define AILAYER_DENSE_PALETTIZED_F32_M(neurons, indices, palette_params, bias)  {{0,},neurons,{0,0,0,palette_params,(float *) indices},{0,0,0,0,(float *) bias}}
+#define AILAYER_DENSE_SPARSE_F32_M(neurons, sparse_params, values, bias)  {{0,},neurons,{0,0,0,sparse_params,(float *) values},{0,0,0,0,(float *) bias}}
+#define AILAYER_DENSE_SPARSE_F32_A(neurons, sparse_params)                 {{0,},neurons,{0,0,0,sparse_params,0},{0,0,0,0,0}}
+#define AILAYER_DENSE_SPARSE_Q7_M(neurons, sparse_params, values, bias, bias_qparams, result_qparams)  {{0,0,0,0,0,0,0,{0,0,0,result_qparams,0}},neurons,{0,0,0,sparse_params,(float *) values},{0,0,0,bias_qparams,(float *) bias},}
+#define AILAYER_DENSE_SPARSE_Q7_A(neurons, sparse_params)                  {{0,},neurons,{0,0,0,sparse_params,0},{0,0,0,0,0}}
 
 typedef struct ailayer_dense 	ailayer_dense_f32_t;
 typedef struct ailayer_dense 	ailayer_dense_q31_t;
@@ -137,6 +142,77 @@ ailayer_t *ailayer_dense_f32_default(ailayer_dense_f32_t *layer, ailayer_t *inpu
  */
 ailayer_t *ailayer_dense_wt_f32_default(ailayer_dense_f32_t *layer, ailayer_t *input_layer);
 
+/** @brief Initializes and connect a \link ailayer_dense.h Dense layer \endlink with \link aimath_palette.h palettized \endlink weights and \link aimath_f32.h F32 \endlink default implementation
+ *
+ * The weights matrix is transposed ([neurons x inputs], like in ailayer_dense_wt_f32_default()) and every weight is stored as
+ * a 4 or 8 bit index into a per-layer F32 codebook (see aimath_palette.h). This reduces the weights memory by a factor of 8 (4 bit)
+ * or 4 (8 bit) compared to F32. The forward pass uses aimath_f32_default_linear_palettized_bt().
+ *
+ * The indices and the codebook are usually created from the weights of a trained F32 Dense layer with aialgo_palettize_f32().
+ * The parameters must be given (no automatic parameter distribution) and the layer supports inference only.
+ *
+ * **Example:** Create the layer structure with palettized weights (3 inputs, 2 neurons):\n
+ * \code{.c}
+ * const float codebook[16] = {-0.81f, -0.42f, ... , 0.93f};
+ * aimath_palette_params_t palette = {4, 16, (float *) codebook};
+ * const uint8_t indices[2*2] = {0x3A, 0x07,
+ *                               0xF1, 0x04};
+ * const float bias_data_dense[] = {-0.29f, 0.23f};
+ * ailayer_dense_f32_t dense_layer = AILAYER_DENSE_PALETTIZED_F32_M(2, indices, &palette, bias_data_dense);
+ * \endcode
+ *
+ * **Example:** Initialize and connect the layer:\n
+ * \code{.c}
+ * x = ailayer_dense_palettized_f32_default(&dense_layer, x);
+ * \endcode
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_dense_palettized_f32_default(ailayer_dense_f32_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_dense.h Dense layer \endlink with \link aimath_sparse.h sparse \endlink weights and \link aimath_f32.h F32 \endlink default implementation
+ *
+ * The weights matrix is transposed ([neurons x inputs], like in ailayer_dense_wt_f32_default()) and only the non-zero weights
+ * (or blocks of weights) are stored in one of the formats of aimath_sparse.h. Parameter memory and MACs are proportional to the
+ * number of stored weights. The forward pass uses aimath_f32_default_linear_sparse_bt().
+ *
+ * Use the CSR format for high unstructured sparsity (4 byte value + 2 byte index per weight) and the 1x4 or 4x1 block formats
+ * for lower or structured sparsity (16 byte values + 2 byte index per 4 weights, no indirect loads in the inner loop).
+ *
+ * The sparse weights are usually created from the weights of a trained and pruned F32 Dense layer (see aialgo_pruning.h)
+ * with aialgo_sparsify(). The tensor parameters of the weights must be an aimath_sparse_params_t with format and nnz set.
+ * If the parameters are distributed with aialgo_distribute_parameter_memory(), the values and index arrays are placed
+ * in the parameter memory and ailayer.sizeof_paramem reports the compressed size. The layer supports inference only.
+ *
+ * **Example:** Create the layer structure with sparse weights (4 inputs, 2 neurons):\n
+ * \code{.c}
+ * uint32_t row_ptr[3] = {0, 2, 3};
+ * uint16_t col_idx[3] = {0, 3, 1};
+ * aimath_sparse_params_t sparse_params = {AIMATH_SPARSE_CSR, 3, row_ptr, col_idx, 0};
+ * const float values[3] = {0.83f, -0.42f, 0.37f};
+ * const float bias_data_dense[] = {-0.29f, 0.23f};
+ * ailayer_dense_f32_t dense_layer = AILAYER_DENSE_SPARSE_F32_M(2, &sparse_params, values, bias_data_dense);
+ * \endcode
+ *
+ * **Example:** Create the layer structure for automatic parameter distribution:\n
+ * \code{.c}
+ * aimath_sparse_params_t sparse_params = {AIMATH_SPARSE_BLOCK_1X4, 12}; // Format and number of blocks
+ * ailayer_dense_f32_t dense_layer = AILAYER_DENSE_SPARSE_F32_A(2, &sparse_params);
+ * \endcode
+ *
+ * **Example:** Initialize and connect the layer:\n
+ * \code{.c}
+ * x = ailayer_dense_sparse_f32_default(&dense_layer, x);
+ * \endcode
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_dense_sparse_f32_default(ailayer_dense_f32_t *layer, ailayer_t *input_layer);
+
 /** @brief Initializes and connect a \link ailayer_dense.h Dense layer \endlink with the \link aimath_q31.h Q31 \endlink default implementation
  *
  * **Example:** Create the layer structure with pretrained weights:\n
@@ -341,6 +417,82 @@ ailayer_t *ailayer_dense_q7_default(ailayer_dense_q7_t *layer, ailayer_t *input_
  */
 ailayer_t *ailayer_dense_wt_q7_default(ailayer_dense_q7_t *layer, ailayer_t *input_layer);
 
+/** @brief Initializes and connect a \link ailayer_dense.h Dense layer \endlink with the \link aimath_q7.h Q7 \endlink default implementation and fused input quantization
+ *
+ * Same as ailayer_dense_q7_default(), but the layer is the first layer of a model and quantizes the raw input data
+ * (F32 or 16 bit ADC values) on the fly (aimath_q7_default_linear32_fused_input()). The Q7 input layer gets an
+ * aimath_q7_source_params_t as result tensor parameters, that describes the format of the raw data and the Q7 quantization.
+ * The raw data can be passed to aialgo_inference_model() or aialgo_forward_model() directly, without quantizing it
+ * into an extra buffer with aimath_q7_quantize_tensor_from_f32() before.
+ *
+ * **Example:**\n
+ * \code{.c}
+ * aimath_q7_source_params_t input_q_params = { {5, 0}, AIMATH_Q7_SOURCE_F32, 0, 0 };
+ * ailayer_input_q7_t input_layer = AILAYER_INPUT_Q7_M(2, input_layer_shape, &input_q_params);
+ * ...
+ * x = ailayer_input_q7_default(&input_layer);
+ * x = ailayer_dense_q7_fused_input_default(&dense_layer, x);
+ * ...
+ * uint16_t input_shape[2] = {1, 3};
+ * float input_data[1*3] = {0.1f, -1.2f, 2.3f};
+ * aitensor_t input_tensor = AITENSOR_2D_F32(input_shape, input_data);
+ * aialgo_inference_model(&model, &input_tensor, &output_tensor);
+ * \endcode
+ *
+ * aialgo_inference_model() splits the raw data into batches with the element size of the source format
+ * (4 bytes for F32, 2 bytes for I16 and U16), so the data type of the input tensor is not used for raw data.
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer (Q7 input layer with aimath_q7_source_params_t).
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_dense_q7_fused_input_default(ailayer_dense_q7_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_dense.h Dense layer \endlink with the \link aimath_q7.h Q7 \endlink default implementation for transposed weights tensor and fused input quantization
+ *
+ * Same as ailayer_dense_wt_q7_default() with the fused input quantization of ailayer_dense_q7_fused_input_default().
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer (Q7 input layer with aimath_q7_source_params_t).
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_dense_wt_q7_fused_input_default(ailayer_dense_q7_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_dense.h Dense layer \endlink with \link aimath_sparse.h sparse \endlink weights and \link aimath_q7.h Q7 \endlink default implementation
+ *
+ * Same as ailayer_dense_sparse_f32_default() with Q7 values and a Q31 bias. The forward pass uses aimath_q7_default_linear32_sparse_bt().
+ * The quantization parameters of the values are given by aimath_sparse_params_t.values_params and the zero point has to be 0.
+ *
+ * Use the 1x4 or 4x1 block formats (4 byte values + 2 byte index per 4 weights) for Q7, CSR (1 byte value + 2 byte index per weight)
+ * needs less memory than the dense matrix only for a sparsity above 67 %.
+ *
+ * The sparse weights are usually created with aialgo_sparsify() from the weights of a quantized Q7 Dense layer.
+ *
+ * **Example:** Create the layer structure with sparse weights (4 inputs, 2 neurons):\n
+ * \code{.c}
+ * aimath_q7_params_t values_qparams = {5, 0};
+ * uint32_t row_ptr[3] = {0, 1, 2};
+ * uint16_t col_idx[2] = {0, 0};
+ * aimath_sparse_params_t sparse_params = {AIMATH_SPARSE_BLOCK_1X4, 2, row_ptr, col_idx, &values_qparams};
+ * const int8_t values[2*4] = {27, 0, -13, 8,
+ *                             0, 12, 0, -31};
+ * aimath_q31_params_t bias_qparams = {10, 0};
+ * const int32_t bias_data_dense[] = {-297, 235};
+ * aimath_q7_params_t result_qparams = {3, 0};
+ * ailayer_dense_q7_t dense_layer = AILAYER_DENSE_SPARSE_Q7_M(2, &sparse_params, values, bias_data_dense, &bias_qparams, &result_qparams);
+ * \endcode
+ *
+ * **Example:** Initialize and connect the layer:\n
+ * \code{.c}
+ * x = ailayer_dense_sparse_q7_default(&dense_layer, x);
+ * \endcode
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_dense_sparse_q7_default(ailayer_dense_q7_t *layer, ailayer_t *input_layer);
+
 /** @brief \link aimath_f32.h F32 \endlink default implementation of the ailayer.init_params function for the Conv2D layer
  *
  * *Implementation of ailayer.init_params.*
@@ -109,3 +109,37 @@ void ailayer_elu_calc_result_tensor_params_q7_default(ailayer_t *self)
 	qparams->zero_point = ((aimath_q7_params_t *) (self->input_layer->result.tensor_params))->zero_point;
 }
 
+static float elu_f32(float x, const void *args)
+{
+    const aiscalar_q7_t *alpha = (const aiscalar_q7_t *) args;
+    float alpha_f32 = (float) (alpha->value - alpha->zero_point) / (float) ((uint32_t) 1 << alpha->shift);
+
+    return x > 0.0f ? x : alpha_f32 * (expf(x) - 1.0f);
+}
+
+ailayer_t *ailayer_elu_q7_lut_default(ailayer_elu_q7_lut_t *layer, ailayer_t *input_layer)
+{
+    ailayer_t *return_layer;
+
+    return_layer = ailayer_elu_q7_default(&layer->base, input_layer);
+    ailayer_q7_lut_init_default(return_layer, &layer->lut, elu_f32, &layer->base.alpha,
+                                ailayer_elu_forward_q7_lut_default, ailayer_elu_calc_result_tensor_params_q7_lut_default);
+
+    return return_layer;
+}
+
+void ailayer_elu_forward_q7_lut_default(ailayer_t *self)
+{
+    ailayer_elu_q7_lut_t *layer = (ailayer_elu_q7_lut_t *) (self->layer_configuration);
+
+    ailayer_q7_lut_forward_default(self, &layer->lut);
+    return;
+}
+
+void ailayer_elu_calc_result_tensor_params_q7_lut_default(ailayer_t *self)
+{
+    ailayer_elu_q7_lut_t *layer = (ailayer_elu_q7_lut_t *) (self->layer_configuration);
+
+    ailayer_q7_lut_calc_result_tensor_params_default(self, &layer->lut);
+    return;
+}
@@ -30,6 +30,7 @@
 #include "basic/default/aimath/aimath_f32_default.h"
 #include "basic/default/aimath/aimath_q31_default.h"
 #include "basic/default/aimath/aimath_q7_default.h"
+#include "basic/default/ailayer/ailayer_q7_lut_default.h"
 
 #define AILAYER_ELU_F32_A(alpha) {{{0,},},alpha}
 #define AILAYER_ELU_F32_M(alpha) {{{0,},},alpha}
@@ -37,10 +38,13 @@
 #define AILAYER_ELU_Q31_A(alpha) {{{0,},},alpha}
 #define AILAYER_ELU_Q7_M(alpha)  {{{0,},},alpha}
 #define AILAYER_ELU_Q7_A(alpha)  {{{0,},},alpha}
+#define AILAYER_ELU_Q7_LUT_M(alpha)      {AILAYER_ELU_Q7_M(alpha), AILAYER_Q7_LUT()}
+#define AILAYER_ELU_Q7_LUT_A(alpha)      {AILAYER_ELU_Q7_A(alpha), AILAYER_Q7_LUT()}
 
 typedef struct ailayer_elu_f32 	ailayer_elu_f32_t;
 typedef struct ailayer_elu_q31 	ailayer_elu_q31_t;
 typedef struct ailayer_elu_q7 	ailayer_elu_q7_t;
+typedef struct ailayer_elu_q7_lut 	ailayer_elu_q7_lut_t;
 
 /** @brief Data-type specific ELU layer struct for \link aimath_f32.h F32 \endlink
  *
@@ -69,6 +73,15 @@ struct ailayer_elu_q7 {
 	aiscalar_q7_t alpha; /**< Data-type specific parameter used to calculate ELU function for input values < 0. */
 };
 
+/** @brief ELU layer struct for \link aimath_q7.h Q7 \endlink with a lookup table
+ *
+ * Adds the lookup table to the Q7 implementation.
+ */
+struct ailayer_elu_q7_lut {
+	ailayer_elu_q7_t base; /**< Inherited field members from the \link aimath_q7.h Q7 \endlink ELU layer struct. */
+	ailayer_q7_lut_t lut; /**< Lookup table for the current input quantization parameters (see ailayer_q7_lut_default.h). */
+};
+
 /** @brief Initializes and connect an \link ailayer_elu.h ELU layer \endlink with the \link aimath_f32.h F32 \endlink default implementation
  *
  * **Example:** Create the layer structure:\n
@@ -150,6 +163,33 @@ ailayer_t *ailayer_elu_q31_default(ailayer_elu_q31_t *layer, ailayer_t *input_la
  */
 ailayer_t *ailayer_elu_q7_default(ailayer_elu_q7_t *layer, ailayer_t *input_layer);
 
+/** @brief Initializes and connect a \link ailayer_elu.h ELU layer \endlink with the \link aimath_q7.h Q7 \endlink default implementation using a lookup table
+ *
+ * Instead of evaluating a piecewise approximation for every element, the results for all 256 possible input values are
+ * pre-calculated (in F32) into a lookup table in the layer structure. The forward pass is one table load per element
+ * (aimath_q7_default_lut()). No parameter memory is needed, so the layer also works with pretrained models whose parameters are in read-only memory.
+ * The table is calculated in the constructor if the quantization parameters of the input are already known (e.g. for a pretrained model),
+ * otherwise when the quantization parameters are calculated or in the first forward pass. It is re-calculated if the
+ * quantization parameters of the input change. Set lut.table.is_valid to 0 after changing alpha.
+ *
+ * The quantization parameters of the result tensor are the same as the input quantization parameters (same as ailayer_elu_q7_default()).
+ *
+ * **Example:** Create the layer structure:\n
+ * \code{.c}
+ * ailayer_elu_q7_lut_t elu_layer = AILAYER_ELU_Q7_LUT_M(AISCALAR_Q7(1.0f, 2, 0));
+ * \endcode
+ *
+ * **Example:** Initialize and connect the layer:\n
+ * \code{.c}
+ * x = ailayer_elu_q7_lut_default(&elu_layer, x);
+ * \endcode
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_elu_q7_lut_default(ailayer_elu_q7_lut_t *layer, ailayer_t *input_layer);
+
 /** @brief Calculate and set the quantization parameters for the result tensor of the ELU \link aimath_q31.h Q31 \endlink default implementation
  *
  * *Implementation of ailayer.calc_result_tensor_params.*
@@ -170,4 +210,24 @@ void ailayer_elu_calc_result_tensor_params_q31_default(ailayer_t *self);
  */
 void ailayer_elu_calc_result_tensor_params_q7_default(ailayer_t *self);
 
+/** @brief Calculate the forward pass of the ELU layer with the lookup table (\link aimath_q7.h Q7 \endlink)
+ *
+ * *Implementation of ailayer.forward.*
+ *
+ * Applies the lookup table with ailayer_q7_lut_forward_default().
+ *
+ * @param *self     The layer structure
+ */
+void ailayer_elu_forward_q7_lut_default(ailayer_t *self);
+
+/** @brief Calculate the quantization parameters of the result and the lookup table of the ELU layer (\link aimath_q7.h Q7 \endlink)
+ *
+ * *Implementation of ailayer.calc_result_tensor_params.*
+ *
+ * Uses ailayer_elu_calc_result_tensor_params_q7_default() and calculates the lookup table for the quantization parameters of the input.
+ *
+ * @param *self     The layer structure
+ */
+void ailayer_elu_calc_result_tensor_params_q7_lut_default(ailayer_t *self);
+
 #endif // AILAYER_ELU_DEFAULT
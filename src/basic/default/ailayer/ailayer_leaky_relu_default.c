@@ -109,3 +109,37 @@ void ailayer_leaky_relu_calc_result_tensor_params_q7_default(ailayer_t *self)
 	qparams->zero_point = ((aimath_q7_params_t *) (self->input_layer->result.tensor_params))->zero_point;
 }
 
+static float leaky_relu_f32(float x, const void *args)
+{
+    const aiscalar_q7_t *alpha = (const aiscalar_q7_t *) args;
+    float alpha_f32 = (float) (alpha->value - alpha->zero_point) / (float) ((uint32_t) 1 << alpha->shift);
+
+    return x >= 0.0f ? x : alpha_f32 * x;
+}
+
+ailayer_t *ailayer_leaky_relu_q7_lut_default(ailayer_leaky_relu_q7_lut_t *layer, ailayer_t *input_layer)
+{
+    ailayer_t *return_layer;
+
+    return_layer = ailayer_leaky_relu_q7_default(&layer->base, input_layer);
+    ailayer_q7_lut_init_default(return_layer, &layer->lut, leaky_relu_f32, &layer->base.alpha,
+                                ailayer_leaky_relu_forward_q7_lut_default, ailayer_leaky_relu_calc_result_tensor_params_q7_lut_default);
+
+    return return_layer;
+}
+
+void ailayer_leaky_relu_forward_q7_lut_default(ailayer_t *self)
+{
+    ailayer_leaky_relu_q7_lut_t *layer = (ailayer_leaky_relu_q7_lut_t *) (self->layer_configuration);
+
+    ailayer_q7_lut_forward_default(self, &layer->lut);
+    return;
+}
+
+void ailayer_leaky_relu_calc_result_tensor_params_q7_lut_default(ailayer_t *self)
+{
+    ailayer_leaky_relu_q7_lut_t *layer = (ailayer_leaky_relu_q7_lut_t *) (self->layer_configuration);
+
+    ailayer_q7_lut_calc_result_tensor_params_default(self, &layer->lut);
+    return;
+}
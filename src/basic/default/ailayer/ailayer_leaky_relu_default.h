@@ -32,6 +32,7 @@
 #include "basic/default/aimath/aimath_f32_default.h"
 #include "basic/default/aimath/aimath_q31_default.h"
 #include "basic/default/aimath/aimath_q7_default.h"
+#include "basic/default/ailayer/ailayer_q7_lut_default.h"
 
 #define AILAYER_LEAKY_RELU_F32_A(alpha)         {{{0,},},alpha}
 #define AILAYER_LEAKY_RELU_F32_M(alpha)         {{{0,},},alpha}
@@ -39,10 +40,13 @@
 #define AILAYER_LEAKY_RELU_Q31_A(alpha)         {{{0,},},alpha}
 #define AILAYER_LEAKY_RELU_Q7_M(alpha)          {{{0,},},alpha}
 #define AILAYER_LEAKY_RELU_Q7_A(alpha)          {{{0,},},alpha}
+#define AILAYER_LEAKY_RELU_Q7_LUT_M(alpha)      {AILAYER_LEAKY_RELU_Q7_M(alpha), AILAYER_Q7_LUT()}
+#define AILAYER_LEAKY_RELU_Q7_LUT_A(alpha)      {AILAYER_LEAKY_RELU_Q7_A(alpha), AILAYER_Q7_LUT()}
 
 typedef struct ailayer_leaky_relu_f32 	ailayer_leaky_relu_f32_t;
 typedef struct ailayer_leaky_relu_q31 	ailayer_leaky_relu_q31_t;
 typedef struct ailayer_leaky_relu_q7 	ailayer_leaky_relu_q7_t;
+typedef struct ailayer_leaky_relu_q7_lut 	ailayer_leaky_relu_q7_lut_t;
 
 /** @brief Data-type specific Leaky ReLU layer struct for \link aimath_f32.h F32 \endlink
  *
@@ -71,6 +75,15 @@ struct ailayer_leaky_relu_q7 {
 	aiscalar_q7_t alpha; /**< Data type-specific parameter used to calculate Leaky ReLU function for input values < 0. */
 };
 
+/** @brief Leaky ReLU layer struct for \link aimath_q7.h Q7 \endlink with a lookup table
+ *
+ * Adds the lookup table to the Q7 implementation.
+ */
+struct ailayer_leaky_relu_q7_lut {
+	ailayer_leaky_relu_q7_t base; /**< Inherited field members from the \link aimath_q7.h Q7 \endlink Leaky ReLU layer struct. */
+	ailayer_q7_lut_t lut; /**< Lookup table for the current input quantization parameters (see ailayer_q7_lut_default.h). */
+};
+
 /** @brief Initializes and connect a \link ailayer_leaky_relu.h Leaky ReLU layer \endlink with the \link aimath_f32.h F32 \endlink default implementation
  *
  * **Example:** Create the layer structure:\n
@@ -152,6 +165,33 @@ ailayer_t *ailayer_leaky_relu_q31_default(ailayer_leaky_relu_q31_t *layer, ailay
  */
 ailayer_t *ailayer_leaky_relu_q7_default(ailayer_leaky_relu_q7_t *layer, ailayer_t *input_layer);
 
+/** @brief Initializes and connect a \link ailayer_leaky_relu.h Leaky ReLU layer \endlink with the \link aimath_q7.h Q7 \endlink default implementation using a lookup table
+ *
+ * Instead of evaluating a piecewise approximation for every element, the results for all 256 possible input values are
+ * pre-calculated (in F32) into a lookup table in the layer structure. The forward pass is one table load per element
+ * (aimath_q7_default_lut()). No parameter memory is needed, so the layer also works with pretrained models whose parameters are in read-only memory.
+ * The table is calculated in the constructor if the quantization parameters of the input are already known (e.g. for a pretrained model),
+ * otherwise when the quantization parameters are calculated or in the first forward pass. It is re-calculated if the
+ * quantization parameters of the input change. Set lut.table.is_valid to 0 after changing alpha.
+ *
+ * The quantization parameters of the result tensor are the same as the input quantization parameters (same as ailayer_leaky_relu_q7_default()).
+ *
+ * **Example:** Create the layer structure:\n
+ * \code{.c}
+ * ailayer_leaky_relu_q7_lut_t leaky_relu_layer = AILAYER_LEAKY_RELU_Q7_LUT_M(AISCALAR_Q7(0.01f, 7, 0));
+ * \endcode
+ *
+ * **Example:** Initialize and connect the layer:\n
+ * \code{.c}
+ * x = ailayer_leaky_relu_q7_lut_default(&leaky_relu_layer, x);
+ * \endcode
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_leaky_relu_q7_lut_default(ailayer_leaky_relu_q7_lut_t *layer, ailayer_t *input_layer);
+
 /** @brief Calculate and set the quantization parameters for the result tensor of the Leaky ReLU \link aimath_q31.h Q31 \endlink default implementation
  *
  * *Implementation of ailayer.calc_result_tensor_params.*
@@ -172,4 +212,24 @@ void ailayer_leaky_relu_calc_result_tensor_params_q31_default(ailayer_t *self);
  */
 void ailayer_leaky_relu_calc_result_tensor_params_q7_default(ailayer_t *self);
 
+/** @brief Calculate the forward pass of the Leaky ReLU layer with the lookup table (\link aimath_q7.h Q7 \endlink)
+ *
+ * *Implementation of ailayer.forward.*
+ *
+ * Applies the lookup table with ailayer_q7_lut_forward_default().
+ *
+ * @param *self     The layer structure
+ */
+void ailayer_leaky_relu_forward_q7_lut_default(ailayer_t *self);
+
+/** @brief Calculate the quantization parameters of the result and the lookup table of the Leaky ReLU layer (\link aimath_q7.h Q7 \endlink)
+ *
+ * *Implementation of ailayer.calc_result_tensor_params.*
+ *
+ * Uses ailayer_leaky_relu_calc_result_tensor_params_q7_default() and calculates the lookup table for the quantization parameters of the input.
+ *
+ * @param *self     The layer structure
+ */
+void ailayer_leaky_relu_calc_result_tensor_params_q7_lut_default(ailayer_t *self);
+
 #endif // AILAYER_LEAKY_RELU_DEFAULT
@@ -0,0 +1,76 @@
+/**
+ * \file basic/default/ailayer/ailayer_q7_lut_default.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief
+ * \details
+ */
+
+#include "basic/default/ailayer/ailayer_q7_lut_default.h"
+
+void ailayer_q7_lut_init_default(ailayer_t *self,
+                                 ailayer_q7_lut_t *lut,
+                                 float (*function)(float x, const void *args),
+                                 const void *args,
+                                 void (*forward)(ailayer_t *self),
+                                 void (*calc_result_tensor_params)(ailayer_t *self))
+{
+    lut->function = function;
+    lut->args = args;
+    lut->calc_result_tensor_params = self->calc_result_tensor_params;
+    lut->table.is_valid = 0;
+
+    self->forward = forward;
+    self->calc_result_tensor_params = calc_result_tensor_params;
+
+    // Pretrained models know the quantization of the input already
+    if(self->input_layer->result.tensor_params != 0){
+        ailayer_q7_lut_calc_result_tensor_params_default(self, lut);
+    }
+    return;
+}
+
+void ailayer_q7_lut_calc_result_tensor_params_default(ailayer_t *self, ailayer_q7_lut_t *lut)
+{
+    void *result_params = self->result.tensor_params;
+
+    // The result tensor parameters are only set when the inference memory is scheduled,
+    // so the quantization of the base implementation is calculated into the table
+    self->result.tensor_params = &lut->table.result_params;
+    lut->calc_result_tensor_params(self);
+    self->result.tensor_params = result_params;
+
+    aimath_q7_default_lut_build((aimath_q7_params_t *) self->input_layer->result.tensor_params,
+                                &lut->table.result_params,
+                                lut->function, lut->args, &lut->table);
+    if(result_params != 0){
+        *((aimath_q7_params_t *) result_params) = lut->table.result_params;
+    }
+    return;
+}
+
+void ailayer_q7_lut_forward_default(ailayer_t *self, ailayer_q7_lut_t *lut)
+{
+    aitensor_t *x_in = &(self->input_layer->result);
+    aitensor_t *x_out = &(self->result);
+
+    if(!aimath_q7_default_lut_is_valid(&lut->table, (aimath_q7_params_t *) x_in->tensor_params)){
+        ailayer_q7_lut_calc_result_tensor_params_default(self, lut);
+    }
+    aimath_q7_default_lut(x_in, &lut->table, x_out);
+    return;
+}
@@ -0,0 +1,85 @@
+/**
+ * \file basic/default/ailayer/ailayer_q7_lut_default.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Shared lookup table implementation of the \link aimath_q7.h Q7 \endlink activation layers
+ * \details The Q7 lookup table layers (e.g. ailayer_sigmoid_q7_lut_default(), ailayer_elu_q7_lut_default()) only provide
+ * the F32 function of the activation. The table (aimath_q7_lut_t) is part of the layer structure, so it works with
+ * parameters in read-only memory and without parameter memory. It is calculated in the constructor if the quantization parameters
+ * of the input are already known (e.g. for a pretrained model created with the *_M macros), when the quantization parameters
+ * are calculated (ailayer.calc_result_tensor_params) and in the forward pass if the quantization parameters of the input changed.
+ */
+
+#ifndef AILAYER_Q7_LUT_DEFAULT
+#define AILAYER_Q7_LUT_DEFAULT
+
+#include "core/aifes_core.h"
+#include "basic/default/aimath/aimath_q7_default.h"
+
+#define AILAYER_Q7_LUT()    {{{0,},},0,0}  /**< Initializer of an ailayer_q7_lut_t (the fields are set by ailayer_q7_lut_init_default()) */
+
+typedef struct ailayer_q7_lut 	ailayer_q7_lut_t;
+
+/** @brief Lookup table of a \link aimath_q7.h Q7 \endlink activation layer together with the function it is calculated from
+ */
+struct ailayer_q7_lut {
+	aimath_q7_lut_t table; /**< Lookup table for the current input quantization parameters. */
+	float (*function)(float x, const void *args); /**< F32 activation function the table is calculated from. */
+	const void *args; /**< Additional arguments for the function (e.g. alpha of the ELU layer, can be 0). */
+	void (*calc_result_tensor_params)(ailayer_t *self); /**< Quantization of the result of the base implementation (e.g. ailayer_sigmoid_calc_result_tensor_params_q7_default()). */
+};
+
+/** @brief Initializes the lookup table of a Q7 activation layer
+ *
+ * Called by the constructors of the lookup table layers after the constructor of the base Q7 implementation.
+ * Sets the forward and calc_result_tensor_params functions of the layer that still have to call ailayer_q7_lut_forward_default()
+ * and ailayer_q7_lut_calc_result_tensor_params_default() with the table of the layer. If the quantization parameters of the input are already set,
+ * the table is calculated.
+ *
+ * @param *self                         The layer structure (already initialized by the base Q7 constructor)
+ * @param *lut                          The lookup table in the layer structure
+ * @param function                      F32 activation function
+ * @param *args                         Additional arguments for the function (can be 0)
+ * @param forward                       Layer specific forward function (calls ailayer_q7_lut_forward_default())
+ * @param calc_result_tensor_params     Layer specific function to calculate the table (calls ailayer_q7_lut_calc_result_tensor_params_default())
+ */
+void ailayer_q7_lut_init_default(ailayer_t *self,
+                                 ailayer_q7_lut_t *lut,
+                                 float (*function)(float x, const void *args),
+                                 const void *args,
+                                 void (*forward)(ailayer_t *self),
+                                 void (*calc_result_tensor_params)(ailayer_t *self));
+
+/** @brief Calculates the quantization parameters of the result and the lookup table for the quantization parameters of the input
+ *
+ * @param *self     The layer structure
+ * @param *lut      The lookup table in the layer structure
+ */
+void ailayer_q7_lut_calc_result_tensor_params_default(ailayer_t *self, ailayer_q7_lut_t *lut);
+
+/** @brief Calculates the forward pass of a Q7 activation layer with the lookup table
+ *
+ * The table is re-calculated if it is not valid for the current quantization parameters of the input (e.g. after a re-quantization).
+ *
+ * @param *self     The layer structure
+ * @param *lut      The lookup table in the layer structure
+ */
+void ailayer_q7_lut_forward_default(ailayer_t *self, ailayer_q7_lut_t *lut);
+
+#endif // AILAYER_Q7_LUT_DEFAULT
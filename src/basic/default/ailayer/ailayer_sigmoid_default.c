@@ -98,3 +98,35 @@ void ailayer_sigmoid_calc_result_tensor_params_q7_default(ailayer_t *self)
 	qparams->shift = 8;
 	qparams->zero_point = -128;
 }
+
+static float sigmoid_f32(float x, const void *args)
+{
+    return 1.0f / (1.0f + expf(-x));
+}
+
+ailayer_t *ailayer_sigmoid_q7_lut_default(ailayer_sigmoid_q7_lut_t *layer, ailayer_t *input_layer)
+{
+    ailayer_t *return_layer;
+
+    return_layer = ailayer_sigmoid_q7_default(&layer->base, input_layer);
+    ailayer_q7_lut_init_default(return_layer, &layer->lut, sigmoid_f32, 0,
+                                ailayer_sigmoid_forward_q7_lut_default, ailayer_sigmoid_calc_result_tensor_params_q7_lut_default);
+
+    return return_layer;
+}
+
+void ailayer_sigmoid_forward_q7_lut_default(ailayer_t *self)
+{
+    ailayer_sigmoid_q7_lut_t *layer = (ailayer_sigmoid_q7_lut_t *) (self->layer_configuration);
+
+    ailayer_q7_lut_forward_default(self, &layer->lut);
+    return;
+}
+
+void ailayer_sigmoid_calc_result_tensor_params_q7_lut_default(ailayer_t *self)
+{
+    ailayer_sigmoid_q7_lut_t *layer = (ailayer_sigmoid_q7_lut_t *) (self->layer_configuration);
+
+    ailayer_q7_lut_calc_result_tensor_params_default(self, &layer->lut);
+    return;
+}
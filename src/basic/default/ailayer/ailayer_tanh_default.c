@@ -100,4 +100,34 @@ void ailayer_tanh_calc_result_tensor_params_q7_default(ailayer_t *self)
 	qparams->zero_point = 0;
 }
 
+static float tanh_f32(float x, const void *args)
+{
+    return tanhf(x);
+}
+
+ailayer_t *ailayer_tanh_q7_lut_default(ailayer_tanh_q7_lut_t *layer, ailayer_t *input_layer)
+{
+    ailayer_t *return_layer;
+
+    return_layer = ailayer_tanh_q7_default(&layer->base, input_layer);
+    ailayer_q7_lut_init_default(return_layer, &layer->lut, tanh_f32, 0,
+                                ailayer_tanh_forward_q7_lut_default, ailayer_tanh_calc_result_tensor_params_q7_lut_default);
+
+    return return_layer;
+}
 
+void ailayer_tanh_forward_q7_lut_default(ailayer_t *self)
+{
+    ailayer_tanh_q7_lut_t *layer = (ailayer_tanh_q7_lut_t *) (self->layer_configuration);
+
+    ailayer_q7_lut_forward_default(self, &layer->lut);
+    return;
+}
+
+void ailayer_tanh_calc_result_tensor_params_q7_lut_default(ailayer_t *self)
+{
+    ailayer_tanh_q7_lut_t *layer = (ailayer_tanh_q7_lut_t *) (self->layer_configuration);
+
+    ailayer_q7_lut_calc_result_tensor_params_default(self, &layer->lut);
+    return;
+}
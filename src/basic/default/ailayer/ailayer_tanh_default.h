@@ -32,6 +32,7 @@
 #include "basic/default/aimath/aimath_f32_default.h"
 #include "basic/default/aimath/aimath_q31_default.h"
 #include "basic/default/aimath/aimath_q7_default.h"
+#include "basic/default/ailayer/ailayer_q7_lut_default.h"
 
 #define AILAYER_TANH_F32_M()        {{0,}}
 #define AILAYER_TANH_F32_A()        {{0,}}
@@ -39,10 +40,22 @@
 #define AILAYER_TANH_Q31_A()        {{0,}}
 #define AILAYER_TANH_Q7_M()         {{0,}}
 #define AILAYER_TANH_Q7_A()         {{0,}}
+#define AILAYER_TANH_Q7_LUT_M()      {AILAYER_TANH_Q7_M(), AILAYER_Q7_LUT()}
+#define AILAYER_TANH_Q7_LUT_A()      {AILAYER_TANH_Q7_A(), AILAYER_Q7_LUT()}
 
 typedef struct ailayer_tanh 	ailayer_tanh_f32_t;
 typedef struct ailayer_tanh 	ailayer_tanh_q31_t;
 typedef struct ailayer_tanh 	ailayer_tanh_q7_t;
+typedef struct ailayer_tanh_q7_lut 	ailayer_tanh_q7_lut_t;
+
+/** @brief Tanh layer struct for \link aimath_q7.h Q7 \endlink with a lookup table
+ *
+ * Adds the lookup table to the base implementation.
+ */
+struct ailayer_tanh_q7_lut {
+	ailayer_tanh_t base; /**< Inherited field members from general ailayer_tanh struct. */
+	ailayer_q7_lut_t lut; /**< Lookup table for the current input quantization parameters (see ailayer_q7_lut_default.h). */
+};
 
 /** @brief Initializes and connect an \link ailayer_tanh.h Tanh layer \endlink with the \link aimath_f32.h F32 \endlink default implementation
  *
@@ -118,6 +131,33 @@ ailayer_t *ailayer_tanh_q31_default(ailayer_tanh_q31_t *layer, ailayer_t *input_
  */
 ailayer_t *ailayer_tanh_q7_default(ailayer_tanh_q7_t *layer, ailayer_t *input_layer);
 
+/** @brief Initializes and connect a \link ailayer_tanh.h Tanh layer \endlink with the \link aimath_q7.h Q7 \endlink default implementation using a lookup table
+ *
+ * Instead of evaluating a piecewise approximation for every element, the results for all 256 possible input values are
+ * pre-calculated (in F32) into a lookup table in the layer structure. The forward pass is one table load per element
+ * (aimath_q7_default_lut()). No parameter memory is needed, so the layer also works with pretrained models whose parameters are in read-only memory.
+ * The table is calculated in the constructor if the quantization parameters of the input are already known (e.g. for a pretrained model),
+ * otherwise when the quantization parameters are calculated or in the first forward pass. It is re-calculated if the
+ * quantization parameters of the input change.
+ *
+ * The quantization parameters of the result tensor are {shift = 7, zero_point = 0} (same as ailayer_tanh_q7_default()).
+ *
+ * **Example:** Create the layer structure:\n
+ * \code{.c}
+ * ailayer_tanh_q7_lut_t tanh_layer = AILAYER_TANH_Q7_LUT_M();
+ * \endcode
+ *
+ * **Example:** Initialize and connect the layer:\n
+ * \code{.c}
+ * x = ailayer_tanh_q7_lut_default(&tanh_layer, x);
+ * \endcode
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_tanh_q7_lut_default(ailayer_tanh_q7_lut_t *layer, ailayer_t *input_layer);
+
 /** @brief Calculate and set the quantization parameters for the result tensor of the tanh \link aimath_q31.h Q31 \endlink default implementation
  *
  * *Implementation of ailayer.calc_result_tensor_params.*
@@ -138,4 +178,24 @@ void ailayer_tanh_calc_result_tensor_params_q31_default(ailayer_t *self);
  */
 void ailayer_tanh_calc_result_tensor_params_q7_default(ailayer_t *self);
 
+/** @brief Calculate the forward pass of the Tanh layer with the lookup table (\link aimath_q7.h Q7 \endlink)
+ *
+ * *Implementation of ailayer.forward.*
+ *
+ * Applies the lookup table with ailayer_q7_lut_forward_default().
+ *
+ * @param *self     The layer structure
+ */
+void ailayer_tanh_forward_q7_lut_default(ailayer_t *self);
+
+/** @brief Calculate the quantization parameters of the result and the lookup table of the Tanh layer (\link aimath_q7.h Q7 \endlink)
+ *
+ * *Implementation of ailayer.calc_result_tensor_params.*
+ *
+ * Uses ailayer_tanh_calc_result_tensor_params_q7_default() and calculates the lookup table for the quantization parameters of the input.
+ *
+ * @param *self     The layer structure
+ */
+void ailayer_tanh_calc_result_tensor_params_q7_lut_default(ailayer_t *self);
+
 #endif // AILAYER_TANH_DEFAULT
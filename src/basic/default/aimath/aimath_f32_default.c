@@ -68,6 +68,55 @@ void aimath_f32_default_linear(const aitensor_t *a, const aitensor_t *b, const a
 	return;
 }
 
+void aimath_f32_default_linear_rowwise(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result)
+{
+	uint16_t i, j, k;
+	uint16_t K = a->shape[1], M = b->shape[1];
+	float a_ik;
+
+	float *a_row;
+	float *b_row;
+	float *c_data = c != 0 ? (float *) c->data : 0;
+	float *result_row;
+
+#ifdef AIDEBUG_SHAPE_CHECKS
+	if(a->shape[1] != b->shape[0])
+	{
+		AILOG_E(aistring_error_f32_linear_1);
+		return;
+	}
+	if(a->shape[0] != result->shape[0] || b->shape[1] != result->shape[1])
+	{
+		AILOG_E(aistring_error_f32_linear_2);
+		return;
+	}
+#endif
+
+	for(i = 0; i < a->shape[0]; i++)
+	{
+		a_row = (float *) a->data + i * K;
+		result_row = (float *) result->data + i * M;
+
+		// Initialize the result row with the bias
+		for(j = 0; j < M; j++)
+		{
+			result_row[j] = c != 0 ? c_data[j] : 0.0f;
+		}
+
+		// Accumulate the scaled rows of b
+		for(k = 0; k < K; k++)
+		{
+			a_ik = a_row[k];
+			b_row = (float *) b->data + k * M;
+			for(j = 0; j < M; j++)
+			{
+				result_row[j] += a_ik * b_row[j];
+			}
+		}
+	}
+	return;
+}
+
 void aimath_f32_default_linear_at(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result)
 {
 	uint16_t i, j, k;
@@ -152,6 +201,182 @@ void aimath_f32_default_linear_bt(const aitensor_t *a, const aitensor_t *b, cons
 	return;
 }
 
+void aimath_f32_default_linear_palettized_bt(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result)
+{
+	uint16_t i, j, k, p;
+	float sum;
+	float partial_sums[256];
+	uint8_t index_byte;
+	const uint8_t *b_row;
+
+	aimath_palette_params_t *palette = (aimath_palette_params_t *) b->tensor_params;
+	uint32_t row_bytes = AIMATH_PALETTE_ROW_BYTES(b->shape[1], palette->index_bits);
+
+	float *a_data = (float *) a->data;
+	uint8_t *b_data = (uint8_t *) b->data;
+	float *c_data = c != 0 ? (float *) c->data : 0;
+	float *result_data = (float *) result->data;
+	float *a_row;
+
+#ifdef AIDEBUG_SHAPE_CHECKS
+	if(a->shape[1] != b->shape[1])
+	{
+		AILOG_E(aistring_error_f32_linear_1);
+		return;
+	}
+	if(a->shape[0] != result->shape[0] || b->shape[0] != result->shape[1])
+	{
+		AILOG_E(aistring_error_f32_linear_2);
+		return;
+	}
+#endif
+
+	for(i = 0; i < a->shape[0]; i++)
+	{
+		a_row = a_data + i*a->shape[1];
+		for(j = 0; j < b->shape[0]; j++)
+		{
+			b_row = b_data + j*row_bytes;
+			for(p = 0; p < palette->centroid_count; p++)
+			{
+				partial_sums[p] = 0.0f;
+			}
+
+			// Accumulate the inputs per centroid
+			if(palette->index_bits == 4)
+			{
+				for(k = 0; k + 1 < a->shape[1]; k += 2)
+				{
+					index_byte = b_row[k >> 1];
+					partial_sums[index_byte & 0x0F] += a_row[k];
+					partial_sums[index_byte >> 4] += a_row[k + 1];
+				}
+				if(k < a->shape[1])
+				{
+					partial_sums[b_row[k >> 1] & 0x0F] += a_row[k];
+				}
+			}
+			else
+			{
+				for(k = 0; k < a->shape[1]; k++)
+				{
+					partial_sums[b_row[k]] += a_row[k];
+				}
+			}
+
+			sum = 0.0f;
+			for(p = 0; p < palette->centroid_count; p++)
+			{
+				sum += palette->codebook[p] * partial_sums[p];
+			}
+			if(c != 0){
+				// Bias add
+				sum += c_data[j];
+			}
+			result_data[i*result->shape[1] + j] = sum;
+		}
+	}
+	return;
+}
+
+void aimath_f32_default_linear_sparse_bt(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result)
+{
+	uint32_t i, j, e, p;
+	uint16_t k;
+	float sum;
+	float x;
+	float block_sums[4];
+	const float *values;
+
+	aimath_sparse_params_t *sparse = (aimath_sparse_params_t *) b->tensor_params;
+	uint16_t inputs = a->shape[1];
+	uint16_t outputs = b->shape[0];
+
+	float *a_data = (float *) a->data;
+	float *b_data = (float *) b->data;
+	float *c_data = c != 0 ? (float *) c->data : 0;
+	float *result_data = (float *) result->data;
+	float *a_row;
+	float *result_row;
+
+#ifdef AIDEBUG_SHAPE_CHECKS
+	if(a->shape[1] != b->shape[1])
+	{
+		AILOG_E(aistring_error_f32_linear_1);
+		return;
+	}
+	if(a->shape[0] != result->shape[0] || b->shape[0] != result->shape[1])
+	{
+		AILOG_E(aistring_error_f32_linear_2);
+		return;
+	}
+#endif
+
+	for(i = 0; i < a->shape[0]; i++)
+	{
+		a_row = a_data + i*inputs;
+		result_row = result_data + i*outputs;
+
+		if(sparse->format == AIMATH_SPARSE_BLOCK_1X4)
+		{
+			for(j = 0; j < outputs; j++)
+			{
+				sum = 0.0f;
+				for(e = sparse->row_ptr[j]; e < sparse->row_ptr[j + 1]; e++)
+				{
+					k = sparse->col_idx[e];
+					values = b_data + 4*e;
+					if(k + 4 <= inputs){
+						sum += values[0] * a_row[k] + values[1] * a_row[k + 1] + values[2] * a_row[k + 2] + values[3] * a_row[k + 3];
+					} else {
+						// Last block of a row that exceeds the matrix
+						for(p = 0; k + p < inputs; p++){
+							sum += values[p] * a_row[k + p];
+						}
+					}
+				}
+				result_row[j] = c != 0 ? sum + c_data[j] : sum;
+			}
+		}
+		else if(sparse->format == AIMATH_SPARSE_BLOCK_4X1)
+		{
+			for(j = 0; 4*j < outputs; j++)
+			{
+				block_sums[0] = 0.0f;
+				block_sums[1] = 0.0f;
+				block_sums[2] = 0.0f;
+				block_sums[3] = 0.0f;
+				for(e = sparse->row_ptr[j]; e < sparse->row_ptr[j + 1]; e++)
+				{
+					x = a_row[sparse->col_idx[e]];
+					values = b_data + 4*e;
+					block_sums[0] += values[0] * x;
+					block_sums[1] += values[1] * x;
+					block_sums[2] += values[2] * x;
+					block_sums[3] += values[3] * x;
+				}
+				for(p = 0; p < 4 && 4*j + p < outputs; p++){
+					result_row[4*j + p] = c != 0 ? block_sums[p] + c_data[4*j + p] : block_sums[p];
+				}
+			}
+		}
+		else
+		{
+			// CSR
+			for(j = 0; j < outputs; j++)
+			{
+				sum = 0.0f;
+				for(e = sparse->row_ptr[j]; e < sparse->row_ptr[j + 1]; e++)
+				{
+					sum += b_data[e] * a_row[sparse->col_idx[e]];
+				}
+				result_row[j] = c != 0 ? sum + c_data[j] : sum;
+			}
+		}
+	}
+	return;
+}
+
 
 void aimath_f32_default_linear_atrt(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result)
 {
@@ -780,6 +1005,356 @@ float aimath_f32_default_expf_fast(float x)
 
 }
 
+// Polynomial approximations
+// Range reduction x = n * ln(2) + r with |r| <= ln(2)/2 (Cody-Waite with two constants), exp(x) = 2^n * p(r).
+// Rounding with the magic number 1.5 * 2^23, the exponent scaling with integer operations and selects (?:) instead of
+// branches keep the functions branch-free, so that the compiler can vectorize the loops of the tensor functions
+// (GCC needs -fno-trapping-math to if-convert the float selects, Clang vectorizes them by default).
+#define AIMATH_F32_POLY_EXP_MAX         88.3f   // n <= 127
+#define AIMATH_F32_POLY_EXP_MIN         -87.3f  // n >= -126 (normal numbers)
+#define AIMATH_F32_POLY_LOG2E           1.44269504088896341f
+#define AIMATH_F32_POLY_LN2_HI          0.693359375f
+#define AIMATH_F32_POLY_LN2_LO          -2.12194440e-4f
+#define AIMATH_F32_POLY_ROUND_MAGIC     12582912.0f
+
+float aimath_f32_default_expf_poly(float x)
+{
+    union { float f; int32_t i; } u;
+    float n, r, r2, p;
+
+    x = x < AIMATH_F32_POLY_EXP_MIN ? AIMATH_F32_POLY_EXP_MIN : x;
+    x = x > AIMATH_F32_POLY_EXP_MAX ? AIMATH_F32_POLY_EXP_MAX : x;
+
+    n = (x * AIMATH_F32_POLY_LOG2E + AIMATH_F32_POLY_ROUND_MAGIC) - AIMATH_F32_POLY_ROUND_MAGIC;
+    r = x - n * AIMATH_F32_POLY_LN2_HI;
+    r = r - n * AIMATH_F32_POLY_LN2_LO;
+
+    // Minimax polynomial of degree 7 (Cephes expf)
+    r2 = r * r;
+    p = 1.9875691500e-4f;
+    p = p * r + 1.3981999507e-3f;
+    p = p * r + 8.3334519073e-3f;
+    p = p * r + 4.1665795894e-2f;
+    p = p * r + 1.6666665459e-1f;
+    p = p * r + 5.0000001201e-1f;
+    p = p * r2 + r + 1.0f;
+
+    // 2^n
+    u.i = ((int32_t) n + 127) << 23;
+    return p * u.f;
+}
+
+float aimath_f32_default_expf_poly_fast(float x)
+{
+    union { float f; int32_t i; } u;
+    float n, r, p;
+
+    x = x < AIMATH_F32_POLY_EXP_MIN ? AIMATH_F32_POLY_EXP_MIN : x;
+    x = x > AIMATH_F32_POLY_EXP_MAX ? AIMATH_F32_POLY_EXP_MAX : x;
+
+    n = (x * AIMATH_F32_POLY_LOG2E + AIMATH_F32_POLY_ROUND_MAGIC) - AIMATH_F32_POLY_ROUND_MAGIC;
+    r = x - n * 0.693147180559945f;
+
+    // Polynomial of degree 3 (relative minimax fit on [-ln(2)/2, ln(2)/2])
+    p = 1.65668320e-1f;
+    p = p * r + 5.04963259e-1f;
+    p = p * r + 1.00016419f;
+    p = p * r + 9.99928074e-1f;
+
+    u.i = ((int32_t) n + 127) << 23;
+    return p * u.f;
+}
+
+float aimath_f32_default_logf_poly(float x)
+{
+    union { float f; int32_t i; } u;
+    float e, m, z, p, y;
+    int32_t mask;
+
+    // Non-positive and subnormal values are clamped to the smallest normal value (result: -87.34)
+    u.f = x < FLT_MIN ? FLT_MIN : x;
+
+    // x = 2^e * m with m in [sqrt(0.5), sqrt(2))
+    e = (float) ((u.i >> 23) - 126);
+    u.i = (u.i & 0x007FFFFF) | 0x3F000000;
+    mask = -(u.f < 0.707106781186547524f);
+    e = e - (float) (mask & 1);
+    m = u.f + (float) (mask & 1) * u.f - 1.0f;
+
+    // Polynomial of degree 9 (Cephes logf)
+    z = m * m;
+    p = 7.0376836292e-2f;
+    p = p * m - 1.1514610310e-1f;
+    p = p * m + 1.1676998740e-1f;
+    p = p * m - 1.2420140846e-1f;
+    p = p * m + 1.4249322787e-1f;
+    p = p * m - 1.6668057665e-1f;
+    p = p * m + 2.0000714765e-1f;
+    p = p * m - 2.4999993993e-1f;
+    p = p * m + 3.3333331174e-1f;
+    y = p * m * z;
+
+    y = y + e * AIMATH_F32_POLY_LN2_LO;
+    y = y - 0.5f * z;
+    return m + y + e * AIMATH_F32_POLY_LN2_HI;
+}
+
+void aimath_f32_default_sigmoid_poly(const aitensor_t *x, aitensor_t *result)
+{
+    uint32_t i;
+    uint32_t element_count = aimath_tensor_elements(x);
+    const float *x_data = (const float *) x->data;
+    float *result_data = (float *) result->data;
+
+    for(i = 0; i < element_count; i++){
+        result_data[i] = 1.0f / (1.0f + aimath_f32_default_expf_poly(-x_data[i]));
+    }
+    return;
+}
+
+void aimath_f32_default_sigmoid_poly_fast(const aitensor_t *x, aitensor_t *result)
+{
+    uint32_t i;
+    uint32_t element_count = aimath_tensor_elements(x);
+    const float *x_data = (const float *) x->data;
+    float *result_data = (float *) result->data;
+
+    for(i = 0; i < element_count; i++){
+        result_data[i] = 1.0f / (1.0f + aimath_f32_default_expf_poly_fast(-x_data[i]));
+    }
+    return;
+}
+
+void aimath_f32_default_tanh_poly(const aitensor_t *x, aitensor_t *result)
+{
+    uint32_t i;
+    uint32_t element_count = aimath_tensor_elements(x);
+    const float *x_data = (const float *) x->data;
+    float *result_data = (float *) result->data;
+    float x_abs, z, p, large;
+
+    for(i = 0; i < element_count; i++){
+        x_abs = fabsf(x_data[i]);
+        x_abs = x_abs > 9.0f ? 9.0f : x_abs; // tanh(9) rounds to 1.0f
+
+        // |x| >= 0.625: tanh(|x|) = 1 - 2 / (exp(2|x|) + 1)
+        large = 1.0f - 2.0f / (aimath_f32_default_expf_poly(2.0f * x_abs) + 1.0f);
+
+        // |x| < 0.625: Odd polynomial of degree 11 (Cephes tanhf), avoids the cancellation of the formula above
+        z = x_abs * x_abs;
+        p = -5.70498872745e-3f;
+        p = p * z + 2.06390887954e-2f;
+        p = p * z - 5.37397155531e-2f;
+        p = p * z + 1.33314422036e-1f;
+        p = p * z - 3.33332819422e-1f;
+        p = p * z * x_abs + x_abs;
+
+        result_data[i] = copysignf(x_abs < 0.625f ? p : large, x_data[i]);
+    }
+    return;
+}
+
+void aimath_f32_default_tanh_poly_fast(const aitensor_t *x, aitensor_t *result)
+{
+    uint32_t i;
+    uint32_t element_count = aimath_tensor_elements(x);
+    const float *x_data = (const float *) x->data;
+    float *result_data = (float *) result->data;
+    float x_abs;
+
+    for(i = 0; i < element_count; i++){
+        x_abs = fabsf(x_data[i]);
+        x_abs = x_abs > 9.0f ? 9.0f : x_abs;
+        result_data[i] = copysignf(1.0f - 2.0f / (aimath_f32_default_expf_poly_fast(2.0f * x_abs) + 1.0f), x_data[i]);
+    }
+    return;
+}
+
+void aimath_f32_default_elu_poly(const aitensor_t *x, const void *alpha, aitensor_t *result)
+{
+    uint32_t i;
+    uint32_t element_count = aimath_tensor_elements(x);
+    const float *x_data = (const float *) x->data;
+    float *result_data = (float *) result->data;
+    float alpha_f32 = *((float *) alpha);
+    float negative;
+
+    for(i = 0; i < element_count; i++){
+        negative = alpha_f32 * (aimath_f32_default_expf_poly(x_data[i] < 0.0f ? x_data[i] : 0.0f) - 1.0f);
+        result_data[i] = x_data[i] > 0.0f ? x_data[i] : negative;
+    }
+    return;
+}
+
+void aimath_f32_default_elu_poly_fast(const aitensor_t *x, const void *alpha, aitensor_t *result)
+{
+    uint32_t i;
+    uint32_t element_count = aimath_tensor_elements(x);
+    const float *x_data = (const float *) x->data;
+    float *result_data = (float *) result->data;
+    float alpha_f32 = *((float *) alpha);
+    float negative;
+
+    for(i = 0; i < element_count; i++){
+        negative = alpha_f32 * (aimath_f32_default_expf_poly_fast(x_data[i] < 0.0f ? x_data[i] : 0.0f) - 1.0f);
+        result_data[i] = x_data[i] > 0.0f ? x_data[i] : negative;
+    }
+    return;
+}
+
+void aimath_f32_default_d_elu_poly(const aitensor_t *x, const void *alpha, aitensor_t *result)
+{
+    uint32_t i;
+    uint32_t element_count = aimath_tensor_elements(x);
+    const float *x_data = (const float *) x->data;
+    float *result_data = (float *) result->data;
+    float alpha_f32 = *((float *) alpha);
+    float negative;
+
+    for(i = 0; i < element_count; i++){
+        negative = alpha_f32 * aimath_f32_default_expf_poly(x_data[i] < 0.0f ? x_data[i] : 0.0f);
+        result_data[i] = x_data[i] > 0.0f ? 1.0f : negative;
+    }
+    return;
+}
+
+void aimath_f32_default_d_elu_poly_fast(const aitensor_t *x, const void *alpha, aitensor_t *result)
+{
+    uint32_t i;
+    uint32_t element_count = aimath_tensor_elements(x);
+    const float *x_data = (const float *) x->data;
+    float *result_data = (float *) result->data;
+    float alpha_f32 = *((float *) alpha);
+    float negative;
+
+    for(i = 0; i < element_count; i++){
+        negative = alpha_f32 * aimath_f32_default_expf_poly_fast(x_data[i] < 0.0f ? x_data[i] : 0.0f);
+        result_data[i] = x_data[i] > 0.0f ? 1.0f : negative;
+    }
+    return;
+}
+
+void aimath_f32_default_softmax_poly(const aitensor_t *x, aitensor_t *result)
+{
+    uint32_t i, j;
+    uint32_t row_length = aimath_tensor_elements(x) / x->shape[0];
+    const float *x_data = (const float *) x->data;
+    float *result_data = (float *) result->data;
+    float max, exp_sum, exp_sum_inv;
+
+    for(i = 0; i < x->shape[0]; i++){
+        max = x_data[0];
+        for(j = 1; j < row_length; j++){
+            max = x_data[j] > max ? x_data[j] : max;
+        }
+        exp_sum = 0.0f;
+        for(j = 0; j < row_length; j++){
+            result_data[j] = aimath_f32_default_expf_poly(x_data[j] - max);
+            exp_sum += result_data[j];
+        }
+        exp_sum_inv = 1.0f / exp_sum;
+        for(j = 0; j < row_length; j++){
+            result_data[j] *= exp_sum_inv;
+        }
+        x_data += row_length;
+        result_data += row_length;
+    }
+    return;
+}
+
+void aimath_f32_default_softmax_poly_fast(const aitensor_t *x, aitensor_t *result)
+{
+    uint32_t i, j;
+    uint32_t row_length = aimath_tensor_elements(x) / x->shape[0];
+    const float *x_data = (const float *) x->data;
+    float *result_data = (float *) result->data;
+    float max, exp_sum, exp_sum_inv;
+
+    for(i = 0; i < x->shape[0]; i++){
+        max = x_data[0];
+        for(j = 1; j < row_length; j++){
+            max = x_data[j] > max ? x_data[j] : max;
+        }
+        exp_sum = 0.0f;
+        for(j = 0; j < row_length; j++){
+            result_data[j] = aimath_f32_default_expf_poly_fast(x_data[j] - max);
+            exp_sum += result_data[j];
+        }
+        exp_sum_inv = 1.0f / exp_sum;
+        for(j = 0; j < row_length; j++){
+            result_data[j] *= exp_sum_inv;
+        }
+        x_data += row_length;
+        result_data += row_length;
+    }
+    return;
+}
+
+void aimath_f32_default_binary_crossentropy_sum_poly(const aitensor_t *predicted_data, const aitensor_t *target_data, void *result)
+{
+    uint32_t i;
+    uint32_t element_count = aimath_tensor_elements(predicted_data);
+    const float *p = (const float *) predicted_data->data;
+    const float *t = (const float *) target_data->data;
+    float sum = 0.0f;
+
+    for(i = 0; i < element_count; i++){
+        sum -= t[i] * aimath_f32_default_logf_poly(p[i]) + (1.0f - t[i]) * aimath_f32_default_logf_poly(1.0f - p[i]);
+    }
+    *((float *) result) = sum;
+    return;
+}
+
+void aimath_f32_default_binary_crossentropy_mean_poly(const aitensor_t *predicted_data, const aitensor_t *target_data, void *result)
+{
+    aimath_f32_default_binary_crossentropy_sum_poly(predicted_data, target_data, result);
+    *((float *) result) /= predicted_data->shape[0];
+    return;
+}
+
+void aimath_f32_default_categorical_crossentropy_sum_poly(const aitensor_t *predicted_data, const aitensor_t *target_data, void *result)
+{
+    uint32_t i;
+    uint32_t element_count = aimath_tensor_elements(predicted_data);
+    const float *p = (const float *) predicted_data->data;
+    const float *t = (const float *) target_data->data;
+    float sum = 0.0f;
+
+    for(i = 0; i < element_count; i++){
+        // Zero targets contribute nothing (the clamped logarithm is finite, so no branch is needed)
+        sum -= t[i] * aimath_f32_default_logf_poly(p[i]);
+    }
+    *((float *) result) = sum;
+    return;
+}
+
+void aimath_f32_default_categorical_crossentropy_mean_poly(const aitensor_t *predicted_data, const aitensor_t *target_data, void *result)
+{
+    aimath_f32_default_categorical_crossentropy_sum_poly(predicted_data, target_data, result);
+    *((float *) result) /= predicted_data->shape[0];
+    return;
+}
+
+void aimath_f32_default_categorical_crossentropy_sum_sparse8_poly(const aitensor_t *predicted_data, const aitensor_t *target_data, void *result)
+{
+    uint32_t i, index;
+    float sum = 0.0f;
+
+    for(i = 0; i < target_data->shape[0]; i++){
+        index = i * predicted_data->shape[1] + ((uint8_t *) target_data->data)[i];
+        sum -= aimath_f32_default_logf_poly(((float *) predicted_data->data)[index]);
+    }
+    *((float *) result) = sum;
+    return;
+}
+
+void aimath_f32_default_categorical_crossentropy_mean_sparse8_poly(const aitensor_t *predicted_data, const aitensor_t *target_data, void *result)
+{
+    aimath_f32_default_categorical_crossentropy_sum_sparse8_poly(predicted_data, target_data, result);
+    *((float *) result) /= predicted_data->shape[0];
+    return;
+}
+
 void aimath_f32_default_sum_channelwise(const aitensor_t *x, int8_t channel_axis, aitensor_t *result){
     uint32_t i, j, k;
     uint32_t idx_multiplier1 = 1, idx_multiplier2 = 1;
@@ -30,6 +30,8 @@
 #include <stdlib.h>
 
 #include "basic/base/aimath/aimath_f32.h"
+#include "basic/base/aimath/aimath_palette.h"
+#include "basic/base/aimath/aimath_sparse.h"
 
 /** @brief Performs a matrix multiplication of \link aimath_f32.h F32 \endlink matrices a and b and adds a vector c to each row
  *
@@ -132,6 +134,21 @@
  */
 void aimath_f32_default_linear(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result);
 
+/** @brief Performs a matrix multiplication of \link aimath_f32.h F32 \endlink matrices a and b and adds a vector c to each row (row streaming variant)
+ *
+ * Same operation and tensor layout as aimath_f32_default_linear(), but with a different loop order:
+ * Every result row is accumulated as a sum of scaled rows of b (\f$ r_i = c + \sum_k a_{ik} \cdot b_k \f$).
+ * Matrix b is read contiguously row by row instead of column-wise with a stride of M,
+ * which is usually faster for wide matrices (large M) on targets with a data cache.
+ * Which of both variants is faster for a given shape can be determined with aialgo_tune_kernels_model().
+ *
+ * @param *a        F32 matrix a (2D tensor of shape [N x K])
+ * @param *b        F32 matrix b (2D tensor of shape [K x M])
+ * @param *c        F32 vector c (2D tensor of shape [1 x M] or 1D tensor of shape [M])
+ * @param *result   Resulting F32 matrix (2D tensor of shape [N x M])
+ */
+void aimath_f32_default_linear_rowwise(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result);
+
 /** @brief Performs a matrix multiplication of \link aimath_f32.h F32 \endlink matrices a (transposed) and b and adds a vector c to each row
  *
  * Same operation as aimath_f32_default_linear() but with a transposed a matrix.
@@ -233,6 +250,92 @@ void aimath_f32_default_linear_at(const aitensor_t *a, const aitensor_t *b, cons
  */
 void aimath_f32_default_linear_bt(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result);
 
+/** @brief Performs a matrix multiplication of an \link aimath_f32.h F32 \endlink matrix a and a \link aimath_palette.h palettized \endlink matrix b (transposed) and adds a vector c to each row
+ *
+ * Same operation as aimath_f32_default_linear_bt(), but the elements of b are indices into the F32 codebook of b
+ * (see aimath_palette_params_t). Instead of multiplying every element, the inputs are first accumulated per centroid
+ * and the partial sums are multiplied with the codebook once:
+ * @f[
+ *  result_{ij} = c_j + \sum_{k} a_{ik} \cdot cb_{b_{jk}} = c_j + \sum_{p} cb_p \cdot \sum_{k: b_{jk} = p} a_{ik}
+ * @f]
+ * This replaces K multiplications per result element by K additions and P multiplications (P = number of centroids).
+ * The weights need 4 or 8 bit per element instead of 32 bit.
+ *
+ * Example:
+ * \code{.c}
+ * uint16_t a_shape[2] = {1, 3};
+ * float a_data[1*3] = {1.0f, 2.0f, 3.0f};
+ * aitensor_t a = AITENSOR_2D_F32(a_shape, a_data);
+ *
+ * float codebook[16] = {-1.0f, 0.0f, 0.5f, 1.0f};
+ * aimath_palette_params_t palette = {4, 4, codebook};
+ * uint16_t b_shape[2] = {2, 3};
+ * uint8_t b_data[2*2] = {0x23, 0x01,  // Row 0: indices 3, 2, 1 -> 1.0, 0.5, 0.0
+ *                        0x00, 0x03}; // Row 1: indices 0, 0, 3 -> -1.0, -1.0, 1.0
+ * aitensor_t b = {aiu8, 2, b_shape, &palette, b_data};
+ *
+ * uint16_t c_shape[2] = {1, 2};
+ * float c_data[1*2] = {2.0f, 5.0f};
+ * aitensor_t c = AITENSOR_2D_F32(c_shape, c_data);
+ *
+ * uint16_t result_shape[2] = {1, 2};
+ * float result_data[1*2];
+ * aitensor_t result = AITENSOR_2D_F32(result_shape, result_data);
+ *
+ * aimath_f32_default_linear_palettized_bt(&a, &b, &c, &result); // result = [4.0, 5.0]
+ *
+ * print_aitensor(&result);
+ * \endcode
+ *
+ * @param *a        F32 matrix a (2D tensor of shape [N x K])
+ * @param *b        Palettized U8 index matrix b (2D tensor of shape [M x K] with aimath_palette_params_t as tensor parameters)
+ * @param *c        F32 vector c (2D tensor of shape [1 x M] or 1D tensor of shape [M])
+ * @param *result   Resulting F32 matrix (2D tensor of shape [N x M])
+ */
+void aimath_f32_default_linear_palettized_bt(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result);
+
+/** @brief Performs a matrix multiplication of an \link aimath_f32.h F32 \endlink matrix a and a \link aimath_sparse.h sparse \endlink F32 matrix b (transposed) and adds a vector c to each row
+ *
+ * Same operation as aimath_f32_default_linear_bt(), but only the stored entries of b (see aimath_sparse_params_t) are multiplied:
+ * @f[
+ *  result_{ij} = c_j + \sum_{k: b_{jk} \neq 0} a_{ik} \cdot b_{jk}
+ * @f]
+ * The number of multiply-accumulate operations and the weights memory are proportional to the number of stored entries.
+ * All formats of aimath_sparse.h (CSR, 1x4 and 4x1 blocks) are supported.
+ *
+ * Example:
+ * \code{.c}
+ * uint16_t a_shape[2] = {1, 4};
+ * float a_data[1*4] = {1.0f, 2.0f, 3.0f, 4.0f};
+ * aitensor_t a = AITENSOR_2D_F32(a_shape, a_data);
+ *
+ * uint32_t row_ptr[3] = {0, 2, 3};
+ * uint16_t col_idx[3] = {0, 3, 1};
+ * aimath_sparse_params_t sparse_params = {AIMATH_SPARSE_CSR, 3, row_ptr, col_idx, 0};
+ * uint16_t b_shape[2] = {2, 4};
+ * float b_values[3] = {1.0f, 2.0f, 3.0f}; // Row 0: [1, 0, 0, 2], Row 1: [0, 3, 0, 0]
+ * aitensor_t b = {aif32, 2, b_shape, &sparse_params, b_values};
+ *
+ * uint16_t c_shape[2] = {1, 2};
+ * float c_data[1*2] = {2.0f, 5.0f};
+ * aitensor_t c = AITENSOR_2D_F32(c_shape, c_data);
+ *
+ * uint16_t result_shape[2] = {1, 2};
+ * float result_data[1*2];
+ * aitensor_t result = AITENSOR_2D_F32(result_shape, result_data);
+ *
+ * aimath_f32_default_linear_sparse_bt(&a, &b, &c, &result); // result = [11.0, 11.0]
+ *
+ * print_aitensor(&result);
+ * \endcode
+ *
+ * @param *a        F32 matrix a (2D tensor of shape [N x K])
+ * @param *b        Sparse F32 matrix b (2D tensor of shape [M x K] with aimath_sparse_params_t as tensor parameters)
+ * @param *c        F32 vector c (2D tensor of shape [1 x M] or 1D tensor of shape [M])
+ * @param *result   Resulting F32 matrix (2D tensor of shape [N x M])
+ */
+void aimath_f32_default_linear_sparse_bt(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result);
+
 /** @brief Performs a matrix multiplication with transposed result of \link aimath_f32.h F32 \endlink matrices a (transposed) and b and adds a vector c to each row
  *
  * Same operation as aimath_f32_default_linear() but with a transposed a matrix and transposed result.
@@ -1691,6 +1794,234 @@ void aimath_f32_default_init_he_uniform_cdim(aitensor_t *tensor, int8_t cout_axi
   */
 float aimath_f32_default_expf_fast(const float x);
 
+/** @brief Polynomial approximation of the exponential function (accurate)
+  *
+  * Branch-free implementation with Cody-Waite range reduction (\f$ x = n \cdot ln(2) + r \f$, \f$ |r| \leq ln(2)/2 \f$)
+  * and a minimax polynomial of degree 7 for \f$ e^r \f$. The scaling with \f$ 2^n \f$ is done with integer operations on the exponent bits.
+  * Because the function has no branches and no library calls, loops over this function can be vectorized by the compiler.\n
+  * (GCC needs the option -fno-trapping-math to vectorize the selects of the clamping and of the tensor functions.)
+  *
+  * Maximum error: 1 ULP (compared to the exact result).\n
+  * The input is clamped to [-87.3, 88.3] (the result stays a normal number).
+  *
+  * @param x Input of the exponential function
+  * @return  \f$ e^x \f$
+  */
+float aimath_f32_default_expf_poly(float x);
+
+/** @brief Polynomial approximation of the exponential function (fast)
+  *
+  * Same as aimath_f32_default_expf_poly() but with a polynomial of degree 3.
+  *
+  * Maximum relative error: \f$ 8 \cdot 10^{-5} \f$ (compared to \f$ 4 \cdot 10^{-2} \f$ of aimath_f32_default_expf_fast()).\n
+  * The input is clamped to [-87.3, 88.3].
+  *
+  * @param x Input of the exponential function
+  * @return  \f$ e^x \f$
+  */
+float aimath_f32_default_expf_poly_fast(float x);
+
+/** @brief Polynomial approximation of the natural logarithm
+  *
+  * Branch-free implementation that splits x into exponent and mantissa \f$ m \in [\sqrt{0.5}, \sqrt{2}) \f$
+  * and approximates \f$ ln(m) \f$ with a polynomial of degree 9.
+  *
+  * Maximum error: 1 ULP for normal positive numbers.\n
+  * Non-positive and subnormal inputs are clamped to the smallest normal number, so the result is -87.34 instead of
+  * \f$ -\infty \f$ or NaN (this keeps a crossentropy loss finite).
+  *
+  * @param x Input of the logarithm
+  * @return  \f$ ln(x) \f$
+  */
+float aimath_f32_default_logf_poly(float x);
+
+/** @brief Calculates the sigmoid of each element in a \link aimath_f32.h F32 \endlink tensor with a polynomial approximation (accurate)
+  *
+  * Same as aimath_f32_default_sigmoid() but with aimath_f32_default_expf_poly() instead of expf(). The loop can be vectorized by the compiler.
+  *
+  * Maximum error: 3 ULP
+  *
+  * @param *x       F32 tensor to calculate the sigmoid from (N-D tensor)
+  * @param *result  Resulting F32 tensor (N-D tensor)
+  */
+void aimath_f32_default_sigmoid_poly(const aitensor_t *x, aitensor_t *result);
+
+/** @brief Calculates the sigmoid of each element in a \link aimath_f32.h F32 \endlink tensor with a polynomial approximation (fast)
+  *
+  * Same as aimath_f32_default_sigmoid() but with aimath_f32_default_expf_poly_fast() instead of expf().
+  *
+  * Maximum relative error: \f$ 7.6 \cdot 10^{-5} \f$
+  *
+  * @param *x       F32 tensor to calculate the sigmoid from (N-D tensor)
+  * @param *result  Resulting F32 tensor (N-D tensor)
+  */
+void aimath_f32_default_sigmoid_poly_fast(const aitensor_t *x, aitensor_t *result);
+
+/** @brief Calculates the tanh of each element in a \link aimath_f32.h F32 \endlink tensor with a polynomial approximation (accurate)
+  *
+  * For \f$ |x| < 0.625 \f$ an odd polynomial of degree 11 is used, otherwise \f$ tanh(|x|) = 1 - \frac{2}{e^{2|x|} + 1} \f$
+  * with aimath_f32_default_expf_poly(). Both branches are evaluated and selected without jumps, so the loop can be vectorized by the compiler.
+  *
+  * Maximum error: 2 ULP
+  *
+  * @param *x       F32 tensor to calculate the tanh from (N-D tensor)
+  * @param *result  Resulting F32 tensor (N-D tensor)
+  */
+void aimath_f32_default_tanh_poly(const aitensor_t *x, aitensor_t *result);
+
+/** @brief Calculates the tanh of each element in a \link aimath_f32.h F32 \endlink tensor with a polynomial approximation (fast)
+  *
+  * Calculates \f$ tanh(|x|) = 1 - \frac{2}{e^{2|x|} + 1} \f$ with aimath_f32_default_expf_poly_fast() for all x.
+  *
+  * Maximum absolute error: \f$ 4 \cdot 10^{-5} \f$
+  *
+  * @param *x       F32 tensor to calculate the tanh from (N-D tensor)
+  * @param *result  Resulting F32 tensor (N-D tensor)
+  */
+void aimath_f32_default_tanh_poly_fast(const aitensor_t *x, aitensor_t *result);
+
+/** @brief Calculates the exponential rectifier (ELU) of each element in a \link aimath_f32.h F32 \endlink tensor with a polynomial approximation (accurate)
+  *
+  * Same as aimath_f32_default_elu() but with aimath_f32_default_expf_poly(). The loop can be vectorized by the compiler.
+  *
+  * Maximum absolute error (for \f$ \alpha = 1 \f$): \f$ 6 \cdot 10^{-8} \f$
+  *
+  * @param *x       F32 tensor to calculate the ELU from (N-D tensor)
+  * @param *alpha   Scalar \f$ \alpha \f$ (type aimath_f32_t / float)
+  * @param *result  Resulting F32 tensor (N-D tensor)
+  */
+void aimath_f32_default_elu_poly(const aitensor_t *x, const void *alpha, aitensor_t *result);
+
+/** @brief Calculates the exponential rectifier (ELU) of each element in a \link aimath_f32.h F32 \endlink tensor with a polynomial approximation (fast)
+  *
+  * Same as aimath_f32_default_elu() but with aimath_f32_default_expf_poly_fast().
+  *
+  * Maximum absolute error (for \f$ \alpha = 1 \f$): \f$ 7.5 \cdot 10^{-5} \f$
+  *
+  * @param *x       F32 tensor to calculate the ELU from (N-D tensor)
+  * @param *alpha   Scalar \f$ \alpha \f$ (type aimath_f32_t / float)
+  * @param *result  Resulting F32 tensor (N-D tensor)
+  */
+void aimath_f32_default_elu_poly_fast(const aitensor_t *x, const void *alpha, aitensor_t *result);
+
+/** @brief Calculates the ELU derivative of each element in a \link aimath_f32.h F32 \endlink tensor with a polynomial approximation (accurate)
+  *
+  * Same as aimath_f32_default_d_elu() but with aimath_f32_default_expf_poly().
+  *
+  * @param *x       F32 tensor to calculate the ELU derivative from (N-D tensor)
+  * @param *alpha   Scalar \f$ \alpha \f$ (type aimath_f32_t / float)
+  * @param *result  Resulting F32 tensor (N-D tensor)
+  */
+void aimath_f32_default_d_elu_poly(const aitensor_t *x, const void *alpha, aitensor_t *result);
+
+/** @brief Calculates the ELU derivative of each element in a \link aimath_f32.h F32 \endlink tensor with a polynomial approximation (fast)
+  *
+  * Same as aimath_f32_default_d_elu() but with aimath_f32_default_expf_poly_fast().
+  *
+  * @param *x       F32 tensor to calculate the ELU derivative from (N-D tensor)
+  * @param *alpha   Scalar \f$ \alpha \f$ (type aimath_f32_t / float)
+  * @param *result  Resulting F32 tensor (N-D tensor)
+  */
+void aimath_f32_default_d_elu_poly_fast(const aitensor_t *x, const void *alpha, aitensor_t *result);
+
+/** @brief Calculates the softmax value of each row of a \link aimath_f32.h F32 \endlink matrix with a polynomial approximation (accurate)
+  *
+  * Same as aimath_f32_default_softmax() but with aimath_f32_default_expf_poly() instead of aimath_f32_default_expf_fast().
+  *
+  * The error grows with the row length \f$ L \f$, because the exponentials are summed up one after the other in F32
+  * (worst case bound: about \f$ L + 2 \f$ ULP). Measured maximum error against the exact softmax of the F32
+  * differences \f$ x_j - max \f$ (random logits):
+  * - \f$ L = 2 \f$: 2.5 ULP
+  * - \f$ L = 10 \f$: 4.9 ULP
+  * - \f$ L = 100 \f$: 11 ULP
+  * - \f$ L = 1000 \f$: 26 ULP
+  *
+  * The rounding of the differences \f$ x_j - max \f$ adds a relative error of up to \f$ |x_j - max| \cdot 2^{-24} \f$
+  * (as in aimath_f32_default_softmax()).
+  *
+  * @param *x       F32 matrix to calculate the softmax from (2D tensor)
+  * @param *result  Resulting F32 matrix (2D tensor)
+  */
+void aimath_f32_default_softmax_poly(const aitensor_t *x, aitensor_t *result);
+
+/** @brief Calculates the softmax value of each row of a \link aimath_f32.h F32 \endlink matrix with a polynomial approximation (fast)
+  *
+  * Same as aimath_f32_default_softmax() but with aimath_f32_default_expf_poly_fast() instead of aimath_f32_default_expf_fast().
+  *
+  * Maximum relative error: \f$ 1.5 \cdot 10^{-4} \f$
+  *
+  * @param *x       F32 matrix to calculate the softmax from (2D tensor)
+  * @param *result  Resulting F32 matrix (2D tensor)
+  */
+void aimath_f32_default_softmax_poly_fast(const aitensor_t *x, aitensor_t *result);
+
+/** @brief Calculates the binary cross entropy between the \link aimath_f32.h F32 \endlink predicted and the target data using a sum reduction
+  *        with a polynomial approximation of the logarithm
+  *
+  * Same as aimath_f32_default_binary_crossentropy_sum() but with aimath_f32_default_logf_poly() instead of logf().
+  * Predictions of 0 or 1 lead to a large but finite loss.
+  *
+  * @param *predicted_data  F32 matrix with the predicted or calculated values (2D tensor)
+  * @param *target_data     F32 matrix with the target data / true values / labels (2D tensor)
+  * @param *result          Resulting F32 matrix (2D tensor)
+  */
+void aimath_f32_default_binary_crossentropy_sum_poly(const aitensor_t *predicted_data, const aitensor_t *target_data, void *result);
+
+/** @brief Calculates the binary cross entropy between the \link aimath_f32.h F32 \endlink predicted and the target data using a mean reduction
+  *        with a polynomial approximation of the logarithm
+  *
+  * Same as aimath_f32_default_binary_crossentropy_mean() but with aimath_f32_default_logf_poly() instead of logf().
+  *
+  * @param *predicted_data  F32 matrix with the predicted or calculated values (2D tensor)
+  * @param *target_data     F32 matrix with the target data / true values / labels (2D tensor)
+  * @param *result          Resulting F32 matrix (2D tensor)
+  */
+void aimath_f32_default_binary_crossentropy_mean_poly(const aitensor_t *predicted_data, const aitensor_t *target_data, void *result);
+
+/** @brief Calculates the categorical cross entropy between the \link aimath_f32.h F32 \endlink predicted and the target data using a sum reduction
+  *        with a polynomial approximation of the logarithm
+  *
+  * Same as aimath_f32_default_categorical_crossentropy_sum() but with aimath_f32_default_logf_poly() instead of logf().
+  *
+  * @param *predicted_data  F32 matrix with the predicted or calculated values (2D tensor)
+  * @param *target_data     F32 matrix with the target data / true values / labels (2D tensor)
+  * @param *result          Resulting F32 matrix (2D tensor)
+  */
+void aimath_f32_default_categorical_crossentropy_sum_poly(const aitensor_t *predicted_data, const aitensor_t *target_data, void *result);
+
+/** @brief Calculates the categorical cross entropy between the \link aimath_f32.h F32 \endlink predicted and the target data using a mean reduction
+  *        with a polynomial approximation of the logarithm
+  *
+  * Same as aimath_f32_default_categorical_crossentropy_mean() but with aimath_f32_default_logf_poly() instead of logf().
+  *
+  * @param *predicted_data  F32 matrix with the predicted or calculated values (2D tensor)
+  * @param *target_data     F32 matrix with the target data / true values / labels (2D tensor)
+  * @param *result          Resulting F32 matrix (2D tensor)
+  */
+void aimath_f32_default_categorical_crossentropy_mean_poly(const aitensor_t *predicted_data, const aitensor_t *target_data, void *result);
+
+/** @brief Calculates the categorical Cross-Entropy between the \link aimath_f32.h F32 \endlink predicted data and the \link aimath_u8.h U8 \endlink target data in sparse representation
+  *        using a sum reduction with a polynomial approximation of the logarithm
+  *
+  * Same as aimath_f32_default_categorical_crossentropy_sum_sparse8() but with aimath_f32_default_logf_poly() instead of logf().
+  *
+  * @param *predicted_data  F32 matrix with the predicted or calculated values (2D tensor of shape [N x M])
+  * @param *target_data     U8 matrix with the target data / true values / labels (2D tensor of shape [N x 1] with true class indices)
+  * @param *result          Resulting F32 matrix (2D tensor of shape [N x M])
+  */
+void aimath_f32_default_categorical_crossentropy_sum_sparse8_poly(const aitensor_t *predicted_data, const aitensor_t *target_data, void *result);
+
+/** @brief Calculates the categorical Cross-Entropy between the \link aimath_f32.h F32 \endlink predicted data and the \link aimath_u8.h U8 \endlink target data in sparse representation
+  *        using a mean reduction with a polynomial approximation of the logarithm
+  *
+  * Same as aimath_f32_default_categorical_crossentropy_mean_sparse8() but with aimath_f32_default_logf_poly() instead of logf().
+  *
+  * @param *predicted_data  F32 matrix with the predicted or calculated values (2D tensor of shape [N x M])
+  * @param *target_data     U8 matrix with the target data / true values / labels (2D tensor of shape [N x 1] with true class indices)
+  * @param *result          Resulting F32 matrix (2D tensor of shape [N x M])
+  */
+void aimath_f32_default_categorical_crossentropy_mean_sparse8_poly(const aitensor_t *predicted_data, const aitensor_t *target_data, void *result);
+
 /** @brief Sums up all values of a channel of the \link aimath_f32.h F32 \endlink tensor x
  *
  * Calculates the sum of all elements of each channel c. The result tensor is 1D:
@@ -846,88 +846,85 @@ void aimath_q31_default_d_softsign(const aitensor_t *x, aitensor_t *result)
 	return;
 }
 
+// 2^(-k/64) in Q30 for k = 0 ... 64 (65th entry as end point for the interpolation)
+static const uint32_t aimath_q31_default_exp2_neg_lut[65] = {
+    1073741824, 1062175491, 1050733751, 1039415261, 1028218693, 1017142735, 1006186087, 995347464,
+    984625594, 974019220, 963527098, 953147997, 942880699, 932724001, 922676710, 912737649,
+    902905651, 893179563, 883558244, 874040567, 864625413, 855311680, 846098274, 836984114,
+    827968132, 819049271, 810226483, 801498734, 792865000, 784324269, 775875538, 767517817,
+    759250125, 751071493, 742980960, 734977579, 727060411, 719228525, 711481005, 703816941,
+    696235434, 688735596, 681316545, 673977412, 666717336, 659535466, 652430958, 645402981,
+    638450708, 631573326, 624770026, 618040012, 611382493, 604796689, 598281827, 591837143,
+    585461881, 579155293, 572916640, 566745190, 560640218, 554601009, 548626854, 542717053,
+    536870912
+};
+
+// exp(d * 2^-x_shift) for d <= 0 in Q30 (2^30 = 1.0): exp(r) = 2^(-t) with t = -r * log2(e) = n + f,
+// 2^(-f) from the interpolated lookup table, 2^(-n) by a right shift.
+static uint32_t aimath_q31_default_softmax_exp(int64_t d, uint16_t x_shift)
+{
+    uint64_t t;
+    uint32_t frac, n;
+    uint64_t lo, hi;
+
+    if(x_shift + 14 >= 64) return 1073741824;
+    // -d < 2^32 and log2(e) in Q30 (1549082005) < 2^31, so the product fits into 64 bit; t in Q16
+    t = ((uint64_t) (-d) * 1549082005ULL) >> (x_shift + 14);
+    n = (uint32_t) (t >> 16);
+    if(t > ((uint64_t) 30 << 16)) return 0;
+
+    frac = (uint32_t) t & 0xFFFF;
+    lo = aimath_q31_default_exp2_neg_lut[frac >> 10];
+    hi = aimath_q31_default_exp2_neg_lut[(frac >> 10) + 1];
+    return (uint32_t) ((lo - (((lo - hi) * (frac & 0x3FF)) >> 10)) >> n);
+}
+
 void aimath_q31_default_softmax(const aitensor_t *x, aitensor_t *result) {
     uint32_t i, j;
-    // Borders for linear piecewise approximation of exponential function {-1.0, -2.0, -3.0, -5.0}
-	int64_t borders[4] = {-268435456, -536870912, -805306368, -1342177280};
-	uint16_t border_shift = 28;
 	int32_t max;
+	int32_t *x_row;
+	int32_t *result_row;
 
 	uint16_t x_shift = ((aimath_q31_params_t *) x->tensor_params)->shift;
-	int32_t x_zero_point = ((aimath_q31_params_t *) x->tensor_params)->zero_point;
 
+	uint64_t acc;
+	uint64_t reciprocal;
 	int64_t res;
-	int64_t acc = 0;
-	int32_t e_x[aimath_tensor_elements(x)];
-	int64_t x_data_point;
 
 	// Multiplier for array index calculation
- 	uint16_t multiplier = 1;
+ 	uint32_t multiplier = 1;
  	for(i = x->dim - 1; i >= 1; i--){
         multiplier *= x->shape[i];
  	}
 
- 	if(x_shift > border_shift){
-		borders[0] <<= (x_shift - border_shift);
-		borders[1] <<= (x_shift - border_shift);
-		borders[2] <<= (x_shift - border_shift);
-		borders[3] <<= (x_shift - border_shift);
-	}
-	else{
-        borders[0] >>= (border_shift - x_shift);
-		borders[1] >>= (border_shift - x_shift);
-		borders[2] >>= (border_shift - x_shift);
-		borders[3] >>= (border_shift - x_shift);
-	}
-
     for(i = 0; i < x->shape[0]; i++){
+        x_row = (int32_t *) x->data + i * multiplier;
+        result_row = (int32_t *) result->data + i * multiplier;
+
         // calc max value for numeric stability
-        max = ((int32_t *) x->data)[i * multiplier];
+        max = x_row[0];
         for (j = 1; j < multiplier; j++) {
-            if (((int32_t *) x->data)[i * multiplier + j] > max) {
-                max = ((int32_t *) x->data)[i * multiplier + j];
+            if (x_row[j] > max) {
+                max = x_row[j];
             }
         }
 
-        // Subtract maximum value
-        x_zero_point = max;
-
-        // calc exp functions
+        // Sum of the exponentials in Q30 (the maximum contributes 1.0, so acc >= 2^30)
         acc = 0;
         for(j = 0; j < multiplier; j++)
         {
-            x_data_point = (int64_t) ((int32_t *) x->data)[i * multiplier + j] - (int64_t) x_zero_point;
-
-            if (x_data_point > borders[0]) {
-                // LPA between 0 and -1
-                res = ((2705829376LL * x_data_point) >> x_shift) + 2147483647;
-            }
-            else if (x_data_point > borders[1]) {
-                // LPA between -1 and -2
-                res = ((987842496 * x_data_point) >> x_shift) + 429496832;
-            }
-            else if (x_data_point > borders[2]) {
-                // LPA between -2 and -3
-                res = ((386547072 * x_data_point) >> x_shift) - 773094144;
-            }
-            else if (x_data_point > borders[3]) {
-                // LPA between -3 and -5
-                res = ((107374184 * x_data_point) >> x_shift) - 1610612736;
-            }
-            else {
-                // LPA smaller than -5
-                res = -2147483647;
-            }
-
-            acc += (res + 2147483647);
-            e_x[i * multiplier + j] = (int32_t) res;
+            acc += aimath_q31_default_softmax_exp((int64_t) x_row[j] - (int64_t) max, x_shift);
         }
 
-        //calc softmax
+        // Fixed-point reciprocal 2^62 / acc (fits into 32 bit), one division per row
+        reciprocal = (((uint64_t) 1 << 62) / acc);
+
+        // result = e * 2^32 / acc - (2^31 - 1), rounded
         for(j = 0; j < multiplier; j++)
         {
-            res = (((uint64_t)(e_x[i * multiplier + j] + 2147483647) << 32) / acc) - 2147483647;
-            ((int32_t *) result->data)[i * multiplier + j] = (int32_t) res;
+            res = (int64_t) (((uint64_t) aimath_q31_default_softmax_exp((int64_t) x_row[j] - (int64_t) max, x_shift) * reciprocal
+                              + ((uint64_t) 1 << 29)) >> 30) - 2147483647;
+            result_row[j] = (int32_t) (res > 2147483647 ? 2147483647 : res);
         }
  	}
 
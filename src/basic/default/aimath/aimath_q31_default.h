@@ -883,17 +883,12 @@ void aimath_q31_default_d_softsign(const aitensor_t *x, aitensor_t *result);
  *  result_{i} = \frac{e^{x_i}}{\sum_{j=1}^{K} e^{x_j}} = \frac{e^{x_i - x_{max}}}{\sum_{j=1}^{K} e^{x_j - x_{max}}}
  * @f]
  *
- * The exponential function within softmax is calculated with a piecewise linear approximation (PLA) in the interval [-inf, 0].
+ * The calculation is integer-only: After subtracting the row maximum, the exponential function is evaluated in fixed point
+ * as \f$ e^{r} = 2^{-(n + f)} \f$ with \f$ n + f = -r \cdot \log_2(e) \f$. \f$ 2^{-f} \f$ is linearly interpolated from a
+ * 65 entry lookup table and \f$ 2^{-n} \f$ is a right shift. The exponentials are summed up in a 64 bit integer and multiplied
+ * with a fixed-point reciprocal of the sum (one division per row).
  *
- * @f[
- *   result_{i} = e_{PLA}(x_i - x_{max}) = \begin{cases}
-               0.63 \cdot (x_i - x_{max}) + 1 & \text{if } -1 \leq (x_i - x_{max}) < 0\\
-               0.23 \cdot (x_i - x_{max}) + 0.6 & \text{if } -2 \leq (x_i - x_{max}) < -1\\
-               0.09 \cdot (x_i - x_{max}) + 0.32 & \text{if } -3 \leq (x_i - x_{max}) < -2\\
-               0.025 \cdot (x_i - x_{max}) + 0.125 & \text{if } -5 \leq (x_i - x_{max}) < -3\\
-               0 & \text{if } (x_i - x_{max}) < -5\\
-               \end{cases}
- * @f]
+ * The absolute error of the result is below \f$ 10^{-5} \f$ (compared to the exact softmax of the dequantized input).
  *
  * **The quantization parameters of the result tensor are set to {shift = 32, zero_point = -2147483648} by the function
  * because the output values are in the interval (0, 1).**
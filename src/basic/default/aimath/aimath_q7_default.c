@@ -25,6 +25,7 @@
 AISTRING_STORAGE_WRAPPER(aistring_error_q7_linear32_1, "[aimath_q7_default_linear32] MatMul input shapes doesn't match.\n");
 AISTRING_STORAGE_WRAPPER(aistring_error_q7_linear32_2, "[aimath_q7_default_linear32] MatMul output shape doesn't match.\n");
 AISTRING_STORAGE_WRAPPER(aistring_error_q7_linear32_3, "[aimath_q7_default_linear32] Third operand shift does not match.\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_q7_linear32_sparse_1, "[aimath_q7_default_linear32_sparse_bt] The zero point of the sparse values has to be 0.\n");
 
 void aimath_q7_default_linear32(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result)
 {
@@ -32,7 +33,7 @@ void aimath_q7_default_linear32(const aitensor_t *a, const aitensor_t *b, const
 	int32_t sum, acc; // 16-bit accumulator
 	uint16_t a_shift = ((aimath_q7_params_t *) a->tensor_params)->shift;
 	uint16_t b_shift = ((aimath_q7_params_t *) b->tensor_params)->shift;
-	uint16_t c_shift = ((aimath_q31_params_t *) c->tensor_params)->shift;
+	uint16_t c_shift = c != 0 ? ((aimath_q31_params_t *) c->tensor_params)->shift : a_shift + b_shift; // No bias in aimath_q7_default_mat_mul()
 	uint16_t result_shift = ((aimath_q7_params_t *) result->tensor_params)->shift;
 
 	int8_t z_a = ((aimath_q7_params_t *) a->tensor_params)->zero_point;
@@ -196,6 +197,217 @@ void aimath_q7_default_linear32_bt(const aitensor_t *a, const aitensor_t *b, con
 	return;
 }
 
+void aimath_q7_default_linear32_sparse_bt(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result)
+{
+	uint32_t i, j, e, p;
+	uint16_t k;
+	int32_t sum, acc;
+	int32_t x;
+	int32_t block_sums[4], block_accs[4];
+	const int8_t *values;
+
+	aimath_sparse_params_t *sparse = (aimath_sparse_params_t *) b->tensor_params;
+	aimath_q7_params_t *b_params = (aimath_q7_params_t *) sparse->values_params;
+	uint16_t inputs = a->shape[1];
+	uint16_t outputs = b->shape[0];
+
+	uint16_t a_shift = ((aimath_q7_params_t *) a->tensor_params)->shift;
+	uint16_t result_shift = ((aimath_q7_params_t *) result->tensor_params)->shift;
+	int8_t z_a = ((aimath_q7_params_t *) a->tensor_params)->zero_point;
+	int8_t z_result = ((aimath_q7_params_t *) result->tensor_params)->zero_point;
+
+	// Output scaling factor M = (S_1 * S_2) / S_3
+	uint16_t output_shift = a_shift + b_params->shift - result_shift;
+
+	int8_t *a_data = (int8_t *) a->data;
+	int8_t *b_data = (int8_t *) b->data;
+	int32_t *c_data = c != 0 ? (int32_t *) c->data : 0;
+	int8_t *result_data = (int8_t *) result->data;
+	int8_t *a_row;
+	int8_t *result_row;
+
+#ifdef AIDEBUG_SHAPE_CHECKS
+	if(a->shape[1] != b->shape[1])
+	{
+		AILOG_E(aistring_error_q7_linear32_1);
+		return;
+	}
+	if(a->shape[0] != result->shape[0] || b->shape[0] != result->shape[1])
+	{
+		AILOG_E(aistring_error_q7_linear32_2);
+		return;
+	}
+#endif
+#ifdef AIDEBUG_GENERAL_CHECKS
+	if(c != 0 && ((aimath_q31_params_t *) c->tensor_params)->shift != a_shift + b_params->shift)
+	{
+		AILOG_E(aistring_error_q7_linear32_3);
+		return;
+	}
+	if(b_params->zero_point != 0)
+	{
+		AILOG_E(aistring_error_q7_linear32_sparse_1);
+		return;
+	}
+#endif // AIDEBUG_GENERAL_CHECKS
+
+	// sum = sum_k (a_ik - z_a) * b_jk = sum_k a_ik * b_jk - z_a * sum_k b_jk (only the stored entries of b)
+	for(i = 0; i < a->shape[0]; i++)
+	{
+		a_row = a_data + i*inputs;
+		result_row = result_data + i*outputs;
+
+		if(sparse->format == AIMATH_SPARSE_BLOCK_1X4)
+		{
+			for(j = 0; j < outputs; j++)
+			{
+				sum = 0;
+				acc = 0;
+				for(e = sparse->row_ptr[j]; e < sparse->row_ptr[j + 1]; e++)
+				{
+					k = sparse->col_idx[e];
+					values = b_data + 4*e;
+					if(k + 4 <= inputs){
+						sum += (int32_t) values[0] * a_row[k] + (int32_t) values[1] * a_row[k + 1]
+                             + (int32_t) values[2] * a_row[k + 2] + (int32_t) values[3] * a_row[k + 3];
+					} else {
+						// Last block of a row that exceeds the matrix
+						for(p = 0; k + p < inputs; p++){
+							sum += (int32_t) values[p] * a_row[k + p];
+						}
+					}
+					acc += (int32_t) values[0] + values[1] + values[2] + values[3];
+				}
+				sum -= z_a * acc;
+				if(c != 0) sum += c_data[j];
+				result_row[j] = (int8_t)((sum >> output_shift) + (int16_t) z_result);
+			}
+		}
+		else if(sparse->format == AIMATH_SPARSE_BLOCK_4X1)
+		{
+			for(j = 0; 4*j < outputs; j++)
+			{
+				for(p = 0; p < 4; p++){
+					block_sums[p] = 0;
+					block_accs[p] = 0;
+				}
+				for(e = sparse->row_ptr[j]; e < sparse->row_ptr[j + 1]; e++)
+				{
+					x = a_row[sparse->col_idx[e]];
+					values = b_data + 4*e;
+					for(p = 0; p < 4; p++){
+						block_sums[p] += (int32_t) values[p] * x;
+						block_accs[p] += values[p];
+					}
+				}
+				for(p = 0; p < 4 && 4*j + p < outputs; p++){
+					sum = block_sums[p] - z_a * block_accs[p];
+					if(c != 0) sum += c_data[4*j + p];
+					result_row[4*j + p] = (int8_t)((sum >> output_shift) + (int16_t) z_result);
+				}
+			}
+		}
+		else
+		{
+			// CSR
+			for(j = 0; j < outputs; j++)
+			{
+				sum = 0;
+				acc = 0;
+				for(e = sparse->row_ptr[j]; e < sparse->row_ptr[j + 1]; e++)
+				{
+					sum += (int32_t) b_data[e] * a_row[sparse->col_idx[e]];
+					acc += b_data[e];
+				}
+				sum -= z_a * acc;
+				if(c != 0) sum += c_data[j];
+				result_row[j] = (int8_t)((sum >> output_shift) + (int16_t) z_result);
+			}
+		}
+	}
+	return;
+}
+
+static void aimath_q7_default_linear32_fused_input_internal(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result, uint8_t b_transposed)
+{
+	uint16_t i, j, k;
+	int32_t sum;
+	aimath_q7_source_params_t *source_params = (aimath_q7_source_params_t *) a->tensor_params;
+	uint16_t a_shift = source_params->q_params.shift;
+	uint16_t b_shift = ((aimath_q7_params_t *) b->tensor_params)->shift;
+	uint16_t c_shift = c != 0 ? ((aimath_q31_params_t *) c->tensor_params)->shift : a_shift + b_shift;
+	uint16_t result_shift = ((aimath_q7_params_t *) result->tensor_params)->shift;
+
+	int8_t z_a = source_params->q_params.zero_point;
+	int8_t z_b = ((aimath_q7_params_t *) b->tensor_params)->zero_point;
+	int8_t z_result = ((aimath_q7_params_t *) result->tensor_params)->zero_point;
+
+	// Output scaling factor M = (S_1 * S_2) / S_3
+	uint16_t output_shift = a_shift + b_shift - result_shift;
+
+	uint16_t K = a->shape[1];
+	uint16_t M = b_transposed ? b->shape[0] : b->shape[1];
+	// Strides of the weights in k and j direction
+	uint16_t b_stride_k = b_transposed ? 1 : M;
+	uint16_t b_stride_j = b_transposed ? K : 1;
+
+	int8_t *b_data = (int8_t *) b->data;
+	int32_t *c_data;
+	if(c != 0) c_data = (int32_t *) c->data;
+	int8_t *result_data = (int8_t *) result->data;
+
+#ifdef AIDEBUG_SHAPE_CHECKS
+	if(K != (b_transposed ? b->shape[1] : b->shape[0]))
+	{
+		AILOG_E(aistring_error_q7_linear32_1);
+		return;
+	}
+	if(a->shape[0] != result->shape[0] || M != result->shape[1])
+	{
+		AILOG_E(aistring_error_q7_linear32_2);
+		return;
+	}
+#endif
+#ifdef AIDEBUG_GENERAL_CHECKS
+	if(c_shift != a_shift + b_shift)
+	{
+		AILOG_E(aistring_error_q7_linear32_3);
+		return;
+	}
+#endif // AIDEBUG_GENERAL_CHECKS
+
+	for(i = 0; i < a->shape[0]; i++)
+	{
+		for(j = 0; j < M; j++)
+		{
+			sum = 0;
+			for(k = 0; k < K; k++)
+			{
+				// The raw input value is quantized right before it is used, no staging buffer is needed
+				sum += ((int32_t) aimath_q7_quantize_value_from_source(a->data, (uint32_t) i * K + k, source_params) - z_a)
+				       * ((int32_t) b_data[k*b_stride_k + j*b_stride_j] - z_b);
+			}
+			if(c != 0){
+				// Bias add
+				sum += c_data[j];
+			}
+
+			result_data[i*M + j] = (int8_t)((sum >> output_shift) + (int16_t) z_result);
+		}
+	}
+	return;
+}
+
+void aimath_q7_default_linear32_fused_input(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result)
+{
+	aimath_q7_default_linear32_fused_input_internal(a, b, c, result, 0);
+}
+
+void aimath_q7_default_linear32_bt_fused_input(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result)
+{
+	aimath_q7_default_linear32_fused_input_internal(a, b, c, result, 1);
+}
+
 void aimath_q7_default_mat_mul(const aitensor_t *a, const aitensor_t *b, aitensor_t *result){
 	aimath_q7_default_linear32(a, b, 0, result);
 }
@@ -871,80 +1083,122 @@ void aimath_q7_default_softsign(const aitensor_t *x, aitensor_t *result)
 	return;
 }
 
+void aimath_q7_default_lut_build(const aimath_q7_params_t *x_params,
+                                 const aimath_q7_params_t *result_params,
+                                 float (*function)(float x, const void *args),
+                                 const void *args,
+                                 aimath_q7_lut_t *lut)
+{
+    int16_t q;
+    float x, y;
+    float x_scale = 1.0f / (float) ((uint32_t) 1 << x_params->shift);
+    float result_scale = (float) ((uint32_t) 1 << result_params->shift);
+
+    for(q = -128; q <= 127; q++){
+        x = (float) (q - x_params->zero_point) * x_scale;
+        y = function(x, args) * result_scale;
+        y = (y >= 0.0f ? floorf(y + 0.5f) : ceilf(y - 0.5f)) + (float) result_params->zero_point;
+        if(y > 127.0f) y = 127.0f;
+        if(y < -128.0f) y = -128.0f;
+        lut->table[q + 128] = (int8_t) y;
+    }
+    lut->x_params = *x_params;
+    lut->result_params = *result_params;
+    lut->is_valid = 1;
+    return;
+}
+
+uint8_t aimath_q7_default_lut_is_valid(const aimath_q7_lut_t *lut, const aimath_q7_params_t *x_params)
+{
+    return lut->is_valid
+           && lut->x_params.shift == x_params->shift
+           && lut->x_params.zero_point == x_params->zero_point;
+}
+
+void aimath_q7_default_lut(const aitensor_t *x, const aimath_q7_lut_t *lut, aitensor_t *result)
+{
+    uint32_t i;
+    uint32_t element_count = aimath_tensor_elements(x);
+    const int8_t *x_data = (const int8_t *) x->data;
+    int8_t *result_data = (int8_t *) result->data;
+    const int8_t *table = lut->table + 128;
+
+    for(i = 0; i < element_count; i++){
+        result_data[i] = table[x_data[i]];
+    }
+
+    ((aimath_q7_params_t *) result->tensor_params)->shift = lut->result_params.shift;
+    ((aimath_q7_params_t *) result->tensor_params)->zero_point = lut->result_params.zero_point;
+    return;
+}
+
+// 2^(-k/16) in Q16 for k = 0 ... 16 (17th entry as end point for the interpolation)
+static const uint32_t aimath_q7_default_exp2_neg_lut[17] = {
+    65536, 62757, 60097, 57549, 55109, 52773, 50535, 48393, 46341, 44376, 42495, 40693, 38968, 37316, 35734, 34219, 32768
+};
+
+// exp(d * 2^-x_shift) for d <= 0 in Q16 (2^16 = 1.0): exp(r) = 2^(-t) with t = -r * log2(e) = n + f,
+// 2^(-f) from the interpolated lookup table, 2^(-n) by a right shift.
+static uint32_t aimath_q7_default_softmax_exp(int16_t d, uint16_t x_shift)
+{
+    uint32_t t, frac, lo, hi;
+
+    if(x_shift >= 32) return 65536;
+    t = ((uint32_t) (-d) * 94548) >> x_shift; // 94548 = log2(e) in Q16
+    if((t >> 16) > 16) return 0;
+
+    frac = t & 0xFFFF;
+    lo = aimath_q7_default_exp2_neg_lut[frac >> 12];
+    hi = aimath_q7_default_exp2_neg_lut[(frac >> 12) + 1];
+    return (lo - (((lo - hi) * (frac & 0xFFF)) >> 12)) >> (t >> 16);
+}
+
 void aimath_q7_default_softmax(const aitensor_t *x, aitensor_t *result) {
-    int32_t i, j;
-	int16_t borders[4] = {-16, -32, -48, -80}; //  {-1.0, -2.0, -3.0, -5.0}
-	uint16_t border_shift = 4;
+    uint32_t i, j;
 	int8_t max;
+	int8_t *x_row;
+	int8_t *result_row;
 
 	uint16_t x_shift = ((aimath_q7_params_t *) x->tensor_params)->shift;
-	int8_t x_zero_point = ((aimath_q7_params_t *) x->tensor_params)->zero_point;
 
+	uint32_t acc;
+	uint32_t reciprocal;
 	int32_t res;
-	int32_t acc = 0;
-	int8_t e_x[aimath_tensor_elements(x)];
-	int16_t x_data_point;
 
 	// Multiplier for array index calculation
- 	uint16_t multiplier = 1;
+ 	uint32_t multiplier = 1;
  	for(i = x->dim - 1; i >= 1; i--){
         multiplier *= x->shape[i];
  	}
 
- 	if(x_shift > border_shift){
-		borders[0] <<= (x_shift - border_shift);
-		borders[1] <<= (x_shift - border_shift);
-		borders[2] <<= (x_shift - border_shift);
-		borders[3] <<= (x_shift - border_shift);
-	}
-	else{
-        borders[0] >>= (border_shift - x_shift);
-		borders[1] >>= (border_shift - x_shift);
-		borders[2] >>= (border_shift - x_shift);
-		borders[3] >>= (border_shift - x_shift);
-	}
-
     for(i = 0; i < x->shape[0]; i++){
+        x_row = (int8_t *) x->data + i * multiplier;
+        result_row = (int8_t *) result->data + i * multiplier;
+
         // calc max value for numeric stability
-        max = ((int8_t *) x->data)[i * multiplier];
+        max = x_row[0];
         for (j = 1; j < multiplier; j++) {
-            if (((int8_t *) x->data)[i * multiplier + j] > max) {
-                max = ((int8_t *) x->data)[i * multiplier + j];
+            if (x_row[j] > max) {
+                max = x_row[j];
             }
         }
-        x_zero_point = max;
 
-        // calc exp functions
+        // Sum of the exponentials in Q16 (the maximum contributes 1.0, so acc >= 2^16)
         acc = 0;
         for(j = 0; j < multiplier; j++)
         {
-            x_data_point = (int16_t) ((int8_t *) x->data)[i * multiplier + j] - (int16_t) x_zero_point;
-
-            if (x_data_point > borders[0]) {
-                res = ((161 * x_data_point) >> x_shift) + 127;
-            }
-            else if (x_data_point > borders[1]) {
-                res = ((59 * x_data_point) >> x_shift) + 26;
-            }
-            else if (x_data_point > borders[2]) {
-                res = ((23 * x_data_point) >> x_shift) - 46;
-            }
-            else if (x_data_point > borders[3]) {
-                res = ((6 * x_data_point) >> x_shift) - 96;
-            }
-            else {
-                res = -128;
-            }
-
-            acc += (res + 128);
-            e_x[i * multiplier + j] = (int8_t) res;
+            acc += aimath_q7_default_softmax_exp((int16_t) x_row[j] - (int16_t) max, x_shift);
         }
 
-        //calc softmax
+        // Fixed-point reciprocal 2^47 / acc (fits into 32 bit), one division per row
+        reciprocal = (uint32_t) (((uint64_t) 1 << 47) / acc);
+
+        // result = e * 2^8 / acc - 128, rounded
         for(j = 0; j < multiplier; j++)
         {
-            res = ((((int32_t) e_x[i * multiplier + j] + 128) << 8) / (acc + 1)) - 128;
-            ((int8_t *) result->data)[i * multiplier + j] = (int8_t) res;
+            res = (int32_t) (((uint64_t) aimath_q7_default_softmax_exp((int16_t) x_row[j] - (int16_t) max, x_shift) * reciprocal
+                              + ((uint64_t) 1 << 38)) >> 39) - 128;
+            result_row[j] = (int8_t) (res > 127 ? 127 : res);
         }
  	}
 
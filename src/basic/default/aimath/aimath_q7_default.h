@@ -31,6 +31,7 @@
 
 #include "basic/base/aimath/aimath_q7.h"
 #include "basic/base/aimath/aimath_q31.h"
+#include "basic/base/aimath/aimath_sparse.h"
 
 
 /** @brief Performs a matrix multiplication of \link aimath_q7.h Q7 \endlink matrices a and b and adds a \link aimath_q31.h Q31 \endlink vector c to each row
@@ -251,6 +252,49 @@ void aimath_q7_default_linear32(const aitensor_t *a, const aitensor_t *b, const
  */
 void aimath_q7_default_linear32_bt(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result);
 
+/** @brief Performs a matrix multiplication of a \link aimath_q7.h Q7 \endlink matrix a and a \link aimath_sparse.h sparse \endlink Q7 matrix b (transposed) and adds a \link aimath_q31.h Q31 \endlink vector c to each row
+ *
+ * Same operation as aimath_q7_default_linear32_bt(), but only the stored entries of b (see aimath_sparse_params_t) are multiplied.
+ * The number of multiply-accumulate operations and the weights memory are proportional to the number of stored entries.
+ * All formats of aimath_sparse.h (CSR, 1x4 and 4x1 blocks) are supported.
+ *
+ * The quantization parameters of the values of b are given by aimath_sparse_params_t.values_params.
+ *
+ * ** The zero point of the values of b has to be 0 (symmetric quantization), so that the not stored elements are zero.
+ * The quantization parameters of the vector c have to be {zero_point = 0, shift = a.shift + b.shift}! **
+ *
+ * @param *a        Q7 matrix a (2D tensor of shape [N x K])
+ * @param *b        Sparse Q7 matrix b (2D tensor of shape [M x K] with aimath_sparse_params_t as tensor parameters)
+ * @param *c        Q31 vector c (2D tensor of shape [1 x M] or 1D tensor of shape [M])
+ * @param *result   Resulting Q7 matrix (2D tensor of shape [N x M])
+ */
+void aimath_q7_default_linear32_sparse_bt(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result);
+
+/** @brief Performs a matrix multiplication with fused input quantization and adds a vector c to each row
+ *
+ * Same as aimath_q7_default_linear32(), but matrix a still contains raw input data (F32 or 16 bit ADC values)
+ * and has aimath_q7_source_params_t as tensor parameters. Every raw value is quantized in the inner loop right before
+ * it is multiplied (aimath_q7_quantize_value_from_source()), so neither a separate quantization pass nor a buffer
+ * for the quantized input is needed. In exchange, every input value is quantized once per output column.
+ *
+ * @param *a        Raw matrix a (2D tensor of shape [N x K] with aimath_q7_source_params_t)
+ * @param *b        Q7 matrix b (2D tensor of shape [K x M])
+ * @param *c        Q31 vector c (2D tensor of shape [1 x M])
+ * @param *result   Resulting Q7 matrix (2D tensor of shape [N x M])
+ */
+void aimath_q7_default_linear32_fused_input(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result);
+
+/** @brief Performs a matrix multiplication with fused input quantization and transposed matrix b and adds a vector c to each row
+ *
+ * Same as aimath_q7_default_linear32_bt(), but matrix a still contains raw input data (see aimath_q7_default_linear32_fused_input()).
+ *
+ * @param *a        Raw matrix a (2D tensor of shape [N x K] with aimath_q7_source_params_t)
+ * @param *b        Q7 matrix b (2D tensor of shape [M x K])
+ * @param *c        Q31 vector c (2D tensor of shape [1 x M])
+ * @param *result   Resulting Q7 matrix (2D tensor of shape [N x M])
+ */
+void aimath_q7_default_linear32_bt_fused_input(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result);
+
 /** @brief Performs a matrix multiplication of \link aimath_q7.h Q7 \endlink matrices a and b
   *
   * @f[
@@ -873,12 +917,78 @@ void aimath_q7_default_tanh(const aitensor_t *x, aitensor_t *result);
  */
 void aimath_q7_default_softsign(const aitensor_t *x, aitensor_t *result);
 
+/** @brief Calculates the lookup table of an element wise function for \link aimath_q7.h Q7 \endlink tensors
+ *
+ * Every possible input value \f$ q \in [-128, 127] \f$ is dequantized with the given input quantization parameters,
+ * the function is evaluated in F32 and the result is quantized (with rounding and saturation) with the given result quantization parameters:
+ * @f[
+ *  table_{q + 128} = round(f((q - z_x) \cdot 2^{-s_x}) \cdot 2^{s_{result}}) + z_{result}
+ * @f]
+ *
+ * The input quantization parameters are stored in the table as key (see aimath_q7_default_lut_is_valid()).
+ *
+ * Example:
+ * \code{.c}
+ * float sigmoid(float x, const void *args)
+ * {
+ *     return 1.0f / (1.0f + expf(-x));
+ * }
+ *
+ * aimath_q7_params_t x_params = {4, 0};
+ * aimath_q7_params_t result_params = {8, -128};
+ * aimath_q7_lut_t lut;
+ *
+ * aimath_q7_default_lut_build(&x_params, &result_params, sigmoid, 0, &lut);
+ * \endcode
+ *
+ * @param *x_params         Quantization parameters of the input tensor
+ * @param *result_params    Quantization parameters of the result tensor
+ * @param function          The function to tabulate
+ * @param *args             Additional arguments for the function (e.g. alpha of the ELU function, can be 0)
+ * @param *lut              The resulting lookup table
+ */
+void aimath_q7_default_lut_build(const aimath_q7_params_t *x_params,
+                                 const aimath_q7_params_t *result_params,
+                                 float (*function)(float x, const void *args),
+                                 const void *args,
+                                 aimath_q7_lut_t *lut);
+
+/** @brief Checks if a lookup table is calculated for the given input quantization parameters
+ *
+ * @param *lut          The lookup table
+ * @param *x_params     Quantization parameters of the input tensor
+ * @return              1 if the table can be used for the input, 0 if it has to be (re-)calculated
+ */
+uint8_t aimath_q7_default_lut_is_valid(const aimath_q7_lut_t *lut, const aimath_q7_params_t *x_params);
+
+/** @brief Applies a lookup table to every element of a \link aimath_q7.h Q7 \endlink tensor
+ *
+ * @f[
+ *  result_i = table_{x_i + 128}
+ * @f]
+ *
+ * One table load per element without branches. The quantization parameters of the result tensor are set to the result parameters of the table.
+ * The table must be calculated for the quantization parameters of x (see aimath_q7_default_lut_build()).
+ *
+ * @param *x        Q7 input tensor (N-D)
+ * @param *lut      The lookup table
+ * @param *result   Resulting Q7 tensor (N-D)
+ */
+void aimath_q7_default_lut(const aitensor_t *x, const aimath_q7_lut_t *lut, aitensor_t *result);
+
 /** @brief Calculates the softmax value of each batch element (row) of a \link aimath_q7.h Q7 \endlink tensor
  *
  * @f[
- *  result_{i} = \frac{e^{x_i}}{\sum_{j=1}^{K} e^{x_j}}
+ *  result_{i} = \frac{e^{x_i}}{\sum_{j=1}^{K} e^{x_j}} = \frac{e^{x_i - x_{max}}}{\sum_{j=1}^{K} e^{x_j - x_{max}}}
  * @f]
  *
+ * The calculation is integer-only: After subtracting the row maximum, the exponential function is evaluated in fixed point
+ * as \f$ e^{r} = 2^{-(n + f)} \f$ with \f$ n + f = -r \cdot \log_2(e) \f$. \f$ 2^{-f} \f$ is linearly interpolated from a
+ * 17 entry lookup table and \f$ 2^{-n} \f$ is a right shift. The exponentials are summed up in a 32 bit integer and multiplied
+ * with a fixed-point reciprocal of the sum (one division per row).
+ *
+ * The error of the result is at most 1 LSB (compared to the exact softmax of the dequantized input).
+ *
  * **The quantization parameters of the result tensor are set to {shift = 8, zero_point = -128} by the function
  * because the output values are in the interval (0, 1).**
  *
@@ -634,14 +634,11 @@ int8_t AIFES_E_training_fnn_f32(aitensor_t *input_tensor,
 
     for(i = 0; i < AIFES_E_fnn_training->epochs; i++)
     {
-        // One epoch of training. Iterates through the whole data once
-        aialgo_train_model(&model, input_tensor, target_tensor, optimizer, AIFES_E_fnn_training->batch_size);
-
         // Calculate and print loss every print_interval epochs
         if(i % AIFES_E_fnn_training->epochs_loss_print_interval == 0)
         {
-
-            aialgo_calc_loss_model_f32(&model, input_tensor, target_tensor, &loss);
+            // One epoch of training. The loss is accumulated during the forward passes of the epoch
+            aialgo_train_model_with_loss_f32(&model, input_tensor, target_tensor, optimizer, AIFES_E_fnn_training->batch_size, &loss);
 
             //Print the loss with the user function
             switch(AIFES_E_fnn_training->loss){
@@ -677,9 +674,11 @@ int8_t AIFES_E_training_fnn_f32(aitensor_t *input_tensor,
                 //printf("ERROR! Unknown loss function\n" );
                 return(-10);
             }
-
-
-
+        }
+        else
+        {
+            // One epoch of training. Iterates through the whole data once
+            aialgo_train_model(&model, input_tensor, target_tensor, optimizer, AIFES_E_fnn_training->batch_size);
         }
     }
 
@@ -0,0 +1,70 @@
+/**
+ * \file basic/storage/ailayer/ailayer_dense_storage.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+#include "basic/storage/ailayer/ailayer_dense_storage.h"
+
+ailayer_t *ailayer_dense_f32_storage(ailayer_dense_f32_t *layer, ailayer_t *input_layer)
+{
+    ailayer_t *return_layer;
+
+	layer->base.result.dtype = aif32;
+	layer->base.deltas.dtype = aif32;
+	layer->weights.dtype = aif32;
+	layer->bias.dtype = aif32;
+
+    layer->base.calc_result_tensor_params = 0;
+    layer->base.init_params = 0;
+
+    return_layer = ailayer_dense(layer, input_layer);
+
+    layer->linear = aimath_f32_storage_linear;
+
+    // No training supported, because the parameters are read-only
+    return_layer->backward = 0;
+
+    return return_layer;
+}
+
+ailayer_t *ailayer_dense_wt_q7_storage(ailayer_dense_q7_t *layer, ailayer_t *input_layer)
+{
+    ailayer_t *return_layer;
+
+	layer->base.result.dtype = aiq7;
+	layer->base.deltas.dtype = aiq7;
+	layer->weights.dtype = aiq7;
+	layer->bias.dtype = aiq31; // Higher precision (s_bias = s_input + s_weights)
+
+    layer->base.calc_result_tensor_params = 0;
+    layer->base.init_params = 0;
+
+    return_layer = ailayer_dense(layer, input_layer);
+
+	// Change shape to match transposed weights
+	layer->weights.shape[0] = layer->neurons;
+	layer->weights.shape[1] = input_layer->result.shape[1];
+
+    layer->linear = aimath_q7_storage_linear32_bt;
+
+    // No training supported, because the parameters are read-only
+    return_layer->backward = 0;
+
+    return return_layer;
+}
@@ -0,0 +1,90 @@
+/**
+ * \file basic/storage/ailayer/ailayer_dense_storage.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Implementation of the \link ailayer_dense.h Dense layer \endlink with parameters in a \link aimath_storage.h parameter storage \endlink
+ *
+ * Hardware independent implementations of the Dense layer in \link aimath_f32.h F32 \endlink
+ * and \link aimath_q7.h Q7 \endlink data-type that stream the weights and biases from a read-only storage
+ * (RAM, XIP flash, AVR program memory, external flash, mmap or file).
+ * For more information about the Dense layer refer to ailayer_dense.h.
+ *
+ * This is useful if there are too many weights to fit into the RAM.
+ */
+
+#ifndef AILAYER_DENSE_STORAGE_H
+#define AILAYER_DENSE_STORAGE_H
+
+#include "basic/default/ailayer/ailayer_dense_default.h"
+#include "basic/storage/aimath/aimath_f32_storage.h"
+#include "basic/storage/aimath/aimath_q7_storage.h"
+
+/** @brief Initializes and connect a \link ailayer_dense.h Dense layer \endlink with the \link aimath_f32.h F32 \endlink storage implementation
+ *
+ * The data pointers of the weights and bias have to point to an aimath_storage_ref_t.
+ * The rest of the layer configuration is the same as with ailayer_dense_f32_default().
+ *
+ * **Example:** Weights [3 x 2] and bias [2] in a parameter file:\n
+ * \code{.c}
+ * uint8_t page_buffer[256];
+ * aimath_storage_t storage;
+ * aimath_storage_posix_open(&storage, "dense.bin", page_buffer, sizeof(page_buffer));
+ *
+ * aimath_storage_ref_t weights_ref = {&storage, 0};
+ * aimath_storage_ref_t bias_ref = {&storage, 3 * 2 * sizeof(float)};
+ * ailayer_dense_f32_t dense_layer = AILAYER_DENSE_F32_M(2, &weights_ref, &bias_ref);
+ *
+ * x = ailayer_dense_f32_storage(&dense_layer, x);
+ * \endcode
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_dense_f32_storage(ailayer_dense_f32_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_dense.h Dense layer \endlink with the \link aimath_q7.h Q7 \endlink storage implementation
+ *
+ * The weights matrix is transposed ([neurons x inputs], like in ailayer_dense_wt_q7_default()), so that the weights of one
+ * neuron are a contiguous block in the storage.
+ * The data pointers of the weights and bias have to point to an aimath_storage_ref_t. The quantization parameters
+ * are located in RAM. The bias is a \link aimath_q31.h Q31 \endlink vector with shift = input shift + weights shift.
+ *
+ * **Example:** Weights [2 x 3] (transposed) and bias [2] in a parameter file:\n
+ * \code{.c}
+ * aimath_storage_ref_t weights_ref = {&storage, 0};
+ * aimath_storage_ref_t bias_ref = {&storage, 8};  // 2 * 3 bytes + alignment to 4 bytes
+ * aimath_q7_params_t weights_q_params_dense = { .shift = 3, .zero_point = 0 };
+ * aimath_q31_params_t bias_q_params_dense = { .shift = 10, .zero_point = 0 };
+ * aimath_q7_params_t result_q_params_dense = { .shift = 3, .zero_point = 41 };
+ * ailayer_dense_q7_t dense_layer = AILAYER_DENSE_Q7_M(2,
+ *                                                     &weights_ref, &weights_q_params_dense,
+ *                                                     &bias_ref, &bias_q_params_dense,
+ *                                                     &result_q_params_dense);
+ *
+ * x = ailayer_dense_wt_q7_storage(&dense_layer, x);
+ * \endcode
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_dense_wt_q7_storage(ailayer_dense_q7_t *layer, ailayer_t *input_layer);
+
+#endif // AILAYER_DENSE_STORAGE_H
@@ -0,0 +1,95 @@
+/**
+ * \file basic/storage/aimath/aimath_f32_storage.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+#include "basic/storage/aimath/aimath_f32_storage.h"
+
+#include <string.h>
+
+AISTRING_STORAGE_WRAPPER(aistring_error_f32_linear_storage_1, "[aimath_f32_storage_linear] MatMul input shapes doesn't match.\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_f32_linear_storage_2, "[aimath_f32_storage_linear] MatMul output shape doesn't match.\n");
+
+void aimath_f32_storage_linear(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result)
+{
+	uint16_t i;
+	uint32_t e, k, j, run, r, count, index, size;
+	uint16_t N = a->shape[0];
+	uint16_t K = a->shape[1];
+	uint16_t M = b->shape[1];
+	uint32_t total = (uint32_t) K * M;
+	const aimath_storage_ref_t *b_ref = (const aimath_storage_ref_t *) b->data;
+	const aimath_storage_ref_t *c_ref;
+	const float *tile;
+	const float *a_data = (const float *) a->data;
+	float *result_data = (float *) result->data;
+	float *result_row;
+	float a_value;
+
+#ifdef AIDEBUG_SHAPE_CHECKS
+	if(a->shape[1] != b->shape[0])
+	{
+		AILOG_E(aistring_error_f32_linear_storage_1);
+		return;
+	}
+	if(a->shape[0] != result->shape[0] || b->shape[1] != result->shape[1])
+	{
+		AILOG_E(aistring_error_f32_linear_storage_2);
+		return;
+	}
+#endif
+
+	// Initialize every result row with the bias
+	if(c != 0){
+        c_ref = (const aimath_storage_ref_t *) c->data;
+        aimath_storage_read(c_ref->storage, c_ref->offset, result_data, M * sizeof(float));
+        for(i = 1; i < N; i++){
+            memcpy(result_data + (uint32_t) i * M, result_data, M * sizeof(float));
+        }
+	} else {
+        memset(result_data, 0, (uint32_t) N * M * sizeof(float));
+	}
+
+	// Stream the weights tile by tile and accumulate the products of all rows of a
+	index = 0;
+	while(index < total){
+        size = (total - index) * sizeof(float);
+        tile = (const float *) aimath_storage_fetch(b_ref->storage, b_ref->offset + index * sizeof(float), &size);
+        count = size / sizeof(float);
+
+        // Process the tile in segments that lie in one row of b
+        for(e = 0; e < count; e += run){
+            k = (index + e) / M;
+            j = (index + e) - k * M;
+            run = M - j;
+            if(run > count - e){
+                run = count - e;
+            }
+            for(i = 0; i < N; i++){
+                a_value = a_data[(uint32_t) i * K + k];
+                result_row = result_data + (uint32_t) i * M + j;
+                for(r = 0; r < run; r++){
+                    result_row[r] += a_value * tile[e + r];
+                }
+            }
+        }
+        index += count;
+	}
+	return;
+}
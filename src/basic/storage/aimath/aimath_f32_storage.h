@@ -0,0 +1,81 @@
+/**
+ * \file basic/storage/aimath/aimath_f32_storage.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Math functions for \link aimath_f32.h F32 \endlink data type with parameters in a \link aimath_storage.h parameter storage \endlink
+ *
+ * These functions modify the default implementation of the F32 math functions to stream the parameters tile by tile
+ * from a read-only storage (for example external flash or a file) instead of reading them from RAM.
+ * The data pointers of the parameter tensors point to an aimath_storage_ref_t.
+ */
+
+#ifndef AIMATH_F32_STORAGE_H
+#define AIMATH_F32_STORAGE_H
+
+#include "basic/default/aimath/aimath_f32_default.h"
+#include "basic/storage/aimath/aimath_storage.h"
+
+/** @brief Performs a matrix multiplication of \link aimath_f32.h F32 \endlink matrices a and b and adds a vector c to each row
+ *
+ * The data of b and c is located in a parameter storage (the data pointers point to an aimath_storage_ref_t).
+ * The matrix b is streamed once in tiles of the storage buffer size, independent of the number of rows of a.
+ *
+ * Same functionality as aimath_f32_default_linear().
+ *
+ * @f[
+ *  result = a \cdot b + \left( \begin{array}{c}
+ 							1  \\
+							1 \\
+							\vdots \\
+							1  \\
+							\end{array}\right)  \cdot c
+ * @f]
+ *
+ * Example:
+ * \code{.c}
+ * // Parameter file: b (3 x 2) followed by c (1 x 2)
+ * aimath_storage_t storage;
+ * aimath_storage_ref_t b_ref = {&storage, 0};
+ * aimath_storage_ref_t c_ref = {&storage, 3 * 2 * sizeof(float)};
+ *
+ * uint16_t a_shape[2] = {3, 3};
+ * float a_data[3*3] = {...};
+ * aitensor_t a = AITENSOR_2D_F32(a_shape, a_data);
+ *
+ * uint16_t b_shape[2] = {3, 2};
+ * aitensor_t b = AITENSOR_2D_F32(b_shape, &b_ref);
+ *
+ * uint16_t c_shape[2] = {1, 2};
+ * aitensor_t c = AITENSOR_2D_F32(c_shape, &c_ref);
+ *
+ * uint16_t result_shape[2] = {3, 2};
+ * float result_data[3*2];
+ * aitensor_t result = AITENSOR_2D_F32(result_shape, result_data);
+ *
+ * aimath_f32_storage_linear(&a, &b, &c, &result);
+ * \endcode
+ *
+ * @param *a        F32 matrix a (2D tensor of shape [N x K]) in RAM
+ * @param *b        F32 matrix b (2D tensor of shape [K x M]) in a storage
+ * @param *c        F32 vector c (2D tensor of shape [1 x M] or 1D tensor of shape [M]) in a storage (or 0)
+ * @param *result   Resulting F32 matrix (2D tensor of shape [N x M])
+ */
+void aimath_f32_storage_linear(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result);
+
+#endif // AIMATH_F32_STORAGE_H
@@ -0,0 +1,120 @@
+/**
+ * \file basic/storage/aimath/aimath_q7_storage.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+#include "basic/storage/aimath/aimath_q7_storage.h"
+
+AISTRING_STORAGE_WRAPPER(aistring_error_q7_linear32_storage_1, "[aimath_q7_storage_linear32_bt] MatMul input shapes doesn't match.\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_q7_linear32_storage_2, "[aimath_q7_storage_linear32_bt] MatMul output shape doesn't match.\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_q7_linear32_storage_3, "[aimath_q7_storage_linear32_bt] Third operand shift does not match.\n");
+
+void aimath_q7_storage_linear32_bt(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result)
+{
+	uint16_t i, j;
+	uint32_t k, count, size;
+	int32_t sum, acc, bias;
+	uint16_t K = a->shape[1];
+	uint16_t a_shift = ((aimath_q7_params_t *) a->tensor_params)->shift;
+	uint16_t b_shift = ((aimath_q7_params_t *) b->tensor_params)->shift;
+	uint16_t result_shift = ((aimath_q7_params_t *) result->tensor_params)->shift;
+
+	int8_t z_a = ((aimath_q7_params_t *) a->tensor_params)->zero_point;
+	int8_t z_b = ((aimath_q7_params_t *) b->tensor_params)->zero_point;
+	int8_t z_result = ((aimath_q7_params_t *) result->tensor_params)->zero_point;
+
+	// Output scaling factor M = (S_1 * S_2) / S_3
+	uint16_t output_shift = a_shift + b_shift - result_shift;
+
+	const aimath_storage_ref_t *b_ref = (const aimath_storage_ref_t *) b->data;
+	const aimath_storage_ref_t *c_ref = 0;
+	const int8_t *a_row;
+	const int8_t *tile;
+	int8_t *result_data = (int8_t *) result->data;
+
+#ifdef AIDEBUG_SHAPE_CHECKS
+	if(a->shape[1] != b->shape[1])
+	{
+		AILOG_E(aistring_error_q7_linear32_storage_1);
+		return;
+	}
+	if(a->shape[0] != result->shape[0] || b->shape[0] != result->shape[1])
+	{
+		AILOG_E(aistring_error_q7_linear32_storage_2);
+		return;
+	}
+#endif
+#ifdef AIDEBUG_GENERAL_CHECKS
+	if(c != 0 && ((aimath_q31_params_t *) c->tensor_params)->shift != a_shift + b_shift)
+	{
+		AILOG_E(aistring_error_q7_linear32_storage_3);
+		return;
+	}
+#endif // AIDEBUG_GENERAL_CHECKS
+
+	if(c != 0){
+        c_ref = (const aimath_storage_ref_t *) c->data;
+	}
+
+	for(i = 0; i < a->shape[0]; i++)
+	{
+        a_row = (const int8_t *) a->data + (uint32_t) i * K;
+
+        // a_1 = sum(q_{1,ij}) from j=1 to N
+        acc = 0;
+        if(z_b != 0){
+            for(k = 0; k < K; k++){
+                acc += (int32_t) a_row[k];
+            }
+        }
+
+		for(j = 0; j < b->shape[0]; j++)
+		{
+			sum = 0;
+			if(z_b != 0){
+                sum -= z_b * acc;
+			}
+			if(z_a != 0 && z_b != 0){
+				// N * Z_1 * Z_2
+				sum += K * z_a * z_b;
+			}
+
+			// Stream the weights of output j
+			k = 0;
+			while(k < K){
+                size = K - k;
+                tile = (const int8_t *) aimath_storage_fetch(b_ref->storage, b_ref->offset + (uint32_t) j * K + k, &size);
+                for(count = 0; count < size; count++){
+                    // Zero point correction: - z_a * sum(q_{2,jk})
+                    sum += ((int32_t) a_row[k + count] - (int32_t) z_a) * (int32_t) tile[count];
+                }
+                k += size;
+			}
+
+			if(c != 0){
+				// Bias add
+				aimath_storage_read(c_ref->storage, c_ref->offset + (uint32_t) j * sizeof(int32_t), &bias, sizeof(int32_t));
+				sum += bias;
+			}
+
+			result_data[i*b->shape[0] + j] = (int8_t)((sum >> output_shift) + (int16_t) z_result);
+		}
+	}
+	return;
+}
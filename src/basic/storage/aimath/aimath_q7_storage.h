@@ -0,0 +1,60 @@
+/**
+ * \file basic/storage/aimath/aimath_q7_storage.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Math functions for \link aimath_q7.h Q7 \endlink data type with parameters in a \link aimath_storage.h parameter storage \endlink
+ *
+ * These functions modify the default implementation of the Q7 math functions to stream the parameters tile by tile
+ * from a read-only storage (for example external flash or a file) instead of reading them from RAM.
+ * The data pointers of the parameter tensors point to an aimath_storage_ref_t, the quantization parameters are located in RAM.
+ */
+
+#ifndef AIMATH_Q7_STORAGE_H
+#define AIMATH_Q7_STORAGE_H
+
+#include "basic/default/aimath/aimath_q7_default.h"
+#include "basic/storage/aimath/aimath_storage.h"
+
+/** @brief Performs a matrix multiplication of \link aimath_q7.h Q7 \endlink matrices a and b (transposed) and adds a \link aimath_q31.h Q31 \endlink vector c to each row
+ *
+ * The data of b and c is located in a parameter storage (the data pointers point to an aimath_storage_ref_t).
+ * Every row of the transposed matrix b (the weights of one output) is a contiguous block in the storage that is streamed
+ * in tiles of the storage buffer size.
+ *
+ * Same functionality as aimath_q7_default_linear32_bt().
+ *
+ * ** The quantization parameters of the vector c have to be {zero_point = 0, shift = a.shift + b.shift}! **
+ *
+ * @f[
+ *  result = a \cdot b^T + \left( \begin{array}{c}
+ 							1  \\
+							1 \\
+							\vdots \\
+							1  \\
+							\end{array}\right)  \cdot c
+ * @f]
+ *
+ * @param *a        Q7 matrix a (2D tensor of shape [N x K]) in RAM
+ * @param *b        Q7 matrix b (2D tensor of shape [M x K]) in a storage
+ * @param *c        Q31 vector c (2D tensor of shape [1 x M] or 1D tensor of shape [M]) in a storage (or 0)
+ * @param *result   Resulting Q7 matrix (2D tensor of shape [N x M])
+ */
+void aimath_q7_storage_linear32_bt(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result);
+
+#endif // AIMATH_Q7_STORAGE_H
@@ -0,0 +1,140 @@
+/**
+ * \file basic/storage/aimath/aimath_storage.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+#include "basic/storage/aimath/aimath_storage.h"
+
+#include <string.h>
+
+void aimath_storage_init_direct(aimath_storage_t *storage, const void *address)
+{
+	storage->address = address;
+	storage->read = 0;
+	storage->handle = 0;
+	storage->buffer = 0;
+	storage->buffer_size = 0;
+	storage->paged = 0;
+	storage->cached_page = AIMATH_STORAGE_NO_PAGE;
+	return;
+}
+
+void aimath_storage_init_callback(aimath_storage_t *storage,
+                                  void (*read)(const aimath_storage_t *storage, uint32_t offset, void *buffer, uint32_t size),
+                                  void *handle,
+                                  void *buffer,
+                                  uint32_t buffer_size)
+{
+	storage->address = 0;
+	storage->read = read;
+	storage->handle = handle;
+	storage->buffer = (uint8_t *) buffer;
+	storage->buffer_size = buffer_size;
+	storage->paged = 0;
+	storage->cached_page = AIMATH_STORAGE_NO_PAGE;
+	return;
+}
+
+void aimath_storage_init_paged(aimath_storage_t *storage,
+                               void (*read)(const aimath_storage_t *storage, uint32_t offset, void *buffer, uint32_t size),
+                               void *handle,
+                               void *page_buffer,
+                               uint32_t page_size)
+{
+	aimath_storage_init_callback(storage, read, handle, page_buffer, page_size);
+	storage->paged = 1;
+	return;
+}
+
+void aimath_storage_invalidate(aimath_storage_t *storage)
+{
+	storage->cached_page = AIMATH_STORAGE_NO_PAGE;
+	return;
+}
+
+const void *aimath_storage_fetch(aimath_storage_t *storage, uint32_t offset, uint32_t *size)
+{
+	uint32_t page, page_offset;
+
+	if(storage->address != 0){
+        // Direct access: The whole requested range is available
+        return (const uint8_t *) storage->address + offset;
+	}
+
+	if(storage->paged){
+        page = offset / storage->buffer_size;
+        page_offset = offset - page * storage->buffer_size;
+        if(page != storage->cached_page){
+            storage->read(storage, page * storage->buffer_size, storage->buffer, storage->buffer_size);
+            storage->cached_page = page;
+        }
+        if(*size > storage->buffer_size - page_offset){
+            *size = storage->buffer_size - page_offset;
+        }
+        return storage->buffer + page_offset;
+	}
+
+	// Callback: Read the next tile into the buffer
+	if(*size > storage->buffer_size){
+        *size = storage->buffer_size;
+	}
+	storage->read(storage, offset, storage->buffer, *size);
+	return storage->buffer;
+}
+
+void aimath_storage_read(aimath_storage_t *storage, uint32_t offset, void *buffer, uint32_t size)
+{
+	uint32_t tile_size;
+	const void *tile;
+
+	if(storage->address != 0){
+        memcpy(buffer, (const uint8_t *) storage->address + offset, size);
+        return;
+	}
+	if(!storage->paged){
+        // Read directly into the destination without a copy over the tile buffer
+        storage->read(storage, offset, buffer, size);
+        return;
+	}
+	while(size > 0){
+        tile_size = size;
+        tile = aimath_storage_fetch(storage, offset, &tile_size);
+        memcpy(buffer, tile, tile_size);
+        buffer = (uint8_t *) buffer + tile_size;
+        offset += tile_size;
+        size -= tile_size;
+	}
+	return;
+}
+
+#ifdef AIFES_WITH_AVR_PGM
+#include <avr/pgmspace.h>
+
+static void aimath_storage_avr_pgm_read(const aimath_storage_t *storage, uint32_t offset, void *buffer, uint32_t size)
+{
+	memcpy_P(buffer, (const uint8_t *) storage->handle + offset, size);
+	return;
+}
+
+void aimath_storage_init_avr_pgm(aimath_storage_t *storage, const void *pgm_address, void *buffer, uint32_t buffer_size)
+{
+	aimath_storage_init_callback(storage, aimath_storage_avr_pgm_read, (void *) pgm_address, buffer, buffer_size);
+	return;
+}
+#endif // AIFES_WITH_AVR_PGM
@@ -0,0 +1,194 @@
+/**
+ * \file basic/storage/aimath/aimath_storage.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Read-only parameter storage accessor
+ *
+ * The parameter storage abstracts the memory that holds the (constant) parameters of a model, for example
+ * RAM, memory mapped (XIP) flash, AVR program memory, an external SPI flash or a file.
+ * Kernels of the \link aifes_basic_storage.h storage module \endlink stream the parameters tile by tile through
+ * aimath_storage_fetch(), so that models whose parameters exceed the RAM can be executed.
+ *
+ * Three access variants are available:
+ * - **Direct:** The storage is addressable by a pointer (RAM, XIP flash, mmap). aimath_storage_fetch() returns the pointer
+ *   without copying (see aimath_storage_init_direct()).
+ * - **Callback:** The storage is read with an accessor function into the tile buffer of the storage (see aimath_storage_init_callback()).
+ * - **Page-cached:** Like callback, but the data is read in aligned pages and the last page is kept in the buffer. Consecutive
+ *   small reads of the same page are served from the cache (see aimath_storage_init_paged()).
+ *
+ * A tensor located in a storage is referenced by an aimath_storage_ref_t. The data pointer of the tensor points to the reference
+ * instead of the data itself. The tensor params (e.g. the quantization parameters) stay in RAM.
+ *
+ * **Example:** Dense layer with weights in a file (see aimath_storage_posix.h):
+ * \code{.c}
+ * uint8_t page_buffer[512];
+ * aimath_storage_t storage;
+ * aimath_storage_posix_open(&storage, "weights.bin", page_buffer, sizeof(page_buffer));
+ *
+ * aimath_storage_ref_t weights_ref = {&storage, 0};
+ * aimath_storage_ref_t bias_ref = {&storage, 4 * 10 * 3};
+ * ailayer_dense_f32_t dense_layer = AILAYER_DENSE_F32_M(3, &weights_ref, &bias_ref);
+ * x = ailayer_dense_f32_storage(&dense_layer, x);
+ * \endcode
+ */
+
+#ifndef AIMATH_STORAGE
+#define AIMATH_STORAGE
+
+#include "core/aifes_math.h"
+
+typedef struct aimath_storage       aimath_storage_t;
+typedef struct aimath_storage_ref   aimath_storage_ref_t;
+
+/** @brief Accessor of a read-only parameter storage
+ *
+ * Use one of the initializer functions (aimath_storage_init_direct(), aimath_storage_init_callback(),
+ * aimath_storage_init_paged()) to configure the storage.
+ */
+struct aimath_storage {
+	const void *address;    /**< Base address for direct access (or 0 if the storage has to be read with the read function). */
+
+    /** @brief Accessor function that copies size bytes starting at offset from the storage to the buffer
+     *
+     * @param *storage  The storage
+     * @param offset    Offset in bytes from the start of the storage
+     * @param *buffer   Destination buffer in RAM
+     * @param size      Number of bytes to read
+     */
+	void (*read)(const aimath_storage_t *storage, uint32_t offset, void *buffer, uint32_t size);
+	void *handle;           /**< User data of the accessor function (e.g. a file descriptor or the address in program memory). */
+
+	uint8_t *buffer;        /**< Tile buffer (callback) or page cache (page-cached) in RAM. */
+	uint32_t buffer_size;   /**< Size of the buffer in bytes. Must be a multiple of the size of the stored data types (e.g. 4 for F32). */
+	uint8_t paged;          /**< TRUE: The buffer is used as page cache with page size buffer_size. */
+	uint32_t cached_page;   /**< Index of the page in the cache (AIMATH_STORAGE_NO_PAGE if empty). */
+};
+
+/** @brief Reference to a tensor data field in a parameter storage
+ *
+ * Set the data pointer of a tensor to this structure to use it with the storage kernels.
+ * The offset must be a multiple of the size of the data type.
+ */
+struct aimath_storage_ref {
+	aimath_storage_t *storage;  /**< The storage that holds the data. */
+	uint32_t offset;            /**< Offset of the data in bytes from the start of the storage. */
+};
+
+#define AIMATH_STORAGE_NO_PAGE  0xFFFFFFFF  /**< Marks an empty page cache */
+
+/** @brief Initialize a storage with direct access over a pointer
+ *
+ * Use this for parameters in RAM, memory mapped (XIP) flash or memory mapped files.
+ * The kernels read the data in place without copying.
+ *
+ * @param *storage  The storage to initialize
+ * @param *address  Base address of the storage
+ */
+void aimath_storage_init_direct(aimath_storage_t *storage, const void *address);
+
+/** @brief Initialize a storage with an accessor function
+ *
+ * The data is read in tiles of up to buffer_size bytes into the given buffer.
+ *
+ * @param *storage      The storage to initialize
+ * @param *read         The accessor function
+ * @param *handle       User data for the accessor function (available as storage->handle)
+ * @param *buffer       Tile buffer in RAM
+ * @param buffer_size   Size of the tile buffer in bytes (multiple of the size of the stored data types)
+ */
+void aimath_storage_init_callback(aimath_storage_t *storage,
+                                  void (*read)(const aimath_storage_t *storage, uint32_t offset, void *buffer, uint32_t size),
+                                  void *handle,
+                                  void *buffer,
+                                  uint32_t buffer_size);
+
+/** @brief Initialize a storage with an accessor function and a page cache
+ *
+ * The data is read in aligned pages of page_size bytes. The last read page stays in the cache.
+ * This is the preferred variant for block devices (e.g. SPI flash or files) and for kernels
+ * that read small parts of the same region repeatedly.
+ *
+ * @param *storage      The storage to initialize
+ * @param *read         The accessor function
+ * @param *handle       User data for the accessor function (available as storage->handle)
+ * @param *page_buffer  Page cache in RAM
+ * @param page_size     Size of a page in bytes (multiple of the size of the stored data types)
+ */
+void aimath_storage_init_paged(aimath_storage_t *storage,
+                               void (*read)(const aimath_storage_t *storage, uint32_t offset, void *buffer, uint32_t size),
+                               void *handle,
+                               void *page_buffer,
+                               uint32_t page_size);
+
+/** @brief Invalidate the page cache of a storage
+ *
+ * Call this function if the content of the storage has changed.
+ *
+ * @param *storage  The storage
+ */
+void aimath_storage_invalidate(aimath_storage_t *storage);
+
+/** @brief Get access to a part of the storage
+ *
+ * Returns a pointer to the data at the given offset. The number of bytes that are available at the pointer is
+ * written to size. It might be smaller than the requested size (limited by the tile buffer or the page end),
+ * so the kernels call this function in a loop to stream the data:
+ * \code{.c}
+ * uint32_t done = 0, size;
+ * const float *tile;
+ * while(done < total){
+ *     size = total - done;
+ *     tile = (const float *) aimath_storage_fetch(storage, offset + done, &size);
+ *     // ... process size / 4 elements of tile
+ *     done += size;
+ * }
+ * \endcode
+ *
+ * The pointer is valid until the next call of aimath_storage_fetch() on the same storage.
+ *
+ * @param *storage  The storage
+ * @param offset    Offset in bytes from the start of the storage
+ * @param *size     Requested number of bytes (input) / available number of bytes (output)
+ * @return          Pointer to the data
+ */
+const void *aimath_storage_fetch(aimath_storage_t *storage, uint32_t offset, uint32_t *size);
+
+/** @brief Copy data from the storage to RAM
+ *
+ * @param *storage  The storage
+ * @param offset    Offset in bytes from the start of the storage
+ * @param *buffer   Destination buffer in RAM
+ * @param size      Number of bytes to copy
+ */
+void aimath_storage_read(aimath_storage_t *storage, uint32_t offset, void *buffer, uint32_t size);
+
+#ifdef AIFES_WITH_AVR_PGM
+/** @brief Initialize a storage for data in the AVR program memory (PROGMEM)
+ *
+ * The data is copied with memcpy_P() into the tile buffer.
+ *
+ * @param *storage      The storage to initialize
+ * @param *pgm_address  Address of the data in program memory
+ * @param *buffer       Tile buffer in RAM
+ * @param buffer_size   Size of the tile buffer in bytes
+ */
+void aimath_storage_init_avr_pgm(aimath_storage_t *storage, const void *pgm_address, void *buffer, uint32_t buffer_size);
+#endif // AIFES_WITH_AVR_PGM
+
+#endif // AIMATH_STORAGE
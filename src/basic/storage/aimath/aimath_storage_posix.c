@@ -0,0 +1,118 @@
+/**
+ * \file basic/storage/aimath/aimath_storage_posix.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+// pread() and mmap() are not declared in strict ISO C modes (e.g. -std=c99) without a feature test macro
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "basic/storage/aimath/aimath_storage_posix.h"
+
+#ifdef AIFES_WITH_POSIX_STORAGE
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <string.h>
+
+AISTRING_STORAGE_WRAPPER(aistring_error_storage_posix_1, "[aimath_storage_posix] Unable to open the parameter file.\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_storage_posix_2, "[aimath_storage_posix] Unable to map the parameter file.\n");
+
+// The mapping size is stored in the buffer_size field (no buffer is used for direct access)
+uint8_t aimath_storage_posix_mmap(aimath_storage_t *storage, const char *path)
+{
+	int fd;
+	struct stat file_stat;
+	void *address;
+
+	fd = open(path, O_RDONLY);
+	if(fd < 0){
+        AILOG_E(aistring_error_storage_posix_1);
+        return 1;
+	}
+	if(fstat(fd, &file_stat) != 0 || file_stat.st_size == 0){
+        close(fd);
+        AILOG_E(aistring_error_storage_posix_2);
+        return 1;
+	}
+	address = mmap(0, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if(address == MAP_FAILED){
+        AILOG_E(aistring_error_storage_posix_2);
+        return 1;
+	}
+
+	aimath_storage_init_direct(storage, address);
+	storage->buffer_size = (uint32_t) file_stat.st_size;
+	return 0;
+}
+
+void aimath_storage_posix_unmap(aimath_storage_t *storage)
+{
+	if(storage->address != 0){
+        munmap((void *) storage->address, storage->buffer_size);
+        storage->address = 0;
+	}
+	return;
+}
+
+static void aimath_storage_posix_read(const aimath_storage_t *storage, uint32_t offset, void *buffer, uint32_t size)
+{
+	int fd = (int) (intptr_t) storage->handle;
+	ssize_t count;
+
+	while(size > 0){
+        count = pread(fd, buffer, size, offset);
+        if(count <= 0){
+            // Reading beyond the end of the file (e.g. the last page)
+            memset(buffer, 0, size);
+            return;
+        }
+        buffer = (uint8_t *) buffer + count;
+        offset += count;
+        size -= count;
+	}
+	return;
+}
+
+uint8_t aimath_storage_posix_open(aimath_storage_t *storage, const char *path, void *page_buffer, uint32_t page_size)
+{
+	int fd;
+
+	fd = open(path, O_RDONLY);
+	if(fd < 0){
+        AILOG_E(aistring_error_storage_posix_1);
+        return 1;
+	}
+
+	aimath_storage_init_paged(storage, aimath_storage_posix_read, (void *) (intptr_t) fd, page_buffer, page_size);
+	return 0;
+}
+
+void aimath_storage_posix_close(aimath_storage_t *storage)
+{
+	close((int) (intptr_t) storage->handle);
+	storage->read = 0;
+	return;
+}
+
+#endif // AIFES_WITH_POSIX_STORAGE
@@ -0,0 +1,74 @@
+/**
+ * \file basic/storage/aimath/aimath_storage_posix.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief File backed \link aimath_storage.h parameter storage \endlink for POSIX hosts (Linux, macOS)
+ *
+ * The parameters of a model can be stored in a binary file and executed without loading them into RAM:
+ * - aimath_storage_posix_mmap() maps the file into the address space (direct access, paged in on demand by the operating system).
+ * - aimath_storage_posix_open() reads the file with pread() through a page cache. This variant behaves like a storage
+ *   on an external flash of a microcontroller and can be used to validate the streaming kernels on the host.
+ *
+ * Available if AIFES_WITH_POSIX_STORAGE is defined (automatically on POSIX hosts, see aifes_config.h).
+ */
+
+#ifndef AIMATH_STORAGE_POSIX
+#define AIMATH_STORAGE_POSIX
+
+#include "basic/storage/aimath/aimath_storage.h"
+
+#ifdef AIFES_WITH_POSIX_STORAGE
+
+/** @brief Map a file into memory and initialize a storage with direct access
+ *
+ * Close the storage with aimath_storage_posix_unmap().
+ *
+ * @param *storage  The storage to initialize
+ * @param *path     Path of the parameter file
+ * @return          0 if successful, 1 if the file could not be mapped
+ */
+uint8_t aimath_storage_posix_mmap(aimath_storage_t *storage, const char *path);
+
+/** @brief Unmap a storage that was opened with aimath_storage_posix_mmap()
+ *
+ * @param *storage  The storage
+ */
+void aimath_storage_posix_unmap(aimath_storage_t *storage);
+
+/** @brief Open a file and initialize a page-cached storage
+ *
+ * Close the storage with aimath_storage_posix_close().
+ *
+ * @param *storage      The storage to initialize
+ * @param *path         Path of the parameter file
+ * @param *page_buffer  Page cache in RAM
+ * @param page_size     Size of a page in bytes
+ * @return              0 if successful, 1 if the file could not be opened
+ */
+uint8_t aimath_storage_posix_open(aimath_storage_t *storage, const char *path, void *page_buffer, uint32_t page_size);
+
+/** @brief Close a storage that was opened with aimath_storage_posix_open()
+ *
+ * @param *storage  The storage
+ */
+void aimath_storage_posix_close(aimath_storage_t *storage);
+
+#endif // AIFES_WITH_POSIX_STORAGE
+
+#endif // AIMATH_STORAGE_POSIX
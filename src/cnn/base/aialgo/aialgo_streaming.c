@@ -0,0 +1,430 @@
+/**
+ * \file cnn/base/aialgo/aialgo_streaming.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aialgo_streaming.h for documentation.
+ * \details
+ */
+
+#include "cnn/base/aialgo/aialgo_streaming.h"
+
+#include <string.h>
+
+AISTRING_STORAGE_WRAPPER(aistring_error_stream_1, "[aialgo_stream] Error: The input layer must have the shape [1, C, L] or [1, L, C].\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_stream_2, "[aialgo_stream] Error: The first layer after the input layer must be a Conv1D, MaxPool1D or AvgPool1D layer.\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_stream_3, "[aialgo_stream] Error: Streamed layers must not use padding.\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_stream_4, "[aialgo_stream] Error: All streamed layers must have the same channel axis.\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_stream_5, "[aialgo_schedule_stream_memory] Error: Not enough memory.\n");
+
+static uint8_t aialgo_stream_is_stateful(const ailayer_t *layer)
+{
+    return layer->layer_type == ailayer_conv1d_type
+           || layer->layer_type == ailayer_maxpool1d_type
+           || layer->layer_type == ailayer_avgpool1d_type;
+}
+
+// Layers that keep the shape (activations, batch normalization, ...) can be calculated column by column
+static uint8_t aialgo_stream_is_stateless(const ailayer_t *layer)
+{
+    uint8_t i;
+
+    if(layer->result.dim != layer->input_layer->result.dim){
+        return FALSE;
+    }
+    for(i = 0; i < layer->result.dim; i++){
+        if(layer->result.shape[i] != layer->input_layer->result.shape[i]){
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+// Read the window, stride, padding and channel axis of a stateful layer
+static void aialgo_stream_layer_config(const ailayer_t *layer, uint16_t *window, uint16_t *stride, uint16_t *padding, int8_t *channel_axis)
+{
+    if(layer->layer_type == ailayer_conv1d_type){
+        ailayer_conv1d_t *conv = (ailayer_conv1d_t *) layer->layer_configuration;
+        *window = conv->dilation * (conv->kernel_size - 1) + 1;
+        *stride = conv->stride;
+        *padding = conv->padding;
+        *channel_axis = conv->channel_axis;
+    } else if(layer->layer_type == ailayer_maxpool1d_type){
+        ailayer_maxpool1d_t *pool = (ailayer_maxpool1d_t *) layer->layer_configuration;
+        *window = pool->pool_size;
+        *stride = pool->stride;
+        *padding = pool->padding;
+        *channel_axis = pool->channel_axis;
+    } else {
+        ailayer_avgpool1d_t *pool = (ailayer_avgpool1d_t *) layer->layer_configuration;
+        *window = pool->pool_size;
+        *stride = pool->stride;
+        *padding = pool->padding;
+        *channel_axis = pool->channel_axis;
+    }
+    *channel_axis = (*channel_axis == AIFES_CHANNELS_FIRST) ? AIFES_CHANNELS_FIRST : AIFES_CHANNELS_LAST;
+}
+
+static uint16_t aialgo_stream_channels(const aitensor_t *tensor, int8_t channel_axis)
+{
+    return (channel_axis == AIFES_CHANNELS_FIRST) ? tensor->shape[1] : tensor->shape[2];
+}
+
+static uint16_t aialgo_stream_length(const aitensor_t *tensor, int8_t channel_axis)
+{
+    return (channel_axis == AIFES_CHANNELS_FIRST) ? tensor->shape[2] : tensor->shape[1];
+}
+
+/* Analyzes the model and returns the required memory size (0 on error).
+ * If memory_ptr is not 0, the stream structure is configured and the memory is distributed.
+ */
+static uint32_t aialgo_stream_distribute(aialgo_stream_t *stream, aimodel_t *model, void *memory_ptr)
+{
+    uint16_t i, layer_count = 0;
+    uint16_t window, stride, padding, channels;
+    int8_t layer_channel_axis, channel_axis = 0;
+    uint32_t address_counter = 0, frame_size, max_frame_size, max_window_size = 0;
+    ailayer_t *layer_ptr, *last_layer = 0, *tail_layer = 0;
+    aialgo_stream_layer_t *stream_layer;
+
+    layer_ptr = model->input_layer;
+    if(layer_ptr->result.dim != 3 || layer_ptr->result.shape[0] != 1){
+        AILOG_E(aistring_error_stream_1);
+        return 0;
+    }
+
+    // Find the streamed part of the model
+    for(i = 0; i < model->layer_count; i++){
+        layer_ptr->calc_result_shape(layer_ptr);
+        if(i > 0 && tail_layer == 0){
+            if(aialgo_stream_is_stateful(layer_ptr)){
+                aialgo_stream_layer_config(layer_ptr, &window, &stride, &padding, &layer_channel_axis);
+                if(padding != 0){
+                    AILOG_E(aistring_error_stream_3);
+                    return 0;
+                }
+                if(channel_axis != 0 && channel_axis != layer_channel_axis){
+                    AILOG_E(aistring_error_stream_4);
+                    return 0;
+                }
+                channel_axis = layer_channel_axis;
+                last_layer = layer_ptr;
+                layer_count++;
+            } else if(last_layer != 0 && aialgo_stream_is_stateless(layer_ptr)){
+                last_layer = layer_ptr;
+                layer_count++;
+            } else {
+                tail_layer = layer_ptr;
+            }
+        }
+        layer_ptr = layer_ptr->output_layer;
+    }
+    if(last_layer == 0){
+        AILOG_E(aistring_error_stream_2);
+        return 0;
+    }
+
+    // Memory for the layer states
+    stream_layer = (aialgo_stream_layer_t *) memory_ptr;
+    address_counter += layer_count * sizeof(aialgo_stream_layer_t);
+    AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+
+    // Memory for the ring buffers of the stateful layers
+    layer_ptr = model->input_layer->output_layer;
+    max_frame_size = aialgo_stream_channels(&model->input_layer->result, channel_axis) * model->input_layer->result.dtype->size;
+    for(i = 0; i < layer_count; i++){
+        channels = aialgo_stream_channels(&layer_ptr->input_layer->result, channel_axis);
+        frame_size = channels * layer_ptr->input_layer->result.dtype->size;
+        window = 0;
+        stride = 1;
+        if(aialgo_stream_is_stateful(layer_ptr)){
+            aialgo_stream_layer_config(layer_ptr, &window, &stride, &padding, &layer_channel_axis);
+        }
+        if(memory_ptr != 0){
+            stream_layer[i].layer = layer_ptr;
+            stream_layer[i].window = window;
+            stream_layer[i].stride = stride;
+            stream_layer[i].channels = channels;
+            stream_layer[i].ring = (window > 0) ? memory_ptr + address_counter : 0;
+        }
+        address_counter += 2 * window * frame_size;
+        AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+
+        if(window * frame_size > max_window_size) max_window_size = window * frame_size;
+        frame_size = aialgo_stream_channels(&layer_ptr->result, channel_axis) * layer_ptr->result.dtype->size;
+        if(frame_size > max_frame_size) max_frame_size = frame_size;
+
+        layer_ptr = layer_ptr->output_layer;
+    }
+
+    // Memory for the history and the linearized input of the tail
+    frame_size = aialgo_stream_channels(&last_layer->result, channel_axis) * last_layer->result.dtype->size;
+    if(memory_ptr != 0){
+        stream->model = model;
+        stream->last_layer = last_layer;
+        stream->tail_layer = tail_layer;
+        stream->channel_axis = channel_axis;
+        stream->layer_count = layer_count;
+        stream->layers = stream_layer;
+        stream->history_length = aialgo_stream_length(&last_layer->result, channel_axis);
+        stream->history_channels = aialgo_stream_channels(&last_layer->result, channel_axis);
+        stream->history = memory_ptr + address_counter;
+    }
+    address_counter += aialgo_stream_length(&last_layer->result, channel_axis) * frame_size;
+    AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+
+    if(memory_ptr != 0) stream->tail_input = memory_ptr + address_counter;
+    address_counter += aialgo_stream_length(&last_layer->result, channel_axis) * frame_size;
+    AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+
+    // Ping-pong buffers for the columns
+    for(i = 0; i < 2; i++){
+        if(memory_ptr != 0) stream->frame_buffer[i] = memory_ptr + address_counter;
+        address_counter += max_frame_size;
+        AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+    }
+
+    // The window of channels first layers has to be transposed
+    if(channel_axis == AIFES_CHANNELS_FIRST){
+        if(memory_ptr != 0) stream->window_buffer = memory_ptr + address_counter;
+        address_counter += max_window_size;
+        AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+    } else if(memory_ptr != 0){
+        stream->window_buffer = 0;
+    }
+
+    return address_counter;
+}
+
+uint32_t aialgo_sizeof_stream_memory(aimodel_t *model)
+{
+    return aialgo_stream_distribute(0, model, 0);
+}
+
+uint8_t aialgo_schedule_stream_memory(aialgo_stream_t *stream, aimodel_t *model, void *memory_ptr, uint32_t memory_size)
+{
+    uint32_t required_memory = aialgo_stream_distribute(0, model, 0);
+
+    if(required_memory == 0){
+        return 1;
+    }
+    if(required_memory > memory_size){
+        AILOG_E(aistring_error_stream_5);
+        return 1;
+    }
+    aialgo_stream_distribute(stream, model, memory_ptr);
+    aialgo_stream_reset(stream);
+    return 0;
+}
+
+void aialgo_stream_reset(aialgo_stream_t *stream)
+{
+    uint16_t i;
+
+    for(i = 0; i < stream->layer_count; i++){
+        stream->layers[i].position = 0;
+        stream->layers[i].countdown = stream->layers[i].window;
+    }
+    stream->history_position = 0;
+    stream->history_count = 0;
+
+    aialgo_set_training_mode_model(stream->model, FALSE);
+    aialgo_set_batch_mode_model(stream->model, FALSE);
+}
+
+// Calculates one output column of a stateful layer from a window of input frames (padding 0, stride 1)
+static void aialgo_stream_calc_column(aialgo_stream_layer_t *stream_layer, int8_t channel_axis, void *window_data, void *output_data)
+{
+    ailayer_t *layer = stream_layer->layer;
+    uint16_t output_channels = aialgo_stream_channels(&layer->result, channel_axis);
+    uint16_t window_shape[3], output_shape[3];
+    aitensor_t window = {
+        .dtype = layer->input_layer->result.dtype,
+        .dim = 3,
+        .shape = window_shape,
+        .tensor_params = layer->input_layer->result.tensor_params,
+        .data = window_data
+    };
+    aitensor_t output = {
+        .dtype = layer->result.dtype,
+        .dim = 3,
+        .shape = output_shape,
+        .tensor_params = layer->result.tensor_params,
+        .data = output_data
+    };
+
+    window_shape[0] = 1;
+    output_shape[0] = 1;
+    if(channel_axis == AIFES_CHANNELS_FIRST){
+        window_shape[1] = stream_layer->channels;
+        window_shape[2] = stream_layer->window;
+        output_shape[1] = output_channels;
+        output_shape[2] = 1;
+    } else {
+        window_shape[1] = stream_layer->window;
+        window_shape[2] = stream_layer->channels;
+        output_shape[1] = 1;
+        output_shape[2] = output_channels;
+    }
+
+    if(layer->layer_type == ailayer_conv1d_type){
+        ailayer_conv1d_t *conv = (ailayer_conv1d_t *) layer->layer_configuration;
+        conv->conv1d_fwd(&window, 1, conv->dilation, 0, &conv->weights, &conv->bias, conv->channel_axis, 0, &output);
+    } else if(layer->layer_type == ailayer_maxpool1d_type){
+        ailayer_maxpool1d_t *pool = (ailayer_maxpool1d_t *) layer->layer_configuration;
+        pool->maxpool1d_fwd(&window, pool->pool_size, 1, 0, pool->channel_axis, 0, 0, &output);
+    } else {
+        ailayer_avgpool1d_t *pool = (ailayer_avgpool1d_t *) layer->layer_configuration;
+        pool->avgpool1d_fwd(&window, pool->pool_size, 1, 0, pool->channel_axis, 0, &output);
+    }
+}
+
+// Runs the forward function of a shape preserving layer on a single column
+static void aialgo_stream_forward_column(aialgo_stream_layer_t *stream_layer, int8_t channel_axis, void *input_data, void *output_data)
+{
+    ailayer_t *layer = stream_layer->layer;
+    aitensor_t input_backup = layer->input_layer->result;
+    aitensor_t result_backup = layer->result;
+    uint16_t column_shape[3];
+
+    column_shape[0] = 1;
+    column_shape[1] = (channel_axis == AIFES_CHANNELS_FIRST) ? stream_layer->channels : 1;
+    column_shape[2] = (channel_axis == AIFES_CHANNELS_FIRST) ? 1 : stream_layer->channels;
+
+    layer->input_layer->result.shape = column_shape;
+    layer->input_layer->result.data = input_data;
+    layer->result.shape = column_shape;
+    layer->result.data = output_data;
+
+    layer->forward(layer);
+
+    // Some layers (e.g. reshape) only set the result pointer to the input data
+    if(layer->result.data != output_data){
+        memcpy(output_data, layer->result.data, stream_layer->channels * layer->result.dtype->size);
+    }
+
+    layer->input_layer->result = input_backup;
+    layer->result = result_backup;
+}
+
+uint8_t aialgo_stream_push_sample(aialgo_stream_t *stream, const aitensor_t *sample)
+{
+    uint16_t i, k, c;
+    uint8_t current = 0;
+    uint32_t frame_size, element_size;
+    aialgo_stream_layer_t *stream_layer;
+    void *window_data;
+
+    memcpy(stream->frame_buffer[0], sample->data, aimath_sizeof_tensor_data(sample));
+
+    for(i = 0; i < stream->layer_count; i++){
+        stream_layer = &stream->layers[i];
+
+        if(stream_layer->window == 0){
+            aialgo_stream_forward_column(stream_layer, stream->channel_axis, stream->frame_buffer[current], stream->frame_buffer[!current]);
+        } else {
+            element_size = stream_layer->layer->input_layer->result.dtype->size;
+            frame_size = stream_layer->channels * element_size;
+
+            // Every frame is stored twice, so the window [position, position + window) is always contiguous
+            memcpy(stream_layer->ring + stream_layer->position * frame_size, stream->frame_buffer[current], frame_size);
+            memcpy(stream_layer->ring + (stream_layer->position + stream_layer->window) * frame_size, stream->frame_buffer[current], frame_size);
+            stream_layer->position = (stream_layer->position + 1) % stream_layer->window;
+
+            stream_layer->countdown--;
+            if(stream_layer->countdown > 0){
+                // No new output column in this step
+                return 0;
+            }
+            stream_layer->countdown = stream_layer->stride;
+
+            window_data = stream_layer->ring + stream_layer->position * frame_size;
+            if(stream->channel_axis == AIFES_CHANNELS_FIRST){
+                // [L, C] -> [C, L]
+                for(k = 0; k < stream_layer->window; k++){
+                    for(c = 0; c < stream_layer->channels; c++){
+                        memcpy(stream->window_buffer + ((uint32_t) c * stream_layer->window + k) * element_size,
+                               window_data + ((uint32_t) k * stream_layer->channels + c) * element_size,
+                               element_size);
+                    }
+                }
+                window_data = stream->window_buffer;
+            }
+            aialgo_stream_calc_column(stream_layer, stream->channel_axis, window_data, stream->frame_buffer[!current]);
+        }
+        current = !current;
+    }
+
+    frame_size = stream->history_channels * stream->last_layer->result.dtype->size;
+    memcpy(stream->history + stream->history_position * frame_size, stream->frame_buffer[current], frame_size);
+    stream->history_position = (stream->history_position + 1) % stream->history_length;
+    if(stream->history_count < stream->history_length){
+        stream->history_count++;
+    }
+
+    return stream->history_count == stream->history_length;
+}
+
+uint8_t aialgo_stream_update_outputs(aialgo_stream_t *stream, aitensor_t *output_data)
+{
+    uint16_t i, k, c;
+    uint32_t element_size = stream->last_layer->result.dtype->size;
+    uint32_t frame_size = stream->history_channels * element_size;
+    uint16_t length = stream->history_length;
+    uint16_t position = stream->history_position;
+    ailayer_t *layer_ptr;
+    aitensor_t *output_batch;
+    void *last_result_data;
+
+    if(stream->history_count < length){
+        return 1;
+    }
+
+    // Linearize the history, the oldest column is at the current position
+    if(stream->channel_axis == AIFES_CHANNELS_FIRST){
+        for(k = 0; k < length; k++){
+            for(c = 0; c < stream->history_channels; c++){
+                memcpy(stream->tail_input + ((uint32_t) c * length + k) * element_size,
+                       stream->history + ((uint32_t) ((position + k) % length) * stream->history_channels + c) * element_size,
+                       element_size);
+            }
+        }
+    } else {
+        memcpy(stream->tail_input, stream->history + position * frame_size, (length - position) * frame_size);
+        memcpy(stream->tail_input + (length - position) * frame_size, stream->history, position * frame_size);
+    }
+
+    // Calculate the tail on the whole window
+    last_result_data = stream->last_layer->result.data;
+    stream->last_layer->result.data = stream->tail_input;
+    output_batch = &stream->last_layer->result;
+    layer_ptr = stream->tail_layer;
+    for(i = 0; layer_ptr != 0 && i < stream->model->layer_count; i++){
+        layer_ptr->forward(layer_ptr);
+        output_batch = &layer_ptr->result;
+        if(layer_ptr == stream->model->output_layer){
+            break;
+        }
+        layer_ptr = layer_ptr->output_layer;
+    }
+
+    memcpy(output_data->data, output_batch->data, aimath_sizeof_tensor_data(output_batch));
+    if(output_batch->dtype->tensor_params_size != 0){
+        memcpy(output_data->tensor_params, output_batch->tensor_params, output_batch->dtype->tensor_params_size);
+    }
+    stream->last_layer->result.data = last_result_data;
+
+    return 0;
+}
@@ -0,0 +1,163 @@
+/**
+ * \file cnn/base/aialgo/aialgo_streaming.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Functions for stateful streaming inference of sliding-window time-series models
+ * \details Sliding-window models (for example gesture recognition on IMU data) are usually re-run on the whole window
+ * every time a new sample arrives, although most of the intermediate results only shift by one step.
+ * The streaming mode keeps a ring buffer of the last input frames for every Conv1D, MaxPool1D and AvgPool1D layer
+ * and only calculates the new output columns of these layers when a new sample is pushed.
+ *
+ * The model is split into two parts:
+ * - The <b>streamed part</b> starts directly after the input layer and consists of Conv1D, MaxPool1D and AvgPool1D layers
+ *   (stateful) and layers that do not change the shape of their input like activations or batch normalization (stateless).
+ *   These layers are calculated column by column in aialgo_stream_push_sample().
+ * - The <b>tail</b> consists of all layers starting with the first layer that can not be streamed (for example Flatten and Dense).
+ *   The output columns of the streamed part are collected in a history buffer that has the length of the full window,
+ *   and the tail is calculated on this history in aialgo_stream_update_outputs().
+ *
+ * The stateful layers must not use padding (causal / valid convolution), because the padding at the end of the window
+ * would depend on future samples. With a total stride of 1 in the streamed part, the result of aialgo_stream_update_outputs()
+ * equals the result of aialgo_inference_model() on the last window of samples. With a total stride \f$ S > 1 \f$,
+ * this holds for every \f$ S \f$-th window.
+ *
+ * Example:
+ * \code{.c}
+ * // Model is compiled and the parameter and inference memory is scheduled
+ * aialgo_stream_t stream;
+ *
+ * uint32_t stream_memory_size = aialgo_sizeof_stream_memory(&model);
+ * void *stream_memory = malloc(stream_memory_size);
+ * aialgo_schedule_stream_memory(&stream, &model, stream_memory, stream_memory_size);
+ *
+ * uint16_t sample_shape[2] = {1, 6}; // One IMU sample with 6 channels
+ * float sample_data[6];
+ * aitensor_t sample_tensor = AITENSOR_2D_F32(sample_shape, sample_data);
+ *
+ * while(1){
+ *     read_imu(sample_data);
+ *     if(aialgo_stream_push_sample(&stream, &sample_tensor)){
+ *         aialgo_stream_update_outputs(&stream, &output_tensor);
+ *     }
+ * }
+ * \endcode
+ */
+
+#ifndef AIALGO_STREAMING
+#define AIALGO_STREAMING
+
+#include "core/aifes_core.h"
+#include "core/aifes_math.h"
+#include "basic/base/aimath/aimath_basic.h"
+#include "basic/base/aialgo/aialgo_sequential_inference.h"
+#include "cnn/base/ailayer/ailayer_conv1d.h"
+#include "cnn/base/ailayer/ailayer_maxpool1d.h"
+#include "cnn/base/ailayer/ailayer_avgpool1d.h"
+
+typedef struct aialgo_stream_layer aialgo_stream_layer_t;
+typedef struct aialgo_stream aialgo_stream_t;
+
+/** @brief Streaming state of a single layer in the streamed part of the model
+ *
+ * The structure is created and managed by aialgo_schedule_stream_memory().
+ */
+struct aialgo_stream_layer {
+    ailayer_t *layer;   /**< The layer in the model. */
+    uint16_t window;    /**< Number of input frames needed for one output column (0 for stateless layers). */
+    uint16_t stride;    /**< Number of input frames between two output columns. */
+    uint16_t channels;  /**< Number of channels of an input frame. */
+    uint16_t position;  /**< Position of the oldest frame in the ring buffer. */
+    uint16_t countdown; /**< Number of input frames that are missing until the next output column is calculated. */
+    void *ring;         /**< Ring buffer with the last input frames. Every frame is stored twice (at position and position + window), so that the window is always contiguous in memory. */
+};
+
+/** @brief Streaming state of a model
+ *
+ * The structure is configured by aialgo_schedule_stream_memory().
+ */
+struct aialgo_stream {
+    aimodel_t *model;               /**< The streamed model. */
+    ailayer_t *last_layer;          /**< The last layer of the streamed part. */
+    ailayer_t *tail_layer;          /**< The first layer of the tail (0 if the whole model is streamed). */
+
+    int8_t channel_axis;            /**< The channel axis of the streamed layers (1 for channels first and -1 for channels last). */
+
+    uint16_t layer_count;           /**< Number of layers in the streamed part. */
+    aialgo_stream_layer_t *layers;  /**< States of the layers in the streamed part. */
+
+    uint16_t history_length;        /**< Number of output columns of the streamed part that are used as input for the tail (window length). */
+    uint16_t history_channels;      /**< Number of channels of the output columns of the streamed part. */
+    uint16_t history_position;      /**< Position of the oldest column in the history ring buffer. */
+    uint16_t history_count;         /**< Number of columns in the history ring buffer (saturates at history_length). */
+    void *history;                  /**< Ring buffer with the last output columns of the streamed part. */
+    void *tail_input;               /**< Buffer for the linearized history, used as input for the tail. */
+
+    void *frame_buffer[2];          /**< Ping-pong buffers for the columns that are passed through the streamed part. */
+    void *window_buffer;            /**< Buffer to reorder the window of a channels first layer. */
+};
+
+/** @brief Calculate the memory requirements for the streaming state of a model
+ *
+ * The model must be compiled and the inference memory must be scheduled.
+ *
+ * Use aialgo_schedule_stream_memory() to set the memory to the stream.
+ *
+ * @param *model The model
+ * @return       Required memory size in bytes (0 if the model can not be streamed)
+ */
+uint32_t aialgo_sizeof_stream_memory(aimodel_t *model);
+
+/** @brief Assign the memory for the streaming state to the stream and reset the state
+ *
+ * The required memory size can be calculated with aialgo_sizeof_stream_memory()
+ *
+ * @param *stream        The stream structure to configure
+ * @param *model         The model
+ * @param *memory_ptr    Pointer to the memory block
+ * @param memory_size    Size of the memory block (for error checking)
+ * @return               0 if successful
+ */
+uint8_t aialgo_schedule_stream_memory(aialgo_stream_t *stream, aimodel_t *model, void *memory_ptr, uint32_t memory_size);
+
+/** @brief Clear the ring buffers of the stream
+ *
+ * After a reset, the stream needs a full window of samples until aialgo_stream_update_outputs() can calculate a new result.
+ *
+ * @param *stream The stream
+ */
+void aialgo_stream_reset(aialgo_stream_t *stream);
+
+/** @brief Push a new sample into the stream and calculate the new output columns of the streamed part
+ *
+ * @param *stream       The stream
+ * @param *sample       One sample with the data type of the input layer and one value per input channel (for example with shape [1, C])
+ * @return              1 if a new result can be calculated with aialgo_stream_update_outputs(), 0 otherwise
+ */
+uint8_t aialgo_stream_push_sample(aialgo_stream_t *stream, const aitensor_t *sample);
+
+/** @brief Calculate the model output on the current window
+ *
+ * Only the tail of the model is calculated, the streamed part was already calculated in aialgo_stream_push_sample().
+ *
+ * @param *stream       The stream
+ * @param *output_data  Tensor to store the output of the model
+ * @return              0 if successful, 1 if the stream has not seen a full window yet
+ */
+uint8_t aialgo_stream_update_outputs(aialgo_stream_t *stream, aitensor_t *output_data);
+
+#endif // AIALGO_STREAMING
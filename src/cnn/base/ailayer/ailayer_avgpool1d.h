@@ -0,0 +1,196 @@
+/**
+ * \file cnn/base/ailayer/ailayer_avgpool1d.h
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ *
+ * \brief Base \link ailayer layer \endlink implementation of the AvgPool1D layer
+ *
+ * This is an "abstract" data-type independent implementation. To use the layer use one of the provided
+ * implementations for a specific hardware and data-type (for example from ailayer_avgpool1d_default.h) or set
+ * the required math functions on your own.
+ *
+ * The AvgPool1D layer (or 1D Average-Pooling layer) is used to compress the length of sequential activations,
+ * by taking the mean of the activation values within a small window along the time axis.
+ * The padded values are zero and are included in the mean.
+ *
+ * When the channel axis equals 1 (channels first), the shapes of input and output are
+ * \f$ [N,C,L_{in}] \f$ and \f$ [N,C,L_{out}] \f$, respectively.
+ *
+ * When the channel axis equals -1 or 2 (channels last), the shapes of input and output are
+ * \f$ [N,L_{in},C] \f$ and \f$ [N,L_{out},C] \f$, respectively.
+ *
+ * N is the batch size.
+ *
+ * The results of the forward pass of this layer are written to the result tensor of the base ailayer_t struct.
+ */
+
+#ifndef AILAYER_AVGPOOL1D_H
+#define AILAYER_AVGPOOL1D_H
+
+#include "core/aifes_core.h"
+
+#define AIFES_CHANNELS_FIRST    1
+#define AIFES_CHANNELS_LAST     -1
+
+typedef struct ailayer_avgpool1d 	ailayer_avgpool1d_t;
+
+/** @brief General \link ailayer_avgpool1d.h layer \endlink structure
+*
+*/
+struct ailayer_avgpool1d {
+	ailayer_t base; /**< Inherited field members from general ailayer struct. */
+
+	/** @name Layer configuration
+	 * @brief Required configuration parameters for the layer
+	 *
+	 * These fields have to be configured by the user before calling the initializer function.
+	 */
+	///@{
+	// Values (configurable)
+	uint16_t pool_size; /**< Size of the pooling kernel (\f$ L_{pool} \f$).*/
+	uint16_t stride;    /**< The stride (\f$ S \f$). */
+	uint16_t padding;   /**< The (symmetric) zero padding (\f$ P, \; 0 \leq P < L_{pool} \f$). */
+
+	int8_t channel_axis; /**< Index of the channel axis (1 for channels first and -1 or 2 for channels last). */
+	///@}
+
+	/** @name Math functions
+	 * @brief Required data type specific math functions
+	 */
+	///@{
+
+	/** @brief Required math function: 1D Average-Pooling
+	 *
+	 * Requires a math function that calculates the mean of a kernel window.
+     *
+     * @param input             Input data with dimension \f$ [N,C,L_{in}] \f$ (channels first) or \f$ [N,L_{in},C] \f$ (channels last)
+     * @param pool_size         The size of the pooling window
+     * @param stride            The stride
+     * @param padding           The (symmetric) zero padding
+     * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 2 for channels last).
+     * @param workspace         Pointer to a work space buffer for intermediate results.
+	 * @param output            Output after average-pooling with dimension \f$ [N,C,L_{out}] \f$ (channels first) or \f$ [N,L_{out},C] \f$ (channels last)
+     */
+	void (*avgpool1d_fwd)(
+                          const aitensor_t *input,
+                          uint16_t pool_size,
+                          uint16_t stride,
+                          uint16_t padding,
+                          int8_t channel_axis,
+                          void *work_space,
+                          aitensor_t *output
+                          );
+
+	/** @brief Required math function: Gradients of 1D Average-Pooling with respect to the input
+	 *
+	 * Requires a math function that calculates the gradients with respect to the input \f$ delta_{in} = \mathrm{d} L / \mathrm{d} x_{in} \f$.
+	 *
+	 * Every output gradient is distributed in equal shares to the inputs of its pooling window.
+	 *
+     * @param delta_out         Gradients backpropagated from the following layer with dimension \f$ [N,C,L_{out}] \f$ (channels first) or \f$ [N,L_{out},C] \f$ (channels last)
+     * @param pool_size         The size of the pooling window
+     * @param stride            The stride
+     * @param padding           The (symmetric) zero padding
+     * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 2 for channels last).
+     * @param workspace         Pointer to a work space buffer for intermediate results.
+	 * @param delta_in          Resulting input gradients for backpropagation to the previous layer \f$ [N,C,L_{in}] \f$ (channels first) or \f$ [N,L_{in},C] \f$ (channels last)
+     */
+    void (*avgpool1d_bwd)(
+                          const aitensor_t *delta_out,
+                          uint16_t pool_size,
+                          uint16_t stride,
+                          uint16_t padding,
+                          int8_t channel_axis,
+                          void *work_space,
+                          aitensor_t *delta_in
+                          );
+    ///@}
+
+	uint16_t result_shape[3]; /**< The shape of the result. */
+};
+
+/** @brief AvgPool1D layer type
+ *
+ * Defines the type of the layer (for example for type checks and debug prints).
+ * See aicore_layertype for more information about the layer type.
+ */
+extern const aicore_layertype_t *ailayer_avgpool1d_type;
+
+/** @brief Initialize and connect the given AvgPool1D layer
+ *
+ * This function represents the "constructor" of the abstract AvgPool1D layer. It initializes the layer structure
+ * and connects it to the previous layer.\n
+ * This function is not intended to call it directly. Instead use one of the data type specific implementations
+ * (like for example ailayer_avgpool1d_f32_default()).
+ *
+ * @param *layer        The layer to initialize.
+ * @param *input_layer  The previous layer that provides the inputs to the layer.
+ * @return  Pointer to the (successfully) initialized general layer structure (ailayer_avgpool1d.base)
+ */
+ailayer_t *ailayer_avgpool1d(ailayer_avgpool1d_t *layer, ailayer_t *input_layer);
+
+/** @brief Calculate the forward pass for given AvgPool1D layer
+ *
+ * *Implementation of ailayer.forward.*
+ *
+ * It uses the result tensor of the previous layer as input and writes the result of the forward pass
+ * to the result tensor (ailayer.result) of the given layer.
+ *
+ * Used math functions:
+ * * ailayer_avgpool1d.avgpool1d_fwd
+ *
+ * @param *self Layer to calculate the forward path for.
+ */
+void ailayer_avgpool1d_forward(ailayer_t *self);
+
+/** @brief Calculate the backward pass for given AvgPool1D layer
+ *
+ * *Implementation of ailayer.backward.*
+ *
+ * It uses the deltas tensor of the next layer as input and writes the result of the backward pass
+ * to the deltas tensor (ailayer.deltas) of the given layer.
+ *
+ * Used math functions:
+ * * ailayer_avgpool1d.avgpool1d_bwd
+ *
+ * @param *self Layer to calculate the backward path for.
+ */
+void ailayer_avgpool1d_backward(ailayer_t *self);
+
+/** @brief Calculate the shape of the result tensor (ailayer.result)
+ *
+ * *Implementation of ailayer.calc_result_shape.*
+ *
+ * Resulting shape is \f$ [N,C,L_{out}] \f$ (channels first) or \f$ [N,L_{out},C] \f$ (channels last) with\n
+ *
+ * @f[
+ *  L_{out} = floor \left( \frac{L_{in} + 2 * P - L_{pool}}{S} \right) + 1
+ * @f]
+ *
+ * @param *self Layer to calculate the resulting shape for.
+ */
+void ailayer_avgpool1d_calc_result_shape(ailayer_t *self);
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+/** @brief Print the layer specification
+ *
+ * @param *self     The layer to print the specification for
+ */
+void ailayer_avgpool1d_print_specs(const ailayer_t *self);
+#endif // AIDEBUG_PRINT_MODULE_SPECS
+
+#endif // AILAYER_AVGPOOL1D_H
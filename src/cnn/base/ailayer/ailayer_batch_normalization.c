@@ -27,11 +27,12 @@ AISTRING_STORAGE_WRAPPER(aistring_layer_batch_norm, "Batch Normalization");
 const aicore_layertype_t ailayer_batch_norm_type_s = {
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
     .name = aistring_layer_batch_norm,
-	.print_specs = ailayer_batch_norm_print_specs
+	.print_specs = ailayer_batch_norm_print_specs,
 #else
     .name = 0,
-    .print_specs = 0
+    .print_specs = 0,
 #endif
+    .count_macs = ailayer_batch_norm_count_macs
 };
 const aicore_layertype_t *ailayer_batch_norm_type = &ailayer_batch_norm_type_s;
 
@@ -113,7 +114,12 @@ void ailayer_batch_norm_forward(ailayer_t *self)
 
 	if(AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_TRAINING_MODE)){
         // In training mode
-        if(AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_BATCH_MODE)){
+        if(layer->batch_norm_train != 0){
+            // Fused statistics, moving averages and normalization
+            layer->batch_norm_train(x_in, layer->channel_axis,
+                                    AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_BATCH_MODE),
+                                    momentum, eps, means, variances, moving_means, moving_variances, betas, gammas, x_out);
+        } else if(AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_BATCH_MODE)){
             // For batch mode (a whole batch is processed at once) with sufficiently large batches.
             layer->empirical_mean_channelwise(x_in, layer->channel_axis, means);
             layer->exponential_moving_average(means, momentum, moving_means);
@@ -164,6 +170,10 @@ void ailayer_batch_norm_backward(ailayer_t *self)
         variances = &(layer->moving_variances);
     }
 
+    if(AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_NO_INPUT_GRADIENT)){
+        delta_in = 0;
+    }
+
 	if(AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)){
         layer->d_batch_norm(x_in,
                             layer->channel_axis,
@@ -377,6 +387,12 @@ void ailayer_batch_norm_set_trainmem(ailayer_t *self, void *memory_ptr)
 	return;
 }
 
+uint32_t ailayer_batch_norm_count_macs(const ailayer_t *self)
+{
+    // One scale and shift per element
+    return aimath_tensor_elements(&self->result);
+}
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_batch_norm_1, "momentum: ");
 AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_batch_norm_2, ", eps: ");
@@ -213,6 +213,38 @@ struct ailayer_batch_norm {
                          aitensor_t *d_betas,
                          aitensor_t *d_gammas);
 
+	/** @brief Optional math function: Fused Batch Normalization for the training
+	 *
+	 * If set, this function replaces the separate calls of empirical_mean_channelwise(), empirical_variance_channelwise(),
+	 * exponential_moving_average() and batch_norm() in the training mode.
+	 * It calculates the statistics, updates the moving averages and normalizes the input with fewer passes over the data.
+     *
+     * @param x                 Input tensor.
+     * @param channel_axis      Axis of the input tensor that stores the channel dimension.
+     * @param batch_mode        Normalize with the batch statistics (1) or with the moving statistics (0, single sample mode).
+     * @param momentum          Momentum for the moving averages.
+     * @param eps               Small constant for numerical stability.
+     * @param means             Resulting vector with the means (\f$ \mu_i \f$) of every channel.
+     * @param variances         Resulting vector with the variances (\f$ \sigma^2_i \f$) of every channel.
+     * @param moving_means      Moving averages of the means (updated).
+     * @param moving_variances  Moving averages of the variances (updated).
+     * @param offsets           Vector with the offset parameters (\f$ \beta_i \f$) of every channel.
+     * @param scales            Vector with the scaling parameters (\f$ \gamma_i \f$) of every channel.
+     * @param result            The resulting normalized tensor.
+	 */
+	void (*batch_norm_train)(const aitensor_t *x,
+                             int8_t channel_axis,
+                             uint8_t batch_mode,
+                             const void *momentum,
+                             const void *eps,
+                             aitensor_t *means,
+                             aitensor_t *variances,
+                             aitensor_t *moving_means,
+                             aitensor_t *moving_variances,
+                             const aitensor_t *offsets,
+                             const aitensor_t *scales,
+                             aitensor_t *result);
+
 	///@}
 };
 
@@ -352,6 +384,17 @@ uint32_t ailayer_batch_norm_sizeof_trainmem(const ailayer_t *self);
  */
 void ailayer_batch_norm_set_trainmem(ailayer_t *self, void *memory_ptr);
 
+/** @brief Count the multiply-accumulate operations of one forward pass
+ *
+ * Counts one multiply-accumulate operation (scale and shift) per element of the result.
+ *
+ * *Implementation of aicore_layertype.count_macs.*
+ *
+ * @param *self     The layer
+ * @return          Number of multiply-accumulate operations
+ */
+uint32_t ailayer_batch_norm_count_macs(const ailayer_t *self);
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 /** @brief Print the layer specification
  *
@@ -27,11 +27,12 @@ AISTRING_STORAGE_WRAPPER(aistring_layer_conv2d, "Conv2D");
 const aicore_layertype_t ailayer_conv2d_type_s = {
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
     .name = aistring_layer_conv2d,
-	.print_specs = ailayer_conv2d_print_specs
+	.print_specs = ailayer_conv2d_print_specs,
 #else
     .name = 0,
-    .print_specs = 0
+    .print_specs = 0,
 #endif
+    .count_macs = ailayer_conv2d_count_macs
 };
 const aicore_layertype_t *ailayer_conv2d_type = &ailayer_conv2d_type_s;
 
@@ -140,41 +141,45 @@ void ailayer_conv2d_backward(ailayer_t *self)
 	aitensor_t temp_result;
 	temp_result.data = self->tempmem;
 
-    // Calculate d_weights
-    // d_w = x_in * delta_out
-    temp_result.dim             = 4;
-    temp_result.shape           = d_weights->shape;
-    temp_result.dtype           = d_weights->dtype;
-    temp_result.tensor_params   = d_weights->tensor_params;
-    layer->conv2d_bwd(x_in,
-                      layer->stride,
-                      layer->dilation,
-                      layer->padding,
-                      delta_out,
-                      layer->channel_axis,
-                      0,
-                      &temp_result);
-    layer->tensor_add(d_weights, &temp_result, d_weights);
-
-    // Calculate d_bias
-	// for all f: b_f = sum_hw{dy_fhw}
-    temp_result.dim             = 1;
-    temp_result.shape           = d_bias->shape;
-    temp_result.dtype           = d_bias->dtype;
-    temp_result.tensor_params   = d_bias->tensor_params;
-	layer->sum_channelwise(delta_out, layer->channel_axis, &temp_result);
-    layer->tensor_add(d_bias, &temp_result, d_bias);
-
-    // Calculate delta_in
-    // delta_in = delta_out * w'    <- Full convolution (180 rotated kernel and zero padding)
-    layer->conv2d_bwd_full(delta_out,
-                           layer->stride,
-                           layer->dilation,
-                           layer->padding,
-                           weights,
-                           layer->channel_axis,
-                           0,
-                           delta_in);
+    if(AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)){
+        // Calculate d_weights
+        // d_w = x_in * delta_out
+        temp_result.dim             = 4;
+        temp_result.shape           = d_weights->shape;
+        temp_result.dtype           = d_weights->dtype;
+        temp_result.tensor_params   = d_weights->tensor_params;
+        layer->conv2d_bwd(x_in,
+                          layer->stride,
+                          layer->dilation,
+                          layer->padding,
+                          delta_out,
+                          layer->channel_axis,
+                          0,
+                          &temp_result);
+        layer->tensor_add(d_weights, &temp_result, d_weights);
+
+        // Calculate d_bias
+        // for all f: b_f = sum_hw{dy_fhw}
+        temp_result.dim             = 1;
+        temp_result.shape           = d_bias->shape;
+        temp_result.dtype           = d_bias->dtype;
+        temp_result.tensor_params   = d_bias->tensor_params;
+        layer->sum_channelwise(delta_out, layer->channel_axis, &temp_result);
+        layer->tensor_add(d_bias, &temp_result, d_bias);
+    }
+
+    if(!AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_NO_INPUT_GRADIENT)){
+        // Calculate delta_in
+        // delta_in = delta_out * w'    <- Full convolution (180 rotated kernel and zero padding)
+        layer->conv2d_bwd_full(delta_out,
+                               layer->stride,
+                               layer->dilation,
+                               layer->padding,
+                               weights,
+                               layer->channel_axis,
+                               0,
+                               delta_in);
+    }
 
 	return;
 }
@@ -286,6 +291,11 @@ uint32_t ailayer_conv2d_sizeof_trainmem(const ailayer_t *self)
 	uint32_t memory = 0;
 	ailayer_conv2d_t *layer = (ailayer_conv2d_t *)(self->layer_configuration);
 
+	if(!AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)){
+        // No gradients are needed for frozen parameters
+        return 0;
+	}
+
 	// Weights
 	memory += sizeof(aitensor_t);
 	memory += aimath_sizeof_tensor_data(&layer->weights);
@@ -306,6 +316,13 @@ void ailayer_conv2d_set_trainmem(ailayer_t *self, void *memory_ptr)
 	uint32_t address_counter = 0;
 	ailayer_conv2d_t *layer = (ailayer_conv2d_t *) (self->layer_configuration);
 
+	if(!AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)){
+        // No gradients are needed for frozen parameters
+        self->gradients[0] = 0;
+        self->gradients[1] = 0;
+        return;
+	}
+
 	// Weights gradients in gradients[0]
 	self->gradients[0] = memory_ptr;
 	address_counter += sizeof(aitensor_t);
@@ -334,6 +351,14 @@ void ailayer_conv2d_set_trainmem(ailayer_t *self, void *memory_ptr)
 	return;
 }
 
+uint32_t ailayer_conv2d_count_macs(const ailayer_t *self)
+{
+    ailayer_conv2d_t *layer = (ailayer_conv2d_t *)(self->layer_configuration);
+
+    // Every output element is the dot product of one kernel with a window of the input
+    return aimath_tensor_elements(&self->result) * (aimath_tensor_elements(&layer->weights) / layer->filter_count);
+}
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_conv2d_1, "filter_count: ");
 AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_conv2d_2, "; kernel_size: (");
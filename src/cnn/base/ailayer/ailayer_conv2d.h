@@ -358,6 +358,17 @@ uint32_t ailayer_conv2d_sizeof_trainmem(const ailayer_t *self);
  */
 void ailayer_conv2d_set_trainmem(ailayer_t *self, void *memory_ptr);
 
+/** @brief Count the multiply-accumulate operations of one forward pass
+ *
+ * Counts the multiply-accumulate operations of the convolution (\f$ N \cdot H_{out} \cdot W_{out} \cdot C_{out} \cdot C_{in} \cdot H_{kernel} \cdot W_{kernel} \f$).
+ *
+ * *Implementation of aicore_layertype.count_macs.*
+ *
+ * @param *self     The layer
+ * @return          Number of multiply-accumulate operations
+ */
+uint32_t ailayer_conv2d_count_macs(const ailayer_t *self);
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 /** @brief Print the layer specification
  *
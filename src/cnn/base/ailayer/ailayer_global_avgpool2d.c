@@ -0,0 +1,129 @@
+/**
+ * \file cnn/base/ailayer/ailayer_global_avgpool2d.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief
+ * \details
+ */
+
+#include "cnn/base/ailayer/ailayer_global_avgpool2d.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+
+AISTRING_STORAGE_WRAPPER(aistring_layer_global_avgpool2d, "GlobalAvgPool2D");
+
+const aicore_layertype_t ailayer_global_avgpool2d_type_s = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_layer_global_avgpool2d,
+	.print_specs = ailayer_global_avgpool2d_print_specs
+#else
+    .name = 0,
+    .print_specs = 0
+#endif
+};
+const aicore_layertype_t *ailayer_global_avgpool2d_type = &ailayer_global_avgpool2d_type_s;
+
+
+AISTRING_STORAGE_WRAPPER(aistring_error_global_avgpool2d_1, "[ailayer_global_avgpool2d] Channel axis must be either 1 (-3) or 3 (-1).\n");
+
+ailayer_t *ailayer_global_avgpool2d(ailayer_global_avgpool2d_t *layer, ailayer_t *input_layer)
+{
+    layer->base.layer_type = ailayer_global_avgpool2d_type;
+
+    #ifdef AIDEBUG_GENERAL_CHECKS
+    if(layer->channel_axis != 1 && layer->channel_axis != -3 && layer->channel_axis != 3 && layer->channel_axis != -1){
+        AILOG_E(aistring_error_global_avgpool2d_1);
+    }
+    #endif
+
+    layer->base.settings = 0;
+
+    // Set base params of layer
+	layer->base.input_layer = input_layer;
+    layer->base.output_layer = 0;
+	input_layer->output_layer = &(layer->base);
+
+	layer->base.layer_configuration = layer;
+	layer->base.result.dim = 2;
+	layer->base.result.shape = layer->result_shape;
+
+	layer->base.deltas.dim = 4;
+	layer->base.deltas.shape = input_layer->result.shape;
+
+	// Set forward and backward function pointers
+	layer->base.forward = ailayer_global_avgpool2d_forward;
+	layer->base.backward = ailayer_global_avgpool2d_backward;
+
+	// Set additional function pointers
+	layer->base.calc_result_shape = ailayer_global_avgpool2d_calc_result_shape;
+	layer->base.sizeof_paramem = 0;
+	layer->base.set_paramem = 0;
+	layer->base.sizeof_trainmem = 0;
+	layer->base.set_trainmem = 0;
+	layer->base.sizeof_fwdmem = 0;
+	layer->base.sizeof_bwdmem = 0;
+
+	layer->base.trainable_params_count = 0;
+
+	ailayer_global_avgpool2d_calc_result_shape(&layer->base);
+
+	return &layer->base;
+}
+
+void ailayer_global_avgpool2d_forward(ailayer_t *self)
+{
+	ailayer_global_avgpool2d_t *layer = (ailayer_global_avgpool2d_t *)(self->layer_configuration);
+	aitensor_t *x_in = &(self->input_layer->result);
+	aitensor_t *x_out = &(self->result);
+
+    layer->global_avgpool2d_fwd(x_in, layer->channel_axis, self->tempmem, x_out);
+	return;
+}
+
+void ailayer_global_avgpool2d_backward(ailayer_t *self)
+{
+	ailayer_global_avgpool2d_t *layer = (ailayer_global_avgpool2d_t *)(self->layer_configuration);
+    aitensor_t *delta_in = &(self->deltas); // Ouput of backward function is stored here
+	aitensor_t *delta_out = &(self->output_layer->deltas); // Input to backward function
+
+    layer->global_avgpool2d_bwd(delta_out, layer->channel_axis, delta_in);
+    return;
+}
+
+void ailayer_global_avgpool2d_calc_result_shape(ailayer_t *self)
+{
+	ailayer_global_avgpool2d_t *layer = (ailayer_global_avgpool2d_t *)(self->layer_configuration);
+
+    uint8_t channel_uaxis = layer->channel_axis < 0 ? 4 + layer->channel_axis : layer->channel_axis; // Negative axis = indexing from the end
+
+	self->result.shape[0] = self->input_layer->result.shape[0];             // N
+	self->result.shape[1] = self->input_layer->result.shape[channel_uaxis]; // C
+
+	return;
+}
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_global_avgpool2d_1, "channel_axis: ");
+
+void ailayer_global_avgpool2d_print_specs(const ailayer_t *self)
+{
+    ailayer_global_avgpool2d_t *layer = (ailayer_global_avgpool2d_t *)(self->layer_configuration);
+
+    AIPRINT(aistring_print_layer_specs_global_avgpool2d_1);
+    AIPRINT_LONG_INT("%ld", (long int) layer->channel_axis);
+}
+#endif
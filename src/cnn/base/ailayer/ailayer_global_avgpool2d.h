@@ -0,0 +1,163 @@
+/**
+ * \file cnn/base/ailayer/ailayer_global_avgpool2d.h
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Base \link ailayer layer \endlink implementation of the GlobalAvgPool2D layer
+ *
+ * This is an "abstract" data-type independent implementation. To use the layer use one of the provided
+ * implementations for a specific hardware and data-type (for example from ailayer_global_avgpool2d_default.h) or set
+ * the required math functions on your own.
+ *
+ * The GlobalAvgPool2D layer (or 2D Global Average-Pooling layer) reduces every channel of a feature map to its mean value:
+ * @f[
+ *  y_{n,c} = \frac{1}{H \cdot W} \sum_{h,w} x_{n,c,h,w}
+ * @f]
+ *
+ * It is typically used at the end of a CNN instead of a Flatten layer. As the output size equals the number of channels
+ * (independent of the spatial dimensions), the following Dense layer gets much smaller.
+ *
+ * When the channel axis equals 1 (channels first), the shape of the input is \f$ [N,C,H,W] \f$.\n
+ * When the channel axis equals -1 or 3 (channels last), the shape of the input is \f$ [N,H,W,C] \f$.\n
+ * The shape of the output is \f$ [N,C] \f$ for both cases.
+ *
+ * N is the batch size.
+ *
+ * The results of the forward pass of this layer are written to the result tensor of the base ailayer_t struct.
+ */
+
+#ifndef AILAYER_GLOBAL_AVGPOOL2D_H
+#define AILAYER_GLOBAL_AVGPOOL2D_H
+
+#include "core/aifes_core.h"
+
+#define AIFES_CHANNELS_FIRST    1
+#define AIFES_CHANNELS_LAST     -1
+
+typedef struct ailayer_global_avgpool2d 	ailayer_global_avgpool2d_t;
+
+/** @brief General \link ailayer_global_avgpool2d.h layer \endlink structure
+*
+*/
+struct ailayer_global_avgpool2d {
+	ailayer_t base; /**< Inherited field members from general ailayer struct. */
+
+	/** @name Layer configuration
+	 * @brief Required configuration parameters for the layer
+	 *
+	 * These fields have to be configured by the user before calling the initializer function.
+	 */
+	///@{
+	int8_t channel_axis; /**< Index of the channel axis (1 for channels first and -1 or 3 for channels last). */
+	///@}
+
+	/** @name Math functions
+	 * @brief Required data type specific math functions
+	 */
+	///@{
+
+	/** @brief Required math function: 2D Global Average-Pooling
+	 *
+	 * Requires a math function that calculates the mean over the spatial dimensions of every channel.
+     *
+     * @param input             Input data with dimension \f$ [N,C,H,W] \f$ (channels first) or \f$ [N,H,W,C] \f$ (channels last)
+     * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 3 for channels last).
+     * @param work_space        Pointer to a work space buffer for intermediate results (size given by ailayer.sizeof_fwdmem)
+	 * @param output            Output with dimension \f$ [N,C] \f$
+     */
+	void (*global_avgpool2d_fwd)(const aitensor_t *input, int8_t channel_axis, void *work_space, aitensor_t *output);
+
+	/** @brief Required math function: Gradients of 2D Global Average-Pooling with respect to the input
+	 *
+	 * Requires a math function that calculates the gradients with respect to the input \f$ delta_{in} = \mathrm{d} L / \mathrm{d} x_{in} \f$.
+	 *
+     * @param delta_out         Gradients backpropagated from the following layer with dimension \f$ [N,C] \f$
+     * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 3 for channels last).
+	 * @param delta_in          Resulting input gradients for backpropagation to the previous layer \f$ [N,C,H,W] \f$ (channels first) or \f$ [N,H,W,C] \f$ (channels last)
+     */
+    void (*global_avgpool2d_bwd)(const aitensor_t *delta_out, int8_t channel_axis, aitensor_t *delta_in);
+    ///@}
+
+	uint16_t result_shape[2]; /**< The shape of the result. */
+};
+
+/** @brief GlobalAvgPool2D layer type
+ *
+ * Defines the type of the layer (for example for type checks and debug prints).
+ * See aicore_layertype for more information about the layer type.
+ */
+extern const aicore_layertype_t *ailayer_global_avgpool2d_type;
+
+/** @brief Initialize and connect the given GlobalAvgPool2D layer
+ *
+ * This function represents the "constructor" of the abstract GlobalAvgPool2D layer. It initializes the layer structure
+ * and connects it to the previous layer.\n
+ * This function is not intended to call it directly. Instead use one of the data type specific implementations
+ * (like for example ailayer_global_avgpool2d_f32_default()).
+ *
+ * @param *layer        The layer to initialize.
+ * @param *input_layer  The previous layer that provides the inputs to the layer.
+ * @return  Pointer to the (successfully) initialized general layer structure (ailayer_global_avgpool2d.base)
+ */
+ailayer_t *ailayer_global_avgpool2d(ailayer_global_avgpool2d_t *layer, ailayer_t *input_layer);
+
+/** @brief Calculate the forward pass for given GlobalAvgPool2D layer
+ *
+ * *Implementation of ailayer.forward.*
+ *
+ * It uses the result tensor of the previous layer as input and writes the result of the forward pass
+ * to the result tensor (ailayer.result) of the given layer.
+ *
+ * Used math functions:
+ * * ailayer_global_avgpool2d.global_avgpool2d_fwd
+ *
+ * @param *self Layer to calculate the forward path for.
+ */
+void ailayer_global_avgpool2d_forward(ailayer_t *self);
+
+/** @brief Calculate the backward pass for given GlobalAvgPool2D layer
+ *
+ * *Implementation of ailayer.backward.*
+ *
+ * It uses the deltas tensor of the next layer as input and writes the result of the backward pass
+ * to the deltas tensor (ailayer.deltas) of the given layer.
+ *
+ * Used math functions:
+ * * ailayer_global_avgpool2d.global_avgpool2d_bwd
+ *
+ * @param *self Layer to calculate the backward path for.
+ */
+void ailayer_global_avgpool2d_backward(ailayer_t *self);
+
+/** @brief Calculate the shape of the result tensor (ailayer.result)
+ *
+ * *Implementation of ailayer.calc_result_shape.*
+ *
+ * Resulting shape is \f$ [N,C] \f$.
+ *
+ * @param *self Layer to calculate the resulting shape for.
+ */
+void ailayer_global_avgpool2d_calc_result_shape(ailayer_t *self);
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+/** @brief Print the layer specification
+ *
+ * @param *self     The layer to print the specification for
+ */
+void ailayer_global_avgpool2d_print_specs(const ailayer_t *self);
+#endif // AIDEBUG_PRINT_MODULE_SPECS
+
+#endif // AILAYER_GLOBAL_AVGPOOL2D_H
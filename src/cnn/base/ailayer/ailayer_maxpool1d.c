@@ -0,0 +1,192 @@
+/**
+ * \file cnn/base/ailayer/ailayer_maxpool1d.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief
+ * \details
+ */
+
+#include "cnn/base/ailayer/ailayer_maxpool1d.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+
+AISTRING_STORAGE_WRAPPER(aistring_layer_maxpool1d, "MaxPool1D");
+
+const aicore_layertype_t ailayer_maxpool1d_type_s = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_layer_maxpool1d,
+	.print_specs = ailayer_maxpool1d_print_specs
+#else
+    .name = 0,
+    .print_specs = 0
+#endif
+};
+const aicore_layertype_t *ailayer_maxpool1d_type = &ailayer_maxpool1d_type_s;
+
+
+AISTRING_STORAGE_WRAPPER(aistring_error_maxpool1d_1, "[ailayer_maxpool1d] Padding must be smaller than pool_size.\n");
+AISTRING_STORAGE_WRAPPER(aistring_error_maxpool1d_2, "[ailayer_maxpool1d] Channel axis must be either 1 (-2) or 2 (-1).\n");
+
+ailayer_t *ailayer_maxpool1d(ailayer_maxpool1d_t *layer, ailayer_t *input_layer)
+{
+    layer->base.layer_type = ailayer_maxpool1d_type;
+
+    #ifdef AIDEBUG_GENERAL_CHECKS
+    if(layer->padding >= layer->pool_size)
+    {
+        AILOG_E(aistring_error_maxpool1d_1);
+        return 0;
+    }
+    if(layer->channel_axis != 1 && layer->channel_axis != -2 && layer->channel_axis != 2 && layer->channel_axis != -1){
+        AILOG_E(aistring_error_maxpool1d_2);
+    }
+    #endif
+
+    layer->base.settings = 0;
+
+    // Set base params of layer
+	layer->base.input_layer = input_layer;
+    layer->base.output_layer = 0;
+	input_layer->output_layer = &(layer->base);
+
+	layer->base.layer_configuration = layer;
+	layer->base.result.dim = 3;
+	layer->base.result.shape = layer->result_shape;
+
+	layer->base.deltas.dim = 3;
+	layer->base.deltas.shape = input_layer->result.shape;
+	// Set max locations to NULL, to be able to check, if max_locations has to
+	// be populated during forward path
+	layer->max_locations = NULL;
+
+	// Set forward and backward function pointers
+	layer->base.forward = ailayer_maxpool1d_forward;
+	layer->base.backward = ailayer_maxpool1d_backward;
+
+	// Set additional function pointers
+	layer->base.calc_result_shape = ailayer_maxpool1d_calc_result_shape;
+	layer->base.sizeof_paramem = 0;
+	layer->base.set_paramem = 0;
+	layer->base.sizeof_trainmem = ailayer_maxpool1d_sizeof_trainmem;
+	layer->base.set_trainmem = ailayer_maxpool1d_set_trainmem;
+	layer->base.sizeof_fwdmem = 0;
+	layer->base.sizeof_bwdmem = 0;
+
+	layer->base.trainable_params_count = 0;
+
+	ailayer_maxpool1d_calc_result_shape(&layer->base);
+
+	return &layer->base;
+}
+
+void ailayer_maxpool1d_forward(ailayer_t *self)
+{
+	ailayer_maxpool1d_t *layer = (ailayer_maxpool1d_t *)(self->layer_configuration);
+	aitensor_t *x_in = &(self->input_layer->result);
+	aitensor_t *x_out = &(self->result);
+
+    // Max locations are only stored in training mode (needed for the backward pass)
+    layer->maxpool1d_fwd(x_in,
+                         layer->pool_size,
+                         layer->stride,
+                         layer->padding,
+                         layer->channel_axis,
+                         NULL,
+                         AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_TRAINING_MODE) ? layer->max_locations : NULL,
+                         x_out
+                         );
+	return;
+}
+
+void ailayer_maxpool1d_backward(ailayer_t *self)
+{
+	ailayer_maxpool1d_t *layer = (ailayer_maxpool1d_t *)(self->layer_configuration);
+    aitensor_t *delta_in = &(self->deltas); // Ouput of backward function is stored here
+	aitensor_t *delta_out = &(self->output_layer->deltas); // Input to backward function
+
+    layer->maxpool1d_bwd(delta_out,
+                         layer->pool_size,
+                         layer->stride,
+                         layer->padding,
+                         layer->channel_axis,
+                         NULL,
+                         layer->max_locations,
+                         delta_in
+                         );
+    return;
+}
+
+void ailayer_maxpool1d_calc_result_shape(ailayer_t *self)
+{
+	ailayer_maxpool1d_t *layer = (ailayer_maxpool1d_t *)(self->layer_configuration);
+
+	uint16_t s = layer->stride;
+	uint16_t k = layer->pool_size;
+    int16_t p = layer->padding;
+
+    uint8_t channel_uaxis = layer->channel_axis < 0 ? 3 + layer->channel_axis : layer->channel_axis; // Negative axis = indexing from the end
+
+	if(channel_uaxis == 1){ // Channels first
+        self->result.shape[0] = self->input_layer->result.shape[0]; // N
+        self->result.shape[1] = self->input_layer->result.shape[1]; // C_OUT
+        self->result.shape[2] = (self->input_layer->result.shape[2] + 2 * p - k) / s + 1;    // L
+	} else if(channel_uaxis == 2){ // Channels last
+        self->result.shape[0] = self->input_layer->result.shape[0]; // N
+        self->result.shape[1] = (self->input_layer->result.shape[1] + 2 * p - k) / s + 1;    // L
+        self->result.shape[2] = self->input_layer->result.shape[2]; // C_OUT
+	} else {
+        // Error
+        return;
+	}
+
+	return;
+}
+
+uint32_t ailayer_maxpool1d_sizeof_trainmem(const ailayer_t *self)
+{
+	// Memory for the max_locations
+	return sizeof(uint32_t) * self->result.shape[0] * self->result.shape[1] * self->result.shape[2];
+}
+
+void ailayer_maxpool1d_set_trainmem(ailayer_t *self, void *memory_ptr)
+{
+	ailayer_maxpool1d_t *layer = (ailayer_maxpool1d_t *) (self->layer_configuration);
+	layer->max_locations = memory_ptr;
+
+    return;
+}
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_maxpool1d_1, "pool_size: ");
+AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_maxpool1d_2, "; stride: ");
+AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_maxpool1d_3, "; padding: ");
+AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_maxpool1d_4, "; channel_axis: ");
+
+void ailayer_maxpool1d_print_specs(const ailayer_t *self)
+{
+    ailayer_maxpool1d_t *layer = (ailayer_maxpool1d_t *)(self->layer_configuration);
+
+    AIPRINT(aistring_print_layer_specs_maxpool1d_1);
+    AIPRINT_LONG_INT("%ld", (long int) layer->pool_size);
+    AIPRINT(aistring_print_layer_specs_maxpool1d_2);
+    AIPRINT_LONG_INT("%ld", (long int) layer->stride);
+    AIPRINT(aistring_print_layer_specs_maxpool1d_3);
+    AIPRINT_LONG_INT("%ld", (long int) layer->padding);
+    AIPRINT(aistring_print_layer_specs_maxpool1d_4);
+    AIPRINT_LONG_INT("%ld", (long int) layer->channel_axis);
+}
+#endif
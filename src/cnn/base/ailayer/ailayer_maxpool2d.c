@@ -183,10 +183,17 @@ void ailayer_maxpool2d_calc_result_shape(ailayer_t *self)
 
 uint32_t ailayer_maxpool2d_sizeof_trainmem(const ailayer_t *self)
 {
+	ailayer_maxpool2d_t *layer = (ailayer_maxpool2d_t *) (self->layer_configuration);
 	uint32_t memory = 0;
+	uint32_t elements = (uint32_t) self->result.shape[0] * self->result.shape[1]  * self->result.shape[2] * self->result.shape[3];
 
 	// Memory for the max_locations.
-	memory += sizeof(uint32_t) * self->result.shape[0] * self->result.shape[1]  * self->result.shape[2] * self->result.shape[3];
+	if(layer->max_location_bits == 0 || layer->max_location_bits == 32){
+        memory += sizeof(uint32_t) * elements;
+	} else {
+	    // Packed max locations (max_location_bits bytes per 8 elements)
+        memory += ((elements + 7) / 8) * layer->max_location_bits;
+	}
 
 	return memory;
 }
@@ -205,6 +212,7 @@ AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_maxpool2d_2, "); stride: (")
 AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_maxpool2d_3, "); padding: (");
 AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_maxpool2d_4, "); channel_axis: ");
 AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_maxpool2d_5, ", ");
+AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_maxpool2d_6, "; fused_relu: ");
 
 void ailayer_maxpool2d_print_specs(const ailayer_t *self)
 {
@@ -227,6 +235,9 @@ void ailayer_maxpool2d_print_specs(const ailayer_t *self)
 
     AIPRINT(aistring_print_layer_specs_maxpool2d_4);
     AIPRINT_LONG_INT("%ld", (long int) layer->channel_axis);
+
+    AIPRINT(aistring_print_layer_specs_maxpool2d_6);
+    AIPRINT_LONG_INT("%ld", (long int) layer->fused_relu);
 }
 #endif
 
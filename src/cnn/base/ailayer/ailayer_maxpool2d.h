@@ -63,6 +63,7 @@ struct ailayer_maxpool2d {
 	uint16_t padding[2]; /**< The (symmetric) minus infinity padding in the direction of height and width (\f$ [P_{h}, P_{w}], \; 0 \leq P_h < H_{pool}, 0 \leq P_w < W_{pool}  \f$). */// Must be 0 >= padding < pool_size; -inf padding
 
 	int8_t channel_axis; /**< Index of the channel axis (1 for channels first and -1 or 3 for channels last). */
+	uint8_t fused_relu; /**< Apply a ReLU activation on the pooled result (\f$ max(relu(x)) = relu(max(x)) \f$). Requires an implementation with fused kernels (0 = disabled). */
 	///@}
 
 	/** @name Training parameters
@@ -71,6 +72,7 @@ struct ailayer_maxpool2d {
 	///@{
 	// Values (autogenerated)
 	uint32_t *max_locations;    /**< Pointer to memory section where the indices of the maximum values per pooling window are stored. */
+	uint8_t max_location_bits;  /**< Number of bits per stored max location (set by the implementation). 0 or 32: One uint32_t per output element; Smaller values: Packed storage with that many bytes per 8 output elements. */
 
     void *optimem[2];   /**< Memory field used by the optimizer for training. */
 	///@}
@@ -207,7 +209,7 @@ void ailayer_maxpool2d_calc_result_shape(ailayer_t *self);
  *
  * *Implementation of ailayer.sizeof_trainmem.*
  *
- * The memory size is calculated for storage of the max_locations.
+ * The memory size is calculated for storage of the max_locations. It depends on ailayer_maxpool2d.max_location_bits.
  *
  * @param *self The layer to calculate the gradient memory size for.
  * @return  Calculated gradient memory size in bytes.
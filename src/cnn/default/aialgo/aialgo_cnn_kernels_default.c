@@ -0,0 +1,108 @@
+/**
+ * \file cnn/default/aialgo/aialgo_cnn_kernels_default.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+#include "cnn/default/aialgo/aialgo_cnn_kernels_default.h"
+
+uint8_t aialgo_kernel_is_conv2d_f32(const ailayer_t *layer)
+{
+    const ailayer_conv2d_t *conv2d;
+
+    if(layer->layer_type != ailayer_conv2d_type || layer->result.dtype != aif32){
+        return FALSE;
+    }
+    conv2d = (const ailayer_conv2d_t *) layer->layer_configuration;
+
+    return conv2d->conv2d_fwd == aimath_f32_default_conv2d_fwd
+           || conv2d->conv2d_fwd == aimath_f32_default_conv2d_fwd_hwc
+           || conv2d->conv2d_fwd == aimath_f32_default_pointwise_conv2d_fwd;
+}
+
+static uint8_t is_applicable_conv2d_fwd_hwc_f32_default(const ailayer_t *layer)
+{
+    const ailayer_conv2d_t *conv2d = (const ailayer_conv2d_t *) layer->layer_configuration;
+
+    return aialgo_kernel_is_conv2d_f32(layer)
+           && (conv2d->channel_axis == AIFES_CHANNELS_LAST || conv2d->channel_axis == 3);
+}
+
+static uint8_t is_applicable_conv2d_fwd_pointwise_f32_default(const ailayer_t *layer)
+{
+    const ailayer_conv2d_t *conv2d = (const ailayer_conv2d_t *) layer->layer_configuration;
+
+    return aialgo_kernel_is_conv2d_f32(layer)
+           && conv2d->kernel_size[0] == 1 && conv2d->kernel_size[1] == 1
+           && conv2d->stride[0] == 1 && conv2d->stride[1] == 1
+           && conv2d->padding[0] == 0 && conv2d->padding[1] == 0;
+}
+
+static void install_conv2d_fwd_f32_default(ailayer_t *layer)
+{
+    ((ailayer_conv2d_t *) layer->layer_configuration)->conv2d_fwd = aimath_f32_default_conv2d_fwd;
+}
+
+static void install_conv2d_fwd_hwc_f32_default(ailayer_t *layer)
+{
+    ((ailayer_conv2d_t *) layer->layer_configuration)->conv2d_fwd = aimath_f32_default_conv2d_fwd_hwc;
+}
+
+static void install_conv2d_fwd_pointwise_f32_default(ailayer_t *layer)
+{
+    ((ailayer_conv2d_t *) layer->layer_configuration)->conv2d_fwd = aimath_f32_default_pointwise_conv2d_fwd;
+}
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+AISTRING_STORAGE_WRAPPER(aistring_kernel_conv2d_fwd_f32_default, "Conv2D direct F32 default");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_conv2d_fwd_hwc_f32_default, "Conv2D HWC F32 default");
+AISTRING_STORAGE_WRAPPER(aistring_kernel_conv2d_fwd_pointwise_f32_default, "Conv2D pointwise GEMM F32 default");
+#endif
+
+const aialgo_kernel_t aialgo_kernel_conv2d_fwd_f32_default = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_conv2d_fwd_f32_default,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_CONV2D_FWD_F32_DEFAULT,
+    .is_applicable = aialgo_kernel_is_conv2d_f32,
+    .install = install_conv2d_fwd_f32_default
+};
+
+const aialgo_kernel_t aialgo_kernel_conv2d_fwd_hwc_f32_default = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_conv2d_fwd_hwc_f32_default,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_CONV2D_FWD_HWC_F32_DEFAULT,
+    .is_applicable = is_applicable_conv2d_fwd_hwc_f32_default,
+    .install = install_conv2d_fwd_hwc_f32_default
+};
+
+const aialgo_kernel_t aialgo_kernel_conv2d_fwd_pointwise_f32_default = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_kernel_conv2d_fwd_pointwise_f32_default,
+#else
+    .name = 0,
+#endif
+    .id = AIALGO_KERNEL_ID_CONV2D_FWD_POINTWISE_F32_DEFAULT,
+    .is_applicable = is_applicable_conv2d_fwd_pointwise_f32_default,
+    .install = install_conv2d_fwd_pointwise_f32_default
+};
@@ -0,0 +1,65 @@
+/**
+ * \file cnn/default/aialgo/aialgo_cnn_kernels_default.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Default kernel candidates of the cnn module for the kernel auto-tuner
+ * \details The kernels can be collected in an aialgo_kernel_registry_t and tuned with aialgo_tune_kernels_model().
+ * For more information refer to aialgo_kernel_tuning.h.
+ */
+
+#ifndef AIALGO_CNN_KERNELS_DEFAULT
+#define AIALGO_CNN_KERNELS_DEFAULT
+
+#include "basic/base/aialgo/aialgo_kernel_tuning.h"
+#include "cnn/base/ailayer/ailayer_conv2d.h"
+#include "cnn/default/aimath/aimath_cnn_f32_default.h"
+
+#define AIALGO_KERNEL_ID_CONV2D_FWD_F32_DEFAULT              0x0201 /**< Id of aialgo_kernel_conv2d_fwd_f32_default */
+#define AIALGO_KERNEL_ID_CONV2D_FWD_HWC_F32_DEFAULT          0x0202 /**< Id of aialgo_kernel_conv2d_fwd_hwc_f32_default */
+#define AIALGO_KERNEL_ID_CONV2D_FWD_POINTWISE_F32_DEFAULT    0x0203 /**< Id of aialgo_kernel_conv2d_fwd_pointwise_f32_default */
+
+/** @brief Conv2D layer (F32) with the direct convolution aimath_f32_default_conv2d_fwd()
+ *
+ * Applicable to all \link aimath_f32.h F32 \endlink Conv2D layers created with ailayer_conv2d_f32_default() (channels first and channels last).
+ */
+extern const aialgo_kernel_t aialgo_kernel_conv2d_fwd_f32_default;
+
+/** @brief Conv2D layer (F32) with the channels last kernel aimath_f32_default_conv2d_fwd_hwc()
+ *
+ * Applicable to \link aimath_f32.h F32 \endlink Conv2D layers created with ailayer_conv2d_f32_default() in channels last layout.
+ */
+extern const aialgo_kernel_t aialgo_kernel_conv2d_fwd_hwc_f32_default;
+
+/** @brief Conv2D layer (F32) with the GEMM based kernel aimath_f32_default_pointwise_conv2d_fwd()
+ *
+ * Applicable to \link aimath_f32.h F32 \endlink Conv2D layers created with ailayer_conv2d_f32_default()
+ * with a kernel size of 1x1, a stride of 1 and no padding.
+ */
+extern const aialgo_kernel_t aialgo_kernel_conv2d_fwd_pointwise_f32_default;
+
+/** @brief Checks if the layer is a \link aimath_f32.h F32 \endlink Conv2D layer created with ailayer_conv2d_f32_default()
+ *
+ * The data layout is determined from the forward kernel that is currently installed in the layer.
+ * Can be used in the capability predicates of own Conv2D layer kernels.
+ *
+ * @param *layer    The layer
+ * @return          TRUE if the layer is a F32 Conv2D layer with a default forward kernel, FALSE otherwise
+ */
+uint8_t aialgo_kernel_is_conv2d_f32(const ailayer_t *layer);
+
+#endif // AIALGO_CNN_KERNELS_DEFAULT
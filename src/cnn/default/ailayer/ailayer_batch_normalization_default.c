@@ -42,6 +42,7 @@ ailayer_t *ailayer_batch_norm_f32_default(ailayer_batch_norm_f32_t *layer, ailay
 	layer->base.batch_norm = aimath_f32_default_batch_norm;
 	layer->base.d_batch_norm = aimath_f32_default_d_batch_norm;
 	layer->base.exponential_moving_average = aimath_f32_default_exponential_moving_average;
+	layer->base.batch_norm_train = aimath_f32_default_batch_norm_train;
 
 	return ailayer_batch_norm(&layer->base, input_layer);
 }
@@ -0,0 +1,166 @@
+/**
+ * \file cnn/default/ailayer/ailayer_conv1d_default.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief
+ * \details
+ */
+
+#include "cnn/default/ailayer/ailayer_conv1d_default.h"
+
+// For auto initializer function
+#include "basic/base/ailayer/ailayer_relu.h"
+#include "basic/base/ailayer/ailayer_leaky_relu.h"
+#include "basic/base/ailayer/ailayer_elu.h"
+
+ailayer_t *ailayer_conv1d_f32_default(ailayer_conv1d_f32_t *layer, ailayer_t *input_layer)
+{
+	layer->base.result.dtype = aif32;
+	layer->base.deltas.dtype = aif32;
+	layer->weights.dtype = aif32;
+	layer->bias.dtype = aif32;
+
+	layer->base.calc_result_tensor_params = 0;
+	layer->base.init_params = ailayer_conv1d_init_params_f32_default;
+
+    layer->conv1d_fwd = aimath_f32_default_conv1d_fwd;
+    layer->conv1d_bwd = aimath_f32_default_conv1d_bwd;
+    layer->conv1d_bwd_full = aimath_f32_default_conv1d_bwd_full;
+    layer->tensor_add = aimath_f32_default_tensor_add;
+    layer->sum_channelwise = aimath_f32_default_sum_channelwise;
+
+    return ailayer_conv1d(layer, input_layer);
+}
+
+ailayer_t *ailayer_conv1d_cfirst_f32_default(ailayer_conv1d_f32_t *layer, ailayer_t *input_layer)
+{
+    layer->channel_axis = AIFES_CHANNELS_FIRST;
+    return ailayer_conv1d_f32_default(layer, input_layer);
+}
+
+ailayer_t *ailayer_conv1d_cl_f32_default(ailayer_conv1d_f32_t *layer, ailayer_t *input_layer)
+{
+    layer->channel_axis = AIFES_CHANNELS_FIRST;
+    return ailayer_conv1d_f32_default(layer, input_layer);
+}
+
+ailayer_t *ailayer_conv1d_clast_f32_default(ailayer_conv1d_f32_t *layer, ailayer_t *input_layer)
+{
+    layer->channel_axis = AIFES_CHANNELS_LAST;
+    return ailayer_conv1d_f32_default(layer, input_layer);
+}
+
+ailayer_t *ailayer_conv1d_lc_f32_default(ailayer_conv1d_f32_t *layer, ailayer_t *input_layer)
+{
+    layer->channel_axis = AIFES_CHANNELS_LAST;
+    return ailayer_conv1d_f32_default(layer, input_layer);
+}
+
+ailayer_t *ailayer_conv1d_q7_default(ailayer_conv1d_q7_t *layer, ailayer_t *input_layer)
+{
+    ailayer_t *return_layer;
+
+	layer->base.result.dtype = aiq7;
+	layer->base.deltas.dtype = aiq7;
+	layer->weights.dtype = aiq7;
+	layer->bias.dtype = aiq7;
+
+	// The result tensor params have to be calibrated
+	layer->base.calc_result_tensor_params = 0;
+	layer->base.init_params = 0;
+
+    layer->conv1d_fwd = aimath_q7_default_conv1d_fwd;
+    layer->conv1d_bwd = 0;
+    layer->conv1d_bwd_full = 0;
+    layer->tensor_add = 0;
+    layer->sum_channelwise = 0;
+
+    return_layer = ailayer_conv1d(layer, input_layer);
+
+	// backward
+	// Not supported for q7
+	return_layer->backward = 0;
+
+	return return_layer;
+}
+
+ailayer_t *ailayer_conv1d_cl_q7_default(ailayer_conv1d_q7_t *layer, ailayer_t *input_layer)
+{
+    layer->channel_axis = AIFES_CHANNELS_FIRST;
+    return ailayer_conv1d_q7_default(layer, input_layer);
+}
+
+ailayer_t *ailayer_conv1d_lc_q7_default(ailayer_conv1d_q7_t *layer, ailayer_t *input_layer)
+{
+    layer->channel_axis = AIFES_CHANNELS_LAST;
+    return ailayer_conv1d_q7_default(layer, input_layer);
+}
+
+ailayer_t *ailayer_conv1d_q7_fused_input_default(ailayer_conv1d_q7_t *layer, ailayer_t *input_layer)
+{
+    ailayer_t *return_layer = ailayer_conv1d_q7_default(layer, input_layer);
+
+    // The input layer holds raw data in the format of its aimath_q7_source_params_t
+    AILAYER_SETTINGS_SET(input_layer->settings, 0b1, AILAYER_SETTINGS_SOURCE_INPUT, TRUE);
+    // Quantize the raw input samples on the fly
+    layer->conv1d_fwd = aimath_q7_default_conv1d_fused_input_fwd;
+
+    return return_layer;
+}
+
+ailayer_t *ailayer_conv1d_cl_q7_fused_input_default(ailayer_conv1d_q7_t *layer, ailayer_t *input_layer)
+{
+    layer->channel_axis = AIFES_CHANNELS_FIRST;
+    return ailayer_conv1d_q7_fused_input_default(layer, input_layer);
+}
+
+ailayer_t *ailayer_conv1d_lc_q7_fused_input_default(ailayer_conv1d_q7_t *layer, ailayer_t *input_layer)
+{
+    layer->channel_axis = AIFES_CHANNELS_LAST;
+    return ailayer_conv1d_q7_fused_input_default(layer, input_layer);
+}
+
+void ailayer_conv1d_init_params_f32_default(ailayer_t *self)
+{
+	ailayer_conv1d_t *layer = (ailayer_conv1d_t *) (self->layer_configuration);
+	// The input channel axis of the weights matches the channel axis of the data ([F,C,K] or [F,K,C])
+	int8_t cin_axis = layer->channel_axis;
+	int8_t cout_axis = 0;
+
+	// Initialize weights and biases based on the activation function
+	// Recommended:
+	// Activation function				| Weights-init	| Bias-init
+	// --------------------------------------------------------------
+	// None, tanh, logistic, softmax	| Glorot		| Zeros
+	// ReLu and variants				| He			| Zeros
+	// SELU								| LeCun			| Zeros
+	if(self->output_layer != 0){
+        if(self->output_layer->layer_type == ailayer_relu_type
+           || self->output_layer->layer_type == ailayer_leaky_relu_type
+           || self->output_layer->layer_type == ailayer_elu_type){
+            aimath_f32_default_init_he_uniform_cdim(&layer->weights, cout_axis);
+        } else {
+            aimath_f32_default_init_glorot_uniform_cdim(&layer->weights, cin_axis, cout_axis);
+        }
+	} else {
+        aimath_f32_default_init_glorot_uniform_cdim(&layer->weights, cin_axis, cout_axis);
+	}
+
+	aimath_f32_default_init_zeros(&layer->bias);
+
+	return;
+}
@@ -0,0 +1,270 @@
+/**
+ * \file cnn/default/ailayer/ailayer_conv1d_default.h
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Default implementation of the \link ailayer_conv1d.h Conv1D layer \endlink
+ *
+ * Hardware independent implementations of the Conv1D layer in \link aimath_f32.h F32 \endlink and
+ * \link aimath_q7.h Q7 \endlink data-type.
+ * For more information about the Conv1D layer refer to ailayer_conv1d.h.
+ */
+
+#ifndef AILAYER_CONV1D_DEFAULT
+#define AILAYER_CONV1D_DEFAULT
+
+#include "cnn/base/ailayer/ailayer_conv1d.h"
+
+#include "cnn/default/aimath/aimath_cnn_f32_default.h"
+#include "cnn/default/aimath/aimath_cnn_q7_default.h"
+#include "basic/default/aimath/aimath_f32_default.h"
+
+#define AILAYER_CONV1D_F32_M(filters, kernel_size, stride, dilation, padding, weights, bias) \
+            {{0,},filters,kernel_size,stride,dilation,padding,0,{0,0,0,0,(float *) weights},{0,0,0,0,(float *) bias}}
+#define AILAYER_CONV1D_F32_A(filters, kernel_size, stride, dilation, padding) \
+            {{0,},filters,kernel_size,stride,dilation,padding,0,{0,0,0,0,0},{0,0,0,0,0}}
+#define AILAYER_CONV1D_Q7_M(filters, kernel_size, stride, dilation, padding, weights, weights_qparams, bias, bias_qparams, result_qparams) \
+            {{0,0,0,0,0,0,0,{0,0,0,result_qparams,0}},filters,kernel_size,stride,dilation,padding,0,{0,0,0,weights_qparams,(int8_t *) weights},{0,0,0,bias_qparams,(int8_t *) bias}}
+#define AILAYER_CONV1D_Q7_A(filters, kernel_size, stride, dilation, padding) \
+            {{0,},filters,kernel_size,stride,dilation,padding,0,{0,0,0,0,0},{0,0,0,0,0}}
+
+typedef struct ailayer_conv1d   ailayer_conv1d_f32_t;
+typedef struct ailayer_conv1d   ailayer_conv1d_q7_t;
+
+/// @brief Initializes and connect a \link ailayer_conv1d.h Conv1D layer \endlink with the \link aimath_f32.h F32 \endlink default implementation
+///
+/// **Example:** Create the layer structure with pretrained weights (channels last, 2 filters, 2 input channels, kernel size 3):\n
+/// In C:
+/// \code{.c}
+/// // Use constant data only for inference. For training remove the const qualifier!!
+/// const float kernel_data_conv1d[] = {0.0f, -0.1f,   0.1f, 0.2f,   -0.2f, 0.2f,
+///                                     -0.1f, 0.0f,   0.3f, 0.1f,   0.0f, -0.3f};
+/// const float bias_data_conv1d[] = {0.0f, 0.0f};
+/// ailayer_conv1d_f32_t conv1d_layer = {
+///     .filter_count =     2,
+///     .kernel_size =      3,
+///     .stride =           1,
+///     .dilation =         1,
+///     .padding =          1,
+///     .weights.data =     kernel_data_conv1d,
+///     .bias.data =        bias_data_conv1d
+/// };
+/// \endcode
+/// In C, C++ and on Arduino:
+/// \code{.c}
+/// ailayer_conv1d_f32_t conv1d_layer     = AILAYER_CONV1D_F32_M(
+///                                                                 /* filters =*/     2,
+///                                                                 /* kernel_size =*/ 3,
+///                                                                 /* stride =*/      1,
+///                                                                 /* dilation =*/    1,
+///                                                                 /* padding =*/     1,
+///                                                                 /* weights =*/     kernel_data_conv1d,
+///                                                                 /* bias =*/        bias_data_conv1d
+///                                                              );
+/// \endcode
+///
+/// **Example:** Create the layer structure for automatic parameter distribution:\n
+/// In C, C++ and on Arduino:
+/// \code{.c}
+/// ailayer_conv1d_f32_t conv1d_layer     = AILAYER_CONV1D_F32_A(
+///                                                                 /* filters =*/     8,
+///                                                                 /* kernel_size =*/ 5,
+///                                                                 /* stride =*/      1,
+///                                                                 /* dilation =*/    2,
+///                                                                 /* padding =*/     0
+///                                                              );
+/// \endcode
+///
+/// **Example:** Initialize and connect the layer for data with channels first (all options are equivalent):\n
+/// \code{.c}
+/// conv1d_layer.channel_axis = 1;
+/// x = ailayer_conv1d_f32_default(&conv1d_layer, x);
+/// \endcode
+/// or
+/// \code{.c}
+/// x = ailayer_conv1d_cfirst_f32_default(&conv1d_layer, x);
+/// \endcode
+/// or
+/// \code{.c}
+/// x = ailayer_conv1d_cl_f32_default(&conv1d_layer, x);
+/// \endcode
+///
+/// **Example:** Initialize and connect the layer for data with channels last (all options are equivalent):\n
+/// With channels last (the native layout of interleaved sensor samples), a window with dilation 1 is a single contiguous dot product.\n
+/// \code{.c}
+/// conv1d_layer.channel_axis = -1;
+/// x = ailayer_conv1d_f32_default(&conv1d_layer, x);
+/// \endcode
+/// or
+/// \code{.c}
+/// x = ailayer_conv1d_clast_f32_default(&conv1d_layer, x);
+/// \endcode
+/// or
+/// \code{.c}
+/// x = ailayer_conv1d_lc_f32_default(&conv1d_layer, x);
+/// \endcode
+///
+/// @param *layer        The layer structure to initialize.
+/// @param *input_layer  The prior layer.
+/// @return              The (successfully) initialized layer structure.
+///
+ailayer_t *ailayer_conv1d_f32_default(ailayer_conv1d_f32_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_conv1d.h Conv1D layer \endlink (channels first) with the \link aimath_f32.h F32 \endlink default implementation
+ *
+ * Code examples are given in the description of ailayer_conv1d_f32_default().
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_conv1d_cfirst_f32_default(ailayer_conv1d_f32_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_conv1d.h Conv1D layer \endlink (channels first) with the \link aimath_f32.h F32 \endlink default implementation
+ *
+ * Code examples are given in the description of ailayer_conv1d_f32_default().
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_conv1d_cl_f32_default(ailayer_conv1d_f32_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_conv1d.h Conv1D layer \endlink (channels last) with the \link aimath_f32.h F32 \endlink default implementation
+ *
+ * Code examples are given in the description of ailayer_conv1d_f32_default().
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_conv1d_clast_f32_default(ailayer_conv1d_f32_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_conv1d.h Conv1D layer \endlink (channels last) with the \link aimath_f32.h F32 \endlink default implementation
+ *
+ * Code examples are given in the description of ailayer_conv1d_f32_default().
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_conv1d_lc_f32_default(ailayer_conv1d_f32_t *layer, ailayer_t *input_layer);
+
+/// @brief Initializes and connect a \link ailayer_conv1d.h Conv1D layer \endlink with the \link aimath_q7.h Q7 \endlink default implementation
+///
+/// Weights and bias are \link aimath_q7.h Q7 \endlink tensors. The quantization parameters of the result have to be calibrated
+/// (for example with aialgo_quantize_model_f32_to_q7(), which also quantizes the weights and bias of an equivalent F32 model).
+/// The layer can only be used for inference.
+///
+/// **Example:** Create the layer structure with pretrained weights:\n
+/// \code{.c}
+/// const aimath_q7_params_t conv1d_weights_qparams = {7, 0};
+/// const int8_t kernel_data_conv1d[] = {...};
+/// const aimath_q7_params_t conv1d_bias_qparams = {9, 0};
+/// const int8_t bias_data_conv1d[] = {...};
+/// const aimath_q7_params_t conv1d_result_qparams = {4, -12};
+///
+/// ailayer_conv1d_q7_t conv1d_layer      = AILAYER_CONV1D_Q7_M(
+///                                                                 /* filters =*/         2,
+///                                                                 /* kernel_size =*/     3,
+///                                                                 /* stride =*/          1,
+///                                                                 /* dilation =*/        1,
+///                                                                 /* padding =*/         1,
+///                                                                 /* weights =*/         kernel_data_conv1d,
+///                                                                 /* weights_qparams =*/ &conv1d_weights_qparams,
+///                                                                 /* bias =*/            bias_data_conv1d,
+///                                                                 /* bias_qparams =*/    &conv1d_bias_qparams,
+///                                                                 /* result_qparams =*/  &conv1d_result_qparams
+///                                                              );
+/// x = ailayer_conv1d_lc_q7_default(&conv1d_layer, x);
+/// \endcode
+///
+/// @param *layer        The layer structure to initialize.
+/// @param *input_layer  The prior layer.
+/// @return              The (successfully) initialized layer structure.
+///
+ailayer_t *ailayer_conv1d_q7_default(ailayer_conv1d_q7_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_conv1d.h Conv1D layer \endlink (channels first) with the \link aimath_q7.h Q7 \endlink default implementation
+ *
+ * See ailayer_conv1d_q7_default() for more information.
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_conv1d_cl_q7_default(ailayer_conv1d_q7_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_conv1d.h Conv1D layer \endlink (channels last) with the \link aimath_q7.h Q7 \endlink default implementation
+ *
+ * See ailayer_conv1d_q7_default() for more information.
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_conv1d_lc_q7_default(ailayer_conv1d_q7_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_conv1d.h Conv1D layer \endlink with the \link aimath_q7.h Q7 \endlink default implementation and fused input quantization
+ *
+ * Same as ailayer_conv1d_q7_default(), but the layer is the first layer of a model and quantizes the raw input data
+ * (F32 or 16 bit ADC values) on the fly (aimath_q7_default_conv1d_fused_input_fwd()). The Q7 input layer gets an
+ * aimath_q7_source_params_t as result tensor parameters (see ailayer_dense_q7_fused_input_default() for an example).
+ *
+ * The layer can not be used with aialgo_schedule_stream_memory(), because the streamed samples are already quantized.
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer (Q7 input layer with aimath_q7_source_params_t).
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_conv1d_q7_fused_input_default(ailayer_conv1d_q7_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_conv1d.h Conv1D layer \endlink (channels first) with the \link aimath_q7.h Q7 \endlink default implementation and fused input quantization
+ *
+ * See ailayer_conv1d_q7_fused_input_default() for more information.
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer (Q7 input layer with aimath_q7_source_params_t).
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_conv1d_cl_q7_fused_input_default(ailayer_conv1d_q7_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_conv1d.h Conv1D layer \endlink (channels last) with the \link aimath_q7.h Q7 \endlink default implementation and fused input quantization
+ *
+ * See ailayer_conv1d_q7_fused_input_default() for more information.
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer (Q7 input layer with aimath_q7_source_params_t).
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_conv1d_lc_q7_fused_input_default(ailayer_conv1d_q7_t *layer, ailayer_t *input_layer);
+
+/** @brief \link aimath_f32.h F32 \endlink default implementation of the ailayer.init_params function for the Conv1D layer
+ *
+ * *Implementation of ailayer.init_params.*
+ *
+ * The function will initialize the weights and bias depending on the following activation function.
+ *
+ * | Activation function				| Weights-init	| Bias-init  |
+ * |------------------------------------|---------------|------------|
+ * | None, tanh, logistic, softmax	    | Glorot		| Zeros      |
+ * | ReLu and variants				    | He			| Zeros      |
+ *
+ * @param *self  The layer structure
+ */
+void ailayer_conv1d_init_params_f32_default(ailayer_t *self);
+
+#endif // AILAYER_CONV1D_DEFAULT
@@ -36,9 +36,22 @@ ailayer_t *ailayer_conv2d_f32_default(ailayer_conv2d_f32_t *layer, ailayer_t *in
 	layer->base.calc_result_tensor_params = 0;
 	layer->base.init_params = ailayer_conv2d_init_params_f32_default;
 
-    layer->conv2d_fwd = aimath_f32_default_conv2d_fwd;
-    layer->conv2d_bwd = aimath_f32_default_conv2d_bwd;
-    layer->conv2d_bwd_full = aimath_f32_default_conv2d_bwd_full;
+    if(layer->channel_axis == AIFES_CHANNELS_LAST || layer->channel_axis == 3){
+        // Dedicated kernels with the channels as innermost, contiguous dimension
+        layer->conv2d_fwd = aimath_f32_default_conv2d_fwd_hwc;
+        layer->conv2d_bwd = aimath_f32_default_conv2d_bwd_hwc;
+        layer->conv2d_bwd_full = aimath_f32_default_conv2d_bwd_full_hwc;
+    } else {
+        layer->conv2d_fwd = aimath_f32_default_conv2d_fwd;
+        layer->conv2d_bwd = aimath_f32_default_conv2d_bwd;
+        layer->conv2d_bwd_full = aimath_f32_default_conv2d_bwd_full;
+    }
+    if(layer->kernel_size[0] == 1 && layer->kernel_size[1] == 1
+       && layer->stride[0] == 1 && layer->stride[1] == 1
+       && layer->padding[0] == 0 && layer->padding[1] == 0){
+        // Pointwise convolution: Map the forward pass directly onto the dense GEMM kernel
+        layer->conv2d_fwd = aimath_f32_default_pointwise_conv2d_fwd;
+    }
     layer->tensor_add = aimath_f32_default_tensor_add;
     layer->sum_channelwise = aimath_f32_default_sum_channelwise;
 
@@ -117,6 +117,7 @@ typedef struct ailayer_conv2d   ailayer_conv2d_f32_t;
 /// \endcode
 ///
 /// **Example:** Initialize and connect the layer for data with channels last (all options are equivalent):\n
+/// For channels last, dedicated kernels (e.g. aimath_f32_default_conv2d_fwd_hwc()) with the channels as innermost dimension are used.\n
 /// \code{.c}
 /// conv2d_layer.channel_axis = -1;
 /// x = ailayer_conv2d_f32_default(&conv2d_layer, x);
@@ -0,0 +1,105 @@
+/**
+ * \file cnn/default/ailayer/ailayer_global_avgpool2d_default.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief See ailayer_global_avgpool2d_default.h for documentation.
+ * \details
+ */
+
+#include "cnn/default/ailayer/ailayer_global_avgpool2d_default.h"
+
+ailayer_t *ailayer_global_avgpool2d_f32_default(ailayer_global_avgpool2d_f32_t *layer, ailayer_t *input_layer)
+{
+    layer->base.result.dtype = aif32;
+    layer->base.deltas.dtype = aif32;
+
+	layer->base.calc_result_tensor_params = 0;
+	layer->base.init_params = 0;
+
+    layer->global_avgpool2d_fwd = aimath_f32_default_global_avgpool2d_fwd;
+    layer->global_avgpool2d_bwd = aimath_f32_default_global_avgpool2d_bwd;
+
+    return ailayer_global_avgpool2d(layer, input_layer);
+}
+
+ailayer_t *ailayer_global_avgpool2d_chw_f32_default(ailayer_global_avgpool2d_f32_t *layer, ailayer_t *input_layer)
+{
+	layer->channel_axis = AIFES_CHANNELS_FIRST;
+	return ailayer_global_avgpool2d_f32_default(layer, input_layer);
+}
+
+ailayer_t *ailayer_global_avgpool2d_hwc_f32_default(ailayer_global_avgpool2d_f32_t *layer, ailayer_t *input_layer)
+{
+	layer->channel_axis = AIFES_CHANNELS_LAST;
+	return ailayer_global_avgpool2d_f32_default(layer, input_layer);
+}
+
+ailayer_t *ailayer_global_avgpool2d_q7_default(ailayer_global_avgpool2d_q7_t *layer, ailayer_t *input_layer)
+{
+    ailayer_t *return_layer;
+
+    layer->base.result.dtype = aiq7;
+    layer->base.deltas.dtype = aiq7;
+
+	layer->base.calc_result_tensor_params = ailayer_global_avgpool2d_calc_result_tensor_params_q7_default;
+	layer->base.init_params = 0;
+
+    layer->global_avgpool2d_fwd = aimath_q7_default_global_avgpool2d_fwd;
+    layer->global_avgpool2d_bwd = 0;
+
+    return_layer = ailayer_global_avgpool2d(layer, input_layer);
+
+	return_layer->sizeof_fwdmem = ailayer_global_avgpool2d_sizeof_fwdmem_q7_default;
+
+	// backward
+	// Not supported for q7
+	return_layer->backward = 0;
+
+	return return_layer;
+}
+
+ailayer_t *ailayer_global_avgpool2d_chw_q7_default(ailayer_global_avgpool2d_q7_t *layer, ailayer_t *input_layer)
+{
+	layer->channel_axis = AIFES_CHANNELS_FIRST;
+	return ailayer_global_avgpool2d_q7_default(layer, input_layer);
+}
+
+ailayer_t *ailayer_global_avgpool2d_hwc_q7_default(ailayer_global_avgpool2d_q7_t *layer, ailayer_t *input_layer)
+{
+	layer->channel_axis = AIFES_CHANNELS_LAST;
+	return ailayer_global_avgpool2d_q7_default(layer, input_layer);
+}
+
+void ailayer_global_avgpool2d_calc_result_tensor_params_q7_default(ailayer_t *self)
+{
+	aimath_q7_params_t *qparams = (aimath_q7_params_t *) (self->result.tensor_params);
+
+	// Values are the same as used in the global_avgpool2d q7 default math function
+	qparams->shift = ((aimath_q7_params_t *) (self->input_layer->result.tensor_params))->shift;
+	qparams->zero_point = ((aimath_q7_params_t *) (self->input_layer->result.tensor_params))->zero_point;
+}
+
+uint32_t ailayer_global_avgpool2d_sizeof_fwdmem_q7_default(const ailayer_t *self)
+{
+	const ailayer_global_avgpool2d_t *layer = (ailayer_global_avgpool2d_t *)(self->layer_configuration);
+
+	// 32 bit channel sums for the single pass over a channels last input
+	if(layer->channel_axis == 1 || layer->channel_axis == -3){
+        return 0;
+	}
+	return self->input_layer->result.shape[3] * sizeof(int32_t);
+}
@@ -0,0 +1,150 @@
+/**
+ * \file cnn/default/ailayer/ailayer_global_avgpool2d_default.h
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Default implementation of the \link ailayer_global_avgpool2d.h GlobalAvgPool2D layer \endlink
+ *
+ * Hardware independent implementations of the GlobalAvgPool2D layer in \link aimath_f32.h F32 \endlink and
+ * \link aimath_q7.h Q7 \endlink data-type.
+ * For more information about the GlobalAvgPool2D layer refer to ailayer_global_avgpool2d.h.
+ */
+
+#ifndef AILAYER_GLOBAL_AVGPOOL2D_DEFAULT
+#define AILAYER_GLOBAL_AVGPOOL2D_DEFAULT
+
+#include "cnn/base/ailayer/ailayer_global_avgpool2d.h"
+
+#include "cnn/default/aimath/aimath_cnn_f32_default.h"
+#include "cnn/default/aimath/aimath_cnn_q7_default.h"
+
+#define AILAYER_GLOBAL_AVGPOOL2D_F32_M()        {{0,},}
+#define AILAYER_GLOBAL_AVGPOOL2D_F32_A()        {{0,},}
+#define AILAYER_GLOBAL_AVGPOOL2D_Q7_M()         {{0,},}
+#define AILAYER_GLOBAL_AVGPOOL2D_Q7_A()         {{0,},}
+
+typedef struct ailayer_global_avgpool2d   ailayer_global_avgpool2d_f32_t;
+typedef struct ailayer_global_avgpool2d   ailayer_global_avgpool2d_q7_t;
+
+/// @brief Initializes and connect a \link ailayer_global_avgpool2d.h GlobalAvgPool2D layer \endlink with the \link aimath_f32.h F32 \endlink default implementation
+///
+/// **Example:** Create the layer structure:\n
+/// \code{.c}
+/// ailayer_global_avgpool2d_f32_t gap_layer = AILAYER_GLOBAL_AVGPOOL2D_F32_A();
+/// \endcode
+///
+/// **Example:** Initialize and connect the layer for data with channels first (all options are equivalent):\n
+/// \code{.c}
+/// gap_layer.channel_axis = 1;
+/// x = ailayer_global_avgpool2d_f32_default(&gap_layer, x);
+/// \endcode
+/// or
+/// \code{.c}
+/// x = ailayer_global_avgpool2d_chw_f32_default(&gap_layer, x);
+/// \endcode
+///
+/// **Example:** Initialize and connect the layer for data with channels last (all options are equivalent):\n
+/// \code{.c}
+/// gap_layer.channel_axis = -1;
+/// x = ailayer_global_avgpool2d_f32_default(&gap_layer, x);
+/// \endcode
+/// or
+/// \code{.c}
+/// x = ailayer_global_avgpool2d_hwc_f32_default(&gap_layer, x);
+/// \endcode
+///
+/// The result has the shape [N,C] and can be connected directly to a Dense layer.
+///
+/// @param *layer        The layer structure to initialize.
+/// @param *input_layer  The prior layer.
+/// @return              The (successfully) initialized layer structure.
+///
+ailayer_t *ailayer_global_avgpool2d_f32_default(ailayer_global_avgpool2d_f32_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_global_avgpool2d.h GlobalAvgPool2D layer \endlink (channels first) with the \link aimath_f32.h F32 \endlink default implementation
+ *
+ * Code examples are given in the description of ailayer_global_avgpool2d_f32_default().
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_global_avgpool2d_chw_f32_default(ailayer_global_avgpool2d_f32_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_global_avgpool2d.h GlobalAvgPool2D layer \endlink (channels last) with the \link aimath_f32.h F32 \endlink default implementation
+ *
+ * Code examples are given in the description of ailayer_global_avgpool2d_f32_default().
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_global_avgpool2d_hwc_f32_default(ailayer_global_avgpool2d_f32_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_global_avgpool2d.h GlobalAvgPool2D layer \endlink with the \link aimath_q7.h Q7 \endlink default implementation
+ *
+ * The result has the same quantization parameters as the input. The layer can only be used for inference.
+ *
+ * Code examples are given in the description of ailayer_global_avgpool2d_f32_default() (use the Q7 types and functions instead).
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_global_avgpool2d_q7_default(ailayer_global_avgpool2d_q7_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_global_avgpool2d.h GlobalAvgPool2D layer \endlink (channels first) with the \link aimath_q7.h Q7 \endlink default implementation
+ *
+ * See ailayer_global_avgpool2d_q7_default() for more information.
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_global_avgpool2d_chw_q7_default(ailayer_global_avgpool2d_q7_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_global_avgpool2d.h GlobalAvgPool2D layer \endlink (channels last) with the \link aimath_q7.h Q7 \endlink default implementation
+ *
+ * See ailayer_global_avgpool2d_q7_default() for more information.
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_global_avgpool2d_hwc_q7_default(ailayer_global_avgpool2d_q7_t *layer, ailayer_t *input_layer);
+
+/** @brief Calculate and set the quantization parameters for the result tensor of the GlobalAvgPool2D \link aimath_q7.h Q7 \endlink default implementation
+ *
+ * *Implementation of ailayer.calc_result_tensor_params.*
+ *
+ * The quantization parameters are the same as the ones of the input (as in the corresponding math function aimath_q7_default_global_avgpool2d_fwd()).
+ *
+ * @param *self     The layer structure
+ */
+void ailayer_global_avgpool2d_calc_result_tensor_params_q7_default(ailayer_t *self);
+
+/** @brief \link aimath_q7.h Q7 \endlink default implementation of the ailayer.sizeof_fwdmem function for the GlobalAvgPool2D layer
+ *
+ * *Implementation of ailayer.sizeof_fwdmem.*
+ *
+ * For channels last, the forward pass needs the 32 bit sums of all channels of one sample.
+ *
+ * @param *self  The layer structure
+ * @return       Calculated memory size in bytes.
+ */
+uint32_t ailayer_global_avgpool2d_sizeof_fwdmem_q7_default(const ailayer_t *self);
+
+#endif // AILAYER_GLOBAL_AVGPOOL2D_DEFAULT
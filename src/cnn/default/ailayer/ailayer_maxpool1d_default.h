@@ -0,0 +1,183 @@
+/**
+ * \file cnn/default/ailayer/ailayer_maxpool1d_default.h
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Default implementation of the \link ailayer_maxpool1d.h MaxPool1D layer \endlink
+ *
+ * Hardware independent implementations of the MaxPool1D layer in \link aimath_f32.h F32 \endlink and
+ * \link aimath_q7.h Q7 \endlink data-type.
+ * For more information about the MaxPool1D layer refer to ailayer_maxpool1d.h.
+ */
+
+#ifndef AILAYER_MAXPOOL1D_DEFAULT
+#define AILAYER_MAXPOOL1D_DEFAULT
+
+#include "cnn/base/ailayer/ailayer_maxpool1d.h"
+
+#include "cnn/default/aimath/aimath_cnn_f32_default.h"
+#include "cnn/default/aimath/aimath_cnn_q7_default.h"
+#include "basic/default/aimath/aimath_f32_default.h"
+
+#define AILAYER_MAXPOOL1D_F32_M(pool_size, stride, padding) \
+            {{0,},pool_size,stride,padding,}
+#define AILAYER_MAXPOOL1D_F32_A(pool_size, stride, padding) \
+            {{0,},pool_size,stride,padding,}
+#define AILAYER_MAXPOOL1D_Q7_M(pool_size, stride, padding) \
+            {{0,},pool_size,stride,padding,}
+#define AILAYER_MAXPOOL1D_Q7_A(pool_size, stride, padding) \
+            {{0,},pool_size,stride,padding,}
+
+typedef struct ailayer_maxpool1d   ailayer_maxpool1d_f32_t;
+typedef struct ailayer_maxpool1d   ailayer_maxpool1d_q7_t;
+
+/// @brief Initializes and connect a \link ailayer_maxpool1d.h MaxPool1D layer \endlink with the \link aimath_f32.h F32 \endlink default implementation
+///
+/// **Example:** Create the layer structure:\n
+/// In C:
+/// \code{.c}
+/// ailayer_maxpool1d_f32_t maxpool1d_layer = {
+///     .pool_size =    2,
+///     .stride =       2,
+///     .padding =      0
+/// };
+/// \endcode
+/// In C, C++ and on Arduino:
+/// \code{.c}
+/// ailayer_maxpool1d_f32_t maxpool1d_layer = AILAYER_MAXPOOL1D_F32_A(
+///                                                             /* pool_size =*/    2,
+///                                                             /* stride =*/       2,
+///                                                             /* padding =*/      0
+///                                                            );
+/// \endcode
+///
+/// **Example:** Initialize and connect the layer for data with channels first (all options are equivalent):\n
+/// \code{.c}
+/// maxpool1d_layer.channel_axis = 1;
+/// x = ailayer_maxpool1d_f32_default(&maxpool1d_layer, x);
+/// \endcode
+/// or
+/// \code{.c}
+/// x = ailayer_maxpool1d_cfirst_f32_default(&maxpool1d_layer, x);
+/// \endcode
+/// or
+/// \code{.c}
+/// x = ailayer_maxpool1d_cl_f32_default(&maxpool1d_layer, x);
+/// \endcode
+///
+/// **Example:** Initialize and connect the layer for data with channels last (all options are equivalent):\n
+/// \code{.c}
+/// maxpool1d_layer.channel_axis = -1;
+/// x = ailayer_maxpool1d_f32_default(&maxpool1d_layer, x);
+/// \endcode
+/// or
+/// \code{.c}
+/// x = ailayer_maxpool1d_clast_f32_default(&maxpool1d_layer, x);
+/// \endcode
+/// or
+/// \code{.c}
+/// x = ailayer_maxpool1d_lc_f32_default(&maxpool1d_layer, x);
+/// \endcode
+///
+/// @param *layer        The layer structure to initialize.
+/// @param *input_layer  The prior layer.
+/// @return              The (successfully) initialized layer structure.
+///
+ailayer_t *ailayer_maxpool1d_f32_default(ailayer_maxpool1d_f32_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_maxpool1d.h MaxPool1D layer \endlink (channels first) with the \link aimath_f32.h F32 \endlink default implementation
+ *
+ * Code examples are given in the description of ailayer_maxpool1d_f32_default().
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_maxpool1d_cfirst_f32_default(ailayer_maxpool1d_f32_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_maxpool1d.h MaxPool1D layer \endlink (channels first) with the \link aimath_f32.h F32 \endlink default implementation
+ *
+ * Code examples are given in the description of ailayer_maxpool1d_f32_default().
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_maxpool1d_cl_f32_default(ailayer_maxpool1d_f32_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_maxpool1d.h MaxPool1D layer \endlink (channels last) with the \link aimath_f32.h F32 \endlink default implementation
+ *
+ * Code examples are given in the description of ailayer_maxpool1d_f32_default().
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_maxpool1d_clast_f32_default(ailayer_maxpool1d_f32_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_maxpool1d.h MaxPool1D layer \endlink (channels last) with the \link aimath_f32.h F32 \endlink default implementation
+ *
+ * Code examples are given in the description of ailayer_maxpool1d_f32_default().
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_maxpool1d_lc_f32_default(ailayer_maxpool1d_f32_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_maxpool1d.h MaxPool1D layer \endlink with the \link aimath_q7.h Q7 \endlink default implementation
+ *
+ * The result has the same quantization parameters as the input. The layer can only be used for inference.
+ *
+ * Code examples are given in the description of ailayer_maxpool1d_f32_default() (use the Q7 types and functions instead).
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_maxpool1d_q7_default(ailayer_maxpool1d_q7_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_maxpool1d.h MaxPool1D layer \endlink (channels first) with the \link aimath_q7.h Q7 \endlink default implementation
+ *
+ * See ailayer_maxpool1d_q7_default() for more information.
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_maxpool1d_cl_q7_default(ailayer_maxpool1d_q7_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_maxpool1d.h MaxPool1D layer \endlink (channels last) with the \link aimath_q7.h Q7 \endlink default implementation
+ *
+ * See ailayer_maxpool1d_q7_default() for more information.
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_maxpool1d_lc_q7_default(ailayer_maxpool1d_q7_t *layer, ailayer_t *input_layer);
+
+/** @brief Calculate and set the quantization parameters for the result tensor of the MaxPool1D \link aimath_q7.h Q7 \endlink default implementation
+ *
+ * *Implementation of ailayer.calc_result_tensor_params.*
+ *
+ * The quantization parameters are the same as the ones of the input (as in the corresponding math function aimath_q7_default_maxpool1d_fwd()).
+ *
+ * @param *self     The layer structure
+ */
+void ailayer_maxpool1d_calc_result_tensor_params_q7_default(ailayer_t *self);
+
+#endif // AILAYER_MAXPOOL1D_DEFAULT
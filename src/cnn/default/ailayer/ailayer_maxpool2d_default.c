@@ -21,6 +21,8 @@
 
 #include "cnn/default/ailayer/ailayer_maxpool2d_default.h"
 
+AISTRING_STORAGE_WRAPPER(aistring_error_maxpool2d_f32_default_1, "[ailayer_maxpool2d_f32_default] Fused ReLU is only supported for pool_size (2, 2), stride (2, 2) and padding (0, 0).\n");
+
 ailayer_t *ailayer_maxpool2d_f32_default(ailayer_maxpool2d_f32_t *layer, ailayer_t *input_layer){
     layer->base.result.dtype = aif32;
     layer->base.deltas.dtype = aif32;
@@ -28,8 +30,34 @@ ailayer_t *ailayer_maxpool2d_f32_default(ailayer_maxpool2d_f32_t *layer, ailayer
 	layer->base.calc_result_tensor_params = 0;
 	layer->base.init_params = 0;
 
-    layer->maxpool2d_fwd = aimath_f32_default_maxpool2d_fwd;
-    layer->maxpool2d_bwd = aimath_f32_default_maxpool2d_bwd;
+	layer->max_location_bits = 32;
+
+    if(layer->pool_size[0] == 2 && layer->pool_size[1] == 2
+       && layer->stride[0] == 2 && layer->stride[1] == 2
+       && layer->padding[0] == 0 && layer->padding[1] == 0){
+        // Dedicated kernels for non-overlapping 2x2 windows with packed 2-bit max locations
+        if(layer->fused_relu){
+            layer->maxpool2d_fwd = aimath_f32_default_maxpool2d_2x2_relu_fwd;
+            layer->maxpool2d_bwd = aimath_f32_default_maxpool2d_2x2_relu_bwd;
+            layer->max_location_bits = 3;
+        } else {
+            layer->maxpool2d_fwd = aimath_f32_default_maxpool2d_2x2_fwd;
+            layer->maxpool2d_bwd = aimath_f32_default_maxpool2d_2x2_bwd;
+            layer->max_location_bits = 2;
+        }
+    } else if(layer->fused_relu){
+        #ifdef AIDEBUG_GENERAL_CHECKS
+        AILOG_E(aistring_error_maxpool2d_f32_default_1);
+        #endif
+        return 0;
+    } else if(layer->channel_axis == AIFES_CHANNELS_LAST || layer->channel_axis == 3){
+        // Dedicated kernels with the channels as innermost, contiguous dimension
+        layer->maxpool2d_fwd = aimath_f32_default_maxpool2d_fwd_hwc;
+        layer->maxpool2d_bwd = aimath_f32_default_maxpool2d_bwd_hwc;
+    } else {
+        layer->maxpool2d_fwd = aimath_f32_default_maxpool2d_fwd;
+        layer->maxpool2d_bwd = aimath_f32_default_maxpool2d_bwd;
+    }
 
     return ailayer_maxpool2d(layer, input_layer);
 }
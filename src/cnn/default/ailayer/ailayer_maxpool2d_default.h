@@ -73,6 +73,7 @@ typedef struct ailayer_maxpool2d   ailayer_maxpool2d_f32_t;
 /// \endcode
 ///
 /// **Example:** Initialize and connect the layer for data with channels last (all options are equivalent):\n
+/// For channels last, dedicated kernels (e.g. aimath_f32_default_maxpool2d_fwd_hwc()) with the channels as innermost dimension are used.\n
 /// \code{.c}
 /// maxpool2d_layer.channel_axis = -1;
 /// x = ailayer_maxpool2d_f32_default(&maxpool2d_layer, x);
@@ -86,6 +87,14 @@ typedef struct ailayer_maxpool2d   ailayer_maxpool2d_f32_t;
 /// x = ailayer_maxpool2d_hwc_f32_default(&maxpool2d_layer, x);
 /// \endcode
 ///
+/// For pool_size (2, 2), stride (2, 2) and padding (0, 0), dedicated kernels (aimath_f32_default_maxpool2d_2x2_fwd())
+/// are used that store the max locations for training with only 2 bits per element.\n
+/// In this case, a ReLU activation can be fused into the layer (replaces a following ReLU layer):
+/// \code{.c}
+/// maxpool2d_layer.fused_relu = 1;
+/// x = ailayer_maxpool2d_hwc_f32_default(&maxpool2d_layer, x);
+/// \endcode
+///
 /// @param *layer        The layer structure to initialize.
 /// @param *input_layer  The prior layer.
 /// @return              The (successfully) initialized layer structure.
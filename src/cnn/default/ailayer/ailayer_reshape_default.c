@@ -51,7 +51,7 @@ ailayer_t *ailayer_reshape_q7_default(ailayer_reshape_f32_t *layer, ailayer_t *i
     layer->base.result.dtype = aiq7;
     layer->base.deltas.dtype = aiq7;
 
-	layer->base.calc_result_tensor_params = 0;
+	layer->base.calc_result_tensor_params = ailayer_reshape_calc_result_tensor_params_q7_default;
 	layer->base.init_params = 0;
 
 	// No operation is needed. Comparable to "view" layer in PyTorch.
@@ -98,7 +98,7 @@ ailayer_t *ailayer_flatten_q7_default(ailayer_flatten_f32_t *layer, ailayer_t *i
     layer->base.base.result.dtype = aiq7;
     layer->base.base.deltas.dtype = aiq7;
 
-	layer->base.base.calc_result_tensor_params = 0;
+	layer->base.base.calc_result_tensor_params = ailayer_reshape_calc_result_tensor_params_q7_default;
 	layer->base.base.init_params = 0;
 
 	layer->base.output_dim = 2;
@@ -110,3 +110,12 @@ ailayer_t *ailayer_flatten_q7_default(ailayer_flatten_f32_t *layer, ailayer_t *i
 
     return ailayer_reshape(&layer->base, input_layer);
 }
+
+void ailayer_reshape_calc_result_tensor_params_q7_default(ailayer_t *self)
+{
+	aimath_q7_params_t *qparams = (aimath_q7_params_t *) (self->result.tensor_params);
+
+	// The result is only a view on the input data, so the quantization must not change
+	qparams->shift = ((aimath_q7_params_t *) (self->input_layer->result.tensor_params))->shift;
+	qparams->zero_point = ((aimath_q7_params_t *) (self->input_layer->result.tensor_params))->zero_point;
+}
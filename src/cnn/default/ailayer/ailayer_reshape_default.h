@@ -220,4 +220,14 @@ ailayer_t *ailayer_flatten_q31_default(ailayer_flatten_q31_t *layer, ailayer_t *
 ///
 ailayer_t *ailayer_flatten_q7_default(ailayer_flatten_q7_t *layer, ailayer_t *input_layer);
 
+/** @brief Set the quantization parameters for the result tensor of the Reshape / Flatten \link aimath_q7.h Q7 \endlink default implementation
+ *
+ * *Implementation of ailayer.calc_result_tensor_params.*
+ *
+ * The quantization parameters are the same as the ones of the input, because the result is only a view on the input data.
+ *
+ * @param *self     The layer structure
+ */
+void ailayer_reshape_calc_result_tensor_params_q7_default(ailayer_t *self);
+
 #endif // AILAYER_RESHAPE_DEFAULT_H
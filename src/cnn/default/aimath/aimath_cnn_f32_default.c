@@ -637,6 +637,536 @@ void aimath_f32_default_conv2d_bwd_full(
 }
 
 
+void aimath_f32_default_conv2d_fwd_hwc(
+                    const aitensor_t *input,
+                    const uint16_t stride[2],    // [s_h, s_w]
+                    const uint16_t dilation[2],  // [d_h, d_w]
+                    const uint16_t padding[2],
+                    const aitensor_t *weights,
+                    const aitensor_t *bias,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *output)
+{
+    // Input format: NHWC
+    // Weights format: FHWC
+    // The channels are the innermost dimension, so every kernel tap is a contiguous inner product over C
+    uint16_t N = input->shape[0], H_in = input->shape[1], W_in = input->shape[2], C = input->shape[3];
+    uint16_t H_out = output->shape[1], W_out = output->shape[2], F = output->shape[3];
+    uint16_t K_h = weights->shape[1], K_w = weights->shape[2];
+    int32_t p_h, p_w;
+    int32_t in_h_idx, in_w_idx;
+    uint16_t n_idx, out_h_idx, out_w_idx, k_h_idx, k_w_idx, f_idx, c_idx;
+
+    const float *x_data = (const float *) input->data;
+    const float *w_data = (const float *) weights->data;
+    const float *bias_data = (const float *) bias->data;
+    const float *x_pixel, *w_row;
+    float *y_pixel;
+    float sum;
+
+    if(padding[0] == AIFES_PADDING_SAME){
+        // P = ceil(0.5 * ((N-1) * S - N + D * (K-1) + 1))
+        p_h = (((uint32_t) 1 << 15) * (uint32_t)((H_in - 1) * stride[0] - H_in + dilation[0] * (K_h - 1) + 1)
+                + ((uint32_t) 1 << 16) - 1) >> 16;
+    } else {
+        p_h = padding[0];
+    }
+    if(padding[1] == AIFES_PADDING_SAME){
+        p_w = (((uint32_t) 1 << 15) * (uint32_t)((W_in - 1) * stride[1] - W_in + dilation[1] * (K_w - 1) + 1)
+                + ((uint32_t) 1 << 16) - 1) >> 16;
+    } else {
+        p_w = padding[1];
+    }
+
+    y_pixel = (float *) output->data;
+    for(n_idx = 0; n_idx < N; n_idx++){
+        for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+            for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                for(f_idx = 0; f_idx < F; f_idx++){
+                    y_pixel[f_idx] = bias_data[f_idx];
+                }
+                for(k_h_idx = 0; k_h_idx < K_h; k_h_idx++){
+                    in_h_idx = (int32_t) stride[0] * out_h_idx + (int32_t) dilation[0] * k_h_idx - p_h;
+                    // Zero padding
+                    if(in_h_idx < 0 || in_h_idx >= H_in) continue;
+                    for(k_w_idx = 0; k_w_idx < K_w; k_w_idx++){
+                        in_w_idx = (int32_t) stride[1] * out_w_idx + (int32_t) dilation[1] * k_w_idx - p_w;
+                        if(in_w_idx < 0 || in_w_idx >= W_in) continue;
+
+                        x_pixel = x_data + (((uint32_t) n_idx * H_in + in_h_idx) * W_in + in_w_idx) * C;
+                        w_row = w_data + ((uint32_t) k_h_idx * K_w + k_w_idx) * C;
+                        for(f_idx = 0; f_idx < F; f_idx++){
+                            sum = 0.0f;
+                            for(c_idx = 0; c_idx < C; c_idx++){
+                                sum += x_pixel[c_idx] * w_row[c_idx];
+                            }
+                            y_pixel[f_idx] += sum;
+                            w_row += (uint32_t) K_h * K_w * C;
+                        }
+                    }
+                }
+                y_pixel += F;
+            }
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_conv2d_bwd_hwc(
+                    const aitensor_t *x_in,
+                    const uint16_t stride[2],    // [s_h, s_w]
+                    const uint16_t dilation[2],  // [d_h, d_w]
+                    const uint16_t padding[2],
+                    const aitensor_t *delta_out,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *d_weights)
+{
+    // for all f, kh, kw: dw_f,kh,kw = sum_n,h,w{dy_n,h,w,f * x_n,h',w'}, accumulated as contiguous rows over C
+    uint16_t N = x_in->shape[0], H_in = x_in->shape[1], W_in = x_in->shape[2], C = x_in->shape[3];
+    uint16_t H_out = delta_out->shape[1], W_out = delta_out->shape[2], F = delta_out->shape[3];
+    uint16_t K_h = d_weights->shape[1], K_w = d_weights->shape[2];
+    int32_t in_h_idx, in_w_idx;
+    uint16_t n_idx, out_h_idx, out_w_idx, k_h_idx, k_w_idx, f_idx, c_idx;
+
+    const float *x_data = (const float *) x_in->data;
+    const float *dy_pixel = (const float *) delta_out->data;
+    float *dw_data = (float *) d_weights->data;
+    const float *x_pixel;
+    float *dw_row;
+    float dy;
+
+    aimath_f32_default_init_zeros(d_weights);
+
+    for(n_idx = 0; n_idx < N; n_idx++){
+        for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+            for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                for(k_h_idx = 0; k_h_idx < K_h; k_h_idx++){
+                    in_h_idx = (int32_t) stride[0] * out_h_idx + (int32_t) dilation[0] * k_h_idx - padding[0];
+                    if(in_h_idx < 0 || in_h_idx >= H_in) continue;
+                    for(k_w_idx = 0; k_w_idx < K_w; k_w_idx++){
+                        in_w_idx = (int32_t) stride[1] * out_w_idx + (int32_t) dilation[1] * k_w_idx - padding[1];
+                        if(in_w_idx < 0 || in_w_idx >= W_in) continue;
+
+                        x_pixel = x_data + (((uint32_t) n_idx * H_in + in_h_idx) * W_in + in_w_idx) * C;
+                        dw_row = dw_data + ((uint32_t) k_h_idx * K_w + k_w_idx) * C;
+                        for(f_idx = 0; f_idx < F; f_idx++){
+                            dy = dy_pixel[f_idx];
+                            for(c_idx = 0; c_idx < C; c_idx++){
+                                dw_row[c_idx] += dy * x_pixel[c_idx];
+                            }
+                            dw_row += (uint32_t) K_h * K_w * C;
+                        }
+                    }
+                }
+                dy_pixel += F;
+            }
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_conv2d_bwd_full_hwc(
+                    const aitensor_t *delta_out,
+                    const uint16_t stride[2],    // [s_h, s_w]
+                    const uint16_t dilation[2],  // [d_h, d_w]
+                    const uint16_t padding[2],
+                    const aitensor_t *weights,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *delta_in)
+{
+    // Every output gradient is scattered back to the input pixels it was calculated from (dx_c += dy_f * w_fc)
+    uint16_t N = delta_in->shape[0], H_in = delta_in->shape[1], W_in = delta_in->shape[2], C = delta_in->shape[3];
+    uint16_t H_out = delta_out->shape[1], W_out = delta_out->shape[2], F = delta_out->shape[3];
+    uint16_t K_h = weights->shape[1], K_w = weights->shape[2];
+    int32_t in_h_idx, in_w_idx;
+    uint16_t n_idx, out_h_idx, out_w_idx, k_h_idx, k_w_idx, f_idx, c_idx;
+
+    const float *dy_pixel = (const float *) delta_out->data;
+    const float *w_data = (const float *) weights->data;
+    float *dx_data = (float *) delta_in->data;
+    const float *w_row;
+    float *dx_pixel;
+    float dy;
+
+    aimath_f32_default_init_zeros(delta_in);
+
+    for(n_idx = 0; n_idx < N; n_idx++){
+        for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+            for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                for(k_h_idx = 0; k_h_idx < K_h; k_h_idx++){
+                    in_h_idx = (int32_t) stride[0] * out_h_idx + (int32_t) dilation[0] * k_h_idx - padding[0];
+                    if(in_h_idx < 0 || in_h_idx >= H_in) continue;
+                    for(k_w_idx = 0; k_w_idx < K_w; k_w_idx++){
+                        in_w_idx = (int32_t) stride[1] * out_w_idx + (int32_t) dilation[1] * k_w_idx - padding[1];
+                        if(in_w_idx < 0 || in_w_idx >= W_in) continue;
+
+                        dx_pixel = dx_data + (((uint32_t) n_idx * H_in + in_h_idx) * W_in + in_w_idx) * C;
+                        w_row = w_data + ((uint32_t) k_h_idx * K_w + k_w_idx) * C;
+                        for(f_idx = 0; f_idx < F; f_idx++){
+                            dy = dy_pixel[f_idx];
+                            for(c_idx = 0; c_idx < C; c_idx++){
+                                dx_pixel[c_idx] += dy * w_row[c_idx];
+                            }
+                            w_row += (uint32_t) K_h * K_w * C;
+                        }
+                    }
+                }
+                dy_pixel += F;
+            }
+        }
+    }
+    return;
+}
+
+
+void aimath_f32_default_depthwise_conv2d_fwd(
+                    const aitensor_t *input,
+                    const uint16_t stride[2],    // [s_h, s_w]
+                    const uint16_t dilation[2],  // [d_h, d_w]
+                    const uint16_t padding[2],
+                    const aitensor_t *weights,
+                    const aitensor_t *bias,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *output)
+{
+    // Every input channel c is convolved with its own M kernels to the output channels c * M + m (M: depth multiplier)
+    uint8_t channel_uaxis = channel_axis < 0 ? 4 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = input->shape[0];
+    uint16_t C, H_in, W_in, C_out, H_out, W_out, K_h, K_w, M;
+    int32_t in_h_idx, in_w_idx;
+    uint16_t n_idx, c_idx, m_idx, o_idx, out_h_idx, out_w_idx, k_h_idx, k_w_idx;
+
+    const float *x_data = (const float *) input->data;
+    const float *w_data = (const float *) weights->data;
+    const float *bias_data = (const float *) bias->data;
+    float *y_data = (float *) output->data;
+    const float *x_ptr, *w_ptr;
+    float *y_ptr;
+    float sum, x_value;
+
+    if(channel_uaxis == 1){ // Channels first
+        // x: [N,C,H,W]; w: [C*M,K_h,K_w]; y: [N,C*M,H,W]
+        C = input->shape[1]; H_in = input->shape[2]; W_in = input->shape[3];
+        C_out = output->shape[1]; H_out = output->shape[2]; W_out = output->shape[3];
+        K_h = weights->shape[1]; K_w = weights->shape[2];
+        M = C_out / C;
+
+        y_ptr = y_data;
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(o_idx = 0; o_idx < C_out; o_idx++){
+                x_ptr = x_data + ((uint32_t) n_idx * C + o_idx / M) * H_in * W_in;
+                w_ptr = w_data + (uint32_t) o_idx * K_h * K_w;
+                for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+                    for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                        sum = bias_data[o_idx];
+                        for(k_h_idx = 0; k_h_idx < K_h; k_h_idx++){
+                            in_h_idx = (int32_t) stride[0] * out_h_idx + (int32_t) dilation[0] * k_h_idx - padding[0];
+                            // Zero padding
+                            if(in_h_idx < 0 || in_h_idx >= H_in) continue;
+                            for(k_w_idx = 0; k_w_idx < K_w; k_w_idx++){
+                                in_w_idx = (int32_t) stride[1] * out_w_idx + (int32_t) dilation[1] * k_w_idx - padding[1];
+                                if(in_w_idx < 0 || in_w_idx >= W_in) continue;
+                                sum += x_ptr[in_h_idx * W_in + in_w_idx] * w_ptr[k_h_idx * K_w + k_w_idx];
+                            }
+                        }
+                        *y_ptr++ = sum;
+                    }
+                }
+            }
+        }
+    } else if(channel_uaxis == 3){ // Channels last
+        // x: [N,H,W,C]; w: [K_h,K_w,C*M]; y: [N,H,W,C*M]
+        H_in = input->shape[1]; W_in = input->shape[2]; C = input->shape[3];
+        H_out = output->shape[1]; W_out = output->shape[2]; C_out = output->shape[3];
+        K_h = weights->shape[0]; K_w = weights->shape[1];
+        M = C_out / C;
+
+        y_ptr = y_data;
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+                for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                    for(o_idx = 0; o_idx < C_out; o_idx++){
+                        y_ptr[o_idx] = bias_data[o_idx];
+                    }
+                    for(k_h_idx = 0; k_h_idx < K_h; k_h_idx++){
+                        in_h_idx = (int32_t) stride[0] * out_h_idx + (int32_t) dilation[0] * k_h_idx - padding[0];
+                        if(in_h_idx < 0 || in_h_idx >= H_in) continue;
+                        for(k_w_idx = 0; k_w_idx < K_w; k_w_idx++){
+                            in_w_idx = (int32_t) stride[1] * out_w_idx + (int32_t) dilation[1] * k_w_idx - padding[1];
+                            if(in_w_idx < 0 || in_w_idx >= W_in) continue;
+
+                            x_ptr = x_data + (((uint32_t) n_idx * H_in + in_h_idx) * W_in + in_w_idx) * C;
+                            w_ptr = w_data + ((uint32_t) k_h_idx * K_w + k_w_idx) * C_out;
+                            o_idx = 0;
+                            for(c_idx = 0; c_idx < C; c_idx++){
+                                x_value = x_ptr[c_idx];
+                                for(m_idx = 0; m_idx < M; m_idx++){
+                                    y_ptr[o_idx] += x_value * w_ptr[o_idx];
+                                    o_idx++;
+                                }
+                            }
+                        }
+                    }
+                    y_ptr += C_out;
+                }
+            }
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_depthwise_conv2d_bwd(
+                    const aitensor_t *x_in,
+                    const uint16_t stride[2],    // [s_h, s_w]
+                    const uint16_t dilation[2],  // [d_h, d_w]
+                    const uint16_t padding[2],
+                    const aitensor_t *delta_out,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *d_weights)
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 4 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = x_in->shape[0];
+    uint16_t C, H_in, W_in, C_out, H_out, W_out, K_h, K_w, M;
+    int32_t in_h_idx, in_w_idx;
+    uint16_t n_idx, c_idx, m_idx, o_idx, out_h_idx, out_w_idx, k_h_idx, k_w_idx;
+
+    const float *x_data = (const float *) x_in->data;
+    const float *dy_ptr = (const float *) delta_out->data;
+    float *dw_data = (float *) d_weights->data;
+    const float *x_ptr;
+    float *dw_ptr;
+    float dy, x_value;
+
+    aimath_f32_default_init_zeros(d_weights);
+
+    if(channel_uaxis == 1){ // Channels first
+        C = x_in->shape[1]; H_in = x_in->shape[2]; W_in = x_in->shape[3];
+        C_out = delta_out->shape[1]; H_out = delta_out->shape[2]; W_out = delta_out->shape[3];
+        K_h = d_weights->shape[1]; K_w = d_weights->shape[2];
+        M = C_out / C;
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(o_idx = 0; o_idx < C_out; o_idx++){
+                x_ptr = x_data + ((uint32_t) n_idx * C + o_idx / M) * H_in * W_in;
+                dw_ptr = dw_data + (uint32_t) o_idx * K_h * K_w;
+                for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+                    for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                        dy = *dy_ptr++;
+                        for(k_h_idx = 0; k_h_idx < K_h; k_h_idx++){
+                            in_h_idx = (int32_t) stride[0] * out_h_idx + (int32_t) dilation[0] * k_h_idx - padding[0];
+                            if(in_h_idx < 0 || in_h_idx >= H_in) continue;
+                            for(k_w_idx = 0; k_w_idx < K_w; k_w_idx++){
+                                in_w_idx = (int32_t) stride[1] * out_w_idx + (int32_t) dilation[1] * k_w_idx - padding[1];
+                                if(in_w_idx < 0 || in_w_idx >= W_in) continue;
+                                dw_ptr[k_h_idx * K_w + k_w_idx] += dy * x_ptr[in_h_idx * W_in + in_w_idx];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    } else if(channel_uaxis == 3){ // Channels last
+        H_in = x_in->shape[1]; W_in = x_in->shape[2]; C = x_in->shape[3];
+        H_out = delta_out->shape[1]; W_out = delta_out->shape[2]; C_out = delta_out->shape[3];
+        K_h = d_weights->shape[0]; K_w = d_weights->shape[1];
+        M = C_out / C;
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+                for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                    for(k_h_idx = 0; k_h_idx < K_h; k_h_idx++){
+                        in_h_idx = (int32_t) stride[0] * out_h_idx + (int32_t) dilation[0] * k_h_idx - padding[0];
+                        if(in_h_idx < 0 || in_h_idx >= H_in) continue;
+                        for(k_w_idx = 0; k_w_idx < K_w; k_w_idx++){
+                            in_w_idx = (int32_t) stride[1] * out_w_idx + (int32_t) dilation[1] * k_w_idx - padding[1];
+                            if(in_w_idx < 0 || in_w_idx >= W_in) continue;
+
+                            x_ptr = x_data + (((uint32_t) n_idx * H_in + in_h_idx) * W_in + in_w_idx) * C;
+                            dw_ptr = dw_data + ((uint32_t) k_h_idx * K_w + k_w_idx) * C_out;
+                            o_idx = 0;
+                            for(c_idx = 0; c_idx < C; c_idx++){
+                                x_value = x_ptr[c_idx];
+                                for(m_idx = 0; m_idx < M; m_idx++){
+                                    dw_ptr[o_idx] += dy_ptr[o_idx] * x_value;
+                                    o_idx++;
+                                }
+                            }
+                        }
+                    }
+                    dy_ptr += C_out;
+                }
+            }
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_depthwise_conv2d_bwd_full(
+                    const aitensor_t *delta_out,
+                    const uint16_t stride[2],    // [s_h, s_w]
+                    const uint16_t dilation[2],  // [d_h, d_w]
+                    const uint16_t padding[2],
+                    const aitensor_t *weights,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *delta_in)
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 4 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = delta_in->shape[0];
+    uint16_t C, H_in, W_in, C_out, H_out, W_out, K_h, K_w, M;
+    int32_t in_h_idx, in_w_idx;
+    uint16_t n_idx, c_idx, m_idx, o_idx, out_h_idx, out_w_idx, k_h_idx, k_w_idx;
+
+    const float *dy_ptr = (const float *) delta_out->data;
+    const float *w_data = (const float *) weights->data;
+    float *dx_data = (float *) delta_in->data;
+    const float *w_ptr;
+    float *dx_ptr;
+    float dy, sum;
+
+    aimath_f32_default_init_zeros(delta_in);
+
+    if(channel_uaxis == 1){ // Channels first
+        C = delta_in->shape[1]; H_in = delta_in->shape[2]; W_in = delta_in->shape[3];
+        C_out = delta_out->shape[1]; H_out = delta_out->shape[2]; W_out = delta_out->shape[3];
+        K_h = weights->shape[1]; K_w = weights->shape[2];
+        M = C_out / C;
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(o_idx = 0; o_idx < C_out; o_idx++){
+                dx_ptr = dx_data + ((uint32_t) n_idx * C + o_idx / M) * H_in * W_in;
+                w_ptr = w_data + (uint32_t) o_idx * K_h * K_w;
+                for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+                    for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                        dy = *dy_ptr++;
+                        for(k_h_idx = 0; k_h_idx < K_h; k_h_idx++){
+                            in_h_idx = (int32_t) stride[0] * out_h_idx + (int32_t) dilation[0] * k_h_idx - padding[0];
+                            if(in_h_idx < 0 || in_h_idx >= H_in) continue;
+                            for(k_w_idx = 0; k_w_idx < K_w; k_w_idx++){
+                                in_w_idx = (int32_t) stride[1] * out_w_idx + (int32_t) dilation[1] * k_w_idx - padding[1];
+                                if(in_w_idx < 0 || in_w_idx >= W_in) continue;
+                                dx_ptr[in_h_idx * W_in + in_w_idx] += dy * w_ptr[k_h_idx * K_w + k_w_idx];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    } else if(channel_uaxis == 3){ // Channels last
+        H_in = delta_in->shape[1]; W_in = delta_in->shape[2]; C = delta_in->shape[3];
+        H_out = delta_out->shape[1]; W_out = delta_out->shape[2]; C_out = delta_out->shape[3];
+        K_h = weights->shape[0]; K_w = weights->shape[1];
+        M = C_out / C;
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+                for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                    for(k_h_idx = 0; k_h_idx < K_h; k_h_idx++){
+                        in_h_idx = (int32_t) stride[0] * out_h_idx + (int32_t) dilation[0] * k_h_idx - padding[0];
+                        if(in_h_idx < 0 || in_h_idx >= H_in) continue;
+                        for(k_w_idx = 0; k_w_idx < K_w; k_w_idx++){
+                            in_w_idx = (int32_t) stride[1] * out_w_idx + (int32_t) dilation[1] * k_w_idx - padding[1];
+                            if(in_w_idx < 0 || in_w_idx >= W_in) continue;
+
+                            dx_ptr = dx_data + (((uint32_t) n_idx * H_in + in_h_idx) * W_in + in_w_idx) * C;
+                            w_ptr = w_data + ((uint32_t) k_h_idx * K_w + k_w_idx) * C_out;
+                            o_idx = 0;
+                            for(c_idx = 0; c_idx < C; c_idx++){
+                                sum = 0.0f;
+                                for(m_idx = 0; m_idx < M; m_idx++){
+                                    sum += dy_ptr[o_idx] * w_ptr[o_idx];
+                                    o_idx++;
+                                }
+                                dx_ptr[c_idx] += sum;
+                            }
+                        }
+                    }
+                    dy_ptr += C_out;
+                }
+            }
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_pointwise_conv2d_fwd(
+                    const aitensor_t *input,
+                    const uint16_t stride[2],    // [s_h, s_w]
+                    const uint16_t dilation[2],  // [d_h, d_w]
+                    const uint16_t padding[2],
+                    const aitensor_t *weights,
+                    const aitensor_t *bias,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *output)
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 4 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = input->shape[0];
+    uint16_t C, F;
+    uint32_t n_idx, f_idx, pixel_idx, pixel_count, block_size;
+
+    // 2D views on the 4D tensors for the GEMM kernel
+    uint16_t x_shape[2], w_shape[2], y_shape[2];
+    aitensor_t x_matrix = AITENSOR_2D_F32(x_shape, 0);
+    aitensor_t w_matrix = AITENSOR_2D_F32(w_shape, weights->data);
+    aitensor_t y_matrix = AITENSOR_2D_F32(y_shape, 0);
+    float *y_row;
+
+    if(channel_uaxis == 3){ // Channels last
+        // Y[N*H*W,F] = X[N*H*W,C] * W[F,C]^T + b
+        C = input->shape[3];
+        F = output->shape[3];
+        w_shape[0] = F;
+        w_shape[1] = C;
+        x_shape[1] = C;
+        y_shape[1] = F;
+
+        // The pixels are processed in blocks, because the tensor shapes are limited to 16 bit
+        pixel_count = (uint32_t) N * input->shape[1] * input->shape[2];
+        for(pixel_idx = 0; pixel_idx < pixel_count; pixel_idx += block_size){
+            block_size = pixel_count - pixel_idx > 0xFFFF ? 0xFFFF : pixel_count - pixel_idx;
+            x_shape[0] = block_size;
+            y_shape[0] = block_size;
+            x_matrix.data = (float *) input->data + pixel_idx * C;
+            y_matrix.data = (float *) output->data + pixel_idx * F;
+            aimath_f32_default_linear_bt(&x_matrix, &w_matrix, bias, &y_matrix);
+        }
+    } else if(channel_uaxis == 1){ // Channels first
+        // For every sample: Y[F,H*W] = W[F,C] * X[C,H*W] + b
+        C = input->shape[1];
+        F = output->shape[1];
+        pixel_count = (uint32_t) input->shape[2] * input->shape[3];
+        if(pixel_count > 0xFFFF){
+            aimath_f32_default_conv2d_fwd(input, stride, dilation, padding, weights, bias, channel_axis, work_space, output);
+            return;
+        }
+        w_shape[0] = F;
+        w_shape[1] = C;
+        x_shape[0] = C;
+        x_shape[1] = pixel_count;
+        y_shape[0] = F;
+        y_shape[1] = pixel_count;
+        for(n_idx = 0; n_idx < N; n_idx++){
+            x_matrix.data = (float *) input->data + n_idx * C * pixel_count;
+            y_matrix.data = (float *) output->data + n_idx * F * pixel_count;
+            aimath_f32_default_mat_mul(&w_matrix, &x_matrix, &y_matrix);
+            for(f_idx = 0; f_idx < F; f_idx++){
+                y_row = (float *) y_matrix.data + f_idx * pixel_count;
+                for(pixel_idx = 0; pixel_idx < pixel_count; pixel_idx++){
+                    y_row[pixel_idx] += ((float *) bias->data)[f_idx];
+                }
+            }
+        }
+    }
+    return;
+}
+
+
 void aimath_f32_default_conv_transpose2d_fwd(
                     const aitensor_t *input,
                     const uint16_t stride[2],    // [s_h, s_w]
@@ -969,58 +1499,1180 @@ void aimath_f32_default_maxpool2d_bwd(
     return;
 }
 
-void aimath_f32_default_batch_norm(const aitensor_t *x,
-                                            int8_t axis,
-                                            const aitensor_t *means,
-                                            const aitensor_t *variances,
-                                            const aitensor_t *offsets,
-                                            const aitensor_t *scales,
-                                            const void *eps,
-                                            aitensor_t *result)
+void aimath_f32_default_maxpool2d_fwd_hwc(
+                                      const aitensor_t *input,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      uint32_t *max_locations,
+                                      aitensor_t *output
+                                      )
 {
-    uint32_t i, j, k;
-    uint32_t idx_multiplier1 = 1, idx_multiplier2 = 1;
-    float scale, offset;
-    uint8_t uaxis = axis < 0 ? x->dim + axis : axis; // Negative axis = indexing from the end
+    // The maximum is calculated for all channels of a pixel at once (vector max over the contiguous channels)
+    uint16_t N = input->shape[0], H_in = input->shape[1], W_in = input->shape[2], C = input->shape[3];
+    uint16_t H_out = output->shape[1], W_out = output->shape[2];
+    int32_t in_h_idx, in_w_idx;
+    uint16_t n_idx, out_h_idx, out_w_idx, pool_h_idx, pool_w_idx, c_idx;
 
-    for(i = 0; i < uaxis; i++){
-        idx_multiplier1 *= x->shape[i];
-    }
-    for(i = uaxis+1; i < x->dim; i++){
-        idx_multiplier2 *= x->shape[i];
-    }
+    const float *x_data = (const float *) input->data;
+    const float *x_pixel;
+    float *y_pixel = (float *) output->data;
+    uint32_t *max_locations_pixel = max_locations;
 
-    for(i = 0; i < x->shape[uaxis]; i++){
-        scale = ((float *) scales->data)[i] / (sqrt(((float *) variances->data)[i] + *((float *) eps)));
-        offset = ((float *) offsets->data)[i] - ((float *) means->data)[i] * scale;
+    #ifdef AIDEBUG_SHAPE_CHECKS
+    if(H_out != (uint16_t)((H_in + 2 * padding[0] - pool_size[0]) / stride[0] + 1)
+       || W_out != (uint16_t)((W_in + 2 * padding[1] - pool_size[1]) / stride[1] + 1))
+    {
+        AILOG_E(aistring_error_f32_maxpool2d_default_1);
+        return;
+    }
+    #endif
 
-        for(j = 0; j < idx_multiplier1; j++){
-            for(k = 0; k < idx_multiplier2; k++){
-                ((float *) result->data)[i*idx_multiplier2 + j*idx_multiplier2*x->shape[uaxis] + k] =
-                    ((float *) x->data)[i*idx_multiplier2 + j*idx_multiplier2*x->shape[uaxis] + k] * scale + offset;
+    for(n_idx = 0; n_idx < N; n_idx++){
+        for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+            for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                for(c_idx = 0; c_idx < C; c_idx++){
+                    y_pixel[c_idx] = -FLT_MAX;
+                }
+                if(max_locations_pixel != NULL){
+                    for(c_idx = 0; c_idx < C; c_idx++){
+                        max_locations_pixel[c_idx] = 0;
+                    }
+                }
+                for(pool_h_idx = 0; pool_h_idx < pool_size[0]; pool_h_idx++){
+                    in_h_idx = (int32_t) stride[0] * out_h_idx + pool_h_idx - padding[0];
+                    // Minus infinity padding
+                    if(in_h_idx < 0 || in_h_idx >= H_in) continue;
+                    for(pool_w_idx = 0; pool_w_idx < pool_size[1]; pool_w_idx++){
+                        in_w_idx = (int32_t) stride[1] * out_w_idx + pool_w_idx - padding[1];
+                        if(in_w_idx < 0 || in_w_idx >= W_in) continue;
+
+                        x_pixel = x_data + (((uint32_t) n_idx * H_in + in_h_idx) * W_in + in_w_idx) * C;
+                        if(max_locations_pixel != NULL){
+                            // Save the position of the maximum for the backward pass
+                            for(c_idx = 0; c_idx < C; c_idx++){
+                                if(x_pixel[c_idx] > y_pixel[c_idx]){
+                                    y_pixel[c_idx] = x_pixel[c_idx];
+                                    max_locations_pixel[c_idx] = ((uint32_t) pool_h_idx << 16) | pool_w_idx;
+                                }
+                            }
+                        } else {
+                            for(c_idx = 0; c_idx < C; c_idx++){
+                                if(x_pixel[c_idx] > y_pixel[c_idx]){
+                                    y_pixel[c_idx] = x_pixel[c_idx];
+                                }
+                            }
+                        }
+                    }
+                }
+                y_pixel += C;
+                if(max_locations_pixel != NULL){
+                    max_locations_pixel += C;
+                }
             }
         }
     }
     return;
 }
 
-void aimath_f32_default_d_batch_norm(const aitensor_t *x_in,
-                                              int8_t axis,
-                                              const aitensor_t *means,
-                                              const aitensor_t *vars,
-                                              const aitensor_t *offsets,
-                                              const aitensor_t *scales,
-                                              const aitensor_t *delta_out,
-                                              const void *eps,
-                                              aitensor_t *delta_in,
-                                              aitensor_t *d_betas,
-                                              aitensor_t *d_gammas)
-{
-    uint32_t i, j, k, index;
+void aimath_f32_default_maxpool2d_bwd_hwc(
+                                      const aitensor_t *input,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      const uint32_t *max_locations,
+                                      aitensor_t *output
+                                      )
+{
+    uint16_t N = output->shape[0], H_in = output->shape[1], W_in = output->shape[2], C = output->shape[3];
+    uint16_t H_out = input->shape[1], W_out = input->shape[2];
+    uint16_t n_idx, out_h_idx, out_w_idx, c_idx;
+    uint32_t in_h_idx, in_w_idx;
+
+    const float *dy_pixel = (const float *) input->data;
+    const uint32_t *max_locations_pixel = max_locations;
+    float *dx_image;
+
+    aimath_f32_default_init_zeros(output);
+
+    for(n_idx = 0; n_idx < N; n_idx++){
+        dx_image = (float *) output->data + (uint32_t) n_idx * H_in * W_in * C;
+        for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+            for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                for(c_idx = 0; c_idx < C; c_idx++){
+                    in_h_idx = (uint32_t) out_h_idx * stride[0] + (max_locations_pixel[c_idx] >> 16) - padding[0];
+                    in_w_idx = (uint32_t) out_w_idx * stride[1] + (max_locations_pixel[c_idx] & 0x0000FFFF) - padding[1];
+                    dx_image[(in_h_idx * W_in + in_w_idx) * C + c_idx] += dy_pixel[c_idx];
+                }
+                dy_pixel += C;
+                max_locations_pixel += C;
+            }
+        }
+    }
+    return;
+}
+
+
+// Byte that stores the 2-bit max location of output element i (groups of 8 elements use 2 bytes, or 3 bytes with ReLU mask)
+#define AIMATH_MAXPOOL2D_2X2_CODE_BYTE(i, fused_relu)     (((i) >> 3) * ((fused_relu) ? 3 : 2) + (((i) & 7) >> 2))
+#define AIMATH_MAXPOOL2D_2X2_CODE_SHIFT(i)                (((i) & 3) << 1)
+// Byte that stores the ReLU mask bit of output element i
+#define AIMATH_MAXPOOL2D_2X2_MASK_BYTE(i)                 (((i) >> 3) * 3 + 2)
+
+static void aimath_f32_default_maxpool2d_2x2_window(const float *x_ptr, uint32_t step_w, uint32_t step_h, uint32_t out_idx,
+                                                    uint8_t fused_relu, uint8_t *locations, float *y_data)
+{
+    uint8_t code = 0;
+    float max = x_ptr[0];
+
+    // The code of the max location is (h_offset * 2 + w_offset); the first maximum wins
+    if(x_ptr[step_w] > max){
+        max = x_ptr[step_w];
+        code = 1;
+    }
+    if(x_ptr[step_h] > max){
+        max = x_ptr[step_h];
+        code = 2;
+    }
+    if(x_ptr[step_h + step_w] > max){
+        max = x_ptr[step_h + step_w];
+        code = 3;
+    }
+
+    if(locations != NULL){
+        if((out_idx & 3) == 0){
+            locations[AIMATH_MAXPOOL2D_2X2_CODE_BYTE(out_idx, fused_relu)] = 0;
+        }
+        locations[AIMATH_MAXPOOL2D_2X2_CODE_BYTE(out_idx, fused_relu)] |= code << AIMATH_MAXPOOL2D_2X2_CODE_SHIFT(out_idx);
+        if(fused_relu){
+            if((out_idx & 7) == 0){
+                locations[AIMATH_MAXPOOL2D_2X2_MASK_BYTE(out_idx)] = 0;
+            }
+            // The gradient of the ReLU is passed where max >= 0 (same as aimath_f32_default_d_relu())
+            if(max >= 0.0f){
+                locations[AIMATH_MAXPOOL2D_2X2_MASK_BYTE(out_idx)] |= 1 << (out_idx & 7);
+            }
+        }
+    }
+
+    // max(relu(x)) = relu(max(x)) -> ReLU on the pooled value only
+    if(fused_relu && max < 0.0f){
+        max = 0.0f;
+    }
+    y_data[out_idx] = max;
+    return;
+}
+
+static void aimath_f32_default_maxpool2d_2x2_fwd_internal(const aitensor_t *input, int8_t channel_axis, uint8_t fused_relu, uint8_t *locations, aitensor_t *output)
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 4 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = input->shape[0];
+    uint16_t C, H_in, W_in, H_out, W_out;
+    uint16_t n_idx, c_idx, out_h_idx, out_w_idx;
+    uint32_t out_idx = 0;
+
+    const float *x_data = (const float *) input->data;
+    float *y_data = (float *) output->data;
+
+    if(channel_uaxis == 1){ // Channels first
+        C = input->shape[1]; H_in = input->shape[2]; W_in = input->shape[3];
+        H_out = output->shape[2]; W_out = output->shape[3];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(c_idx = 0; c_idx < C; c_idx++){
+                for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+                    for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                        aimath_f32_default_maxpool2d_2x2_window(
+                                x_data + (((uint32_t) n_idx * C + c_idx) * H_in + 2 * out_h_idx) * W_in + 2 * out_w_idx,
+                                1, W_in, out_idx, fused_relu, locations, y_data);
+                        out_idx++;
+                    }
+                }
+            }
+        }
+    } else { // Channels last
+        H_in = input->shape[1]; W_in = input->shape[2]; C = input->shape[3];
+        H_out = output->shape[1]; W_out = output->shape[2];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+                for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                    for(c_idx = 0; c_idx < C; c_idx++){
+                        aimath_f32_default_maxpool2d_2x2_window(
+                                x_data + (((uint32_t) n_idx * H_in + 2 * out_h_idx) * W_in + 2 * out_w_idx) * C + c_idx,
+                                C, (uint32_t) W_in * C, out_idx, fused_relu, locations, y_data);
+                        out_idx++;
+                    }
+                }
+            }
+        }
+    }
+    return;
+}
+
+static void aimath_f32_default_maxpool2d_2x2_window_bwd(float *dx_ptr, uint32_t step_w, uint32_t step_h, uint32_t out_idx,
+                                                        uint8_t fused_relu, const uint8_t *locations, const float *dy_data)
+{
+    uint8_t code;
+
+    if(fused_relu && !((locations[AIMATH_MAXPOOL2D_2X2_MASK_BYTE(out_idx)] >> (out_idx & 7)) & 0x01)){
+        return;
+    }
+    code = (locations[AIMATH_MAXPOOL2D_2X2_CODE_BYTE(out_idx, fused_relu)] >> AIMATH_MAXPOOL2D_2X2_CODE_SHIFT(out_idx)) & 0x03;
+    // The pooling windows don't overlap -> The gradient can simply be written
+    dx_ptr[(code >> 1) * step_h + (code & 0x01) * step_w] = dy_data[out_idx];
+    return;
+}
+
+static void aimath_f32_default_maxpool2d_2x2_bwd_internal(const aitensor_t *delta_out, int8_t channel_axis, uint8_t fused_relu, const uint8_t *locations, aitensor_t *delta_in)
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 4 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = delta_in->shape[0];
+    uint16_t C, H_in, W_in, H_out, W_out;
+    uint16_t n_idx, c_idx, out_h_idx, out_w_idx;
+    uint32_t out_idx = 0;
+
+    const float *dy_data = (const float *) delta_out->data;
+    float *dx_data = (float *) delta_in->data;
+
+    aimath_f32_default_init_zeros(delta_in);
+
+    if(channel_uaxis == 1){ // Channels first
+        C = delta_in->shape[1]; H_in = delta_in->shape[2]; W_in = delta_in->shape[3];
+        H_out = delta_out->shape[2]; W_out = delta_out->shape[3];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(c_idx = 0; c_idx < C; c_idx++){
+                for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+                    for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                        aimath_f32_default_maxpool2d_2x2_window_bwd(
+                                dx_data + (((uint32_t) n_idx * C + c_idx) * H_in + 2 * out_h_idx) * W_in + 2 * out_w_idx,
+                                1, W_in, out_idx, fused_relu, locations, dy_data);
+                        out_idx++;
+                    }
+                }
+            }
+        }
+    } else { // Channels last
+        H_in = delta_in->shape[1]; W_in = delta_in->shape[2]; C = delta_in->shape[3];
+        H_out = delta_out->shape[1]; W_out = delta_out->shape[2];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+                for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                    for(c_idx = 0; c_idx < C; c_idx++){
+                        aimath_f32_default_maxpool2d_2x2_window_bwd(
+                                dx_data + (((uint32_t) n_idx * H_in + 2 * out_h_idx) * W_in + 2 * out_w_idx) * C + c_idx,
+                                C, (uint32_t) W_in * C, out_idx, fused_relu, locations, dy_data);
+                        out_idx++;
+                    }
+                }
+            }
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_maxpool2d_2x2_fwd(
+                                      const aitensor_t *input,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      uint32_t *max_locations,
+                                      aitensor_t *output
+                                      )
+{
+    aimath_f32_default_maxpool2d_2x2_fwd_internal(input, channel_axis, 0, (uint8_t *) max_locations, output);
+    return;
+}
+
+void aimath_f32_default_maxpool2d_2x2_bwd(
+                                      const aitensor_t *delta_out,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      const uint32_t *max_locations,
+                                      aitensor_t *delta_in
+                                      )
+{
+    aimath_f32_default_maxpool2d_2x2_bwd_internal(delta_out, channel_axis, 0, (const uint8_t *) max_locations, delta_in);
+    return;
+}
+
+void aimath_f32_default_maxpool2d_2x2_relu_fwd(
+                                      const aitensor_t *input,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      uint32_t *max_locations,
+                                      aitensor_t *output
+                                      )
+{
+    aimath_f32_default_maxpool2d_2x2_fwd_internal(input, channel_axis, 1, (uint8_t *) max_locations, output);
+    return;
+}
+
+void aimath_f32_default_maxpool2d_2x2_relu_bwd(
+                                      const aitensor_t *delta_out,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      const uint32_t *max_locations,
+                                      aitensor_t *delta_in
+                                      )
+{
+    aimath_f32_default_maxpool2d_2x2_bwd_internal(delta_out, channel_axis, 1, (const uint8_t *) max_locations, delta_in);
+    return;
+}
+
+AISTRING_STORAGE_WRAPPER(aistring_error_f32_avgpool2d_default_1, "[aimath_f32_default_avgpool2d] AvgPool2D output shape doesn't match.\n");
+
+void aimath_f32_default_avgpool2d_fwd(
+                                      const aitensor_t *input,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      aitensor_t *output
+                                      )
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 4 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = input->shape[0];
+    uint16_t C, H_in, W_in, H_out, W_out;
+    int32_t in_h_idx, in_w_idx;
+    uint16_t n_idx, c_idx, out_h_idx, out_w_idx, pool_h_idx, pool_w_idx;
+
+    // Zero padding is included in the average -> constant divisor
+    float factor = 1.0f / ((float) pool_size[0] * pool_size[1]);
+    const float *x_data = (const float *) input->data;
+    const float *x_ptr;
+    float *y_ptr = (float *) output->data;
+    float sum;
+
+    if(channel_uaxis == 1){ // Channels first
+        C = input->shape[1]; H_in = input->shape[2]; W_in = input->shape[3];
+        H_out = output->shape[2]; W_out = output->shape[3];
+    } else { // Channels last
+        H_in = input->shape[1]; W_in = input->shape[2]; C = input->shape[3];
+        H_out = output->shape[1]; W_out = output->shape[2];
+    }
+
+    #ifdef AIDEBUG_SHAPE_CHECKS
+    if(H_out != (uint16_t)((H_in + 2 * padding[0] - pool_size[0]) / stride[0] + 1)
+       || W_out != (uint16_t)((W_in + 2 * padding[1] - pool_size[1]) / stride[1] + 1))
+    {
+        AILOG_E(aistring_error_f32_avgpool2d_default_1);
+        return;
+    }
+    #endif
+
+    if(channel_uaxis == 1){ // Channels first
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(c_idx = 0; c_idx < C; c_idx++){
+                x_ptr = x_data + ((uint32_t) n_idx * C + c_idx) * H_in * W_in;
+                for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+                    for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                        sum = 0.0f;
+                        for(pool_h_idx = 0; pool_h_idx < pool_size[0]; pool_h_idx++){
+                            in_h_idx = (int32_t) stride[0] * out_h_idx + pool_h_idx - padding[0];
+                            // Zero padding
+                            if(in_h_idx < 0 || in_h_idx >= H_in) continue;
+                            for(pool_w_idx = 0; pool_w_idx < pool_size[1]; pool_w_idx++){
+                                in_w_idx = (int32_t) stride[1] * out_w_idx + pool_w_idx - padding[1];
+                                if(in_w_idx < 0 || in_w_idx >= W_in) continue;
+                                sum += x_ptr[in_h_idx * W_in + in_w_idx];
+                            }
+                        }
+                        *y_ptr++ = sum * factor;
+                    }
+                }
+            }
+        }
+    } else { // Channels last
+        // The sums are accumulated for all channels of a pixel at once
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+                for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                    for(c_idx = 0; c_idx < C; c_idx++){
+                        y_ptr[c_idx] = 0.0f;
+                    }
+                    for(pool_h_idx = 0; pool_h_idx < pool_size[0]; pool_h_idx++){
+                        in_h_idx = (int32_t) stride[0] * out_h_idx + pool_h_idx - padding[0];
+                        if(in_h_idx < 0 || in_h_idx >= H_in) continue;
+                        for(pool_w_idx = 0; pool_w_idx < pool_size[1]; pool_w_idx++){
+                            in_w_idx = (int32_t) stride[1] * out_w_idx + pool_w_idx - padding[1];
+                            if(in_w_idx < 0 || in_w_idx >= W_in) continue;
+
+                            x_ptr = x_data + (((uint32_t) n_idx * H_in + in_h_idx) * W_in + in_w_idx) * C;
+                            for(c_idx = 0; c_idx < C; c_idx++){
+                                y_ptr[c_idx] += x_ptr[c_idx];
+                            }
+                        }
+                    }
+                    for(c_idx = 0; c_idx < C; c_idx++){
+                        y_ptr[c_idx] *= factor;
+                    }
+                    y_ptr += C;
+                }
+            }
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_avgpool2d_bwd(
+                                      const aitensor_t *delta_out,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      aitensor_t *delta_in
+                                      )
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 4 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = delta_in->shape[0];
+    uint16_t C, H_in, W_in, H_out, W_out;
+    int32_t in_h_idx, in_w_idx;
+    uint16_t n_idx, c_idx, out_h_idx, out_w_idx, pool_h_idx, pool_w_idx;
+
+    float factor = 1.0f / ((float) pool_size[0] * pool_size[1]);
+    const float *dy_ptr = (const float *) delta_out->data;
+    float *dx_data = (float *) delta_in->data;
+    float *dx_ptr;
+    float dy_value;
+
+    aimath_f32_default_init_zeros(delta_in);
+
+    if(channel_uaxis == 1){ // Channels first
+        C = delta_in->shape[1]; H_in = delta_in->shape[2]; W_in = delta_in->shape[3];
+        H_out = delta_out->shape[2]; W_out = delta_out->shape[3];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(c_idx = 0; c_idx < C; c_idx++){
+                dx_ptr = dx_data + ((uint32_t) n_idx * C + c_idx) * H_in * W_in;
+                for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+                    for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                        // Every input of the window gets the same share of the output gradient
+                        dy_value = *dy_ptr++ * factor;
+                        for(pool_h_idx = 0; pool_h_idx < pool_size[0]; pool_h_idx++){
+                            in_h_idx = (int32_t) stride[0] * out_h_idx + pool_h_idx - padding[0];
+                            if(in_h_idx < 0 || in_h_idx >= H_in) continue;
+                            for(pool_w_idx = 0; pool_w_idx < pool_size[1]; pool_w_idx++){
+                                in_w_idx = (int32_t) stride[1] * out_w_idx + pool_w_idx - padding[1];
+                                if(in_w_idx < 0 || in_w_idx >= W_in) continue;
+                                dx_ptr[in_h_idx * W_in + in_w_idx] += dy_value;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    } else { // Channels last
+        H_in = delta_in->shape[1]; W_in = delta_in->shape[2]; C = delta_in->shape[3];
+        H_out = delta_out->shape[1]; W_out = delta_out->shape[2];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+                for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                    for(pool_h_idx = 0; pool_h_idx < pool_size[0]; pool_h_idx++){
+                        in_h_idx = (int32_t) stride[0] * out_h_idx + pool_h_idx - padding[0];
+                        if(in_h_idx < 0 || in_h_idx >= H_in) continue;
+                        for(pool_w_idx = 0; pool_w_idx < pool_size[1]; pool_w_idx++){
+                            in_w_idx = (int32_t) stride[1] * out_w_idx + pool_w_idx - padding[1];
+                            if(in_w_idx < 0 || in_w_idx >= W_in) continue;
+
+                            dx_ptr = dx_data + (((uint32_t) n_idx * H_in + in_h_idx) * W_in + in_w_idx) * C;
+                            for(c_idx = 0; c_idx < C; c_idx++){
+                                dx_ptr[c_idx] += dy_ptr[c_idx] * factor;
+                            }
+                        }
+                    }
+                    dy_ptr += C;
+                }
+            }
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_global_avgpool2d_fwd(const aitensor_t *input, int8_t channel_axis, void *work_space, aitensor_t *output)
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 4 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = input->shape[0];
+    uint16_t C;
+    uint32_t HW, n_idx, c_idx, hw_idx;
+
+    const float *x_ptr = (const float *) input->data;
+    float *y_ptr = (float *) output->data;
+    float sum, factor;
+
+    if(channel_uaxis == 1){ // Channels first
+        C = input->shape[1];
+        HW = (uint32_t) input->shape[2] * input->shape[3];
+        factor = 1.0f / (float) HW;
+
+        // Every channel is a contiguous block of H*W values
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(c_idx = 0; c_idx < C; c_idx++){
+                sum = 0.0f;
+                for(hw_idx = 0; hw_idx < HW; hw_idx++){
+                    sum += x_ptr[hw_idx];
+                }
+                *y_ptr++ = sum * factor;
+                x_ptr += HW;
+            }
+        }
+    } else { // Channels last
+        C = input->shape[3];
+        HW = (uint32_t) input->shape[1] * input->shape[2];
+        factor = 1.0f / (float) HW;
+
+        // Single pass over the input: every pixel is added to the channel sums
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(c_idx = 0; c_idx < C; c_idx++){
+                y_ptr[c_idx] = 0.0f;
+            }
+            for(hw_idx = 0; hw_idx < HW; hw_idx++){
+                for(c_idx = 0; c_idx < C; c_idx++){
+                    y_ptr[c_idx] += x_ptr[c_idx];
+                }
+                x_ptr += C;
+            }
+            for(c_idx = 0; c_idx < C; c_idx++){
+                y_ptr[c_idx] *= factor;
+            }
+            y_ptr += C;
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_global_avgpool2d_bwd(const aitensor_t *delta_out, int8_t channel_axis, aitensor_t *delta_in)
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 4 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = delta_in->shape[0];
+    uint16_t C;
+    uint32_t HW, n_idx, c_idx, hw_idx;
+
+    const float *dy_ptr = (const float *) delta_out->data;
+    float *dx_ptr = (float *) delta_in->data;
+    float dy_value, factor;
+
+    if(channel_uaxis == 1){ // Channels first
+        C = delta_in->shape[1];
+        HW = (uint32_t) delta_in->shape[2] * delta_in->shape[3];
+        factor = 1.0f / (float) HW;
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(c_idx = 0; c_idx < C; c_idx++){
+                dy_value = *dy_ptr++ * factor;
+                for(hw_idx = 0; hw_idx < HW; hw_idx++){
+                    dx_ptr[hw_idx] = dy_value;
+                }
+                dx_ptr += HW;
+            }
+        }
+    } else { // Channels last
+        C = delta_in->shape[3];
+        HW = (uint32_t) delta_in->shape[1] * delta_in->shape[2];
+        factor = 1.0f / (float) HW;
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(hw_idx = 0; hw_idx < HW; hw_idx++){
+                for(c_idx = 0; c_idx < C; c_idx++){
+                    dx_ptr[c_idx] = dy_ptr[c_idx] * factor;
+                }
+                dx_ptr += C;
+            }
+            dy_ptr += C;
+        }
+    }
+    return;
+}
+
+// Range of the kernel taps [k_begin, k_end) that hit the input for a window starting at input position start
+static void aimath_f32_default_conv1d_tap_range(int32_t start, uint16_t dilation, uint16_t kernel_size, uint16_t length,
+                                                uint16_t *k_begin, uint16_t *k_end)
+{
+    int32_t last = (int32_t) length - 1 - start;
+
+    *k_begin = start < 0 ? (uint16_t) ((-start + dilation - 1) / dilation) : 0;
+    if(last < 0){
+        *k_end = 0;
+    } else {
+        *k_end = (uint16_t) (last / dilation + 1 < kernel_size ? last / dilation + 1 : kernel_size);
+    }
+    if(*k_end < *k_begin){
+        *k_end = *k_begin;
+    }
+}
+
+void aimath_f32_default_conv1d_fwd(
+                    const aitensor_t *input,
+                    uint16_t stride,
+                    uint16_t dilation,
+                    uint16_t padding,
+                    const aitensor_t *weights,
+                    const aitensor_t *bias,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *output)
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 3 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = input->shape[0], F = weights->shape[0];
+    uint16_t C, L_in, L_out, K;
+    uint16_t n_idx, f_idx, c_idx, t_idx, k_idx, k_begin, k_end;
+    uint32_t i, len;
+    int32_t start;
+
+    const float *x_data = (const float *) input->data;
+    const float *w_data = (const float *) weights->data;
+    const float *bias_data = (const float *) bias->data;
+    const float *x_ptr, *w_ptr;
+    float *y_ptr = (float *) output->data;
+    float sum;
+
+    if(channel_uaxis == 1){ // Channels first: input [N,C,L], weights [F,C,K]
+        C = input->shape[1]; L_in = input->shape[2];
+        L_out = output->shape[2]; K = weights->shape[2];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(f_idx = 0; f_idx < F; f_idx++){
+                for(t_idx = 0; t_idx < L_out; t_idx++){
+                    start = (int32_t) t_idx * stride - padding;
+                    aimath_f32_default_conv1d_tap_range(start, dilation, K, L_in, &k_begin, &k_end);
+                    len = k_end - k_begin;
+
+                    sum = bias_data[f_idx];
+                    for(c_idx = 0; c_idx < C; c_idx++){
+                        x_ptr = x_data + ((uint32_t) n_idx * C + c_idx) * L_in + start + (int32_t) k_begin * dilation;
+                        w_ptr = w_data + ((uint32_t) f_idx * C + c_idx) * K + k_begin;
+                        if(dilation == 1){
+                            // Contiguous sliding dot product
+                            for(i = 0; i < len; i++){
+                                sum += x_ptr[i] * w_ptr[i];
+                            }
+                        } else {
+                            for(i = 0; i < len; i++){
+                                sum += x_ptr[i * dilation] * w_ptr[i];
+                            }
+                        }
+                    }
+                    *y_ptr++ = sum;
+                }
+            }
+        }
+    } else { // Channels last: input [N,L,C], weights [F,K,C]
+        L_in = input->shape[1]; C = input->shape[2];
+        L_out = output->shape[1]; K = weights->shape[1];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(t_idx = 0; t_idx < L_out; t_idx++){
+                start = (int32_t) t_idx * stride - padding;
+                aimath_f32_default_conv1d_tap_range(start, dilation, K, L_in, &k_begin, &k_end);
+
+                for(f_idx = 0; f_idx < F; f_idx++){
+                    x_ptr = x_data + ((uint32_t) n_idx * L_in + start + (int32_t) k_begin * dilation) * C;
+                    w_ptr = w_data + ((uint32_t) f_idx * K + k_begin) * C;
+                    sum = bias_data[f_idx];
+                    if(dilation == 1){
+                        // The whole window is one contiguous block of (k_end - k_begin) * C values
+                        len = (uint32_t) (k_end - k_begin) * C;
+                        for(i = 0; i < len; i++){
+                            sum += x_ptr[i] * w_ptr[i];
+                        }
+                    } else {
+                        for(k_idx = k_begin; k_idx < k_end; k_idx++){
+                            for(c_idx = 0; c_idx < C; c_idx++){
+                                sum += x_ptr[c_idx] * w_ptr[c_idx];
+                            }
+                            x_ptr += (uint32_t) dilation * C;
+                            w_ptr += C;
+                        }
+                    }
+                    y_ptr[f_idx] = sum;
+                }
+                y_ptr += F;
+            }
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_conv1d_bwd(
+                    const aitensor_t *x_in,
+                    uint16_t stride,
+                    uint16_t dilation,
+                    uint16_t padding,
+                    const aitensor_t *delta_out,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *d_weights)
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 3 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = x_in->shape[0], F = d_weights->shape[0];
+    uint16_t C, L_in, L_out, K;
+    uint16_t n_idx, f_idx, c_idx, t_idx, k_idx, k_begin, k_end;
+    uint32_t i, len;
+    int32_t start;
+
+    const float *x_data = (const float *) x_in->data;
+    const float *dy_data = (const float *) delta_out->data;
+    float *dw_data = (float *) d_weights->data;
+    const float *x_ptr;
+    float *dw_ptr;
+    float dy;
+
+    aimath_f32_default_init_zeros(d_weights);
+
+    if(channel_uaxis == 1){ // Channels first: input [N,C,L], weights [F,C,K]
+        C = x_in->shape[1]; L_in = x_in->shape[2];
+        L_out = delta_out->shape[2]; K = d_weights->shape[2];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(f_idx = 0; f_idx < F; f_idx++){
+                for(t_idx = 0; t_idx < L_out; t_idx++){
+                    dy = dy_data[((uint32_t) n_idx * F + f_idx) * L_out + t_idx];
+                    start = (int32_t) t_idx * stride - padding;
+                    aimath_f32_default_conv1d_tap_range(start, dilation, K, L_in, &k_begin, &k_end);
+                    len = k_end - k_begin;
+
+                    for(c_idx = 0; c_idx < C; c_idx++){
+                        x_ptr = x_data + ((uint32_t) n_idx * C + c_idx) * L_in + start + (int32_t) k_begin * dilation;
+                        dw_ptr = dw_data + ((uint32_t) f_idx * C + c_idx) * K + k_begin;
+                        for(i = 0; i < len; i++){
+                            dw_ptr[i] += dy * x_ptr[i * dilation];
+                        }
+                    }
+                }
+            }
+        }
+    } else { // Channels last: input [N,L,C], weights [F,K,C]
+        L_in = x_in->shape[1]; C = x_in->shape[2];
+        L_out = delta_out->shape[1]; K = d_weights->shape[1];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(t_idx = 0; t_idx < L_out; t_idx++){
+                start = (int32_t) t_idx * stride - padding;
+                aimath_f32_default_conv1d_tap_range(start, dilation, K, L_in, &k_begin, &k_end);
+
+                for(f_idx = 0; f_idx < F; f_idx++){
+                    dy = dy_data[((uint32_t) n_idx * L_out + t_idx) * F + f_idx];
+                    x_ptr = x_data + ((uint32_t) n_idx * L_in + start + (int32_t) k_begin * dilation) * C;
+                    dw_ptr = dw_data + ((uint32_t) f_idx * K + k_begin) * C;
+                    if(dilation == 1){
+                        len = (uint32_t) (k_end - k_begin) * C;
+                        for(i = 0; i < len; i++){
+                            dw_ptr[i] += dy * x_ptr[i];
+                        }
+                    } else {
+                        for(k_idx = k_begin; k_idx < k_end; k_idx++){
+                            for(c_idx = 0; c_idx < C; c_idx++){
+                                dw_ptr[c_idx] += dy * x_ptr[c_idx];
+                            }
+                            x_ptr += (uint32_t) dilation * C;
+                            dw_ptr += C;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_conv1d_bwd_full(
+                    const aitensor_t *delta_out,
+                    uint16_t stride,
+                    uint16_t dilation,
+                    uint16_t padding,
+                    const aitensor_t *weights,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *delta_in)
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 3 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = delta_in->shape[0], F = weights->shape[0];
+    uint16_t C, L_in, L_out, K;
+    uint16_t n_idx, f_idx, c_idx, t_idx, k_idx, k_begin, k_end;
+    uint32_t i, len;
+    int32_t start;
+
+    const float *dy_data = (const float *) delta_out->data;
+    const float *w_data = (const float *) weights->data;
+    float *dx_data = (float *) delta_in->data;
+    const float *w_ptr;
+    float *dx_ptr;
+    float dy;
+
+    aimath_f32_default_init_zeros(delta_in);
+
+    if(channel_uaxis == 1){ // Channels first: input [N,C,L], weights [F,C,K]
+        C = delta_in->shape[1]; L_in = delta_in->shape[2];
+        L_out = delta_out->shape[2]; K = weights->shape[2];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(f_idx = 0; f_idx < F; f_idx++){
+                for(t_idx = 0; t_idx < L_out; t_idx++){
+                    dy = dy_data[((uint32_t) n_idx * F + f_idx) * L_out + t_idx];
+                    start = (int32_t) t_idx * stride - padding;
+                    aimath_f32_default_conv1d_tap_range(start, dilation, K, L_in, &k_begin, &k_end);
+                    len = k_end - k_begin;
+
+                    for(c_idx = 0; c_idx < C; c_idx++){
+                        dx_ptr = dx_data + ((uint32_t) n_idx * C + c_idx) * L_in + start + (int32_t) k_begin * dilation;
+                        w_ptr = w_data + ((uint32_t) f_idx * C + c_idx) * K + k_begin;
+                        for(i = 0; i < len; i++){
+                            dx_ptr[i * dilation] += dy * w_ptr[i];
+                        }
+                    }
+                }
+            }
+        }
+    } else { // Channels last: input [N,L,C], weights [F,K,C]
+        L_in = delta_in->shape[1]; C = delta_in->shape[2];
+        L_out = delta_out->shape[1]; K = weights->shape[1];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(t_idx = 0; t_idx < L_out; t_idx++){
+                start = (int32_t) t_idx * stride - padding;
+                aimath_f32_default_conv1d_tap_range(start, dilation, K, L_in, &k_begin, &k_end);
+
+                for(f_idx = 0; f_idx < F; f_idx++){
+                    dy = dy_data[((uint32_t) n_idx * L_out + t_idx) * F + f_idx];
+                    dx_ptr = dx_data + ((uint32_t) n_idx * L_in + start + (int32_t) k_begin * dilation) * C;
+                    w_ptr = w_data + ((uint32_t) f_idx * K + k_begin) * C;
+                    if(dilation == 1){
+                        len = (uint32_t) (k_end - k_begin) * C;
+                        for(i = 0; i < len; i++){
+                            dx_ptr[i] += dy * w_ptr[i];
+                        }
+                    } else {
+                        for(k_idx = k_begin; k_idx < k_end; k_idx++){
+                            for(c_idx = 0; c_idx < C; c_idx++){
+                                dx_ptr[c_idx] += dy * w_ptr[c_idx];
+                            }
+                            dx_ptr += (uint32_t) dilation * C;
+                            w_ptr += C;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_maxpool1d_fwd(
+                                      const aitensor_t *input,
+                                      uint16_t pool_size,
+                                      uint16_t stride,
+                                      uint16_t padding,
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      uint32_t *max_locations,
+                                      aitensor_t *output
+                                      )
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 3 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = input->shape[0];
+    uint16_t C, L_in, L_out;
+    uint32_t x_c, x_l, y_c, y_l; // Index multipliers
+    uint16_t n_idx, c_idx, t_idx, k_idx, k_begin, k_end;
+    uint32_t max_idx, y_idx;
+    int32_t start;
+
+    const float *x_data = (const float *) input->data;
+    const float *x_ptr;
+    float *y_data = (float *) output->data;
+    float max;
+
+    if(channel_uaxis == 1){ // Channels first: [N,C,L]
+        C = input->shape[1]; L_in = input->shape[2]; L_out = output->shape[2];
+        x_c = L_in; x_l = 1;
+        y_c = L_out; y_l = 1;
+    } else { // Channels last: [N,L,C]
+        L_in = input->shape[1]; C = input->shape[2]; L_out = output->shape[1];
+        x_c = 1; x_l = C;
+        y_c = 1; y_l = C;
+    }
+
+    for(n_idx = 0; n_idx < N; n_idx++){
+        for(t_idx = 0; t_idx < L_out; t_idx++){
+            start = (int32_t) t_idx * stride - padding;
+            aimath_f32_default_conv1d_tap_range(start, 1, pool_size, L_in, &k_begin, &k_end);
+
+            for(c_idx = 0; c_idx < C; c_idx++){
+                x_ptr = x_data + (uint32_t) n_idx * C * L_in + c_idx * x_c;
+                max = -FLT_MAX;
+                max_idx = AIMATH_POOL1D_NO_LOCATION; // Window lies completely in the padding
+                for(k_idx = k_begin; k_idx < k_end; k_idx++){
+                    if(x_ptr[(start + k_idx) * x_l] > max){
+                        max = x_ptr[(start + k_idx) * x_l];
+                        max_idx = start + k_idx;
+                    }
+                }
+                y_idx = (uint32_t) n_idx * C * L_out + c_idx * y_c + t_idx * y_l;
+                y_data[y_idx] = max;
+                // Save the input position of the maximum for the backward pass (not needed for inference only)
+                if(max_locations != NULL){
+                    max_locations[y_idx] = max_idx;
+                }
+            }
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_maxpool1d_bwd(
+                                      const aitensor_t *delta_out,
+                                      uint16_t pool_size,
+                                      uint16_t stride,
+                                      uint16_t padding,
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      const uint32_t *max_locations,
+                                      aitensor_t *delta_in
+                                      )
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 3 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = delta_in->shape[0];
+    uint16_t C, L_in, L_out;
+    uint32_t x_c, x_l, y_c, y_l; // Index multipliers
+    uint16_t n_idx, c_idx, t_idx;
+    uint32_t y_idx;
+
+    const float *dy_data = (const float *) delta_out->data;
+    float *dx_data = (float *) delta_in->data;
+
+    if(channel_uaxis == 1){ // Channels first: [N,C,L]
+        C = delta_in->shape[1]; L_in = delta_in->shape[2]; L_out = delta_out->shape[2];
+        x_c = L_in; x_l = 1;
+        y_c = L_out; y_l = 1;
+    } else { // Channels last: [N,L,C]
+        L_in = delta_in->shape[1]; C = delta_in->shape[2]; L_out = delta_out->shape[1];
+        x_c = 1; x_l = C;
+        y_c = 1; y_l = C;
+    }
+
+    aimath_f32_default_init_zeros(delta_in);
+
+    for(n_idx = 0; n_idx < N; n_idx++){
+        for(c_idx = 0; c_idx < C; c_idx++){
+            for(t_idx = 0; t_idx < L_out; t_idx++){
+                y_idx = (uint32_t) n_idx * C * L_out + c_idx * y_c + t_idx * y_l;
+                if(max_locations[y_idx] != AIMATH_POOL1D_NO_LOCATION){
+                    dx_data[(uint32_t) n_idx * C * L_in + c_idx * x_c + max_locations[y_idx] * x_l] += dy_data[y_idx];
+                }
+            }
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_avgpool1d_fwd(
+                                      const aitensor_t *input,
+                                      uint16_t pool_size,
+                                      uint16_t stride,
+                                      uint16_t padding,
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      aitensor_t *output
+                                      )
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 3 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = input->shape[0];
+    uint16_t C, L_in, L_out;
+    uint16_t n_idx, c_idx, t_idx, k_idx, k_begin, k_end;
+    int32_t start;
+
+    // Zero padding is included in the average -> constant divisor
+    float factor = 1.0f / (float) pool_size;
+    const float *x_data = (const float *) input->data;
+    const float *x_ptr;
+    float *y_ptr = (float *) output->data;
+    float sum;
+
+    if(channel_uaxis == 1){ // Channels first: [N,C,L]
+        C = input->shape[1]; L_in = input->shape[2]; L_out = output->shape[2];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(c_idx = 0; c_idx < C; c_idx++){
+                x_ptr = x_data + ((uint32_t) n_idx * C + c_idx) * L_in;
+                for(t_idx = 0; t_idx < L_out; t_idx++){
+                    start = (int32_t) t_idx * stride - padding;
+                    aimath_f32_default_conv1d_tap_range(start, 1, pool_size, L_in, &k_begin, &k_end);
+                    sum = 0.0f;
+                    for(k_idx = k_begin; k_idx < k_end; k_idx++){
+                        sum += x_ptr[start + k_idx];
+                    }
+                    *y_ptr++ = sum * factor;
+                }
+            }
+        }
+    } else { // Channels last: [N,L,C]
+        L_in = input->shape[1]; C = input->shape[2]; L_out = output->shape[1];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(t_idx = 0; t_idx < L_out; t_idx++){
+                start = (int32_t) t_idx * stride - padding;
+                aimath_f32_default_conv1d_tap_range(start, 1, pool_size, L_in, &k_begin, &k_end);
+                for(c_idx = 0; c_idx < C; c_idx++){
+                    y_ptr[c_idx] = 0.0f;
+                }
+                // Add the input rows of the window to the channel sums
+                for(k_idx = k_begin; k_idx < k_end; k_idx++){
+                    x_ptr = x_data + ((uint32_t) n_idx * L_in + start + k_idx) * C;
+                    for(c_idx = 0; c_idx < C; c_idx++){
+                        y_ptr[c_idx] += x_ptr[c_idx];
+                    }
+                }
+                for(c_idx = 0; c_idx < C; c_idx++){
+                    y_ptr[c_idx] *= factor;
+                }
+                y_ptr += C;
+            }
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_avgpool1d_bwd(
+                                      const aitensor_t *delta_out,
+                                      uint16_t pool_size,
+                                      uint16_t stride,
+                                      uint16_t padding,
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      aitensor_t *delta_in
+                                      )
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 3 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = delta_in->shape[0];
+    uint16_t C, L_in, L_out;
+    uint16_t n_idx, c_idx, t_idx, k_idx, k_begin, k_end;
+    int32_t start;
+
+    float factor = 1.0f / (float) pool_size;
+    const float *dy_ptr = (const float *) delta_out->data;
+    float *dx_data = (float *) delta_in->data;
+    float *dx_ptr;
+    float dy;
+
+    aimath_f32_default_init_zeros(delta_in);
+
+    if(channel_uaxis == 1){ // Channels first: [N,C,L]
+        C = delta_in->shape[1]; L_in = delta_in->shape[2]; L_out = delta_out->shape[2];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(c_idx = 0; c_idx < C; c_idx++){
+                dx_ptr = dx_data + ((uint32_t) n_idx * C + c_idx) * L_in;
+                for(t_idx = 0; t_idx < L_out; t_idx++){
+                    start = (int32_t) t_idx * stride - padding;
+                    aimath_f32_default_conv1d_tap_range(start, 1, pool_size, L_in, &k_begin, &k_end);
+                    dy = *dy_ptr++ * factor;
+                    for(k_idx = k_begin; k_idx < k_end; k_idx++){
+                        dx_ptr[start + k_idx] += dy;
+                    }
+                }
+            }
+        }
+    } else { // Channels last: [N,L,C]
+        L_in = delta_in->shape[1]; C = delta_in->shape[2]; L_out = delta_out->shape[1];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(t_idx = 0; t_idx < L_out; t_idx++){
+                start = (int32_t) t_idx * stride - padding;
+                aimath_f32_default_conv1d_tap_range(start, 1, pool_size, L_in, &k_begin, &k_end);
+                for(k_idx = k_begin; k_idx < k_end; k_idx++){
+                    dx_ptr = dx_data + ((uint32_t) n_idx * L_in + start + k_idx) * C;
+                    for(c_idx = 0; c_idx < C; c_idx++){
+                        dx_ptr[c_idx] += dy_ptr[c_idx] * factor;
+                    }
+                }
+                dy_ptr += C;
+            }
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_batch_norm(const aitensor_t *x,
+                                            int8_t axis,
+                                            const aitensor_t *means,
+                                            const aitensor_t *variances,
+                                            const aitensor_t *offsets,
+                                            const aitensor_t *scales,
+                                            const void *eps,
+                                            aitensor_t *result)
+{
+    uint32_t i, j, k;
+    uint32_t idx_multiplier1 = 1, idx_multiplier2 = 1;
+    float scale, offset;
+    uint8_t uaxis = axis < 0 ? x->dim + axis : axis; // Negative axis = indexing from the end
+
+    for(i = 0; i < uaxis; i++){
+        idx_multiplier1 *= x->shape[i];
+    }
+    for(i = uaxis+1; i < x->dim; i++){
+        idx_multiplier2 *= x->shape[i];
+    }
+
+    for(i = 0; i < x->shape[uaxis]; i++){
+        scale = ((float *) scales->data)[i] / (sqrt(((float *) variances->data)[i] + *((float *) eps)));
+        offset = ((float *) offsets->data)[i] - ((float *) means->data)[i] * scale;
+
+        for(j = 0; j < idx_multiplier1; j++){
+            for(k = 0; k < idx_multiplier2; k++){
+                ((float *) result->data)[i*idx_multiplier2 + j*idx_multiplier2*x->shape[uaxis] + k] =
+                    ((float *) x->data)[i*idx_multiplier2 + j*idx_multiplier2*x->shape[uaxis] + k] * scale + offset;
+            }
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_d_batch_norm(const aitensor_t *x_in,
+                                              int8_t axis,
+                                              const aitensor_t *means,
+                                              const aitensor_t *vars,
+                                              const aitensor_t *offsets,
+                                              const aitensor_t *scales,
+                                              const aitensor_t *delta_out,
+                                              const void *eps,
+                                              aitensor_t *delta_in,
+                                              aitensor_t *d_betas,
+                                              aitensor_t *d_gammas)
+{
+    uint32_t i, j, k, m;
     uint8_t uaxis = axis < 0 ? x_in->dim + axis : axis;
     uint32_t idx_multiplier1 = 1, idx_multiplier2 = 1;
-    // Auxillary variables
-    float sqrt_var, sqrt_var_inv, d_var, d_mean, xhat, d_xhat, shifted_x;
+    uint16_t channels = x_in->shape[uaxis];
+    float *x_data = (float *) x_in->data;
+    float *dy_data = (float *) delta_out->data;
+    float *dx_data = delta_in != 0 ? (float *) delta_in->data : 0;
+    float *mean_data = (float *) means->data;
+    float *gamma_data = (float *) scales->data;
+    float mean, inv_std, sum_dy, sum_dy_xhat, factor;
+
+    // Per channel: 1 / sqrt(var + eps), sum(d_y) and sum(d_y * xhat)
+    float inv_stds[channels];
+    float sums_dy[channels];
+    float sums_dy_xhat[channels];
 
     // Multipliers for index calculations
     for(i = 0; i < uaxis; i++){
@@ -1029,71 +2681,176 @@ void aimath_f32_default_d_batch_norm(const aitensor_t *x_in,
     for(i = uaxis+1; i < x_in->dim; i++){
         idx_multiplier2 *= x_in->shape[i];
     }
+    m = idx_multiplier1 * idx_multiplier2;
 
-    // Gradients calculation per channel:
-    // d_xhat_i = d_y_i * gamma
-    // d_var = sum_i=1:m(d_xhat_i * (x_i - mean) * -0.5 * 1/(sqrt(var + eps)^3))
-    // d_mean = sum_i=1:m(d_xhat_i * -sqrt(var + eps))
-    // d_x_i = d_xhat_i * 1 / sqrt(var + eps) + d_var * 2 * (x_i - mean) / m + d_mean / m
-    // d_gamma = sum_i=1:m(d_y_i * x_hat_i)
+    // Gradients calculation per channel (equivalent to the equations of Ioffe and Szegedy):
+    // xhat_i = (x_i - mean) / sqrt(var + eps)
     // d_beta = sum(d_y_i)
+    // d_gamma = sum_i=1:m(d_y_i * xhat_i)
+    // d_x_i = gamma / sqrt(var + eps) * (d_y_i - d_beta / m - xhat_i * d_gamma / m)
 
-    // Iterate through all channels
-    for(i = 0; i < x_in->shape[uaxis]; i++){
-        sqrt_var = sqrtf(((float *) vars->data)[i] + *((float *) eps));
-        sqrt_var_inv = 1.0f / sqrt_var;
-
+    for(i = 0; i < channels; i++){
+        inv_stds[i] = 1.0f / sqrtf(((float *) vars->data)[i] + *((float *) eps));
+        sums_dy[i] = 0.0f;
+        sums_dy_xhat[i] = 0.0f;
+    }
 
-        // d_var = sum_i=1:m(d_xhat_i * (x_i - mean) * -0.5 * 1/(sqrt(var + eps)^3))
-        // d_mean = sum_i=1:m(d_xhat_i * -sqrt(var + eps))
-        d_var = 0.0f;
-        d_mean = 0.0f;
-        for(j = 0; j < idx_multiplier1; j++){
+    // Pass 1: Channel sums in memory order
+    for(j = 0; j < idx_multiplier1; j++){
+        for(i = 0; i < channels; i++){
+            mean = mean_data[i];
+            sum_dy = 0.0f;
+            sum_dy_xhat = 0.0f;
             for(k = 0; k < idx_multiplier2; k++){
-                index = i*idx_multiplier2 + j*idx_multiplier2*x_in->shape[uaxis] + k;
-
-                // d_xhat_j = d_y_j * gamma
-                d_xhat = ((float *) delta_out->data)[index] * ((float *) scales->data)[i];
-
-                shifted_x = ((float *) x_in->data)[index] - ((float *) means->data)[i];
-
-                d_var += d_xhat * shifted_x;
-                d_mean += d_xhat;
+                sum_dy += dy_data[k];
+                sum_dy_xhat += dy_data[k] * (x_data[k] - mean);
             }
+            sums_dy[i] += sum_dy;
+            sums_dy_xhat[i] += sum_dy_xhat;
+            x_data += idx_multiplier2;
+            dy_data += idx_multiplier2;
         }
-        d_var *= -0.5f * (sqrt_var_inv * sqrt_var_inv * sqrt_var_inv);
-        d_mean *= -sqrt_var_inv;
+    }
+    for(i = 0; i < channels; i++){
+        sums_dy_xhat[i] *= inv_stds[i];
 
+        if(d_gammas != 0){
+            ((float *) d_gammas->data)[i] += sums_dy_xhat[i];
+        }
+        if(d_betas != 0){
+            ((float *) d_betas->data)[i] += sums_dy[i];
+        }
+    }
+
+    // Pass 2: Input gradients
+    if(delta_in != 0){
+        x_data = (float *) x_in->data;
+        dy_data = (float *) delta_out->data;
         for(j = 0; j < idx_multiplier1; j++){
-            for(k = 0; k < idx_multiplier2; k++){
-                index = i*idx_multiplier2 + j*idx_multiplier2*x_in->shape[uaxis] + k;
+            for(i = 0; i < channels; i++){
+                mean = mean_data[i];
+                inv_std = inv_stds[i];
+                factor = gamma_data[i] * inv_std;
+                sum_dy = sums_dy[i] / m;
+                sum_dy_xhat = sums_dy_xhat[i] * inv_std / m;
+                for(k = 0; k < idx_multiplier2; k++){
+                    dx_data[k] = factor * (dy_data[k] - sum_dy - (x_data[k] - mean) * sum_dy_xhat);
+                }
+                x_data += idx_multiplier2;
+                dy_data += idx_multiplier2;
+                dx_data += idx_multiplier2;
+            }
+        }
+    }
 
-                shifted_x = ((float *) x_in->data)[index] - ((float *) means->data)[i];
+    return;
+}
 
-                // d_xhat_j = d_y_j * gamma
-                d_xhat = ((float *) delta_out->data)[index] * ((float *) scales->data)[i];
+void aimath_f32_default_batch_norm_train(const aitensor_t *x,
+                                         int8_t axis,
+                                         uint8_t batch_mode,
+                                         const void *momentum,
+                                         const void *eps,
+                                         aitensor_t *means,
+                                         aitensor_t *variances,
+                                         aitensor_t *moving_means,
+                                         aitensor_t *moving_variances,
+                                         const aitensor_t *offsets,
+                                         const aitensor_t *scales,
+                                         aitensor_t *result)
+{
+    uint32_t i, j, k, m;
+    uint8_t uaxis = axis < 0 ? x->dim + axis : axis;
+    uint32_t idx_multiplier1 = 1, idx_multiplier2 = 1;
+    uint16_t channels = x->shape[uaxis];
+    float *x_data = (float *) x->data;
+    float *result_data = (float *) result->data;
+    float *mean_data = (float *) means->data;
+    float *var_data = (float *) variances->data;
+    float *moving_mean_data = (float *) moving_means->data;
+    float *moving_var_data = (float *) moving_variances->data;
+    float mom = *((float *) momentum);
+    float shift, delta, sum, sum_sq, mean, scale, offset;
+
+    // Per channel: Shifted sums and the normalization scale and offset
+    float shifts[channels];
+    float sums[channels];
+    float sums_sq[channels];
 
-                // xhat = (x - mean) / sqrt(var + eps)
-                xhat = shifted_x * sqrt_var_inv;
+    for(i = 0; i < uaxis; i++){
+        idx_multiplier1 *= x->shape[i];
+    }
+    for(i = uaxis+1; i < x->dim; i++){
+        idx_multiplier2 *= x->shape[i];
+    }
+    m = idx_multiplier1 * idx_multiplier2;
+
+    // Pass 1: Single pass statistics in memory order.
+    // The values are shifted by the first value of the channel (shifted data algorithm), which avoids the
+    // cancellation of sum(x^2) - sum(x)^2 / m without a division per element like the Welford update.
+    for(i = 0; i < channels; i++){
+        shifts[i] = x_data[i * idx_multiplier2];
+        sums[i] = 0.0f;
+        sums_sq[i] = 0.0f;
+    }
+    for(j = 0; j < idx_multiplier1; j++){
+        for(i = 0; i < channels; i++){
+            shift = shifts[i];
+            sum = 0.0f;
+            sum_sq = 0.0f;
+            for(k = 0; k < idx_multiplier2; k++){
+                delta = x_data[k] - shift;
+                sum += delta;
+                sum_sq += delta * delta;
+            }
+            sums[i] += sum;
+            sums_sq[i] += sum_sq;
+            x_data += idx_multiplier2;
+        }
+    }
 
-                if(delta_in != 0){
-                    // d_x_j = d_xhat_j * 1 / sqrt(var + eps) [+ d_var * 2 * (x_j - mean) / m + d_mean / m]
-                    ((float *) delta_in->data)[index] =
-                        d_xhat * sqrt_var_inv + (d_var * 2 * shifted_x + d_mean) / (idx_multiplier1 * idx_multiplier2);
-                }
+    for(i = 0; i < channels; i++){
+        // Batch statistics
+        delta = sums[i] / m;
+        mean = shifts[i] + delta;
+        mean_data[i] = mean;
+        var_data[i] = sums_sq[i] / m - delta * delta;
+        if(var_data[i] < 0.0f) var_data[i] = 0.0f;
+
+        // Moving averages
+        moving_mean_data[i] = mom * moving_mean_data[i] + (1.0f - mom) * mean;
+        if(!batch_mode){
+            // Variance around the updated moving mean: var + (mean - moving_mean)^2
+            delta = mean - moving_mean_data[i];
+            var_data[i] += delta * delta;
+        }
+        moving_var_data[i] = mom * moving_var_data[i] + (1.0f - mom) * var_data[i];
+
+        // Normalization: y = x * scale + offset
+        if(batch_mode){
+            scale = ((float *) scales->data)[i] / sqrtf(var_data[i] + *((float *) eps));
+            offset = ((float *) offsets->data)[i] - mean * scale;
+        } else {
+            scale = ((float *) scales->data)[i] / sqrtf(moving_var_data[i] + *((float *) eps));
+            offset = ((float *) offsets->data)[i] - moving_mean_data[i] * scale;
+        }
+        shifts[i] = scale;
+        sums[i] = offset;
+    }
 
-                if(d_gammas != 0){
-                    // d_gamma = sum_j=1:m(d_y_j * x_hat_j)
-                    ((float *) d_gammas->data)[i] += ((float *) delta_out->data)[index] * xhat;
-                }
-                if(d_betas != 0){
-                    // d_beta = sum(d_y_j)
-                    ((float *) d_betas->data)[i] += ((float *) delta_out->data)[index];
-                }
+    // Pass 2: Normalize while writing
+    x_data = (float *) x->data;
+    for(j = 0; j < idx_multiplier1; j++){
+        for(i = 0; i < channels; i++){
+            scale = shifts[i];
+            offset = sums[i];
+            for(k = 0; k < idx_multiplier2; k++){
+                result_data[k] = x_data[k] * scale + offset;
             }
+            x_data += idx_multiplier2;
+            result_data += idx_multiplier2;
         }
     }
-
     return;
 }
 
@@ -38,6 +38,8 @@
 #define AIFES_PADDING_SAME      0xFFFF  // Not fully implemented yet
 #define AIFES_PADDING_VALID     0
 
+#define AIMATH_POOL1D_NO_LOCATION   0xFFFFFFFF  // Marks a 1D pooling window that lies completely in the padding
+
 
 /** @brief Performs 2D convolution on slices of 4D \link aimath_f32.h F32 \endlink tensors and adds an optional bias
   *
@@ -214,6 +216,225 @@ void aimath_f32_default_conv2d_bwd_full(
                     aitensor_t *delta_in
 );
 
+/** @brief Performs 2D convolutions on channels last (NHWC) \link aimath_f32.h F32 \endlink tensors and adds a bias (forward pass of the Conv2D layer)
+ *
+ * @f[
+ *  x_{out} = x_{in} \ast w + b
+ * @f]
+ *
+ * Dedicated implementation of aimath_f32_default_conv2d_fwd() for the channels last data layout. The channel dimension is
+ * the innermost, contiguous dimension of the input and the kernels, so every kernel position is calculated as an inner product over \f$ C_{in} \f$.
+ * Sensor and camera data can be processed in their native layout without strided memory access.
+ *
+ * @param input             Input (\f$ x_{in} \f$) data with dimension \f$ [N,H_{in},W_{in},C_{in}] \f$
+ * @param stride            The stride in the direction of height and width
+ * @param dilation          The dilation in the direction of height and width
+ * @param padding           The (symmetric) zero padding in the direction of height and width
+ * @param weights           Convolution kernels with dimension \f$ [C_{out},H_{kernel},W_{kernel},C_{in}] \f$
+ * @param bias              Bias with dimension \f$ C_{out} \f$
+ * @param channel_axis      Index of the channel axis (Not in use; always channels last)
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param output            Output (\f$ x_{out} \f$) after convolution with dimension \f$ [N,H_{out},W_{out},C_{out}] \f$
+ */
+void aimath_f32_default_conv2d_fwd_hwc(
+                    const aitensor_t *input,
+                    const uint16_t stride[2],    // [s_h, s_w]
+                    const uint16_t dilation[2],  // [d_h, d_w]
+                    const uint16_t padding[2],
+                    const aitensor_t *weights,
+                    const aitensor_t *bias,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *output
+                    );
+
+/** @brief Calculates the gradients of the Conv2D layer with respect to the weights for channels last (NHWC) \link aimath_f32.h F32 \endlink tensors
+ *
+ * Calculates the gradients with respect to the weights \f$ \partial w = \mathrm{d} L / \mathrm{d} w \f$.
+ *
+ * @f[
+ *  \partial w = x_{in} \ast delta_{out}
+ * @f]
+ *
+ * Dedicated implementation of aimath_f32_default_conv2d_bwd() for the channels last data layout.
+ *
+ * @param x_in              Input data with dimension \f$ [N,H_{in},W_{in},C_{in}] \f$
+ * @param stride            The stride in the direction of height and width
+ * @param dilation          The dilation in the direction of height and width
+ * @param padding           The (symmetric) zero padding in the direction of height and width
+ * @param delta_out         Gradients backpropagated from the following layer with dimension \f$ [N,H_{out},W_{out},C_{out}] \f$
+ * @param channel_axis      Index of the channel axis (Not in use; always channels last)
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param d_weights         Output gradients of the weights with dimension \f$ [C_{out},H_{kernel},W_{kernel},C_{in}] \f$
+ */
+void aimath_f32_default_conv2d_bwd_hwc(
+                    const aitensor_t *x_in,
+                    const uint16_t stride[2],    // [s_h, s_w]
+                    const uint16_t dilation[2],  // [d_h, d_w]
+                    const uint16_t padding[2],
+                    const aitensor_t *delta_out,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *d_weights
+);
+
+/** @brief Calculates the gradients of the Conv2D layer with respect to the input for channels last (NHWC) \link aimath_f32.h F32 \endlink tensors
+ *
+ * Calculates the gradients with respect to the input \f$ delta_{in} = \mathrm{d} L / \mathrm{d} x_{in} \f$.
+ *
+ * @f[
+ *  delta_{in} = delta_{out} \ast' w
+ * @f]
+ * \f$ \cdot \ast' \cdot \f$ is a transposed convolution.
+ *
+ * Dedicated implementation of aimath_f32_default_conv2d_bwd_full() for the channels last data layout.
+ *
+ * @param delta_out         Gradients backpropagated from the following layer with dimension \f$ [N,H_{out},W_{out},C_{out}] \f$
+ * @param stride            The stride in the direction of height and width
+ * @param dilation          The dilation in the direction of height and width
+ * @param padding           The (symmetric) zero padding in the direction of height and width
+ * @param weights           Convolution kernels with dimension \f$ [C_{out},H_{kernel},W_{kernel},C_{in}] \f$
+ * @param channel_axis      Index of the channel axis (Not in use; always channels last)
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param delta_in          Resulting input gradients for backpropagation to the previous layer with dimension \f$ [N,H_{in},W_{in},C_{in}] \f$
+ */
+void aimath_f32_default_conv2d_bwd_full_hwc(
+                    const aitensor_t *delta_out,
+                    const uint16_t stride[2],    // [s_h, s_w]
+                    const uint16_t dilation[2],  // [d_h, d_w]
+                    const uint16_t padding[2],
+                    const aitensor_t *weights,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *delta_in
+);
+
+/** @brief Performs depthwise 2D convolutions with the given 4D \link aimath_f32.h F32 \endlink tensors and adds a bias (forward pass of the DepthwiseConv2D layer)
+ *
+ * Every input channel \f$ c \f$ is convolved separately with \f$ M \f$ kernels (depth multiplier) to the output channels \f$ c \cdot M + m \f$:
+ * @f[
+ *  x_{out;cM+m} = x_{in;c} \ast w_{cM+m} + b_{cM+m}
+ * @f]
+ *
+ * The depth multiplier is given by \f$ M = C_{out} / C_{in} \f$.
+ *
+ * @param input             Input (\f$ x_{in} \f$) data with dimension \f$ [N,C_{in},H_{in},W_{in}] \f$ (channels first) or \f$ [N,H_{in},W_{in},C_{in}] \f$ (channels last)
+ * @param stride            The stride in the direction of height and width
+ * @param dilation          The dilation in the direction of height and width
+ * @param padding           The (symmetric) zero padding in the direction of height and width
+ * @param weights           Convolution kernels with dimension \f$ [C_{out},H_{kernel},W_{kernel}] \f$ (channels first) or \f$ [H_{kernel},W_{kernel},C_{out}] \f$ (channels last)
+ * @param bias              Bias with dimension \f$ C_{out} \f$
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 3 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param output            Output (\f$ x_{out} \f$) after convolution with dimension \f$ [N,C_{out},H_{out},W_{out}] \f$ (channels first) or \f$ [N,H_{out},W_{out},C_{out}] \f$ (channels last)
+ */
+void aimath_f32_default_depthwise_conv2d_fwd(
+                    const aitensor_t *input,
+                    const uint16_t stride[2],    // [s_h, s_w]
+                    const uint16_t dilation[2],  // [d_h, d_w]
+                    const uint16_t padding[2],
+                    const aitensor_t *weights,
+                    const aitensor_t *bias,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *output
+                    );
+
+/** @brief Calculates the gradients of the DepthwiseConv2D layer with respect to the weights in \link aimath_f32.h F32 \endlink data type
+ *
+ * Calculates the gradients with respect to the weights \f$ \partial w = \mathrm{d} L / \mathrm{d} w \f$.
+ *
+ * @f[
+ *  \partial w_{cM+m} = x_{in;c} \ast delta_{out;cM+m}
+ * @f]
+ *
+ * @param x_in              Input data with dimension \f$ [N,C_{in},H_{in},W_{in}] \f$ (channels first) or \f$ [N,H_{in},W_{in},C_{in}] \f$ (channels last)
+ * @param stride            The stride in the direction of height and width
+ * @param dilation          The dilation in the direction of height and width
+ * @param padding           The (symmetric) zero padding in the direction of height and width
+ * @param delta_out         Gradients backpropagated from the following layer with dimension \f$ [N,C_{out},H_{out},W_{out}] \f$ (channels first) or \f$ [N,H_{out},W_{out},C_{out}] \f$ (channels last)
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 3 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param d_weights         Output gradients of the weights with dimension \f$ [C_{out},H_{kernel},W_{kernel}] \f$ (channels first) or \f$ [H_{kernel},W_{kernel},C_{out}] \f$ (channels last)
+ */
+void aimath_f32_default_depthwise_conv2d_bwd(
+                    const aitensor_t *x_in,
+                    const uint16_t stride[2],    // [s_h, s_w]
+                    const uint16_t dilation[2],  // [d_h, d_w]
+                    const uint16_t padding[2],
+                    const aitensor_t *delta_out,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *d_weights
+);
+
+/** @brief Calculates the gradients of the DepthwiseConv2D layer with respect to the input in \link aimath_f32.h F32 \endlink data type
+ *
+ * Calculates the gradients with respect to the input \f$ delta_{in} = \mathrm{d} L / \mathrm{d} x_{in} \f$.
+ *
+ * @f[
+ *  delta_{in;c} = \sum_m delta_{out;cM+m} \ast' w_{cM+m}
+ * @f]
+ * \f$ \cdot \ast' \cdot \f$ is a transposed convolution.
+ *
+ * @param delta_out         Gradients backpropagated from the following layer with dimension \f$ [N,C_{out},H_{out},W_{out}] \f$ (channels first) or \f$ [N,H_{out},W_{out},C_{out}] \f$ (channels last)
+ * @param stride            The stride in the direction of height and width
+ * @param dilation          The dilation in the direction of height and width
+ * @param padding           The (symmetric) zero padding in the direction of height and width
+ * @param weights           Convolution kernels with dimension \f$ [C_{out},H_{kernel},W_{kernel}] \f$ (channels first) or \f$ [H_{kernel},W_{kernel},C_{out}] \f$ (channels last)
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 3 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param delta_in          Resulting input gradients for backpropagation to the previous layer with dimension \f$ [N,C_{in},H_{in},W_{in}] \f$ (channels first) or \f$ [N,H_{in},W_{in},C_{in}] \f$ (channels last)
+ */
+void aimath_f32_default_depthwise_conv2d_bwd_full(
+                    const aitensor_t *delta_out,
+                    const uint16_t stride[2],    // [s_h, s_w]
+                    const uint16_t dilation[2],  // [d_h, d_w]
+                    const uint16_t padding[2],
+                    const aitensor_t *weights,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *delta_in
+);
+
+/** @brief Performs pointwise (1x1) 2D convolutions with the given 4D \link aimath_f32.h F32 \endlink tensors and adds a bias (fast forward pass of the Conv2D layer)
+ *
+ * A convolution with a kernel size of 1x1, a stride of 1 and no padding is a matrix multiplication over the channels.
+ * This function maps it directly onto the dense GEMM kernels:
+ * @f[
+ *  X_{out} = X_{in} \cdot W^T + b
+ * @f]
+ * with \f$ X_{in} \f$ as \f$ [N \cdot H \cdot W, C_{in}] \f$ matrix (channels last; aimath_f32_default_linear_bt()), respectively
+ * @f[
+ *  X_{out;n} = W \cdot X_{in;n} + b
+ * @f]
+ * with \f$ X_{in;n} \f$ as \f$ [C_{in}, H \cdot W] \f$ matrix for every sample (channels first; aimath_f32_default_mat_mul()).
+ *
+ * The default F32 Conv2D layer uses this function automatically for its forward pass when the kernel size is 1x1,
+ * the stride is 1 and no padding is applied.
+ *
+ * @param input             Input (\f$ x_{in} \f$) data with dimension \f$ [N,C_{in},H,W] \f$ (channels first) or \f$ [N,H,W,C_{in}] \f$ (channels last)
+ * @param stride            The stride in the direction of height and width (Must be 1)
+ * @param dilation          The dilation in the direction of height and width (Not in use)
+ * @param padding           The (symmetric) zero padding in the direction of height and width (Must be 0)
+ * @param weights           Convolution kernels with dimension \f$ [C_{out},C_{in},1,1] \f$ (channels first) or \f$ [C_{out},1,1,C_{in}] \f$ (channels last)
+ * @param bias              Bias with dimension \f$ C_{out} \f$
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 3 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param output            Output (\f$ x_{out} \f$) after convolution with dimension \f$ [N,C_{out},H,W] \f$ (channels first) or \f$ [N,H,W,C_{out}] \f$ (channels last)
+ */
+void aimath_f32_default_pointwise_conv2d_fwd(
+                    const aitensor_t *input,
+                    const uint16_t stride[2],    // [s_h, s_w]
+                    const uint16_t dilation[2],  // [d_h, d_w]
+                    const uint16_t padding[2],
+                    const aitensor_t *weights,
+                    const aitensor_t *bias,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *output
+                    );
+
 /** @brief Performs 2D transposed convolutions with the given 4D \link aimath_f32.h F32 \endlink tensors and adds a bias (forward pass of the ConvTranspose2D layer)
  *
  * @f[
@@ -310,6 +531,457 @@ void aimath_f32_default_maxpool2d_bwd(
                                       aitensor_t *delta_in
                                       );
 
+/** @brief 2D max-pooling on channels last (NHWC) \link aimath_f32.h F32 \endlink tensors
+ *
+ * Dedicated implementation of aimath_f32_default_maxpool2d_fwd() for the channels last data layout.
+ * The maximum of a pooling window is calculated for all channels of a pixel at once (vector max over the contiguous channels).
+ *
+ * For training (max_locations != 0), the index of the max-value in the kernel window is be stored in max_locations
+ * (same format as in aimath_f32_default_maxpool2d_fwd()).
+ *
+ * @param input             Input data with dimension \f$ [N,H_{in},W_{in},C] \f$
+ * @param pool_size         The size of the pooling window (height and width)
+ * @param stride            The stride in the direction of height and width.
+ * @param padding           The (symmetric) minus infinity padding in the direction of height and width
+ * @param channel_axis      Index of the channel axis (Not in use; always channels last)
+ * @param work_space        Pointer to a work space buffer for intermediate results.
+ * @param max_locations     Pointer to memory section where the indices of the maximum values per pooling window are stored.
+ * @param output            Output after max-pooling with dimension \f$ [N,H_{out},W_{out},C] \f$
+ */
+void aimath_f32_default_maxpool2d_fwd_hwc(
+                                      const aitensor_t *input,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      uint32_t *max_locations,
+                                      aitensor_t *output
+                                      );
+
+/** @brief Calculates the gradients of the MaxPool2D layer with respect to the input for channels last (NHWC) \link aimath_f32.h F32 \endlink tensors
+ *
+ * Dedicated implementation of aimath_f32_default_maxpool2d_bwd() for the channels last data layout.
+ *
+ * @param delta_out         Gradients backpropagated from the following layer with dimension \f$ [N,H_{out},W_{out},C] \f$
+ * @param pool_size         The size of the pooling window (height and width)
+ * @param stride            The stride in the direction of height and width.
+ * @param padding           The (symmetric) minus infinity padding in the direction of height and width
+ * @param channel_axis      Index of the channel axis (Not in use; always channels last)
+ * @param work_space        Pointer to a work space buffer for intermediate results.
+ * @param max_locations     Pointer to memory section where the indices of the maximum values per pooling window are stored.
+ * @param delta_in          Resulting input gradients for backpropagation to the previous layer \f$ [N,H_{in},W_{in},C] \f$
+ */
+void aimath_f32_default_maxpool2d_bwd_hwc(
+                                      const aitensor_t *delta_out,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      const uint32_t *max_locations,
+                                      aitensor_t *delta_in
+                                      );
+
+/** @brief 2D max-pooling with a 2x2 window and stride 2 on 4D \link aimath_f32.h F32 \endlink tensors
+ *
+ * Dedicated implementation of aimath_f32_default_maxpool2d_fwd() for the common case of pool_size = (2, 2),
+ * stride = (2, 2) and padding = (0, 0) (pool_size, stride and padding are not in use). Both channels first and channels last are supported.
+ *
+ * For training (max_locations != 0), the position of the maximum in the pooling window is stored as a 2-bit code
+ * (\f$ 2 \cdot h_{offset} + w_{offset} \f$) in the order of the output elements. Every 8 output elements occupy 2 bytes
+ * of max_locations (instead of 32 bytes for aimath_f32_default_maxpool2d_fwd()).
+ *
+ * @param input             Input data with dimension \f$ [N,C,H_{in},W_{in}] \f$ (channels first) or \f$ [N,H_{in},W_{in},C] \f$ (channels last)
+ * @param pool_size         The size of the pooling window (Not in use; always (2, 2))
+ * @param stride            The stride in the direction of height and width (Not in use; always (2, 2))
+ * @param padding           The (symmetric) minus infinity padding in the direction of height and width (Not in use; always (0, 0))
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 3 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results.
+ * @param max_locations     Pointer to memory section where the packed max locations are stored.
+ * @param output            Output after max-pooling with dimension \f$ [N,C,H_{out},W_{out}] \f$ (channels first) or \f$ [N,H_{out},W_{out},C] \f$ (channels last)
+ */
+void aimath_f32_default_maxpool2d_2x2_fwd(
+                                      const aitensor_t *input,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      uint32_t *max_locations,
+                                      aitensor_t *output
+                                      );
+
+/** @brief Calculates the gradients of the 2x2 / stride 2 max-pooling with respect to the input in \link aimath_f32.h F32 \endlink data type
+ *
+ * Backward pass of aimath_f32_default_maxpool2d_2x2_fwd(). The output gradient is written to the position in the input
+ * gradients depicted by the packed 2-bit max locations.
+ *
+ * @param delta_out         Gradients backpropagated from the following layer with dimension \f$ [N,C,H_{out},W_{out}] \f$ (channels first) or \f$ [N,H_{out},W_{out},C] \f$ (channels last)
+ * @param pool_size         The size of the pooling window (Not in use; always (2, 2))
+ * @param stride            The stride in the direction of height and width (Not in use; always (2, 2))
+ * @param padding           The (symmetric) minus infinity padding in the direction of height and width (Not in use; always (0, 0))
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 3 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results.
+ * @param max_locations     Pointer to memory section where the packed max locations are stored.
+ * @param delta_in          Resulting input gradients for backpropagation to the previous layer \f$ [N,C,H_{in},W_{in}] \f$ (channels first) or \f$ [N,H_{in},W_{in},C] \f$ (channels last)
+ */
+void aimath_f32_default_maxpool2d_2x2_bwd(
+                                      const aitensor_t *delta_out,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      const uint32_t *max_locations,
+                                      aitensor_t *delta_in
+                                      );
+
+/** @brief 2D max-pooling with a 2x2 window and stride 2 and a fused ReLU activation on 4D \link aimath_f32.h F32 \endlink tensors
+ *
+ * Same as aimath_f32_default_maxpool2d_2x2_fwd() followed by a ReLU. As \f$ max(relu(x)) = relu(max(x)) \f$,
+ * the ReLU is only calculated on the (4 times smaller) pooled result.
+ *
+ * For training (max_locations != 0), the 2-bit max location codes are stored together with a 1-bit ReLU mask
+ * (set if the pooled value is \f$ \geq 0 \f$). Every 8 output elements occupy 3 bytes of max_locations.
+ *
+ * @param input             Input data with dimension \f$ [N,C,H_{in},W_{in}] \f$ (channels first) or \f$ [N,H_{in},W_{in},C] \f$ (channels last)
+ * @param pool_size         The size of the pooling window (Not in use; always (2, 2))
+ * @param stride            The stride in the direction of height and width (Not in use; always (2, 2))
+ * @param padding           The (symmetric) minus infinity padding in the direction of height and width (Not in use; always (0, 0))
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 3 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results.
+ * @param max_locations     Pointer to memory section where the packed max locations and ReLU mask are stored.
+ * @param output            Output after max-pooling and ReLU with dimension \f$ [N,C,H_{out},W_{out}] \f$ (channels first) or \f$ [N,H_{out},W_{out},C] \f$ (channels last)
+ */
+void aimath_f32_default_maxpool2d_2x2_relu_fwd(
+                                      const aitensor_t *input,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      uint32_t *max_locations,
+                                      aitensor_t *output
+                                      );
+
+/** @brief Calculates the gradients of the 2x2 / stride 2 max-pooling with fused ReLU with respect to the input in \link aimath_f32.h F32 \endlink data type
+ *
+ * Backward pass of aimath_f32_default_maxpool2d_2x2_relu_fwd(). The output gradient is only passed to the input gradients
+ * where the ReLU mask is set.
+ *
+ * @param delta_out         Gradients backpropagated from the following layer with dimension \f$ [N,C,H_{out},W_{out}] \f$ (channels first) or \f$ [N,H_{out},W_{out},C] \f$ (channels last)
+ * @param pool_size         The size of the pooling window (Not in use; always (2, 2))
+ * @param stride            The stride in the direction of height and width (Not in use; always (2, 2))
+ * @param padding           The (symmetric) minus infinity padding in the direction of height and width (Not in use; always (0, 0))
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 3 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results.
+ * @param max_locations     Pointer to memory section where the packed max locations and ReLU mask are stored.
+ * @param delta_in          Resulting input gradients for backpropagation to the previous layer \f$ [N,C,H_{in},W_{in}] \f$ (channels first) or \f$ [N,H_{in},W_{in},C] \f$ (channels last)
+ */
+void aimath_f32_default_maxpool2d_2x2_relu_bwd(
+                                      const aitensor_t *delta_out,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      const uint32_t *max_locations,
+                                      aitensor_t *delta_in
+                                      );
+
+/** @brief 2D average-pooling on 4D \link aimath_f32.h F32 \endlink tensors
+ *
+ * Performs a 2D average-pooling operation on 2D slices of a 4D input tensor. This function is used as the forward pass of the
+ * AvgPool2D layer.
+ *
+ * The padded values are zero and are included in the average, i.e. every output value is the sum over the pooling
+ * window divided by \f$ H_{pool} \cdot W_{pool} \f$.
+ *
+ * The output dimensions of the height and width are given as:
+ * @f[
+ *  H_{out} = floor \left( \frac{H_{in} + 2 * P_h - H_{pool}}{S_h} \right) + 1
+ * @f]
+ * @f[
+ *  W_{out} = floor \left( \frac{W_{in} + 2 * P_w - W_{pool}}{S_w} \right) + 1
+ * @f]
+ *
+ * @param input             Input data with dimension \f$ [N,C,H_{in},W_{in}] \f$ (channels first) or \f$ [N,H_{in},W_{in},C] \f$ (channels last)
+ * @param pool_size         The size of the pooling window (height and width)
+ * @param stride            The stride in the direction of height and width.
+ * @param padding           The (symmetric) zero padding in the direction of height and width
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 3 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results.
+ * @param output            Output after average-pooling with dimension \f$ [N,C,H_{out},W_{out}] \f$ (channels first) or \f$ [N,H_{out},W_{out},C] \f$ (channels last)
+ */
+void aimath_f32_default_avgpool2d_fwd(
+                                      const aitensor_t *input,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      aitensor_t *output
+                                      );
+
+/** @brief Calculates the gradients of the AvgPool2D layer with respect to the input in \link aimath_f32.h F32 \endlink data type
+ *
+ * Calculates the gradients with respect to the input \f$ delta_{in} = \mathrm{d} L / \mathrm{d} x_{in} \f$.
+ *
+ * Every output gradient is distributed in equal shares of \f$ 1 / (H_{pool} \cdot W_{pool}) \f$ to the inputs of its pooling window.
+ *
+ * @param delta_out         Gradients backpropagated from the following layer with dimension \f$ [N,C,H_{out},W_{out}] \f$ (channels first) or \f$ [N,H_{out},W_{out},C] \f$ (channels last)
+ * @param pool_size         The size of the pooling window (height and width)
+ * @param stride            The stride in the direction of height and width.
+ * @param padding           The (symmetric) zero padding in the direction of height and width
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 3 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results.
+ * @param delta_in          Resulting input gradients for backpropagation to the previous layer \f$ [N,C,H_{in},W_{in}] \f$ (channels first) or \f$ [N,H_{in},W_{in},C] \f$ (channels last)
+ */
+void aimath_f32_default_avgpool2d_bwd(
+                                      const aitensor_t *delta_out,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      aitensor_t *delta_in
+                                      );
+
+/** @brief 2D global average-pooling on 4D \link aimath_f32.h F32 \endlink tensors
+ *
+ * Calculates the mean over the spatial dimensions for every sample and channel:
+ * @f[
+ *  y_{n,c} = \frac{1}{H \cdot W} \sum_{h,w} x_{n,c,h,w}
+ * @f]
+ *
+ * The mean is calculated as a single streaming reduction over the input (comparable to aimath_f32_default_mean_channelwise()).
+ * For channels last, every pixel is added to the channel sums at once.
+ *
+ * @param input             Input data with dimension \f$ [N,C,H,W] \f$ (channels first) or \f$ [N,H,W,C] \f$ (channels last)
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 3 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param output            Output with dimension \f$ [N,C] \f$
+ */
+void aimath_f32_default_global_avgpool2d_fwd(const aitensor_t *input, int8_t channel_axis, void *work_space, aitensor_t *output);
+
+/** @brief Calculates the gradients of the GlobalAvgPool2D layer with respect to the input in \link aimath_f32.h F32 \endlink data type
+ *
+ * Calculates the gradients with respect to the input \f$ delta_{in} = \mathrm{d} L / \mathrm{d} x_{in} \f$ by broadcasting
+ * the output gradients over the spatial dimensions:
+ * @f[
+ *  \delta_{in; n,c,h,w} = \frac{\delta_{out; n,c}}{H \cdot W}
+ * @f]
+ *
+ * @param delta_out         Gradients backpropagated from the following layer with dimension \f$ [N,C] \f$
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 3 for channels last).
+ * @param delta_in          Resulting input gradients for backpropagation to the previous layer \f$ [N,C,H,W] \f$ (channels first) or \f$ [N,H,W,C] \f$ (channels last)
+ */
+void aimath_f32_default_global_avgpool2d_bwd(const aitensor_t *delta_out, int8_t channel_axis, aitensor_t *delta_in);
+
+/** @brief Performs 1D convolutions with the given 3D \link aimath_f32.h F32 \endlink tensors and adds a bias (forward pass of the Conv1D layer)
+ *
+ * @f[
+ *  x_{out} = x_{in} \ast w + b
+ * @f]
+ *
+ * Every output value is calculated as a dot product of a kernel with the input window. The range of kernel taps
+ * that hit the padding is calculated once per window, so the inner loops run without any bounds checks.
+ * With a dilation of 1, the window is contiguous in memory (per channel for channels first and over the whole
+ * window for channels last).
+ *
+ * The output length is given as:
+ * @f[
+ *  L_{out} = floor \left( \frac{L_{in} + 2 * P - D * (K - 1) - 1}{S} \right) + 1
+ * @f]
+ *
+ * @param input             Input (\f$ x_{in} \f$) data with dimension \f$ [N,C_{in},L_{in}] \f$ (channels first) or \f$ [N,L_{in},C_{in}] \f$ (channels last)
+ * @param stride            The stride (\f$ S \f$)
+ * @param dilation          The dilation of the kernel (\f$ D \f$)
+ * @param padding           The (symmetric) zero padding (\f$ P \f$)
+ * @param weights           Convolution kernels with dimension \f$ [C_{out},C_{in},K] \f$ (channels first) or \f$ [C_{out},K,C_{in}] \f$ (channels last)
+ * @param bias              Bias with dimension \f$ C_{out} \f$
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 2 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param output            Output (\f$ x_{out} \f$) after convolution with dimension \f$ [N,C_{out},L_{out}] \f$ (channels first) or \f$ [N,L_{out},C_{out}] \f$ (channels last)
+ */
+void aimath_f32_default_conv1d_fwd(
+                    const aitensor_t *input,
+                    uint16_t stride,
+                    uint16_t dilation,
+                    uint16_t padding,
+                    const aitensor_t *weights,
+                    const aitensor_t *bias,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *output
+                    );
+
+/** @brief Calculates the gradients of the Conv1D layer with respect to the weights in \link aimath_f32.h F32 \endlink data type
+ *
+ * Calculates the gradients with respect to the weights \f$ \partial w = \mathrm{d} L / \mathrm{d} w \f$.
+ *
+ * @f[
+ *  \partial w = x_{in} \ast delta_{out}
+ * @f]
+ *
+ * @param x_in              Input data with dimension \f$ [N,C_{in},L_{in}] \f$ (channels first) or \f$ [N,L_{in},C_{in}] \f$ (channels last)
+ * @param stride            The stride
+ * @param dilation          The dilation of the kernel
+ * @param padding           The (symmetric) zero padding
+ * @param delta_out         Gradients backpropagated from the following layer with dimension \f$ [N,C_{out},L_{out}] \f$ (channels first) or \f$ [N,L_{out},C_{out}] \f$ (channels last)
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 2 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param d_weights         Output gradients of the weights with dimension \f$ [C_{out},C_{in},K] \f$ (channels first) or \f$ [C_{out},K,C_{in}] \f$ (channels last)
+ */
+void aimath_f32_default_conv1d_bwd(
+                    const aitensor_t *x_in,
+                    uint16_t stride,
+                    uint16_t dilation,
+                    uint16_t padding,
+                    const aitensor_t *delta_out,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *d_weights
+                    );
+
+/** @brief Calculates the gradients of the Conv1D layer with respect to the input in \link aimath_f32.h F32 \endlink data type
+ *
+ * Calculates the gradients with respect to the input \f$ delta_{in} = \mathrm{d} L / \mathrm{d} x_{in} \f$.
+ *
+ * @f[
+ *  delta_{in} = delta_{out} \ast' w
+ * @f]
+ * \f$ \cdot \ast' \cdot \f$ is a transposed convolution.
+ *
+ * @param delta_out         Gradients backpropagated from the following layer with dimension \f$ [N,C_{out},L_{out}] \f$ (channels first) or \f$ [N,L_{out},C_{out}] \f$ (channels last)
+ * @param stride            The stride
+ * @param dilation          The dilation of the kernel
+ * @param padding           The (symmetric) zero padding
+ * @param weights           Convolution kernels with dimension \f$ [C_{out},C_{in},K] \f$ (channels first) or \f$ [C_{out},K,C_{in}] \f$ (channels last)
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 2 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param delta_in          Resulting input gradients for backpropagation to the previous layer with dimension \f$ [N,C_{in},L_{in}] \f$ (channels first) or \f$ [N,L_{in},C_{in}] \f$ (channels last)
+ */
+void aimath_f32_default_conv1d_bwd_full(
+                    const aitensor_t *delta_out,
+                    uint16_t stride,
+                    uint16_t dilation,
+                    uint16_t padding,
+                    const aitensor_t *weights,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *delta_in
+                    );
+
+/** @brief 1D max-pooling on 3D \link aimath_f32.h F32 \endlink tensors
+ *
+ * Performs a 1D max-pooling operation along the time (length) axis of a 3D input tensor. This function is used as the forward pass of the
+ * MaxPool1D layer.
+ *
+ * The output length is given as:
+ * @f[
+ *  L_{out} = floor \left( \frac{L_{in} + 2 * P - L_{pool}}{S} \right) + 1
+ * @f]
+ *
+ * For every output value, the input position of the maximum along the length axis is stored in max_locations
+ * (AIMATH_POOL1D_NO_LOCATION if the window lies completely in the padding).
+ *
+ * @param input             Input data with dimension \f$ [N,C,L_{in}] \f$ (channels first) or \f$ [N,L_{in},C] \f$ (channels last)
+ * @param pool_size         The size of the pooling window
+ * @param stride            The stride
+ * @param padding           The (symmetric) padding
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 2 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param max_locations     Pointer to memory section where the indices of the maximum values are stored (set to null for inference only)
+ * @param output            Output after max-pooling with dimension \f$ [N,C,L_{out}] \f$ (channels first) or \f$ [N,L_{out},C] \f$ (channels last)
+ */
+void aimath_f32_default_maxpool1d_fwd(
+                                      const aitensor_t *input,
+                                      uint16_t pool_size,
+                                      uint16_t stride,
+                                      uint16_t padding,
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      uint32_t *max_locations,
+                                      aitensor_t *output
+                                      );
+
+/** @brief Calculates the gradients of the MaxPool1D layer with respect to the input in \link aimath_f32.h F32 \endlink data type
+ *
+ * Calculates the gradients with respect to the input \f$ delta_{in} = \mathrm{d} L / \mathrm{d} x_{in} \f$.
+ * Every output gradient is routed to the input position that was stored in max_locations during the forward pass.
+ *
+ * @param delta_out         Gradients backpropagated from the following layer with dimension \f$ [N,C,L_{out}] \f$ (channels first) or \f$ [N,L_{out},C] \f$ (channels last)
+ * @param pool_size         The size of the pooling window
+ * @param stride            The stride
+ * @param padding           The (symmetric) padding
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 2 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param max_locations     Indices of the maximum values from the forward pass
+ * @param delta_in          Resulting input gradients for backpropagation to the previous layer \f$ [N,C,L_{in}] \f$ (channels first) or \f$ [N,L_{in},C] \f$ (channels last)
+ */
+void aimath_f32_default_maxpool1d_bwd(
+                                      const aitensor_t *delta_out,
+                                      uint16_t pool_size,
+                                      uint16_t stride,
+                                      uint16_t padding,
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      const uint32_t *max_locations,
+                                      aitensor_t *delta_in
+                                      );
+
+/** @brief 1D average-pooling on 3D \link aimath_f32.h F32 \endlink tensors
+ *
+ * Performs a 1D average-pooling operation along the time (length) axis of a 3D input tensor. This function is used as the forward pass of the
+ * AvgPool1D layer.
+ *
+ * The padded values are zero and are included in the average, i.e. every output value is the sum over the pooling
+ * window divided by \f$ L_{pool} \f$.
+ *
+ * @param input             Input data with dimension \f$ [N,C,L_{in}] \f$ (channels first) or \f$ [N,L_{in},C] \f$ (channels last)
+ * @param pool_size         The size of the pooling window
+ * @param stride            The stride
+ * @param padding           The (symmetric) zero padding
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 2 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param output            Output after average-pooling with dimension \f$ [N,C,L_{out}] \f$ (channels first) or \f$ [N,L_{out},C] \f$ (channels last)
+ */
+void aimath_f32_default_avgpool1d_fwd(
+                                      const aitensor_t *input,
+                                      uint16_t pool_size,
+                                      uint16_t stride,
+                                      uint16_t padding,
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      aitensor_t *output
+                                      );
+
+/** @brief Calculates the gradients of the AvgPool1D layer with respect to the input in \link aimath_f32.h F32 \endlink data type
+ *
+ * Calculates the gradients with respect to the input \f$ delta_{in} = \mathrm{d} L / \mathrm{d} x_{in} \f$.
+ *
+ * Every output gradient is distributed in equal shares of \f$ 1 / L_{pool} \f$ to the inputs of its pooling window.
+ *
+ * @param delta_out         Gradients backpropagated from the following layer with dimension \f$ [N,C,L_{out}] \f$ (channels first) or \f$ [N,L_{out},C] \f$ (channels last)
+ * @param pool_size         The size of the pooling window
+ * @param stride            The stride
+ * @param padding           The (symmetric) zero padding
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 2 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param delta_in          Resulting input gradients for backpropagation to the previous layer \f$ [N,C,L_{in}] \f$ (channels first) or \f$ [N,L_{in},C] \f$ (channels last)
+ */
+void aimath_f32_default_avgpool1d_bwd(
+                                      const aitensor_t *delta_out,
+                                      uint16_t pool_size,
+                                      uint16_t stride,
+                                      uint16_t padding,
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      aitensor_t *delta_in
+                                      );
+
 /** @brief Batch Normalization on \link aimath_f32.h F32 \endlink tensors
  *
  * Performs the Batch Normalization operation (proposed by Ioffe and Szegedy, https://arxiv.org/abs/1502.03167):\n
@@ -342,6 +1014,10 @@ void aimath_f32_default_batch_norm(const aitensor_t *x,
  *
  * Please refer to the paper by Ioffe and Szegedy (https://arxiv.org/abs/1502.03167) for the equations of the gradients.
  *
+ * The gradients are calculated in two passes in memory order: The first pass accumulates the channel sums
+ * \f$ \sum d_y \f$ and \f$ \sum d_y \cdot \hat{x} \f$ (which are also the gradients of \f$ \beta \f$ and \f$ \gamma \f$),
+ * the second pass calculates \f$ d_x = \frac{\gamma}{\sqrt{\sigma^2 + \epsilon}} (d_y - \frac{1}{m}\sum d_y - \hat{x} \frac{1}{m}\sum d_y \cdot \hat{x}) \f$.
+ *
  * @param x_in          Input tensor (N-D)
  * @param axis          Axis of the input tensor that stores the channel dimension.
  * @param means         1D vector with the means (\f$ \mu_i \f$) of every channel.
@@ -366,6 +1042,47 @@ void aimath_f32_default_d_batch_norm(const aitensor_t *x_in,
                                               aitensor_t *d_betas,
                                               aitensor_t *d_gammas);
 
+/** @brief Fused Batch Normalization with the statistics calculation for the training in \link aimath_f32.h F32 \endlink data type
+ *
+ * Calculates the channel-wise means and variances, updates the moving averages and normalizes the input
+ * in two passes over the input tensor (instead of separate passes for the mean, the variance and the normalization):
+ * The first pass calculates the statistics in a single sweep with shifted sums, the second pass writes the normalized result.
+ *
+ * Batch mode (batch_mode = 1, the whole batch is processed in one forward pass):
+ * @f[
+ *  y_{i,j} = \gamma_i \cdot \frac{x_{i,j} - \mu_{i}}{\sqrt{\sigma_{i}^2+\epsilon}} + \beta_i
+ * @f]
+ * with the batch statistics \f$ \mu_i \f$ and \f$ \sigma^2_i \f$.\n
+ * Single sample mode (batch_mode = 0): The variance is calculated around the updated moving mean and the moving statistics are used for the normalization
+ * (same as with aimath_f32_default_mean_channelwise(), aimath_f32_default_variance_channelwise(), aimath_f32_default_exponential_moving_average()
+ * and aimath_f32_default_batch_norm() in ailayer_batch_norm_forward()).
+ *
+ * @param x                 Input tensor (N-D)
+ * @param axis              Axis of the input tensor that stores the channel dimension.
+ * @param batch_mode        Normalize with the batch statistics (1) or with the moving statistics (0)
+ * @param momentum          F32 scalar with the momentum of the moving averages
+ * @param eps               F32 scalar with a small constant for numerical stability.
+ * @param means             1D vector for the means (\f$ \mu_i \f$) of every channel (output).
+ * @param variances         1D vector for the variances (\f$ \sigma^2_i \f$) of every channel (output).
+ * @param moving_means      1D vector with the moving averages of the means (input and output).
+ * @param moving_variances  1D vector with the moving averages of the variances (input and output).
+ * @param offsets           1D vector with the offset parameters (\f$ \beta_i \f$) of every channel.
+ * @param scales            1D vector with the scaling parameters (\f$ \gamma_i \f$) of every channel.
+ * @param result            The resulting normalized tensor (N-D)
+ */
+void aimath_f32_default_batch_norm_train(const aitensor_t *x,
+                                         int8_t axis,
+                                         uint8_t batch_mode,
+                                         const void *momentum,
+                                         const void *eps,
+                                         aitensor_t *means,
+                                         aitensor_t *variances,
+                                         aitensor_t *moving_means,
+                                         aitensor_t *moving_variances,
+                                         const aitensor_t *offsets,
+                                         const aitensor_t *scales,
+                                         aitensor_t *result);
+
 /** @brief Pads a \link aimath_f32.h F32 \endlink tensor with zeros
  *
  * @param x             Input F32 tensor (N-D)
@@ -0,0 +1,472 @@
+/**
+ * \file cnn/default/aimath/aimath_cnn_q7_default.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief
+ * \details
+ */
+
+#include "cnn/default/aimath/aimath_cnn_q7_default.h"
+
+// Division of an integer sum by a positive count, rounded to the nearest integer
+#define AIMATH_Q7_DIV_ROUND(sum, count)     ((sum) >= 0 ? ((sum) + (int32_t) (count) / 2) / (int32_t) (count) : ((sum) - (int32_t) (count) / 2) / (int32_t) (count))
+
+void aimath_q7_default_avgpool2d_fwd(
+                                      const aitensor_t *input,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      aitensor_t *output
+                                      )
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 4 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = input->shape[0];
+    uint16_t C, H_in, W_in, H_out, W_out;
+    int32_t in_h_idx, in_w_idx;
+    uint16_t n_idx, c_idx, out_h_idx, out_w_idx, pool_h_idx, pool_w_idx;
+
+    int8_t zero_point = ((aimath_q7_params_t *) input->tensor_params)->zero_point;
+    int32_t count = (int32_t) pool_size[0] * pool_size[1];
+    int32_t valid_count, sum;
+
+    const int8_t *x_data = (const int8_t *) input->data;
+    const int8_t *x_ptr;
+    int8_t *y_ptr = (int8_t *) output->data;
+
+    if(channel_uaxis == 1){ // Channels first
+        C = input->shape[1]; H_in = input->shape[2]; W_in = input->shape[3];
+        H_out = output->shape[2]; W_out = output->shape[3];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(c_idx = 0; c_idx < C; c_idx++){
+                x_ptr = x_data + ((uint32_t) n_idx * C + c_idx) * H_in * W_in;
+                for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+                    for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                        sum = 0;
+                        valid_count = 0;
+                        for(pool_h_idx = 0; pool_h_idx < pool_size[0]; pool_h_idx++){
+                            in_h_idx = (int32_t) stride[0] * out_h_idx + pool_h_idx - padding[0];
+                            if(in_h_idx < 0 || in_h_idx >= H_in) continue;
+                            for(pool_w_idx = 0; pool_w_idx < pool_size[1]; pool_w_idx++){
+                                in_w_idx = (int32_t) stride[1] * out_w_idx + pool_w_idx - padding[1];
+                                if(in_w_idx < 0 || in_w_idx >= W_in) continue;
+                                sum += x_ptr[in_h_idx * W_in + in_w_idx];
+                                valid_count++;
+                            }
+                        }
+                        // Padded values are real zeros, i.e. the zero point
+                        sum += (count - valid_count) * zero_point;
+                        *y_ptr++ = (int8_t) AIMATH_Q7_DIV_ROUND(sum, count);
+                    }
+                }
+            }
+        }
+    } else { // Channels last
+        H_in = input->shape[1]; W_in = input->shape[2]; C = input->shape[3];
+        H_out = output->shape[1]; W_out = output->shape[2];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(out_h_idx = 0; out_h_idx < H_out; out_h_idx++){
+                for(out_w_idx = 0; out_w_idx < W_out; out_w_idx++){
+                    for(c_idx = 0; c_idx < C; c_idx++){
+                        sum = 0;
+                        valid_count = 0;
+                        for(pool_h_idx = 0; pool_h_idx < pool_size[0]; pool_h_idx++){
+                            in_h_idx = (int32_t) stride[0] * out_h_idx + pool_h_idx - padding[0];
+                            if(in_h_idx < 0 || in_h_idx >= H_in) continue;
+                            for(pool_w_idx = 0; pool_w_idx < pool_size[1]; pool_w_idx++){
+                                in_w_idx = (int32_t) stride[1] * out_w_idx + pool_w_idx - padding[1];
+                                if(in_w_idx < 0 || in_w_idx >= W_in) continue;
+                                sum += x_data[(((uint32_t) n_idx * H_in + in_h_idx) * W_in + in_w_idx) * C + c_idx];
+                                valid_count++;
+                            }
+                        }
+                        sum += (count - valid_count) * zero_point;
+                        y_ptr[c_idx] = (int8_t) AIMATH_Q7_DIV_ROUND(sum, count);
+                    }
+                    y_ptr += C;
+                }
+            }
+        }
+    }
+
+	((aimath_q7_params_t *) output->tensor_params)->shift = ((aimath_q7_params_t *) input->tensor_params)->shift;
+	((aimath_q7_params_t *) output->tensor_params)->zero_point = zero_point;
+    return;
+}
+
+void aimath_q7_default_global_avgpool2d_fwd(const aitensor_t *input, int8_t channel_axis, void *work_space, aitensor_t *output)
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 4 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = input->shape[0];
+    uint16_t C;
+    uint32_t HW, n_idx, c_idx, hw_idx;
+    int32_t sum;
+    int32_t *sums = (int32_t *) work_space; // Channel sums (channels last)
+
+    const int8_t *x_ptr = (const int8_t *) input->data;
+    int8_t *y_ptr = (int8_t *) output->data;
+
+    if(channel_uaxis == 1){ // Channels first
+        C = input->shape[1];
+        HW = (uint32_t) input->shape[2] * input->shape[3];
+
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(c_idx = 0; c_idx < C; c_idx++){
+                sum = 0;
+                for(hw_idx = 0; hw_idx < HW; hw_idx++){
+                    sum += x_ptr[hw_idx];
+                }
+                *y_ptr++ = (int8_t) AIMATH_Q7_DIV_ROUND(sum, HW);
+                x_ptr += HW;
+            }
+        }
+    } else { // Channels last
+        C = input->shape[3];
+        HW = (uint32_t) input->shape[1] * input->shape[2];
+
+        // Single pass over the input: every pixel is added to the channel sums
+        for(n_idx = 0; n_idx < N; n_idx++){
+            for(c_idx = 0; c_idx < C; c_idx++){
+                sums[c_idx] = 0;
+            }
+            for(hw_idx = 0; hw_idx < HW; hw_idx++){
+                for(c_idx = 0; c_idx < C; c_idx++){
+                    sums[c_idx] += x_ptr[c_idx];
+                }
+                x_ptr += C;
+            }
+            for(c_idx = 0; c_idx < C; c_idx++){
+                y_ptr[c_idx] = (int8_t) AIMATH_Q7_DIV_ROUND(sums[c_idx], HW);
+            }
+            y_ptr += C;
+        }
+    }
+
+	((aimath_q7_params_t *) output->tensor_params)->shift = ((aimath_q7_params_t *) input->tensor_params)->shift;
+	((aimath_q7_params_t *) output->tensor_params)->zero_point = ((aimath_q7_params_t *) input->tensor_params)->zero_point;
+    return;
+}
+
+// Range of the kernel taps [k_begin, k_end) that hit the input for a window starting at input position start
+static void aimath_q7_default_conv1d_tap_range(int32_t start, uint16_t dilation, uint16_t kernel_size, uint16_t length,
+                                               uint16_t *k_begin, uint16_t *k_end)
+{
+    int32_t last = (int32_t) length - 1 - start;
+
+    *k_begin = start < 0 ? (uint16_t) ((-start + dilation - 1) / dilation) : 0;
+    if(last < 0){
+        *k_end = 0;
+    } else {
+        *k_end = (uint16_t) (last / dilation + 1 < kernel_size ? last / dilation + 1 : kernel_size);
+    }
+    if(*k_end < *k_begin){
+        *k_end = *k_begin;
+    }
+}
+
+void aimath_q7_default_conv1d_fwd(
+                    const aitensor_t *input,
+                    uint16_t stride,
+                    uint16_t dilation,
+                    uint16_t padding,
+                    const aitensor_t *weights,
+                    const aitensor_t *bias,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *output)
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 3 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = input->shape[0], F = weights->shape[0];
+    uint16_t C, L_in, L_out, K;
+    uint16_t n_idx, f_idx, c_idx, t_idx, k_idx, k_begin, k_end;
+    uint32_t i, len;
+    int32_t start, sum;
+
+    int16_t x_shift = ((aimath_q7_params_t *) input->tensor_params)->shift;
+    int16_t w_shift = ((aimath_q7_params_t *) weights->tensor_params)->shift;
+    int16_t b_shift = ((aimath_q7_params_t *) bias->tensor_params)->shift;
+    int16_t y_shift = ((aimath_q7_params_t *) output->tensor_params)->shift;
+    int16_t z_x = ((aimath_q7_params_t *) input->tensor_params)->zero_point;
+    int16_t z_w = ((aimath_q7_params_t *) weights->tensor_params)->zero_point;
+    int16_t z_b = ((aimath_q7_params_t *) bias->tensor_params)->zero_point;
+    int16_t z_y = ((aimath_q7_params_t *) output->tensor_params)->zero_point;
+
+    // The accumulator has the shift x_shift + w_shift
+    int16_t bias_shift = x_shift + w_shift - b_shift;
+    // Output scaling factor M = (S_x * S_w) / S_y
+    int16_t output_shift = x_shift + w_shift - y_shift;
+
+    const int8_t *x_data = (const int8_t *) input->data;
+    const int8_t *w_data = (const int8_t *) weights->data;
+    const int8_t *b_data = (const int8_t *) bias->data;
+    const int8_t *x_ptr, *w_ptr;
+    int8_t *y_data = (int8_t *) output->data;
+    uint32_t y_f, y_t; // Index multipliers of the output
+
+    if(channel_uaxis == 1){ // Channels first: input [N,C,L], weights [F,C,K]
+        C = input->shape[1]; L_in = input->shape[2];
+        L_out = output->shape[2]; K = weights->shape[2];
+        y_f = L_out; y_t = 1;
+    } else { // Channels last: input [N,L,C], weights [F,K,C]
+        L_in = input->shape[1]; C = input->shape[2];
+        L_out = output->shape[1]; K = weights->shape[1];
+        y_f = 1; y_t = F;
+    }
+
+    for(n_idx = 0; n_idx < N; n_idx++){
+        for(t_idx = 0; t_idx < L_out; t_idx++){
+            start = (int32_t) t_idx * stride - padding;
+            // Padded values equal the zero point and don't contribute to the sum
+            aimath_q7_default_conv1d_tap_range(start, dilation, K, L_in, &k_begin, &k_end);
+            len = k_end - k_begin;
+
+            for(f_idx = 0; f_idx < F; f_idx++){
+                sum = (int32_t) b_data[f_idx] - z_b;
+                sum = bias_shift >= 0 ? sum << bias_shift : sum >> -bias_shift;
+
+                if(channel_uaxis == 1){
+                    for(c_idx = 0; c_idx < C; c_idx++){
+                        x_ptr = x_data + ((uint32_t) n_idx * C + c_idx) * L_in + start + (int32_t) k_begin * dilation;
+                        w_ptr = w_data + ((uint32_t) f_idx * C + c_idx) * K + k_begin;
+                        for(i = 0; i < len; i++){
+                            sum += ((int32_t) x_ptr[i * dilation] - z_x) * ((int32_t) w_ptr[i] - z_w);
+                        }
+                    }
+                } else {
+                    x_ptr = x_data + ((uint32_t) n_idx * L_in + start + (int32_t) k_begin * dilation) * C;
+                    w_ptr = w_data + ((uint32_t) f_idx * K + k_begin) * C;
+                    if(dilation == 1){
+                        // The whole window is one contiguous block of (k_end - k_begin) * C values
+                        for(i = 0; i < len * C; i++){
+                            sum += ((int32_t) x_ptr[i] - z_x) * ((int32_t) w_ptr[i] - z_w);
+                        }
+                    } else {
+                        for(k_idx = k_begin; k_idx < k_end; k_idx++){
+                            for(c_idx = 0; c_idx < C; c_idx++){
+                                sum += ((int32_t) x_ptr[c_idx] - z_x) * ((int32_t) w_ptr[c_idx] - z_w);
+                            }
+                            x_ptr += (uint32_t) dilation * C;
+                            w_ptr += C;
+                        }
+                    }
+                }
+
+                sum = (output_shift >= 0 ? sum >> output_shift : sum << -output_shift) + z_y;
+                y_data[(uint32_t) n_idx * F * L_out + f_idx * y_f + t_idx * y_t] = (int8_t) (sum > 127 ? 127 : (sum < -128 ? -128 : sum));
+            }
+        }
+    }
+    return;
+}
+
+void aimath_q7_default_conv1d_fused_input_fwd(
+                    const aitensor_t *input,
+                    uint16_t stride,
+                    uint16_t dilation,
+                    uint16_t padding,
+                    const aitensor_t *weights,
+                    const aitensor_t *bias,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *output)
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 3 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = input->shape[0], F = weights->shape[0];
+    uint16_t C, L_in, L_out, K;
+    uint16_t n_idx, f_idx, c_idx, t_idx, k_idx, k_begin, k_end;
+    int32_t start, sum;
+    aimath_q7_source_params_t *source_params = (aimath_q7_source_params_t *) input->tensor_params;
+
+    int16_t x_shift = source_params->q_params.shift;
+    int16_t w_shift = ((aimath_q7_params_t *) weights->tensor_params)->shift;
+    int16_t b_shift = ((aimath_q7_params_t *) bias->tensor_params)->shift;
+    int16_t y_shift = ((aimath_q7_params_t *) output->tensor_params)->shift;
+    int16_t z_x = source_params->q_params.zero_point;
+    int16_t z_w = ((aimath_q7_params_t *) weights->tensor_params)->zero_point;
+    int16_t z_b = ((aimath_q7_params_t *) bias->tensor_params)->zero_point;
+    int16_t z_y = ((aimath_q7_params_t *) output->tensor_params)->zero_point;
+
+    // The accumulator has the shift x_shift + w_shift
+    int16_t bias_shift = x_shift + w_shift - b_shift;
+    // Output scaling factor M = (S_x * S_w) / S_y
+    int16_t output_shift = x_shift + w_shift - y_shift;
+
+    const int8_t *w_data = (const int8_t *) weights->data;
+    const int8_t *b_data = (const int8_t *) bias->data;
+    int8_t *y_data = (int8_t *) output->data;
+    uint32_t y_f, y_t; // Index multipliers of the output
+    uint32_t x_c, x_l, w_c, w_k; // Index multipliers of the input and the weights
+    uint32_t x_idx, w_idx;
+
+    if(channel_uaxis == 1){ // Channels first: input [N,C,L], weights [F,C,K]
+        C = input->shape[1]; L_in = input->shape[2];
+        L_out = output->shape[2]; K = weights->shape[2];
+        y_f = L_out; y_t = 1;
+        x_c = L_in; x_l = 1;
+        w_c = K; w_k = 1;
+    } else { // Channels last: input [N,L,C], weights [F,K,C]
+        L_in = input->shape[1]; C = input->shape[2];
+        L_out = output->shape[1]; K = weights->shape[1];
+        y_f = 1; y_t = F;
+        x_c = 1; x_l = C;
+        w_c = 1; w_k = C;
+    }
+
+    for(n_idx = 0; n_idx < N; n_idx++){
+        for(t_idx = 0; t_idx < L_out; t_idx++){
+            start = (int32_t) t_idx * stride - padding;
+            // Padded values equal the zero point and don't contribute to the sum
+            aimath_q7_default_conv1d_tap_range(start, dilation, K, L_in, &k_begin, &k_end);
+
+            for(f_idx = 0; f_idx < F; f_idx++){
+                sum = (int32_t) b_data[f_idx] - z_b;
+                sum = bias_shift >= 0 ? sum << bias_shift : sum >> -bias_shift;
+
+                for(k_idx = k_begin; k_idx < k_end; k_idx++){
+                    x_idx = (uint32_t) n_idx * C * L_in + (uint32_t) (start + (int32_t) k_idx * dilation) * x_l;
+                    w_idx = (uint32_t) f_idx * C * K + (uint32_t) k_idx * w_k;
+                    for(c_idx = 0; c_idx < C; c_idx++){
+                        // The raw input value is quantized right before it is used, no staging buffer is needed
+                        sum += ((int32_t) aimath_q7_quantize_value_from_source(input->data, x_idx, source_params) - z_x)
+                               * ((int32_t) w_data[w_idx] - z_w);
+                        x_idx += x_c;
+                        w_idx += w_c;
+                    }
+                }
+
+                sum = (output_shift >= 0 ? sum >> output_shift : sum << -output_shift) + z_y;
+                y_data[(uint32_t) n_idx * F * L_out + f_idx * y_f + t_idx * y_t] = (int8_t) (sum > 127 ? 127 : (sum < -128 ? -128 : sum));
+            }
+        }
+    }
+    return;
+}
+
+void aimath_q7_default_maxpool1d_fwd(
+                                      const aitensor_t *input,
+                                      uint16_t pool_size,
+                                      uint16_t stride,
+                                      uint16_t padding,
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      uint32_t *max_locations,
+                                      aitensor_t *output
+                                      )
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 3 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = input->shape[0];
+    uint16_t C, L_in, L_out;
+    uint32_t x_c, x_l, y_c, y_l; // Index multipliers
+    uint16_t n_idx, c_idx, t_idx, k_idx, k_begin, k_end;
+    uint32_t y_idx;
+    int32_t start;
+
+    const int8_t *x_data = (const int8_t *) input->data;
+    const int8_t *x_ptr;
+    int8_t *y_data = (int8_t *) output->data;
+    int8_t max;
+
+    if(channel_uaxis == 1){ // Channels first: [N,C,L]
+        C = input->shape[1]; L_in = input->shape[2]; L_out = output->shape[2];
+        x_c = L_in; x_l = 1;
+        y_c = L_out; y_l = 1;
+    } else { // Channels last: [N,L,C]
+        L_in = input->shape[1]; C = input->shape[2]; L_out = output->shape[1];
+        x_c = 1; x_l = C;
+        y_c = 1; y_l = C;
+    }
+
+    for(n_idx = 0; n_idx < N; n_idx++){
+        for(t_idx = 0; t_idx < L_out; t_idx++){
+            start = (int32_t) t_idx * stride - padding;
+            aimath_q7_default_conv1d_tap_range(start, 1, pool_size, L_in, &k_begin, &k_end);
+
+            for(c_idx = 0; c_idx < C; c_idx++){
+                x_ptr = x_data + (uint32_t) n_idx * C * L_in + c_idx * x_c;
+                max = -128;
+                for(k_idx = k_begin; k_idx < k_end; k_idx++){
+                    if(x_ptr[(start + k_idx) * x_l] > max){
+                        max = x_ptr[(start + k_idx) * x_l];
+                    }
+                }
+                y_idx = (uint32_t) n_idx * C * L_out + c_idx * y_c + t_idx * y_l;
+                y_data[y_idx] = max;
+            }
+        }
+    }
+
+	((aimath_q7_params_t *) output->tensor_params)->shift = ((aimath_q7_params_t *) input->tensor_params)->shift;
+	((aimath_q7_params_t *) output->tensor_params)->zero_point = ((aimath_q7_params_t *) input->tensor_params)->zero_point;
+    return;
+}
+
+void aimath_q7_default_avgpool1d_fwd(
+                                      const aitensor_t *input,
+                                      uint16_t pool_size,
+                                      uint16_t stride,
+                                      uint16_t padding,
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      aitensor_t *output
+                                      )
+{
+    uint8_t channel_uaxis = channel_axis < 0 ? 3 + channel_axis : channel_axis; // Negative axis = indexing from the end
+    uint16_t N = input->shape[0];
+    uint16_t C, L_in, L_out;
+    uint32_t x_c, x_l, y_c, y_l; // Index multipliers
+    uint16_t n_idx, c_idx, t_idx, k_idx, k_begin, k_end;
+    int32_t start, sum;
+
+    int8_t zero_point = ((aimath_q7_params_t *) input->tensor_params)->zero_point;
+    const int8_t *x_data = (const int8_t *) input->data;
+    const int8_t *x_ptr;
+    int8_t *y_data = (int8_t *) output->data;
+
+    if(channel_uaxis == 1){ // Channels first: [N,C,L]
+        C = input->shape[1]; L_in = input->shape[2]; L_out = output->shape[2];
+        x_c = L_in; x_l = 1;
+        y_c = L_out; y_l = 1;
+    } else { // Channels last: [N,L,C]
+        L_in = input->shape[1]; C = input->shape[2]; L_out = output->shape[1];
+        x_c = 1; x_l = C;
+        y_c = 1; y_l = C;
+    }
+
+    for(n_idx = 0; n_idx < N; n_idx++){
+        for(t_idx = 0; t_idx < L_out; t_idx++){
+            start = (int32_t) t_idx * stride - padding;
+            aimath_q7_default_conv1d_tap_range(start, 1, pool_size, L_in, &k_begin, &k_end);
+
+            for(c_idx = 0; c_idx < C; c_idx++){
+                x_ptr = x_data + (uint32_t) n_idx * C * L_in + c_idx * x_c;
+                // Padded values are real zeros, i.e. the zero point
+                sum = ((int32_t) pool_size - (k_end - k_begin)) * zero_point;
+                for(k_idx = k_begin; k_idx < k_end; k_idx++){
+                    sum += x_ptr[(start + k_idx) * x_l];
+                }
+                y_data[(uint32_t) n_idx * C * L_out + c_idx * y_c + t_idx * y_l] = (int8_t) AIMATH_Q7_DIV_ROUND(sum, pool_size);
+            }
+        }
+    }
+
+	((aimath_q7_params_t *) output->tensor_params)->shift = ((aimath_q7_params_t *) input->tensor_params)->shift;
+	((aimath_q7_params_t *) output->tensor_params)->zero_point = zero_point;
+    return;
+}
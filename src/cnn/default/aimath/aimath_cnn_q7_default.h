@@ -0,0 +1,194 @@
+/**
+ * \file cnn/default/aimath/aimath_cnn_q7_default.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Math functions for \link aimath_q7.h Q7 \endlink data type, CNN-specific implementation
+ *
+ * These functions can be used when no hardware specific implementation is available.
+ */
+
+#ifndef AIMATH_CNN_Q7_DEFAULT_H
+#define AIMATH_CNN_Q7_DEFAULT_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "core/aifes_core.h"
+#include "basic/base/aimath/aimath_q7.h"
+#include "basic/default/aimath/aimath_q7_default.h"
+
+
+/** @brief 2D average-pooling on 4D \link aimath_q7.h Q7 \endlink tensors
+ *
+ * Performs a 2D average-pooling operation on 2D slices of a 4D input tensor. This function is used as the forward pass of the
+ * AvgPool2D layer.
+ *
+ * The result has the same quantization parameters (shift and zero point) as the input. The padded values are zero
+ * (i.e. equal to the zero point) and are included in the average. The window sums are accumulated in 32-bit integers
+ * and rounded to the nearest integer after the division.
+ *
+ * @param input             Input data with dimension \f$ [N,C,H_{in},W_{in}] \f$ (channels first) or \f$ [N,H_{in},W_{in},C] \f$ (channels last)
+ * @param pool_size         The size of the pooling window (height and width)
+ * @param stride            The stride in the direction of height and width.
+ * @param padding           The (symmetric) zero padding in the direction of height and width
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 3 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results.
+ * @param output            Output after average-pooling with dimension \f$ [N,C,H_{out},W_{out}] \f$ (channels first) or \f$ [N,H_{out},W_{out},C] \f$ (channels last)
+ */
+void aimath_q7_default_avgpool2d_fwd(
+                                      const aitensor_t *input,
+                                      const uint16_t pool_size[2],
+                                      const uint16_t stride[2],
+                                      const uint16_t padding[2],
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      aitensor_t *output
+                                      );
+
+/** @brief 2D global average-pooling on 4D \link aimath_q7.h Q7 \endlink tensors
+ *
+ * Calculates the mean over the spatial dimensions for every sample and channel (see aimath_f32_default_global_avgpool2d_fwd()).
+ *
+ * The result has the same quantization parameters (shift and zero point) as the input.
+ * The sums are accumulated in 32-bit integers and rounded to the nearest integer after the division.
+ * For channels last, the input is read once in memory order and every pixel is added to the C channel sums
+ * in the work space (see ailayer_global_avgpool2d_sizeof_fwdmem_q7_default()).
+ *
+ * @param input             Input data with dimension \f$ [N,C,H,W] \f$ (channels first) or \f$ [N,H,W,C] \f$ (channels last)
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 3 for channels last).
+ * @param work_space        Pointer to a work space buffer of \f$ C \f$ int32_t values for the channel sums (channels last only)
+ * @param output            Output with dimension \f$ [N,C] \f$
+ */
+void aimath_q7_default_global_avgpool2d_fwd(const aitensor_t *input, int8_t channel_axis, void *work_space, aitensor_t *output);
+
+/** @brief Performs 1D convolutions with the given 3D \link aimath_q7.h Q7 \endlink tensors and adds a bias (forward pass of the Conv1D layer)
+ *
+ * @f[
+ *  x_{out} = x_{in} \ast w + b
+ * @f]
+ *
+ * The products \f$ (x - z_x)(w - z_w) \f$ are accumulated in 32-bit integers with the shift \f$ s_x + s_w \f$. The bias
+ * (\link aimath_q7.h Q7 \endlink) is rescaled to this shift before the accumulation. The result is requantized to the
+ * (calibrated) quantization parameters of the output tensor and saturated to the Q7 range.
+ *
+ * See aimath_f32_default_conv1d_fwd() for the memory layout and the loop structure.
+ *
+ * @param input             Input (\f$ x_{in} \f$) data with dimension \f$ [N,C_{in},L_{in}] \f$ (channels first) or \f$ [N,L_{in},C_{in}] \f$ (channels last)
+ * @param stride            The stride
+ * @param dilation          The dilation of the kernel
+ * @param padding           The (symmetric) zero padding
+ * @param weights           Convolution kernels with dimension \f$ [C_{out},C_{in},K] \f$ (channels first) or \f$ [C_{out},K,C_{in}] \f$ (channels last)
+ * @param bias              Bias with dimension \f$ C_{out} \f$
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 2 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param output            Output (\f$ x_{out} \f$) after convolution with dimension \f$ [N,C_{out},L_{out}] \f$ (channels first) or \f$ [N,L_{out},C_{out}] \f$ (channels last)
+ */
+void aimath_q7_default_conv1d_fwd(
+                    const aitensor_t *input,
+                    uint16_t stride,
+                    uint16_t dilation,
+                    uint16_t padding,
+                    const aitensor_t *weights,
+                    const aitensor_t *bias,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *output
+                    );
+
+/** @brief Performs 1D convolutions with fused input quantization (forward pass of the first Conv1D layer)
+ *
+ * Same as aimath_q7_default_conv1d_fwd(), but the input still contains raw data (F32 or 16 bit ADC values) and has
+ * aimath_q7_source_params_t as tensor parameters. Every raw value is quantized in the inner loop right before it is
+ * multiplied with a kernel tap (aimath_q7_quantize_value_from_source()), so neither a separate quantization pass nor
+ * a buffer for the quantized input is needed. In exchange, every input value is quantized once per filter and window that covers it.
+ *
+ * @param input             Raw input data with dimension \f$ [N,C_{in},L_{in}] \f$ (channels first) or \f$ [N,L_{in},C_{in}] \f$ (channels last) and aimath_q7_source_params_t
+ * @param stride            The stride
+ * @param dilation          The dilation of the kernel
+ * @param padding           The (symmetric) zero padding
+ * @param weights           Convolution kernels with dimension \f$ [C_{out},C_{in},K] \f$ (channels first) or \f$ [C_{out},K,C_{in}] \f$ (channels last)
+ * @param bias              Bias with dimension \f$ C_{out} \f$
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 2 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param output            Output after convolution with dimension \f$ [N,C_{out},L_{out}] \f$ (channels first) or \f$ [N,L_{out},C_{out}] \f$ (channels last)
+ */
+void aimath_q7_default_conv1d_fused_input_fwd(
+                    const aitensor_t *input,
+                    uint16_t stride,
+                    uint16_t dilation,
+                    uint16_t padding,
+                    const aitensor_t *weights,
+                    const aitensor_t *bias,
+                    int8_t channel_axis,
+                    void *work_space,
+                    aitensor_t *output
+                    );
+
+/** @brief 1D max-pooling on 3D \link aimath_q7.h Q7 \endlink tensors
+ *
+ * Performs a 1D max-pooling operation along the length axis of a 3D input tensor (see aimath_f32_default_maxpool1d_fwd()).
+ * The result has the same quantization parameters (shift and zero point) as the input.
+ *
+ * @param input             Input data with dimension \f$ [N,C,L_{in}] \f$ (channels first) or \f$ [N,L_{in},C] \f$ (channels last)
+ * @param pool_size         The size of the pooling window
+ * @param stride            The stride
+ * @param padding           The (symmetric) padding
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 2 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param max_locations     Not in use (only needed for training)
+ * @param output            Output after max-pooling with dimension \f$ [N,C,L_{out}] \f$ (channels first) or \f$ [N,L_{out},C] \f$ (channels last)
+ */
+void aimath_q7_default_maxpool1d_fwd(
+                                      const aitensor_t *input,
+                                      uint16_t pool_size,
+                                      uint16_t stride,
+                                      uint16_t padding,
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      uint32_t *max_locations,
+                                      aitensor_t *output
+                                      );
+
+/** @brief 1D average-pooling on 3D \link aimath_q7.h Q7 \endlink tensors
+ *
+ * Performs a 1D average-pooling operation along the length axis of a 3D input tensor (see aimath_f32_default_avgpool1d_fwd()).
+ *
+ * The result has the same quantization parameters (shift and zero point) as the input. The padded values are zero
+ * (i.e. equal to the zero point) and are included in the average. The window sums are accumulated in 32-bit integers
+ * and rounded to the nearest integer after the division.
+ *
+ * @param input             Input data with dimension \f$ [N,C,L_{in}] \f$ (channels first) or \f$ [N,L_{in},C] \f$ (channels last)
+ * @param pool_size         The size of the pooling window
+ * @param stride            The stride
+ * @param padding           The (symmetric) zero padding
+ * @param channel_axis      Index of the channel axis (1 for channels first and -1 or 2 for channels last).
+ * @param work_space        Pointer to a work space buffer for intermediate results (Not in use)
+ * @param output            Output after average-pooling with dimension \f$ [N,C,L_{out}] \f$ (channels first) or \f$ [N,L_{out},C] \f$ (channels last)
+ */
+void aimath_q7_default_avgpool1d_fwd(
+                                      const aitensor_t *input,
+                                      uint16_t pool_size,
+                                      uint16_t stride,
+                                      uint16_t padding,
+                                      int8_t channel_axis,
+                                      void *work_space,
+                                      aitensor_t *output
+                                      );
+
+#endif // AIMATH_CNN_Q7_DEFAULT_H
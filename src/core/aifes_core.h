@@ -39,6 +39,7 @@
 #define AILAYER_SETTINGS_BATCH_MODE                     2 // When true, a whole batch is processed in a single forward pass
 #define AILAYER_SETTINGS_NO_INPUT_GRADIENT              3 // When true, no input gradient is calculated
 #define AILAYER_SETTINGS_KEEP_INPUT_BUFFER_FOR_RESULT   4 // When true, no input gradient is calculated
+#define AILAYER_SETTINGS_SOURCE_INPUT                   5 // When true, the layer holds raw input data described by aimath_q7_source_params_t (fused input quantization)
 
 #define AILAYER_SETTINGS_SET(settings, mask, selector, value)   (settings = ((settings) & ~(mask << (selector))) | ((value) << (selector)))
 #define AILAYER_SETTINGS_IS(settings, mask, selector)           (((settings) >> (selector)) & mask)
@@ -52,6 +53,10 @@ typedef struct aicore_layertype aicore_layertype_t;
 typedef struct aicore_losstype aicore_losstype_t;
 typedef struct aicore_optitype aicore_optitype_t;
 
+#ifdef AIFES_WITH_PROFILING
+typedef struct aialgo_profile aialgo_profile_t;
+#endif
+
 
 /** @brief Type indicator of the layer
  *
@@ -62,11 +67,12 @@ typedef struct aicore_optitype aicore_optitype_t;
  * const aicore_layertype_t ailayer_dense_type_s = {
  * #ifdef AIDEBUG_PRINT_MODULE_SPECS
  *     .name = "Dense",
- *     .print_specs = ailayer_dense_print_specs
+ *     .print_specs = ailayer_dense_print_specs,
  * #else
  *     .name = 0,
- *     .print_specs = 0
+ *     .print_specs = 0,
  * #endif
+ *     .count_macs = ailayer_dense_count_macs
  * };
  * const aicore_layertype_t *ailayer_dense_type = &ailayer_dense_type_s;
  * \endcode
@@ -90,6 +96,16 @@ struct aicore_layertype {
 	* @param *print         A function for printing (for example printf)
 	*/
 	void (*print_specs)(const ailayer_t *self);
+
+    /** @brief Set a function to count the multiply-accumulate operations of one forward pass (optional)
+    *
+    * Used for example by the footprint analysis (aialgo_analyze_footprint()). Set to 0 for layers without
+    * significant arithmetic (for example activations or reshape layers). The result shape of the layer must be calculated before.
+    *
+	* @param self           The layer
+	* @return               Number of multiply-accumulate operations
+	*/
+	uint32_t (*count_macs)(const ailayer_t *self);
 };
 
 /** @brief Type indicator of the loss to check for the loss type
@@ -186,6 +202,10 @@ struct aimodel {
 	uint16_t trainable_params_count; /**< Total number of trainable parameter tensors */
 
 	ailoss_t *loss; /**< The loss or cost function of the model (only for training). */
+
+#ifdef AIFES_WITH_PROFILING
+	aialgo_profile_t *profile; /**< Profile for the per-layer counters (see aialgo_profiling.h). Set with aialgo_set_profile_model(), 0 if not profiled. */
+#endif
 };
 
 
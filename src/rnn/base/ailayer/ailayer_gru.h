@@ -0,0 +1,317 @@
+/**
+ * \file rnn/base/ailayer/ailayer_gru.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Base \link ailayer layer \endlink implementation of the GRU layer
+ *
+ * This is an "abstract" data-type independent implementation. To use the layer use one of the provided
+ * implementations for a specific hardware and data-type (for example from ailayer_gru_default.h) or set
+ * the required math functions on your own.
+ *
+ * The GRU layer (gated recurrent unit) is a recurrent layer that processes an input sequence \f$ [N,T,I] \f$
+ * (batch, time steps, input features) step by step with a hidden state \f$ h \f$ of \f$ H \f$ units:
+ * @f[
+ *  [zx_u, zx_r, zx_n] = x_t \cdot W_x + b_x, \quad [zh_u, zh_r, zh_n] = h_{t-1} \cdot W_h + b_h
+ * @f]
+ * @f[
+ *  u = \sigma(zx_u + zh_u), \quad r = \sigma(zx_r + zh_r), \quad n = \tanh(zx_n + r \circ zh_n)
+ * @f]
+ * @f[
+ *  h_t = u \circ h_{t-1} + (1 - u) \circ n
+ * @f]
+ *
+ * The input weights and the recurrent weights are stacked into one weights tensor \f$ W = [W_x; W_h] \f$ with shape \f$ [I + H, 3H] \f$,
+ * so that all gates of a time step are calculated with a single pass over the weights. The bias \f$ [b_x, b_h] \f$ has the shape \f$ [6H] \f$.
+ * Trained Keras weights (reset_after = True) can be used with \f$ W = [W_{kernel}; W_{recurrent}] \f$ (same gate order).
+ *
+ * The result is the sequence of hidden states \f$ [N,T,H] \f$ (return_sequences = TRUE) or the last hidden state \f$ [N,H] \f$.
+ *
+ * The hidden state \f$ [N,H] \f$ is stored in the parameter memory. If the layer is stateful, the state is kept between
+ * two forward passes. This allows step-by-step streaming inference with sequences of length \f$ T = 1 \f$ and truncated
+ * backpropagation through time over consecutive windows. Otherwise the state is reset to zero at the beginning of every forward pass.
+ * Use ailayer_gru_reset_state() to reset the state manually.
+ *
+ * For training, the gates and hidden states of all time steps are cached in the training memory (see aialgo_schedule_training_memory()).
+ * The gradients are propagated back through the time steps of the current sequence only.
+ *
+ * The results of the forward pass of this layer are written to the result tensor of the base ailayer_t struct.
+ */
+
+#ifndef GRU_LAYER
+#define GRU_LAYER
+
+#include "core/aifes_core.h"
+
+typedef struct ailayer_gru 	ailayer_gru_t;
+
+/** @brief General \link ailayer_gru.h GRU layer \endlink structure
+*
+*/
+struct ailayer_gru {
+	ailayer_t base; /**< Inherited field members from general ailayer struct. */
+
+	/** @name Layer configuration
+	 * @brief Required configuration parameters for the layer
+	 *
+	 * These fields have to be configured by the user before calling the initializer function.
+	 */
+	///@{
+	uint32_t units;             /**< Number of hidden units (\f$ H \f$). */
+	uint8_t return_sequences;   /**< TRUE: Return the hidden states of all time steps \f$ [N,T,H] \f$, FALSE: Return only the last hidden state \f$ [N,H] \f$. */
+	uint8_t stateful;           /**< TRUE: Keep the hidden state between forward passes, FALSE: Reset the state in every forward pass. */
+	///@}
+
+	/** @name Trainable parameters
+	 * @brief Data fields for the trainable parameters (weights, bias) of the layer
+	 */
+	///@{
+	aitensor_t weights; /**< Tensor containing the stacked input and recurrent weights \f$ [I + H, 3H] \f$. */
+	aitensor_t bias;    /**< Tensor containing the input and recurrent bias weights \f$ [6H] \f$. */
+	///@}
+
+	aitensor_t hidden_state;    /**< Tensor containing the hidden state \f$ [N,H] \f$ (stored in the parameter memory). */
+
+	uint16_t weights_shape[2];  /**< Weights tensor shape. */
+	uint16_t bias_shape[1];     /**< Bias weights tensor shape. */
+	uint16_t state_shape[2];    /**< Shape of the hidden state. */
+
+	aitensor_t *trainable_params[2]; /**< Pointer to the weights and bias (which are the trainable parameters). */
+	aitensor_t *gradients[2]; /**< Gradients structure for the backpropagation algorithm. */
+	void *optimem[2];   /**< Memory field used by the optimizer for training. */
+
+	/** @name Training caches
+	 * @brief Data fields for the intermediate results of the forward pass that are needed in the backward pass (stored in the training memory)
+	 */
+	///@{
+	aitensor_t gate_cache;      /**< Activated gates and recurrent part of the new gate \f$ [u, r, n, zh_n] \f$ of all time steps \f$ [N,T,4H] \f$. */
+	aitensor_t hidden_cache;    /**< Hidden states of all time steps including the initial state \f$ [N,T+1,H] \f$. */
+
+	uint16_t gate_cache_shape[3];   /**< Shape of the gate cache. */
+	uint16_t state_cache_shape[3];  /**< Shape of the hidden state cache. */
+	///@}
+
+	uint16_t result_shape[3]; /**< The shape of the result. */
+
+	/** @name Math functions
+	 * @brief Required data type specific math functions
+	 */
+	///@{
+
+	/** @brief Required math function: GRU forward pass over a sequence
+	 *
+	 * Requires a math function that calculates the GRU on the whole sequence (see aimath_f32_default_gru_fwd()).
+	 *
+	 * The caches are 0 in inference mode.
+     *
+     * @param x_in              Input sequence \f$ [N,T,I] \f$
+     * @param weights           Stacked weights \f$ [I + H, 3H] \f$
+     * @param bias              Input and recurrent bias \f$ [6H] \f$
+     * @param return_sequences  Return the hidden states of all time steps or only the last one
+     * @param work_space        Pointer to a work space buffer for intermediate results (see ailayer_t.sizeof_fwdmem).
+     * @param hidden_state      Hidden state \f$ [N,H] \f$ (read and written)
+     * @param gate_cache        Cache for the gates \f$ [N,T,4H] \f$ (or 0)
+     * @param hidden_cache      Cache for the hidden states \f$ [N,T+1,H] \f$ (or 0)
+     * @param result            Output \f$ [N,T,H] \f$ or \f$ [N,H] \f$
+     */
+	void (*gru_fwd)(
+                     const aitensor_t *x_in,
+                     const aitensor_t *weights,
+                     const aitensor_t *bias,
+                     uint8_t return_sequences,
+                     void *work_space,
+                     aitensor_t *hidden_state,
+                     aitensor_t *gate_cache,
+                     aitensor_t *hidden_cache,
+                     aitensor_t *result
+                     );
+
+	/** @brief Required math function: GRU backward pass (backpropagation through time)
+	 *
+	 * Requires a math function that adds the gradients of the weights and bias to d_weights and d_bias
+	 * and calculates the gradients with respect to the input (see aimath_f32_default_gru_bwd()).
+     *
+     * @param x_in              Input sequence \f$ [N,T,I] \f$
+     * @param weights           Stacked weights \f$ [I + H, 3H] \f$
+     * @param delta_out         Gradients backpropagated from the following layer \f$ [N,T,H] \f$ or \f$ [N,H] \f$
+     * @param return_sequences  delta_out contains the gradients of all time steps or only of the last one
+     * @param gate_cache        Cached gates \f$ [N,T,4H] \f$
+     * @param hidden_cache      Cached hidden states \f$ [N,T+1,H] \f$
+     * @param work_space        Pointer to a work space buffer for intermediate results (see ailayer_t.sizeof_bwdmem).
+     * @param d_weights         Gradients of the weights (or 0 if the layer is not trainable)
+     * @param d_bias            Gradients of the bias (or 0 if the layer is not trainable)
+     * @param delta_in          Gradients with respect to the input \f$ [N,T,I] \f$ (or 0 if not needed)
+     */
+	void (*gru_bwd)(
+                     const aitensor_t *x_in,
+                     const aitensor_t *weights,
+                     const aitensor_t *delta_out,
+                     uint8_t return_sequences,
+                     const aitensor_t *gate_cache,
+                     const aitensor_t *hidden_cache,
+                     void *work_space,
+                     aitensor_t *d_weights,
+                     aitensor_t *d_bias,
+                     aitensor_t *delta_in
+                     );
+
+    ///@}
+};
+
+/** @brief GRU layer type
+ *
+ * Defines the type of the layer (for example for type checks and debug prints).
+ * See aicore_layertype for more information about the layer type.
+ */
+extern const aicore_layertype_t *ailayer_gru_type;
+
+/** @brief Initialize and connect the given GRU layer
+ *
+ * This function represents the "constructor" of the abstract GRU layer. It initializes the layer structure
+ * and connects it to the previous layer.\n
+ * This function is not intended to call it directly. Instead use one of the data type specific implementations
+ * (like for example ailayer_gru_f32_default()).
+ *
+ * @param *layer        The layer to initialize.
+ * @param *input_layer  The previous layer that provides the input sequence \f$ [N,T,I] \f$ to the layer.
+ * @return  Pointer to the (successfully) initialized general layer structure (ailayer_gru.base)
+ */
+ailayer_t *ailayer_gru(ailayer_gru_t *layer, ailayer_t *input_layer);
+
+/** @brief Calculate the forward pass for given GRU layer
+ *
+ * *Implementation of ailayer.forward.*
+ *
+ * Resets the state (if the layer is not stateful) and calculates the sequence with ailayer_gru.gru_fwd.
+ * In training mode, the intermediate results are stored in the caches for the backward pass.
+ *
+ * @param *self Layer to calculate the forward path for.
+ */
+void ailayer_gru_forward(ailayer_t *self);
+
+/** @brief Calculate the backward pass for the given GRU layer
+ *
+ * *Implementation of ailayer.backward.*
+ *
+ * Calculates the gradients with ailayer_gru.gru_bwd (truncated backpropagation through time over the current sequence).
+ *
+ * @param *self Layer to calculate the backward path for.
+ */
+void ailayer_gru_backward(ailayer_t *self);
+
+/** @brief Calculate the shape of the result tensor (ailayer.result)
+ *
+ * *Implementation of ailayer.calc_result_shape.*
+ *
+ * Resulting shape is [N,T,H] (return_sequences) or [N,H]. The shapes of the state and caches are updated as well.
+ *
+ * @param *self Layer to calculate the resulting shape for.
+ */
+void ailayer_gru_calc_result_shape(ailayer_t *self);
+
+/** @brief Calculate and return the memory size needed by this layer for temporary results of the forward pass
+ *
+ * *Implementation of ailayer.sizeof_fwdmem.*
+ *
+ * The forward pass needs a buffer for the input and recurrent gate pre-activations of one time step (\f$ 6H \f$ elements).
+ *
+ * @param *self The layer
+ * @return Calculated memory size in bytes.
+ */
+uint32_t ailayer_gru_sizeof_fwdmem(const ailayer_t *self);
+
+/** @brief Calculate and return the memory size needed by this layer for temporary results of the backward pass
+ *
+ * *Implementation of ailayer.sizeof_bwdmem.*
+ *
+ * The backward pass needs buffers for the hidden state and gate gradients of one time step (\f$ 7H \f$ elements).
+ *
+ * @param *self The layer
+ * @return Calculated memory size in bytes.
+ */
+uint32_t ailayer_gru_sizeof_bwdmem(const ailayer_t *self);
+
+/** @brief Calculate and return the parameter memory size needed for this layer
+ *
+ * *Implementation of ailayer.sizeof_paramem.*
+ *
+ * The parameter memory holds the weights, the bias and the hidden state.
+ *
+ * @param *self The layer to calculate the parameter memory size for
+ * @return  Calculated parameter memory size in bytes.
+ */
+uint32_t ailayer_gru_sizeof_paramem(const ailayer_t *self);
+
+/** @brief Distribute provided memory to the parameter pointers
+ *
+ * *Implementation of ailayer.set_paramem.*
+ *
+ * @param *self         The layer to set the memory fields for.
+ * @param *memory_ptr   The memory that can be used for the parameters
+ */
+void ailayer_gru_set_paramem(ailayer_t *self, void *memory_ptr);
+
+/** @brief Calculate and return the memory size needed by this layer for training
+ *
+ * *Implementation of ailayer.sizeof_trainmem.*
+ *
+ * The training memory holds the gradients (if the layer is trainable) and the caches for the backpropagation through time.
+ *
+ * @param *self The layer to calculate the gradient memory size for.
+ * @return  Calculated gradient memory size in bytes.
+ */
+uint32_t ailayer_gru_sizeof_trainmem(const ailayer_t *self);
+
+/** @brief Distribute provided memory to the gradients and caches
+ *
+ * *Implementation of ailayer.set_trainmem.*
+ *
+ * @param *self         The layer to set the memory fields for.
+ * @param *memory_ptr   The memory that can be used for the gradients and caches
+ */
+void ailayer_gru_set_trainmem(ailayer_t *self, void *memory_ptr);
+
+/** @brief Reset the hidden state of the layer to zero
+ *
+ * Call this function for example between two independent sequences of a stateful layer.
+ *
+ * @param *self The layer
+ */
+void ailayer_gru_reset_state(ailayer_t *self);
+
+/** @brief Count the multiply-accumulate operations of one forward pass
+ *
+ * Counts the multiply-accumulate operations of the gate matrix multiplications of all time steps (\f$ N \cdot T \cdot (I + H) \cdot 3H \f$).
+ * The element-wise operations of the state update are not counted.
+ *
+ * *Implementation of aicore_layertype.count_macs.*
+ *
+ * @param *self     The layer
+ * @return          Number of multiply-accumulate operations
+ */
+uint32_t ailayer_gru_count_macs(const ailayer_t *self);
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+/** @brief Print the layer specification
+ *
+ * @param *self     The layer to print the specification for
+ */
+void ailayer_gru_print_specs(const ailayer_t *self);
+#endif // AIDEBUG_PRINT_MODULE_SPECS
+
+#endif // GRU_LAYER
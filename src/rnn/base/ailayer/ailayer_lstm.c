@@ -0,0 +1,412 @@
+/**
+ * \file rnn/base/ailayer/ailayer_lstm.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+#include "rnn/base/ailayer/ailayer_lstm.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+#include <string.h>
+
+AISTRING_STORAGE_WRAPPER(aistring_layer_lstm, "LSTM");
+
+const aicore_layertype_t ailayer_lstm_type_s = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = aistring_layer_lstm,
+	.print_specs = ailayer_lstm_print_specs,
+#else
+    .name = 0,
+    .print_specs = 0,
+#endif
+    .count_macs = ailayer_lstm_count_macs
+};
+const aicore_layertype_t *ailayer_lstm_type = &ailayer_lstm_type_s;
+
+
+AISTRING_STORAGE_WRAPPER(aistring_error_lstm_1, "[ailayer_lstm] Input must be a sequence of shape [N,T,I].\n");
+
+
+ailayer_t *ailayer_lstm(ailayer_lstm_t *layer, ailayer_t *input_layer)
+{
+    if(input_layer->result.dim != 3){
+        AILOG_E(aistring_error_lstm_1);
+        return 0;
+    }
+
+    layer->base.layer_type = ailayer_lstm_type;
+
+    layer->base.settings = 0;
+    AILAYER_SETTINGS_SET(layer->base.settings, 0b1, AILAYER_SETTINGS_TRAINABLE, TRUE);
+    AILAYER_SETTINGS_SET(layer->base.settings, 0b1, AILAYER_SETTINGS_NO_INPUT_GRADIENT, FALSE);
+
+	layer->base.input_layer = input_layer;
+    layer->base.output_layer = 0;
+	input_layer->output_layer = &(layer->base);
+
+    // Set base params of layer
+	layer->base.layer_configuration = layer;
+	layer->base.result.dim = layer->return_sequences ? 3 : 2;
+	layer->base.result.shape = layer->result_shape;
+	layer->base.deltas.dim = 3;
+	layer->base.deltas.shape = input_layer->result.shape;
+
+	layer->weights.dim = 2;
+	layer->weights.shape = layer->weights_shape;
+	layer->weights.shape[0] = input_layer->result.shape[2] + layer->units; // I + H
+	layer->weights.shape[1] = 4 * layer->units; // 4H
+
+	layer->bias.dim = 1;
+	layer->bias.shape = layer->bias_shape;
+	layer->bias.shape[0] = 4 * layer->units;
+
+	// The states have no tensor params (fixed for quantized data types)
+	layer->hidden_state.dim = 2;
+	layer->hidden_state.shape = layer->state_shape;
+	layer->hidden_state.tensor_params = 0;
+	layer->cell_state.dim = 2;
+	layer->cell_state.shape = layer->state_shape;
+	layer->cell_state.tensor_params = 0;
+
+	layer->gate_cache.dim = 3;
+	layer->gate_cache.shape = layer->gate_cache_shape;
+	layer->gate_cache.dtype = layer->base.result.dtype;
+	layer->gate_cache.tensor_params = 0;
+	layer->cell_cache.dim = 3;
+	layer->cell_cache.shape = layer->state_cache_shape;
+	layer->cell_cache.dtype = layer->cell_state.dtype;
+	layer->cell_cache.tensor_params = 0;
+	layer->hidden_cache.dim = 3;
+	layer->hidden_cache.shape = layer->state_cache_shape;
+	layer->hidden_cache.dtype = layer->hidden_state.dtype;
+	layer->hidden_cache.tensor_params = 0;
+
+	// Set forward and backward function pointers
+	layer->base.forward = ailayer_lstm_forward;
+	layer->base.backward = ailayer_lstm_backward;
+
+	// Set additional function pointers
+	layer->base.calc_result_shape = ailayer_lstm_calc_result_shape;
+	layer->base.sizeof_paramem = ailayer_lstm_sizeof_paramem;
+	layer->base.set_paramem = ailayer_lstm_set_paramem;
+	layer->base.sizeof_trainmem = ailayer_lstm_sizeof_trainmem;
+	layer->base.set_trainmem = ailayer_lstm_set_trainmem;
+	layer->base.sizeof_fwdmem = ailayer_lstm_sizeof_fwdmem;
+	layer->base.sizeof_bwdmem = ailayer_lstm_sizeof_bwdmem;
+
+	layer->base.trainable_params_count = 2;
+	layer->base.trainable_params = layer->trainable_params;
+	layer->base.gradients = layer->gradients;
+	layer->base.optimem = layer->optimem;
+
+	layer->trainable_params[0] = &layer->weights;
+	layer->trainable_params[1] = &layer->bias;
+
+	ailayer_lstm_calc_result_shape(&layer->base);
+
+	return &layer->base;
+}
+
+void ailayer_lstm_forward(ailayer_t *self)
+{
+	aitensor_t *x_in = &(self->input_layer->result);
+	aitensor_t *x_out = &(self->result);
+	ailayer_lstm_t *layer = (ailayer_lstm_t *)(self->layer_configuration);
+
+	if(!layer->stateful){
+        ailayer_lstm_reset_state(self);
+	}
+
+	if(AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_TRAINING_MODE)){
+        // Store the intermediate results for the backpropagation through time
+        layer->lstm_fwd(x_in,
+                        &layer->weights,
+                        &layer->bias,
+                        layer->return_sequences,
+                        self->tempmem,
+                        &layer->hidden_state,
+                        &layer->cell_state,
+                        &layer->gate_cache,
+                        &layer->cell_cache,
+                        &layer->hidden_cache,
+                        x_out);
+	} else {
+        layer->lstm_fwd(x_in,
+                        &layer->weights,
+                        &layer->bias,
+                        layer->return_sequences,
+                        self->tempmem,
+                        &layer->hidden_state,
+                        &layer->cell_state,
+                        0,
+                        0,
+                        0,
+                        x_out);
+	}
+
+	return;
+}
+
+void ailayer_lstm_backward(ailayer_t *self)
+{
+	aitensor_t *delta_in = &(self->deltas);
+	aitensor_t *delta_out = &(self->output_layer->deltas);
+	aitensor_t *x_in = &(self->input_layer->result);
+	ailayer_lstm_t *layer = (ailayer_lstm_t *)(self->layer_configuration);
+	aitensor_t *d_weights = 0;
+	aitensor_t *d_bias = 0;
+
+    if(AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)){
+        d_weights = layer->gradients[0];
+        d_bias = layer->gradients[1];
+    }
+    if(AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_NO_INPUT_GRADIENT)){
+        delta_in = 0;
+    }
+
+    layer->lstm_bwd(x_in,
+                    &layer->weights,
+                    delta_out,
+                    layer->return_sequences,
+                    &layer->gate_cache,
+                    &layer->cell_cache,
+                    &layer->hidden_cache,
+                    self->tempmem,
+                    d_weights,
+                    d_bias,
+                    delta_in);
+
+	return;
+}
+
+void ailayer_lstm_calc_result_shape(ailayer_t *self)
+{
+	ailayer_lstm_t *layer = (ailayer_lstm_t *)(self->layer_configuration);
+	uint16_t N = self->input_layer->result.shape[0];
+	uint16_t T = self->input_layer->result.shape[1];
+
+	if(layer->return_sequences){
+        self->result.shape[0] = N;
+        self->result.shape[1] = T;
+        self->result.shape[2] = layer->units;
+	} else {
+        self->result.shape[0] = N;
+        self->result.shape[1] = layer->units;
+	}
+
+	layer->state_shape[0] = N;
+	layer->state_shape[1] = layer->units;
+
+	layer->gate_cache_shape[0] = N;
+	layer->gate_cache_shape[1] = T;
+	layer->gate_cache_shape[2] = 4 * layer->units;
+
+	layer->state_cache_shape[0] = N;
+	layer->state_cache_shape[1] = T + 1;
+	layer->state_cache_shape[2] = layer->units;
+
+	return;
+}
+
+uint32_t ailayer_lstm_sizeof_fwdmem(const ailayer_t *self)
+{
+	const ailayer_lstm_t *layer = (ailayer_lstm_t *)(self->layer_configuration);
+
+	// Gate pre-activations of one time step
+	return 4 * layer->units * aimath_sizeof_dtype(layer->weights.dtype);
+}
+
+uint32_t ailayer_lstm_sizeof_bwdmem(const ailayer_t *self)
+{
+	const ailayer_lstm_t *layer = (ailayer_lstm_t *)(self->layer_configuration);
+
+	// Gradients of the hidden state, the cell state and the gates of one time step
+	return 6 * layer->units * aimath_sizeof_dtype(layer->weights.dtype);
+}
+
+uint32_t ailayer_lstm_sizeof_paramem(const ailayer_t *self)
+{
+	uint32_t memory = 0;
+	ailayer_lstm_t *layer = (ailayer_lstm_t *)(self->layer_configuration);
+
+	// Weights
+	memory += layer->weights.dtype->tensor_params_size;
+    AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
+	memory += aimath_sizeof_tensor_data(&(layer->weights));
+    AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
+
+	// Bias
+	memory += layer->bias.dtype->tensor_params_size;
+    AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
+	memory += aimath_sizeof_tensor_data(&(layer->bias));
+    AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
+
+	// States
+	memory += aimath_sizeof_tensor_data(&(layer->hidden_state));
+    AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
+	memory += aimath_sizeof_tensor_data(&(layer->cell_state));
+	return memory;
+}
+
+void ailayer_lstm_set_paramem(ailayer_t *self, void *memory_ptr)
+{
+	uint32_t address_counter = 0;
+	ailayer_lstm_t *layer = (ailayer_lstm_t *)(self->layer_configuration);
+
+	layer->weights.tensor_params = memory_ptr + address_counter;
+	address_counter += layer->weights.dtype->tensor_params_size;
+    AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+
+	layer->weights.data = memory_ptr + address_counter;
+	address_counter += aimath_sizeof_tensor_data(&(layer->weights));
+    AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+
+	layer->bias.tensor_params = memory_ptr + address_counter;
+	address_counter += layer->bias.dtype->tensor_params_size;
+    AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+
+	layer->bias.data = memory_ptr + address_counter;
+	address_counter += aimath_sizeof_tensor_data(&(layer->bias));
+    AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+
+	layer->hidden_state.data = memory_ptr + address_counter;
+	address_counter += aimath_sizeof_tensor_data(&(layer->hidden_state));
+    AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+
+	layer->cell_state.data = memory_ptr + address_counter;
+
+	layer->trainable_params[0] = &(layer->weights);
+	layer->trainable_params[1] = &(layer->bias);
+
+	return;
+}
+
+uint32_t ailayer_lstm_sizeof_trainmem(const ailayer_t *self)
+{
+	uint32_t memory = 0;
+	ailayer_lstm_t *layer = (ailayer_lstm_t *)(self->layer_configuration);
+
+	if(AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)){
+        // Weights
+        memory += sizeof(aitensor_t);
+        memory += aimath_sizeof_tensor_data(&layer->weights);
+        AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
+        memory += aimath_sizeof_tensor_params(&layer->weights);
+        AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
+
+        // Bias
+        memory += sizeof(aitensor_t);
+        memory += aimath_sizeof_tensor_data(&layer->bias);
+        AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
+        memory += aimath_sizeof_tensor_params(&layer->bias);
+        AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
+	}
+
+	// Caches for the backpropagation through time (also needed for frozen parameters to calculate the input gradients)
+	memory += aimath_sizeof_tensor_data(&layer->gate_cache);
+    AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
+	memory += aimath_sizeof_tensor_data(&layer->cell_cache);
+    AIFES_ALIGN_INTEGER(memory, AIFES_MEMORY_ALIGNMENT);
+	memory += aimath_sizeof_tensor_data(&layer->hidden_cache);
+	return memory;
+}
+
+void ailayer_lstm_set_trainmem(ailayer_t *self, void *memory_ptr)
+{
+	uint32_t address_counter = 0;
+	ailayer_lstm_t *layer = (ailayer_lstm_t *) (self->layer_configuration);
+
+	if(AILAYER_SETTINGS_IS(self->settings, 0b1, AILAYER_SETTINGS_TRAINABLE)){
+        // Weights gradients in gradients[0]
+        self->gradients[0] = memory_ptr;
+        address_counter += sizeof(aitensor_t);
+        self->gradients[0]->data = memory_ptr + address_counter;
+        self->gradients[0]->dtype = layer->weights.dtype;
+        self->gradients[0]->dim = 2;
+        self->gradients[0]->shape = layer->weights.shape;
+        address_counter += aimath_sizeof_tensor_data(layer->gradients[0]);
+        AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+        self->gradients[0]->tensor_params = memory_ptr + address_counter;
+        address_counter += aimath_sizeof_tensor_params(layer->gradients[0]);
+        AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+
+        // Bias gradients in gradients[1]
+        self->gradients[1] = memory_ptr + address_counter;
+        address_counter += sizeof(aitensor_t);
+        self->gradients[1]->data = memory_ptr + address_counter;
+        self->gradients[1]->dtype = layer->bias.dtype;
+        self->gradients[1]->dim = 1;
+        self->gradients[1]->shape = layer->bias.shape;
+        address_counter += aimath_sizeof_tensor_data(layer->gradients[1]);
+        AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+        self->gradients[1]->tensor_params = memory_ptr + address_counter;
+        address_counter += aimath_sizeof_tensor_params(layer->gradients[1]);
+        AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+	} else {
+        // No gradients are needed for frozen parameters
+        self->gradients[0] = 0;
+        self->gradients[1] = 0;
+	}
+
+	layer->gate_cache.data = memory_ptr + address_counter;
+	address_counter += aimath_sizeof_tensor_data(&layer->gate_cache);
+    AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+
+	layer->cell_cache.data = memory_ptr + address_counter;
+	address_counter += aimath_sizeof_tensor_data(&layer->cell_cache);
+    AIFES_ALIGN_INTEGER(address_counter, AIFES_MEMORY_ALIGNMENT);
+
+	layer->hidden_cache.data = memory_ptr + address_counter;
+
+	return;
+}
+
+void ailayer_lstm_reset_state(ailayer_t *self)
+{
+	ailayer_lstm_t *layer = (ailayer_lstm_t *)(self->layer_configuration);
+
+	memset(layer->hidden_state.data, 0, aimath_sizeof_tensor_data(&layer->hidden_state));
+	memset(layer->cell_state.data, 0, aimath_sizeof_tensor_data(&layer->cell_state));
+	return;
+}
+
+uint32_t ailayer_lstm_count_macs(const ailayer_t *self)
+{
+    ailayer_lstm_t *layer = (ailayer_lstm_t *)(self->layer_configuration);
+
+    // One gate GEMM [N,I+H] * [I+H,4H] per time step
+    return (uint32_t) self->input_layer->result.shape[0] * self->input_layer->result.shape[1] * aimath_tensor_elements(&layer->weights);
+}
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_lstm_1, "units: ");
+AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_lstm_2, "; return_sequences: ");
+AISTRING_STORAGE_WRAPPER(aistring_print_layer_specs_lstm_3, "; stateful: ");
+
+void ailayer_lstm_print_specs(const ailayer_t *self)
+{
+    ailayer_lstm_t *layer = (ailayer_lstm_t *)(self->layer_configuration);
+
+    AIPRINT(aistring_print_layer_specs_lstm_1);
+    AIPRINT_LONG_INT("%ld", (long int) layer->units);
+    AIPRINT(aistring_print_layer_specs_lstm_2);
+    AIPRINT_LONG_INT("%ld", (long int) layer->return_sequences);
+    AIPRINT(aistring_print_layer_specs_lstm_3);
+    AIPRINT_LONG_INT("%ld", (long int) layer->stateful);
+}
+#endif
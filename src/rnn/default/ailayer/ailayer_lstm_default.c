@@ -0,0 +1,105 @@
+/**
+ * \file rnn/default/ailayer/ailayer_lstm_default.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+#include "rnn/default/ailayer/ailayer_lstm_default.h"
+
+ailayer_t *ailayer_lstm_f32_default(ailayer_lstm_f32_t *layer, ailayer_t *input_layer)
+{
+	layer->base.result.dtype = aif32;
+	layer->base.deltas.dtype = aif32;
+	layer->weights.dtype = aif32;
+	layer->bias.dtype = aif32;
+	layer->hidden_state.dtype = aif32;
+	layer->cell_state.dtype = aif32;
+
+	layer->base.calc_result_tensor_params = 0;
+	layer->base.init_params = ailayer_lstm_init_params_f32_default;
+
+    layer->lstm_fwd = aimath_f32_default_lstm_fwd;
+    layer->lstm_bwd = aimath_f32_default_lstm_bwd;
+
+    return ailayer_lstm(layer, input_layer);
+}
+
+ailayer_t *ailayer_lstm_q7_default(ailayer_lstm_q7_t *layer, ailayer_t *input_layer)
+{
+    ailayer_t *return_layer;
+
+	layer->base.result.dtype = aiq7;
+	layer->base.deltas.dtype = aiq7;
+	layer->weights.dtype = aiq7;
+	layer->bias.dtype = aiq7;
+	layer->hidden_state.dtype = aiq7;
+	layer->cell_state.dtype = aiq31;
+
+	layer->base.calc_result_tensor_params = ailayer_lstm_calc_result_tensor_params_q7_default;
+	layer->base.init_params = 0;
+
+    layer->lstm_fwd = aimath_q7_default_lstm_fwd;
+    layer->lstm_bwd = 0;
+
+    return_layer = ailayer_lstm(layer, input_layer);
+    if(return_layer == 0){
+        return 0;
+    }
+
+	return_layer->sizeof_fwdmem = ailayer_lstm_sizeof_fwdmem_q7_default;
+
+	// backward
+	// Not supported for q7
+	return_layer->backward = 0;
+
+	return return_layer;
+}
+
+void ailayer_lstm_init_params_f32_default(ailayer_t *self)
+{
+	ailayer_lstm_t *layer = (ailayer_lstm_t *) (self->layer_configuration);
+	uint32_t i;
+
+	aimath_f32_default_init_glorot_uniform(&layer->weights);
+	aimath_f32_default_init_zeros(&layer->bias);
+
+	// Forget gate bias of one helps to keep the cell state at the beginning of the training
+	for(i = layer->units; i < 2 * layer->units; i++){
+        ((float *) layer->bias.data)[i] = 1.0f;
+	}
+
+	ailayer_lstm_reset_state(self);
+	return;
+}
+
+void ailayer_lstm_calc_result_tensor_params_q7_default(ailayer_t *self)
+{
+	aimath_q7_params_t *qparams = (aimath_q7_params_t *) (self->result.tensor_params);
+
+	qparams->shift = AIMATH_Q7_RNN_HIDDEN_SHIFT;
+	qparams->zero_point = 0;
+	return;
+}
+
+uint32_t ailayer_lstm_sizeof_fwdmem_q7_default(const ailayer_t *self)
+{
+	const ailayer_lstm_t *layer = (ailayer_lstm_t *)(self->layer_configuration);
+
+	// 32 bit accumulators and quantized gate pre-activations and gates of one time step
+	return 4 * layer->units * sizeof(int32_t) + 8 * layer->units * sizeof(int8_t);
+}
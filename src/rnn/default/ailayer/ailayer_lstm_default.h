@@ -0,0 +1,172 @@
+/**
+ * \file rnn/default/ailayer/ailayer_lstm_default.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Default implementation of the \link ailayer_lstm.h LSTM layer \endlink
+ *
+ * Hardware independent implementations of the LSTM layer in \link aimath_f32.h F32 \endlink and
+ * \link aimath_q7.h Q7 \endlink data-type.
+ * For more information about the LSTM layer refer to ailayer_lstm.h.
+ */
+
+#ifndef AILAYER_LSTM_DEFAULT
+#define AILAYER_LSTM_DEFAULT
+
+#include "rnn/base/ailayer/ailayer_lstm.h"
+
+#include "rnn/default/aimath/aimath_rnn_f32_default.h"
+#include "rnn/default/aimath/aimath_rnn_q7_default.h"
+#include "basic/default/aimath/aimath_f32_default.h"
+
+#define AILAYER_LSTM_F32_M(units, return_sequences, stateful, weights, bias, hidden_state, cell_state) \
+            {{0,},units,return_sequences,stateful,{0,0,0,0,(float *) weights},{0,0,0,0,(float *) bias},{0,0,0,0,(float *) hidden_state},{0,0,0,0,(float *) cell_state}}
+#define AILAYER_LSTM_F32_A(units, return_sequences, stateful) \
+            {{0,},units,return_sequences,stateful,{0,0,0,0,0},{0,0,0,0,0},{0,0,0,0,0},{0,0,0,0,0}}
+#define AILAYER_LSTM_Q7_M(units, return_sequences, stateful, weights, weights_qparams, bias, bias_qparams, hidden_state, cell_state) \
+            {{0,},units,return_sequences,stateful,{0,0,0,weights_qparams,(int8_t *) weights},{0,0,0,bias_qparams,(int8_t *) bias},{0,0,0,0,(int8_t *) hidden_state},{0,0,0,0,(int32_t *) cell_state}}
+#define AILAYER_LSTM_Q7_A(units, return_sequences, stateful) \
+            {{0,},units,return_sequences,stateful,{0,0,0,0,0},{0,0,0,0,0},{0,0,0,0,0},{0,0,0,0,0}}
+
+typedef struct ailayer_lstm   ailayer_lstm_f32_t;
+typedef struct ailayer_lstm   ailayer_lstm_q7_t;
+
+/// @brief Initializes and connect a \link ailayer_lstm.h LSTM layer \endlink with the \link aimath_f32.h F32 \endlink default implementation
+///
+/// The stacked weights \f$ [I + H, 4H] \f$ contain the input weights in the first \f$ I \f$ rows and the recurrent weights
+/// in the last \f$ H \f$ rows. The columns are ordered by the gates input, forget, cell and output (like in Keras).
+/// The hidden and cell state buffers need \f$ N \cdot H \f$ elements each.
+///
+/// **Example:** Create the layer structure with pretrained weights (2 input features, 3 units):\n
+/// In C, C++ and on Arduino:
+/// \code{.c}
+/// float weights_data_lstm[(2 + 3) * 4 * 3] = {...};
+/// float bias_data_lstm[4 * 3] = {...};
+/// float hidden_state_lstm[1 * 3];
+/// float cell_state_lstm[1 * 3];
+///
+/// ailayer_lstm_f32_t lstm_layer         = AILAYER_LSTM_F32_M(
+///                                                                 /* units =*/            3,
+///                                                                 /* return_sequences =*/ FALSE,
+///                                                                 /* stateful =*/         FALSE,
+///                                                                 /* weights =*/          weights_data_lstm,
+///                                                                 /* bias =*/             bias_data_lstm,
+///                                                                 /* hidden_state =*/     hidden_state_lstm,
+///                                                                 /* cell_state =*/       cell_state_lstm
+///                                                              );
+/// \endcode
+///
+/// **Example:** Create the layer structure for automatic parameter distribution:\n
+/// In C, C++ and on Arduino:
+/// \code{.c}
+/// ailayer_lstm_f32_t lstm_layer         = AILAYER_LSTM_F32_A(
+///                                                                 /* units =*/            16,
+///                                                                 /* return_sequences =*/ FALSE,
+///                                                                 /* stateful =*/         FALSE
+///                                                              );
+/// \endcode
+///
+/// **Example:** Step-by-step streaming inference:\n
+/// Configure the layer as stateful and feed one time step at a time (input shape [1,1,I]).
+/// The result is the hidden state after the new time step.
+/// \code{.c}
+/// uint16_t input_layer_shape[] = {1, 1, 2};
+/// ...
+/// ailayer_lstm_f32_t lstm_layer = AILAYER_LSTM_F32_A(16, FALSE, TRUE);
+/// x = ailayer_lstm_f32_default(&lstm_layer, x);
+/// ...
+/// ailayer_lstm_reset_state(&lstm_layer.base); // Start a new sequence
+/// aialgo_inference_model(&model, &input_sample, &output); // Process the next sample
+/// \endcode
+///
+/// @param *layer        The layer structure to initialize.
+/// @param *input_layer  The prior layer.
+/// @return              The (successfully) initialized layer structure.
+///
+ailayer_t *ailayer_lstm_f32_default(ailayer_lstm_f32_t *layer, ailayer_t *input_layer);
+
+/// @brief Initializes and connect a \link ailayer_lstm.h LSTM layer \endlink with the \link aimath_q7.h Q7 \endlink default implementation
+///
+/// Weights and bias are \link aimath_q7.h Q7 \endlink tensors (for example quantized with aialgo_quantize_model_f32_to_q7()).
+/// The hidden state and the result have the fixed quantization parameters shift = AIMATH_Q7_RNN_HIDDEN_SHIFT and zero_point = 0.
+/// The cell state is a \link aimath_q31.h Q31 \endlink buffer with shift AIMATH_Q7_RNN_CELL_SHIFT.
+/// Call ailayer_lstm_reset_state() before the first inference of a stateful layer.
+/// The layer can only be used for inference.
+///
+/// **Example:** Create the layer structure with pretrained weights:\n
+/// \code{.c}
+/// const aimath_q7_params_t lstm_weights_qparams = {7, 0};
+/// const int8_t weights_data_lstm[(2 + 3) * 4 * 3] = {...};
+/// const aimath_q7_params_t lstm_bias_qparams = {6, 0};
+/// const int8_t bias_data_lstm[4 * 3] = {...};
+/// int8_t hidden_state_lstm[1 * 3];
+/// int32_t cell_state_lstm[1 * 3];
+///
+/// ailayer_lstm_q7_t lstm_layer          = AILAYER_LSTM_Q7_M(
+///                                                                 /* units =*/            3,
+///                                                                 /* return_sequences =*/ FALSE,
+///                                                                 /* stateful =*/         FALSE,
+///                                                                 /* weights =*/          weights_data_lstm,
+///                                                                 /* weights_qparams =*/  &lstm_weights_qparams,
+///                                                                 /* bias =*/             bias_data_lstm,
+///                                                                 /* bias_qparams =*/     &lstm_bias_qparams,
+///                                                                 /* hidden_state =*/     hidden_state_lstm,
+///                                                                 /* cell_state =*/       cell_state_lstm
+///                                                              );
+/// x = ailayer_lstm_q7_default(&lstm_layer, x);
+/// \endcode
+///
+/// @param *layer        The layer structure to initialize.
+/// @param *input_layer  The prior layer.
+/// @return              The (successfully) initialized layer structure.
+///
+ailayer_t *ailayer_lstm_q7_default(ailayer_lstm_q7_t *layer, ailayer_t *input_layer);
+
+/** @brief \link aimath_f32.h F32 \endlink default implementation of the ailayer.init_params function for the LSTM layer
+ *
+ * *Implementation of ailayer.init_params.*
+ *
+ * The weights are initialized with Glorot uniform, the bias with zeros except for the forget gate (ones).
+ * The states are reset to zero.
+ *
+ * @param *self  The layer structure
+ */
+void ailayer_lstm_init_params_f32_default(ailayer_t *self);
+
+/** @brief \link aimath_q7.h Q7 \endlink default implementation of the ailayer.calc_result_tensor_params function for the LSTM layer
+ *
+ * *Implementation of ailayer.calc_result_tensor_params.*
+ *
+ * Sets the fixed quantization parameters of the hidden state (shift = AIMATH_Q7_RNN_HIDDEN_SHIFT, zero_point = 0).
+ *
+ * @param *self  The layer structure
+ */
+void ailayer_lstm_calc_result_tensor_params_q7_default(ailayer_t *self);
+
+/** @brief \link aimath_q7.h Q7 \endlink default implementation of the ailayer.sizeof_fwdmem function for the LSTM layer
+ *
+ * *Implementation of ailayer.sizeof_fwdmem.*
+ *
+ * The forward pass needs the 32 bit accumulators and the quantized gates of one time step.
+ *
+ * @param *self  The layer structure
+ * @return       Calculated memory size in bytes.
+ */
+uint32_t ailayer_lstm_sizeof_fwdmem_q7_default(const ailayer_t *self);
+
+#endif // AILAYER_LSTM_DEFAULT
@@ -0,0 +1,392 @@
+/**
+ * \file rnn/default/aimath/aimath_rnn_f32_default.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+#include "rnn/default/aimath/aimath_rnn_f32_default.h"
+
+#include <string.h>
+
+static float aimath_f32_default_rnn_sigmoid(float x)
+{
+    return 1.0f / (1.0f + expf(-x));
+}
+
+// y += a * x
+static void aimath_f32_default_rnn_axpy(float a, const float *x, float *y, uint32_t length)
+{
+    uint32_t j;
+
+    for(j = 0; j < length; j++){
+        y[j] += a * x[j];
+    }
+}
+
+static float aimath_f32_default_rnn_dot(const float *a, const float *b, uint32_t length)
+{
+    uint32_t j;
+    float sum = 0.0f;
+
+    for(j = 0; j < length; j++){
+        sum += a[j] * b[j];
+    }
+    return sum;
+}
+
+// z += x * W for the given rows of the weights (row major, G columns)
+static void aimath_f32_default_rnn_linear(const float *x, uint16_t rows, const float *w, uint32_t G, float *z)
+{
+    uint16_t i;
+
+    for(i = 0; i < rows; i++){
+        if(x[i] != 0.0f){
+            aimath_f32_default_rnn_axpy(x[i], w + (uint32_t) i * G, z, G);
+        }
+    }
+}
+
+void aimath_f32_default_lstm_fwd(
+                                 const aitensor_t *x_in,
+                                 const aitensor_t *weights,
+                                 const aitensor_t *bias,
+                                 uint8_t return_sequences,
+                                 void *work_space,
+                                 aitensor_t *hidden_state,
+                                 aitensor_t *cell_state,
+                                 aitensor_t *gate_cache,
+                                 aitensor_t *cell_cache,
+                                 aitensor_t *hidden_cache,
+                                 aitensor_t *result
+                                 )
+{
+    uint16_t n, t, j;
+    uint16_t N = x_in->shape[0];
+    uint16_t T = x_in->shape[1];
+    uint16_t I = x_in->shape[2];
+    uint16_t H = hidden_state->shape[1];
+    uint32_t G = 4 * (uint32_t) H;
+    const float *w = (float *) weights->data;
+    const float *x_t;
+    float *h, *c, *z;
+    float gate_i, gate_f, gate_g, gate_o;
+
+    for(n = 0; n < N; n++){
+        h = (float *) hidden_state->data + (uint32_t) n * H;
+        c = (float *) cell_state->data + (uint32_t) n * H;
+
+        if(hidden_cache != 0){
+            memcpy((float *) hidden_cache->data + (uint32_t) n * (T + 1) * H, h, H * sizeof(float));
+            memcpy((float *) cell_cache->data + (uint32_t) n * (T + 1) * H, c, H * sizeof(float));
+        }
+
+        for(t = 0; t < T; t++){
+            x_t = (float *) x_in->data + ((uint32_t) n * T + t) * I;
+            z = (gate_cache != 0) ? (float *) gate_cache->data + ((uint32_t) n * T + t) * G : (float *) work_space;
+
+            // All gates in one pass over the stacked weights: z = [x_t, h_{t-1}] * W + b
+            memcpy(z, bias->data, G * sizeof(float));
+            aimath_f32_default_rnn_linear(x_t, I, w, G, z);
+            aimath_f32_default_rnn_linear(h, H, w + (uint32_t) I * G, G, z);
+
+            for(j = 0; j < H; j++){
+                gate_i = aimath_f32_default_rnn_sigmoid(z[j]);
+                gate_f = aimath_f32_default_rnn_sigmoid(z[H + j]);
+                gate_g = tanhf(z[2 * H + j]);
+                gate_o = aimath_f32_default_rnn_sigmoid(z[3 * H + j]);
+
+                c[j] = gate_f * c[j] + gate_i * gate_g;
+                h[j] = gate_o * tanhf(c[j]);
+
+                // Keep the activated gates for the backward pass
+                z[j] = gate_i;
+                z[H + j] = gate_f;
+                z[2 * H + j] = gate_g;
+                z[3 * H + j] = gate_o;
+            }
+
+            if(hidden_cache != 0){
+                memcpy((float *) hidden_cache->data + ((uint32_t) n * (T + 1) + t + 1) * H, h, H * sizeof(float));
+                memcpy((float *) cell_cache->data + ((uint32_t) n * (T + 1) + t + 1) * H, c, H * sizeof(float));
+            }
+            if(return_sequences){
+                memcpy((float *) result->data + ((uint32_t) n * T + t) * H, h, H * sizeof(float));
+            }
+        }
+        if(!return_sequences){
+            memcpy((float *) result->data + (uint32_t) n * H, h, H * sizeof(float));
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_lstm_bwd(
+                                 const aitensor_t *x_in,
+                                 const aitensor_t *weights,
+                                 const aitensor_t *delta_out,
+                                 uint8_t return_sequences,
+                                 const aitensor_t *gate_cache,
+                                 const aitensor_t *cell_cache,
+                                 const aitensor_t *hidden_cache,
+                                 void *work_space,
+                                 aitensor_t *d_weights,
+                                 aitensor_t *d_bias,
+                                 aitensor_t *delta_in
+                                 )
+{
+    uint16_t n, t, j, i;
+    int32_t t_idx;
+    uint16_t N = x_in->shape[0];
+    uint16_t T = x_in->shape[1];
+    uint16_t I = x_in->shape[2];
+    uint16_t H = cell_cache->shape[2];
+    uint32_t G = 4 * (uint32_t) H;
+    const float *w = (float *) weights->data;
+    const float *x_t, *dy, *gates, *c_t, *c_prev, *h_prev;
+    float *dh = (float *) work_space;
+    float *dc = dh + H;
+    float *dz = dc + H;
+    float tanh_c, d_o, gate_i, gate_f, gate_g, gate_o;
+
+    for(n = 0; n < N; n++){
+        memset(dh, 0, H * sizeof(float));
+        memset(dc, 0, H * sizeof(float));
+
+        for(t_idx = T - 1; t_idx >= 0; t_idx--){
+            t = (uint16_t) t_idx;
+            if(return_sequences){
+                dy = (float *) delta_out->data + ((uint32_t) n * T + t) * H;
+                for(j = 0; j < H; j++) dh[j] += dy[j];
+            } else if(t == T - 1){
+                dy = (float *) delta_out->data + (uint32_t) n * H;
+                for(j = 0; j < H; j++) dh[j] += dy[j];
+            }
+
+            x_t = (float *) x_in->data + ((uint32_t) n * T + t) * I;
+            gates = (float *) gate_cache->data + ((uint32_t) n * T + t) * G;
+            c_prev = (float *) cell_cache->data + ((uint32_t) n * (T + 1) + t) * H;
+            c_t = c_prev + H;
+            h_prev = (float *) hidden_cache->data + ((uint32_t) n * (T + 1) + t) * H;
+
+            for(j = 0; j < H; j++){
+                gate_i = gates[j];
+                gate_f = gates[H + j];
+                gate_g = gates[2 * H + j];
+                gate_o = gates[3 * H + j];
+
+                tanh_c = tanhf(c_t[j]);
+                d_o = dh[j] * tanh_c;
+                dc[j] += dh[j] * gate_o * (1.0f - tanh_c * tanh_c);
+
+                // Gradients of the pre-activations
+                dz[j] = dc[j] * gate_g * gate_i * (1.0f - gate_i);
+                dz[H + j] = dc[j] * c_prev[j] * gate_f * (1.0f - gate_f);
+                dz[2 * H + j] = dc[j] * gate_i * (1.0f - gate_g * gate_g);
+                dz[3 * H + j] = d_o * gate_o * (1.0f - gate_o);
+
+                // Gradient to the previous cell state
+                dc[j] *= gate_f;
+            }
+
+            if(d_weights != 0){
+                for(i = 0; i < I; i++){
+                    aimath_f32_default_rnn_axpy(x_t[i], dz, (float *) d_weights->data + (uint32_t) i * G, G);
+                }
+                for(i = 0; i < H; i++){
+                    aimath_f32_default_rnn_axpy(h_prev[i], dz, (float *) d_weights->data + ((uint32_t) I + i) * G, G);
+                }
+            }
+            if(d_bias != 0){
+                aimath_f32_default_rnn_axpy(1.0f, dz, (float *) d_bias->data, G);
+            }
+            if(delta_in != 0){
+                for(i = 0; i < I; i++){
+                    ((float *) delta_in->data)[((uint32_t) n * T + t) * I + i] = aimath_f32_default_rnn_dot(w + (uint32_t) i * G, dz, G);
+                }
+            }
+
+            // Gradient to the previous hidden state (truncated at the beginning of the sequence)
+            for(i = 0; i < H; i++){
+                dh[i] = aimath_f32_default_rnn_dot(w + ((uint32_t) I + i) * G, dz, G);
+            }
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_gru_fwd(
+                                const aitensor_t *x_in,
+                                const aitensor_t *weights,
+                                const aitensor_t *bias,
+                                uint8_t return_sequences,
+                                void *work_space,
+                                aitensor_t *hidden_state,
+                                aitensor_t *gate_cache,
+                                aitensor_t *hidden_cache,
+                                aitensor_t *result
+                                )
+{
+    uint16_t n, t, j;
+    uint16_t N = x_in->shape[0];
+    uint16_t T = x_in->shape[1];
+    uint16_t I = x_in->shape[2];
+    uint16_t H = hidden_state->shape[1];
+    uint32_t G = 3 * (uint32_t) H;
+    const float *w = (float *) weights->data;
+    const float *x_t;
+    float *h, *gates;
+    float *zx = (float *) work_space;
+    float *zh = zx + G;
+    float gate_u, gate_r, gate_n;
+
+    for(n = 0; n < N; n++){
+        h = (float *) hidden_state->data + (uint32_t) n * H;
+
+        if(hidden_cache != 0){
+            memcpy((float *) hidden_cache->data + (uint32_t) n * (T + 1) * H, h, H * sizeof(float));
+        }
+
+        for(t = 0; t < T; t++){
+            x_t = (float *) x_in->data + ((uint32_t) n * T + t) * I;
+
+            // All gates in one pass over the stacked weights, the input and recurrent parts are kept separately
+            memcpy(zx, bias->data, G * sizeof(float));
+            memcpy(zh, (float *) bias->data + G, G * sizeof(float));
+            aimath_f32_default_rnn_linear(x_t, I, w, G, zx);
+            aimath_f32_default_rnn_linear(h, H, w + (uint32_t) I * G, G, zh);
+
+            for(j = 0; j < H; j++){
+                gate_u = aimath_f32_default_rnn_sigmoid(zx[j] + zh[j]);
+                gate_r = aimath_f32_default_rnn_sigmoid(zx[H + j] + zh[H + j]);
+                gate_n = tanhf(zx[2 * H + j] + gate_r * zh[2 * H + j]);
+
+                h[j] = gate_u * h[j] + (1.0f - gate_u) * gate_n;
+
+                if(gate_cache != 0){
+                    gates = (float *) gate_cache->data + ((uint32_t) n * T + t) * 4 * H;
+                    gates[j] = gate_u;
+                    gates[H + j] = gate_r;
+                    gates[2 * H + j] = gate_n;
+                    gates[3 * H + j] = zh[2 * H + j];
+                }
+            }
+
+            if(hidden_cache != 0){
+                memcpy((float *) hidden_cache->data + ((uint32_t) n * (T + 1) + t + 1) * H, h, H * sizeof(float));
+            }
+            if(return_sequences){
+                memcpy((float *) result->data + ((uint32_t) n * T + t) * H, h, H * sizeof(float));
+            }
+        }
+        if(!return_sequences){
+            memcpy((float *) result->data + (uint32_t) n * H, h, H * sizeof(float));
+        }
+    }
+    return;
+}
+
+void aimath_f32_default_gru_bwd(
+                                const aitensor_t *x_in,
+                                const aitensor_t *weights,
+                                const aitensor_t *delta_out,
+                                uint8_t return_sequences,
+                                const aitensor_t *gate_cache,
+                                const aitensor_t *hidden_cache,
+                                void *work_space,
+                                aitensor_t *d_weights,
+                                aitensor_t *d_bias,
+                                aitensor_t *delta_in
+                                )
+{
+    uint16_t n, t, j, i;
+    int32_t t_idx;
+    uint16_t N = x_in->shape[0];
+    uint16_t T = x_in->shape[1];
+    uint16_t I = x_in->shape[2];
+    uint16_t H = hidden_cache->shape[2];
+    uint32_t G = 3 * (uint32_t) H;
+    const float *w = (float *) weights->data;
+    const float *x_t, *dy, *gates, *h_prev;
+    float *dh = (float *) work_space;
+    float *dzx = dh + H;
+    float *dzh = dzx + G;
+    float gate_u, gate_r, gate_n, dz_n, d_r;
+
+    for(n = 0; n < N; n++){
+        memset(dh, 0, H * sizeof(float));
+
+        for(t_idx = T - 1; t_idx >= 0; t_idx--){
+            t = (uint16_t) t_idx;
+            if(return_sequences){
+                dy = (float *) delta_out->data + ((uint32_t) n * T + t) * H;
+                for(j = 0; j < H; j++) dh[j] += dy[j];
+            } else if(t == T - 1){
+                dy = (float *) delta_out->data + (uint32_t) n * H;
+                for(j = 0; j < H; j++) dh[j] += dy[j];
+            }
+
+            x_t = (float *) x_in->data + ((uint32_t) n * T + t) * I;
+            gates = (float *) gate_cache->data + ((uint32_t) n * T + t) * 4 * H;
+            h_prev = (float *) hidden_cache->data + ((uint32_t) n * (T + 1) + t) * H;
+
+            for(j = 0; j < H; j++){
+                gate_u = gates[j];
+                gate_r = gates[H + j];
+                gate_n = gates[2 * H + j];
+
+                dz_n = dh[j] * (1.0f - gate_u) * (1.0f - gate_n * gate_n);
+                d_r = dz_n * gates[3 * H + j];
+
+                dzx[j] = dh[j] * (h_prev[j] - gate_n) * gate_u * (1.0f - gate_u);
+                dzx[H + j] = d_r * gate_r * (1.0f - gate_r);
+                dzx[2 * H + j] = dz_n;
+
+                dzh[j] = dzx[j];
+                dzh[H + j] = dzx[H + j];
+                dzh[2 * H + j] = dz_n * gate_r;
+
+                // Direct path to the previous hidden state
+                dh[j] *= gate_u;
+            }
+
+            if(d_weights != 0){
+                for(i = 0; i < I; i++){
+                    aimath_f32_default_rnn_axpy(x_t[i], dzx, (float *) d_weights->data + (uint32_t) i * G, G);
+                }
+                for(i = 0; i < H; i++){
+                    aimath_f32_default_rnn_axpy(h_prev[i], dzh, (float *) d_weights->data + ((uint32_t) I + i) * G, G);
+                }
+            }
+            if(d_bias != 0){
+                aimath_f32_default_rnn_axpy(1.0f, dzx, (float *) d_bias->data, G);
+                aimath_f32_default_rnn_axpy(1.0f, dzh, (float *) d_bias->data + G, G);
+            }
+            if(delta_in != 0){
+                for(i = 0; i < I; i++){
+                    ((float *) delta_in->data)[((uint32_t) n * T + t) * I + i] = aimath_f32_default_rnn_dot(w + (uint32_t) i * G, dzx, G);
+                }
+            }
+
+            // Gradient to the previous hidden state (truncated at the beginning of the sequence)
+            for(i = 0; i < H; i++){
+                dh[i] += aimath_f32_default_rnn_dot(w + ((uint32_t) I + i) * G, dzh, G);
+            }
+        }
+    }
+    return;
+}
@@ -0,0 +1,195 @@
+/**
+ * \file rnn/default/aimath/aimath_rnn_f32_default.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Math functions for \link aimath_f32.h F32 \endlink data type, RNN-specific implementation
+ *
+ * These functions can be used when no hardware specific implementation is available.
+ *
+ * All recurrent kernels process an input sequence with dimension \f$ [N,T,I] \f$ (batch, time steps, input features).
+ * The input weights and the recurrent weights are stacked into one weights matrix with dimension \f$ [I + H, G \cdot H] \f$
+ * (the first \f$ I \f$ rows multiply the input \f$ x_t \f$, the last \f$ H \f$ rows multiply the hidden state \f$ h_{t-1} \f$),
+ * so that the pre-activations of all \f$ G \f$ gates of a time step are calculated in a single pass over the weights.
+ */
+
+#ifndef AIMATH_RNN_F32_DEFAULT_H
+#define AIMATH_RNN_F32_DEFAULT_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "core/aifes_core.h"
+#include "basic/base/aimath/aimath_f32.h"
+#include "basic/default/aimath/aimath_f32_default.h"
+
+/** @brief Calculates the LSTM layer on a 3D \link aimath_f32.h F32 \endlink sequence tensor (forward pass)
+ *
+ * For every sample and time step \f$ t \f$:
+ * @f[
+ *  z_t = [x_t, h_{t-1}] \cdot W + b = [z_i, z_f, z_g, z_o]
+ * @f]
+ * @f[
+ *  c_t = \sigma(z_f) \circ c_{t-1} + \sigma(z_i) \circ \tanh(z_g)
+ * @f]
+ * @f[
+ *  h_t = \sigma(z_o) \circ \tanh(c_t)
+ * @f]
+ *
+ * The gate order (input, forget, cell, output) is the same as in Keras, so trained Keras weights can be used with
+ * \f$ W = [W_{kernel}; W_{recurrent}] \f$.
+ *
+ * The hidden and cell state are read at the beginning of the sequence and hold the states of the last time step afterwards.
+ *
+ * If the cache tensors are given (training), the activated gates, the cell states and the hidden states of every time step are
+ * stored for the backward pass. The caches of the states contain the initial state at time step 0.
+ *
+ * @param x_in              Input sequence with dimension \f$ [N,T,I] \f$
+ * @param weights           Stacked weights with dimension \f$ [I + H, 4H] \f$
+ * @param bias              Bias with dimension \f$ [4H] \f$
+ * @param return_sequences  TRUE: The result contains the hidden states of all time steps, FALSE: Only the last hidden state
+ * @param work_space        Work space buffer with \f$ 4H \f$ floats (only used if gate_cache is 0)
+ * @param hidden_state      Hidden state with dimension \f$ [N,H] \f$ (read and written)
+ * @param cell_state        Cell state with dimension \f$ [N,H] \f$ (read and written)
+ * @param gate_cache        Cache for the activated gates with dimension \f$ [N,T,4H] \f$ (or 0)
+ * @param cell_cache        Cache for the cell states with dimension \f$ [N,T+1,H] \f$ (or 0)
+ * @param hidden_cache      Cache for the hidden states with dimension \f$ [N,T+1,H] \f$ (or 0)
+ * @param result            Output with dimension \f$ [N,T,H] \f$ (return_sequences) or \f$ [N,H] \f$
+ */
+void aimath_f32_default_lstm_fwd(
+                                 const aitensor_t *x_in,
+                                 const aitensor_t *weights,
+                                 const aitensor_t *bias,
+                                 uint8_t return_sequences,
+                                 void *work_space,
+                                 aitensor_t *hidden_state,
+                                 aitensor_t *cell_state,
+                                 aitensor_t *gate_cache,
+                                 aitensor_t *cell_cache,
+                                 aitensor_t *hidden_cache,
+                                 aitensor_t *result
+                                 );
+
+/** @brief Calculates the gradients of the LSTM layer with backpropagation through time (backward pass)
+ *
+ * Uses the caches of the last forward pass (see aimath_f32_default_lstm_fwd()). The gradients with respect to the
+ * initial states are not propagated (truncated backpropagation through time with the sequence length as window).
+ *
+ * The gradients of the weights and bias are <b>added</b> to d_weights and d_bias.
+ *
+ * @param x_in              Input sequence with dimension \f$ [N,T,I] \f$
+ * @param weights           Stacked weights with dimension \f$ [I + H, 4H] \f$
+ * @param delta_out         Gradients backpropagated from the following layer with dimension \f$ [N,T,H] \f$ (return_sequences) or \f$ [N,H] \f$
+ * @param return_sequences  TRUE: delta_out contains the gradients of all time steps, FALSE: Only of the last time step
+ * @param gate_cache        Cached activated gates with dimension \f$ [N,T,4H] \f$
+ * @param cell_cache        Cached cell states with dimension \f$ [N,T+1,H] \f$
+ * @param hidden_cache      Cached hidden states with dimension \f$ [N,T+1,H] \f$
+ * @param work_space        Work space buffer with \f$ 6H \f$ floats
+ * @param d_weights         Gradients of the weights with dimension \f$ [I + H, 4H] \f$ (or 0 if not needed)
+ * @param d_bias            Gradients of the bias with dimension \f$ [4H] \f$ (or 0 if not needed)
+ * @param delta_in          Gradients with respect to the input with dimension \f$ [N,T,I] \f$ (or 0 if not needed)
+ */
+void aimath_f32_default_lstm_bwd(
+                                 const aitensor_t *x_in,
+                                 const aitensor_t *weights,
+                                 const aitensor_t *delta_out,
+                                 uint8_t return_sequences,
+                                 const aitensor_t *gate_cache,
+                                 const aitensor_t *cell_cache,
+                                 const aitensor_t *hidden_cache,
+                                 void *work_space,
+                                 aitensor_t *d_weights,
+                                 aitensor_t *d_bias,
+                                 aitensor_t *delta_in
+                                 );
+
+/** @brief Calculates the GRU layer on a 3D \link aimath_f32.h F32 \endlink sequence tensor (forward pass)
+ *
+ * The GRU variant with the reset gate applied after the matrix multiplication is used (as in Keras with reset_after=True and in PyTorch).
+ * For every sample and time step \f$ t \f$:
+ * @f[
+ *  [x_t, 0] \cdot W + b_x = [zx_u, zx_r, zx_n], \quad [0, h_{t-1}] \cdot W + b_h = [zh_u, zh_r, zh_n]
+ * @f]
+ * @f[
+ *  u = \sigma(zx_u + zh_u), \quad r = \sigma(zx_r + zh_r), \quad n = \tanh(zx_n + r \circ zh_n)
+ * @f]
+ * @f[
+ *  h_t = u \circ h_{t-1} + (1 - u) \circ n
+ * @f]
+ *
+ * Both parts are calculated in a single pass over the stacked weights. The gate order (update, reset, new) and the bias layout
+ * \f$ b = [b_x, b_h] \f$ are the same as in Keras, so trained Keras weights can be used with \f$ W = [W_{kernel}; W_{recurrent}] \f$.
+ *
+ * If the cache tensors are given (training), the activated gates \f$ u, r, n \f$ and \f$ zh_n \f$ and the hidden states of every
+ * time step are stored for the backward pass. The hidden state cache contains the initial state at time step 0.
+ *
+ * @param x_in              Input sequence with dimension \f$ [N,T,I] \f$
+ * @param weights           Stacked weights with dimension \f$ [I + H, 3H] \f$
+ * @param bias              Input and recurrent bias with dimension \f$ [6H] \f$
+ * @param return_sequences  TRUE: The result contains the hidden states of all time steps, FALSE: Only the last hidden state
+ * @param work_space        Work space buffer with \f$ 6H \f$ floats
+ * @param hidden_state      Hidden state with dimension \f$ [N,H] \f$ (read and written)
+ * @param gate_cache        Cache for the gates with dimension \f$ [N,T,4H] \f$ (or 0)
+ * @param hidden_cache      Cache for the hidden states with dimension \f$ [N,T+1,H] \f$ (or 0)
+ * @param result            Output with dimension \f$ [N,T,H] \f$ (return_sequences) or \f$ [N,H] \f$
+ */
+void aimath_f32_default_gru_fwd(
+                                const aitensor_t *x_in,
+                                const aitensor_t *weights,
+                                const aitensor_t *bias,
+                                uint8_t return_sequences,
+                                void *work_space,
+                                aitensor_t *hidden_state,
+                                aitensor_t *gate_cache,
+                                aitensor_t *hidden_cache,
+                                aitensor_t *result
+                                );
+
+/** @brief Calculates the gradients of the GRU layer with backpropagation through time (backward pass)
+ *
+ * Uses the caches of the last forward pass (see aimath_f32_default_gru_fwd()). The gradients with respect to the
+ * initial state are not propagated (truncated backpropagation through time with the sequence length as window).
+ *
+ * The gradients of the weights and bias are <b>added</b> to d_weights and d_bias.
+ *
+ * @param x_in              Input sequence with dimension \f$ [N,T,I] \f$
+ * @param weights           Stacked weights with dimension \f$ [I + H, 3H] \f$
+ * @param delta_out         Gradients backpropagated from the following layer with dimension \f$ [N,T,H] \f$ (return_sequences) or \f$ [N,H] \f$
+ * @param return_sequences  TRUE: delta_out contains the gradients of all time steps, FALSE: Only of the last time step
+ * @param gate_cache        Cached gates with dimension \f$ [N,T,4H] \f$
+ * @param hidden_cache      Cached hidden states with dimension \f$ [N,T+1,H] \f$
+ * @param work_space        Work space buffer with \f$ 7H \f$ floats
+ * @param d_weights         Gradients of the weights with dimension \f$ [I + H, 3H] \f$ (or 0 if not needed)
+ * @param d_bias            Gradients of the bias with dimension \f$ [6H] \f$ (or 0 if not needed)
+ * @param delta_in          Gradients with respect to the input with dimension \f$ [N,T,I] \f$ (or 0 if not needed)
+ */
+void aimath_f32_default_gru_bwd(
+                                const aitensor_t *x_in,
+                                const aitensor_t *weights,
+                                const aitensor_t *delta_out,
+                                uint8_t return_sequences,
+                                const aitensor_t *gate_cache,
+                                const aitensor_t *hidden_cache,
+                                void *work_space,
+                                aitensor_t *d_weights,
+                                aitensor_t *d_bias,
+                                aitensor_t *delta_in
+                                );
+
+#endif // AIMATH_RNN_F32_DEFAULT_H
@@ -0,0 +1,253 @@
+/**
+ * \file rnn/default/aimath/aimath_rnn_q7_default.c
+ * \version 2.2.0
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief
+ * \details
+ */
+
+#include "rnn/default/aimath/aimath_rnn_q7_default.h"
+
+#include <string.h>
+
+// Arithmetic shift with rounding (positive shift: right shift, negative shift: left shift)
+static int32_t aimath_q7_default_rnn_shift(int32_t value, int16_t shift)
+{
+    if(shift > 0){
+        return (value + ((int32_t) 1 << (shift - 1))) >> shift;
+    } else {
+        return value << (-shift);
+    }
+}
+
+static int8_t aimath_q7_default_rnn_saturate(int32_t value)
+{
+    if(value > 127) return 127;
+    if(value < -128) return -128;
+    return (int8_t) value;
+}
+
+// acc += (x - x_zero_point) * W for the given rows of the weights (row major, G columns)
+static void aimath_q7_default_rnn_linear(const int8_t *x, int8_t x_zero_point, uint16_t rows, const int8_t *w, uint32_t G, int32_t *acc)
+{
+    uint16_t i;
+    uint32_t j;
+    int16_t x_value;
+    const int8_t *w_row;
+
+    for(i = 0; i < rows; i++){
+        x_value = (int16_t) x[i] - (int16_t) x_zero_point;
+        if(x_value != 0){
+            w_row = w + (uint32_t) i * G;
+            for(j = 0; j < G; j++){
+                acc[j] += (int32_t) x_value * (int32_t) w_row[j];
+            }
+        }
+    }
+}
+
+// Applies a Q7 activation function to the gate pre-activations (shift AIMATH_Q7_RNN_GATE_SHIFT, zero point 0)
+static void aimath_q7_default_rnn_activate(void (*activation)(const aitensor_t *x, aitensor_t *result), int8_t *z, int8_t *gates, uint16_t length)
+{
+    uint16_t shape[2] = {1, length};
+    aimath_q7_params_t z_params = {.shift = AIMATH_Q7_RNN_GATE_SHIFT, .zero_point = 0};
+    aimath_q7_params_t gate_params;
+    aitensor_t z_tensor = {.dtype = aiq7, .dim = 2, .shape = shape, .tensor_params = &z_params, .data = z};
+    aitensor_t gate_tensor = {.dtype = aiq7, .dim = 2, .shape = shape, .tensor_params = &gate_params, .data = gates};
+
+    activation(&z_tensor, &gate_tensor);
+}
+
+void aimath_q7_default_lstm_fwd(
+                                const aitensor_t *x_in,
+                                const aitensor_t *weights,
+                                const aitensor_t *bias,
+                                uint8_t return_sequences,
+                                void *work_space,
+                                aitensor_t *hidden_state,
+                                aitensor_t *cell_state,
+                                aitensor_t *gate_cache,
+                                aitensor_t *cell_cache,
+                                aitensor_t *hidden_cache,
+                                aitensor_t *result
+                                )
+{
+    uint16_t n, t, j;
+    uint16_t N = x_in->shape[0];
+    uint16_t T = x_in->shape[1];
+    uint16_t I = x_in->shape[2];
+    uint16_t H = hidden_state->shape[1];
+    uint32_t G = 4 * (uint32_t) H;
+
+    uint16_t x_shift = ((aimath_q7_params_t *) x_in->tensor_params)->shift;
+    int8_t x_zero_point = ((aimath_q7_params_t *) x_in->tensor_params)->zero_point;
+    uint16_t w_shift = ((aimath_q7_params_t *) weights->tensor_params)->shift;
+    uint16_t b_shift = ((aimath_q7_params_t *) bias->tensor_params)->shift;
+
+    // Common shift of the accumulator. Either the input or the hidden state part has to be shifted to the left.
+    int16_t acc_shift = (x_shift > AIMATH_Q7_RNN_HIDDEN_SHIFT ? x_shift : AIMATH_Q7_RNN_HIDDEN_SHIFT) + w_shift;
+    int16_t x_left_shift = acc_shift - x_shift - w_shift;
+    int16_t h_left_shift = acc_shift - AIMATH_Q7_RNN_HIDDEN_SHIFT - w_shift;
+
+    const int8_t *w = (int8_t *) weights->data;
+    const int8_t *b = (int8_t *) bias->data;
+    const int8_t *x_t;
+    int8_t *h;
+    int32_t *c;
+    int32_t *acc = (int32_t *) work_space;
+    int8_t *z = (int8_t *) (acc + G);
+    int8_t *gates = z + G;
+    int64_t c_new;
+    uint32_t j32;
+
+    for(n = 0; n < N; n++){
+        h = (int8_t *) hidden_state->data + (uint32_t) n * H;
+        c = (int32_t *) cell_state->data + (uint32_t) n * H;
+
+        for(t = 0; t < T; t++){
+            x_t = (int8_t *) x_in->data + ((uint32_t) n * T + t) * I;
+
+            // All gates in one pass over the stacked weights: z = [x_t, h_{t-1}] * W + b
+            memset(acc, 0, G * sizeof(int32_t));
+            if(x_left_shift > 0){
+                aimath_q7_default_rnn_linear(x_t, x_zero_point, I, w, G, acc);
+                for(j32 = 0; j32 < G; j32++) acc[j32] <<= x_left_shift;
+                aimath_q7_default_rnn_linear(h, 0, H, w + (uint32_t) I * G, G, acc);
+            } else {
+                aimath_q7_default_rnn_linear(h, 0, H, w + (uint32_t) I * G, G, acc);
+                for(j32 = 0; j32 < G; j32++) acc[j32] <<= h_left_shift;
+                aimath_q7_default_rnn_linear(x_t, x_zero_point, I, w, G, acc);
+            }
+            for(j32 = 0; j32 < G; j32++){
+                acc[j32] += aimath_q7_default_rnn_shift((int32_t) b[j32], b_shift - acc_shift);
+                z[j32] = aimath_q7_default_rnn_saturate(aimath_q7_default_rnn_shift(acc[j32], acc_shift - AIMATH_Q7_RNN_GATE_SHIFT));
+            }
+
+            // Gate order: input, forget, cell, output
+            aimath_q7_default_rnn_activate(aimath_q7_default_sigmoid, z, gates, 2 * H);
+            aimath_q7_default_rnn_activate(aimath_q7_default_tanh, z + 2 * H, gates + 2 * H, H);
+            aimath_q7_default_rnn_activate(aimath_q7_default_sigmoid, z + 3 * H, gates + 3 * H, H);
+
+            for(j = 0; j < H; j++){
+                // Sigmoid output: shift 8, zero point -128 -> (q + 128) / 256; tanh output: shift 7, zero point 0
+                c_new = ((int64_t) ((int32_t) gates[H + j] + 128) * c[j] + 128) >> 8;
+                c_new += (int64_t) (((int32_t) gates[j] + 128) * (int32_t) gates[2 * H + j]) << (AIMATH_Q7_RNN_CELL_SHIFT - 15);
+                if(c_new > INT32_MAX) c_new = INT32_MAX;
+                if(c_new < INT32_MIN) c_new = INT32_MIN;
+                c[j] = (int32_t) c_new;
+
+                z[j] = aimath_q7_default_rnn_saturate(aimath_q7_default_rnn_shift(c[j], AIMATH_Q7_RNN_CELL_SHIFT - AIMATH_Q7_RNN_GATE_SHIFT));
+            }
+            aimath_q7_default_rnn_activate(aimath_q7_default_tanh, z, z + H, H);
+
+            for(j = 0; j < H; j++){
+                h[j] = aimath_q7_default_rnn_saturate(aimath_q7_default_rnn_shift(((int32_t) gates[3 * H + j] + 128) * (int32_t) z[H + j], 8));
+            }
+
+            if(return_sequences){
+                memcpy((int8_t *) result->data + ((uint32_t) n * T + t) * H, h, H);
+            }
+        }
+        if(!return_sequences){
+            memcpy((int8_t *) result->data + (uint32_t) n * H, h, H);
+        }
+    }
+    return;
+}
+
+void aimath_q7_default_gru_fwd(
+                               const aitensor_t *x_in,
+                               const aitensor_t *weights,
+                               const aitensor_t *bias,
+                               uint8_t return_sequences,
+                               void *work_space,
+                               aitensor_t *hidden_state,
+                               aitensor_t *gate_cache,
+                               aitensor_t *hidden_cache,
+                               aitensor_t *result
+                               )
+{
+    uint16_t n, t, j;
+    uint16_t N = x_in->shape[0];
+    uint16_t T = x_in->shape[1];
+    uint16_t I = x_in->shape[2];
+    uint16_t H = hidden_state->shape[1];
+    uint32_t G = 3 * (uint32_t) H;
+
+    uint16_t x_shift = ((aimath_q7_params_t *) x_in->tensor_params)->shift;
+    int8_t x_zero_point = ((aimath_q7_params_t *) x_in->tensor_params)->zero_point;
+    uint16_t w_shift = ((aimath_q7_params_t *) weights->tensor_params)->shift;
+    uint16_t b_shift = ((aimath_q7_params_t *) bias->tensor_params)->shift;
+
+    // Common shift of the accumulators
+    int16_t acc_shift = (x_shift > AIMATH_Q7_RNN_HIDDEN_SHIFT ? x_shift : AIMATH_Q7_RNN_HIDDEN_SHIFT) + w_shift;
+    int16_t x_left_shift = acc_shift - x_shift - w_shift;
+    int16_t h_left_shift = acc_shift - AIMATH_Q7_RNN_HIDDEN_SHIFT - w_shift;
+
+    const int8_t *w = (int8_t *) weights->data;
+    const int8_t *b = (int8_t *) bias->data;
+    const int8_t *x_t;
+    int8_t *h;
+    int32_t *acc_x = (int32_t *) work_space;
+    int32_t *acc_h = acc_x + G;
+    int8_t *z = (int8_t *) (acc_h + G);
+    int8_t *gates = z + G;
+    int32_t pre_n, u;
+    uint32_t j32;
+
+    for(n = 0; n < N; n++){
+        h = (int8_t *) hidden_state->data + (uint32_t) n * H;
+
+        for(t = 0; t < T; t++){
+            x_t = (int8_t *) x_in->data + ((uint32_t) n * T + t) * I;
+
+            // All gates in one pass over the stacked weights, the input and recurrent parts are kept separately
+            memset(acc_x, 0, 2 * G * sizeof(int32_t));
+            aimath_q7_default_rnn_linear(x_t, x_zero_point, I, w, G, acc_x);
+            aimath_q7_default_rnn_linear(h, 0, H, w + (uint32_t) I * G, G, acc_h);
+            for(j32 = 0; j32 < G; j32++){
+                acc_x[j32] = (acc_x[j32] << x_left_shift) + aimath_q7_default_rnn_shift((int32_t) b[j32], b_shift - acc_shift);
+                acc_h[j32] = (acc_h[j32] << h_left_shift) + aimath_q7_default_rnn_shift((int32_t) b[G + j32], b_shift - acc_shift);
+            }
+
+            // Gate order: update, reset, new
+            for(j32 = 0; j32 < 2 * (uint32_t) H; j32++){
+                z[j32] = aimath_q7_default_rnn_saturate(aimath_q7_default_rnn_shift(acc_x[j32] + acc_h[j32], acc_shift - AIMATH_Q7_RNN_GATE_SHIFT));
+            }
+            aimath_q7_default_rnn_activate(aimath_q7_default_sigmoid, z, gates, 2 * H);
+
+            for(j = 0; j < H; j++){
+                // Reset gate (sigmoid output: shift 8, zero point -128) applied to the recurrent part
+                pre_n = acc_x[2 * H + j] + (int32_t) (((int64_t) ((int32_t) gates[H + j] + 128) * acc_h[2 * H + j] + 128) >> 8);
+                z[2 * H + j] = aimath_q7_default_rnn_saturate(aimath_q7_default_rnn_shift(pre_n, acc_shift - AIMATH_Q7_RNN_GATE_SHIFT));
+            }
+            aimath_q7_default_rnn_activate(aimath_q7_default_tanh, z + 2 * H, gates + 2 * H, H);
+
+            for(j = 0; j < H; j++){
+                u = (int32_t) gates[j] + 128;
+                h[j] = aimath_q7_default_rnn_saturate(aimath_q7_default_rnn_shift((256 - u) * (int32_t) gates[2 * H + j] + u * (int32_t) h[j], 8));
+            }
+
+            if(return_sequences){
+                memcpy((int8_t *) result->data + ((uint32_t) n * T + t) * H, h, H);
+            }
+        }
+        if(!return_sequences){
+            memcpy((int8_t *) result->data + (uint32_t) n * H, h, H);
+        }
+    }
+    return;
+}
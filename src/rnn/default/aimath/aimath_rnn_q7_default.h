@@ -0,0 +1,113 @@
+/**
+ * \file rnn/default/aimath/aimath_rnn_q7_default.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.2.0
+ * \copyright  Copyright (C) 2020-2023  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.<br><br>
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.<br><br>
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.<br><br>
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ *
+ * \brief Math functions for \link aimath_q7.h Q7 \endlink data type, RNN-specific implementation
+ *
+ * These functions can be used when no hardware specific implementation is available.
+ *
+ * The recurrent Q7 kernels use fixed quantization parameters for all internal values, so only the input has to be calibrated:
+ * - The hidden state and the result are Q7 with shift 7 and zero point 0 (range \f$ [-1, 1) \f$).
+ * - The gate pre-activations are requantized to Q7 with shift AIMATH_Q7_RNN_GATE_SHIFT and zero point 0 and are activated with
+ *   aimath_q7_default_sigmoid() and aimath_q7_default_tanh().
+ * - The LSTM cell state is stored in a \link aimath_q31.h Q31 \endlink tensor with shift AIMATH_Q7_RNN_CELL_SHIFT.
+ *
+ * The weights and the bias are expected to be symmetrically quantized (zero point 0), as done by aialgo_quantize_model_f32_to_q7().
+ */
+
+#ifndef AIMATH_RNN_Q7_DEFAULT_H
+#define AIMATH_RNN_Q7_DEFAULT_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "core/aifes_core.h"
+#include "basic/base/aimath/aimath_q7.h"
+#include "basic/base/aimath/aimath_q31.h"
+#include "basic/default/aimath/aimath_q7_default.h"
+
+#define AIMATH_Q7_RNN_GATE_SHIFT    4   /**< Shift of the Q7 gate pre-activations (range [-8, 8)) */
+#define AIMATH_Q7_RNN_HIDDEN_SHIFT  7   /**< Shift of the Q7 hidden state and result (range [-1, 1)) */
+#define AIMATH_Q7_RNN_CELL_SHIFT    16  /**< Shift of the Q31 LSTM cell state */
+
+/** @brief Calculates the LSTM layer on a 3D \link aimath_q7.h Q7 \endlink sequence tensor (forward pass)
+ *
+ * Integer version of aimath_f32_default_lstm_fwd(). The gate pre-activations of all gates are accumulated in 32-bit integers
+ * in a single pass over the stacked weights.
+ *
+ * The work space must hold \f$ 4H \f$ 32-bit integers and \f$ 8H \f$ bytes (see ailayer_lstm_sizeof_fwdmem_q7_default()).
+ * The caches are not supported (inference only) and must be 0.
+ *
+ * @param x_in              Input sequence with dimension \f$ [N,T,I] \f$
+ * @param weights           Stacked weights with dimension \f$ [I + H, 4H] \f$ (symmetric quantization)
+ * @param bias              Bias with dimension \f$ [4H] \f$ (symmetric quantization)
+ * @param return_sequences  TRUE: The result contains the hidden states of all time steps, FALSE: Only the last hidden state
+ * @param work_space        Work space buffer
+ * @param hidden_state      Q7 hidden state with dimension \f$ [N,H] \f$ (read and written)
+ * @param cell_state        Q31 cell state with dimension \f$ [N,H] \f$ (read and written)
+ * @param gate_cache        Not supported (0)
+ * @param cell_cache        Not supported (0)
+ * @param hidden_cache      Not supported (0)
+ * @param result            Output with dimension \f$ [N,T,H] \f$ (return_sequences) or \f$ [N,H] \f$
+ */
+void aimath_q7_default_lstm_fwd(
+                                const aitensor_t *x_in,
+                                const aitensor_t *weights,
+                                const aitensor_t *bias,
+                                uint8_t return_sequences,
+                                void *work_space,
+                                aitensor_t *hidden_state,
+                                aitensor_t *cell_state,
+                                aitensor_t *gate_cache,
+                                aitensor_t *cell_cache,
+                                aitensor_t *hidden_cache,
+                                aitensor_t *result
+                                );
+
+/** @brief Calculates the GRU layer on a 3D \link aimath_q7.h Q7 \endlink sequence tensor (forward pass)
+ *
+ * Integer version of aimath_f32_default_gru_fwd(). The input and recurrent parts of the gate pre-activations are accumulated
+ * in 32-bit integers in a single pass over the stacked weights.
+ *
+ * The work space must hold \f$ 6H \f$ 32-bit integers and \f$ 6H \f$ bytes (see ailayer_gru_sizeof_fwdmem_q7_default()).
+ * The caches are not supported (inference only) and must be 0.
+ *
+ * @param x_in              Input sequence with dimension \f$ [N,T,I] \f$
+ * @param weights           Stacked weights with dimension \f$ [I + H, 3H] \f$ (symmetric quantization)
+ * @param bias              Input and recurrent bias with dimension \f$ [6H] \f$ (symmetric quantization)
+ * @param return_sequences  TRUE: The result contains the hidden states of all time steps, FALSE: Only the last hidden state
+ * @param work_space        Work space buffer
+ * @param hidden_state      Q7 hidden state with dimension \f$ [N,H] \f$ (read and written)
+ * @param gate_cache        Not supported (0)
+ * @param hidden_cache      Not supported (0)
+ * @param result            Output with dimension \f$ [N,T,H] \f$ (return_sequences) or \f$ [N,H] \f$
+ */
+void aimath_q7_default_gru_fwd(
+                               const aitensor_t *x_in,
+                               const aitensor_t *weights,
+                               const aitensor_t *bias,
+                               uint8_t return_sequences,
+                               void *work_space,
+                               aitensor_t *hidden_state,
+                               aitensor_t *gate_cache,
+                               aitensor_t *hidden_cache,
+                               aitensor_t *result
+                               );
+
+#endif // AIMATH_RNN_Q7_DEFAULT_H